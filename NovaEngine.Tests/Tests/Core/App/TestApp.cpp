@@ -3,13 +3,15 @@
 #include <catch.hpp>
 
 #define NOVA_EXTERNAL_MAIN // Prevent Nova from defining a main function
-#include <Nova/Core/App/Entry.h>
+#include <Nova/Core/Engine/Entry.h>
 
 Nova::List<Nova::string> TestApp::s_Args = { "Arg1", "Arg2" };
 
+MainApp(TestApp)
+
 TEST_CASE("Nova/Core/App/App Lifecycle", "Check if app forwards arguments and returns the proper exit code")
 {
-	Nova::App::AppExitCode exitCode = Nova::Entry(TestApp::s_Args);
+	Nova::AppExitCode exitCode = Nova::Entry(TestApp::s_Args);
 
-	REQUIRE(exitCode == Nova::App::AppExitCode::SUCCESS);
+	REQUIRE(exitCode == Nova::AppExitCode::SUCCESS);
 }
\ No newline at end of file
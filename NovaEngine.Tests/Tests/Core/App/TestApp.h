@@ -2,6 +2,7 @@
 
 #include <catch.hpp>
 #include <Nova/Core/App/App.h>
+#include <Nova/Core/Engine/Engine.h>
 
 class TestApp : public Nova::App
 {
@@ -21,9 +22,8 @@ public:
 		{
 			REQUIRE(args[i] == s_Args[i]);
 		}
-	}
-
-	virtual Nova::App::AppExitCode Run() override { return AppExitCode::SUCCESS; }
-};
 
-MainApp(TestApp)
\ No newline at end of file
+		// With nothing to tick, the engine stops as soon as it runs
+		Nova::Engine::Get()->RemoveTickListener(GetNodeTree()->GetTickListener());
+	}
+};
\ No newline at end of file
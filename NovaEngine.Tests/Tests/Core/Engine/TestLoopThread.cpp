@@ -0,0 +1,165 @@
+#include <catch.hpp>
+
+#include <Nova/Core/Engine/Engine.h>
+#include <Nova/Core/Engine/LoopThread.h>
+
+#include "../App/TestApp.h"
+
+#include <atomic>
+#include <chrono>
+#include <ctime>
+#include <future>
+#include <stdint.h>
+#include <thread>
+
+namespace
+{
+	/// <summary>
+	/// Counts the ticks it receives, and fulfils a promise once it has received enough
+	/// </summary>
+	class TickCounter : public Nova::RefCounted
+	{
+	public:
+		std::atomic<int> TickCount = 0;
+		int TicksWanted = 3;
+		std::promise<void> HasTicked;
+
+		void Tick(double deltaTime)
+		{
+			if (++TickCount == TicksWanted)
+				HasTicked.set_value();
+		}
+	};
+
+	/// <summary>
+	/// Waits for a loop to run every message posted so far
+	/// </summary>
+	void Flush(Nova::MainLoop& loop)
+	{
+		std::promise<void> isFlushed;
+		loop.Post([&]() { isFlushed.set_value(); });
+
+		REQUIRE(isFlushed.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+	}
+}
+
+TEST_CASE("Nova/Core/Engine/Loop Thread", "Check that named loops start, tick and stop on their own thread")
+{
+	Nova::LoopThread thread("Physics", 0);
+	Nova::MainLoop& loop = *thread.GetLoop();
+
+	REQUIRE(loop.GetName() == "Physics");
+	REQUIRE_FALSE(thread.GetIsStarted());
+
+	SECTION("Ticks listeners on the loop's thread")
+	{
+		thread.Start();
+		REQUIRE(thread.GetIsStarted());
+
+		auto counter = Nova::MakeRef<TickCounter>();
+		std::atomic<bool> isOnLoopThread = false;
+
+		loop.Post([&]() { isOnLoopThread = loop.IsLoopThread(); });
+		loop.AddTickListener(Nova::MakeRef<Nova::TickListener>(0, counter, &TickCounter::Tick));
+
+		REQUIRE(counter->HasTicked.get_future().wait_for(std::chrono::seconds(10)) == std::future_status::ready);
+		REQUIRE(isOnLoopThread);
+		REQUIRE_FALSE(loop.IsLoopThread());
+
+		thread.Stop();
+		thread.Join();
+
+		REQUIRE_FALSE(thread.GetIsStarted());
+		REQUIRE_FALSE(loop.GetIsRunning());
+	}
+
+	SECTION("Stopping right after starting doesn't get lost")
+	{
+		for (int i = 0; i < 100; i++)
+		{
+			thread.Start();
+			thread.Stop();
+			thread.Join();
+
+			REQUIRE_FALSE(loop.GetIsRunning());
+		}
+	}
+
+	SECTION("An idle loop sleeps instead of spinning")
+	{
+		thread.Start();
+		Flush(loop);
+
+		const std::clock_t cpuStart = std::clock();
+		std::this_thread::sleep_for(std::chrono::milliseconds(200));
+		const double cpuSeconds = (double)(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+		// A spinning loop would use a whole core for the entire wait
+		REQUIRE(cpuSeconds < 0.1);
+
+		// Still wakes up for new messages
+		Flush(loop);
+	}
+}
+
+TEST_CASE("Nova/Core/Engine/Loop Post Ordering", "Check that messages posted from many threads run in the order each thread posted them")
+{
+	constexpr uint64_t threadCount = 4;
+	constexpr uint64_t messagesPerThread = 10000;
+
+	Nova::LoopThread thread("Messages", 0);
+	thread.Start();
+
+	// Only touched on the loop's thread until it's flushed
+	Nova::List<uint64_t> nextMessages(threadCount, 0);
+	bool isInOrder = true;
+
+	Nova::List<std::thread> posters;
+
+	for (uint64_t poster = 0; poster < threadCount; poster++)
+	{
+		posters.emplace_back([&, poster]()
+			{
+				for (uint64_t i = 0; i < messagesPerThread; i++)
+				{
+					thread.GetLoop()->Post([&, poster, i]()
+						{
+							isInOrder &= nextMessages[poster] == i;
+							nextMessages[poster]++;
+						});
+				}
+			});
+	}
+
+	for (std::thread& poster : posters)
+	{
+		poster.join();
+	}
+
+	Flush(*thread.GetLoop());
+
+	REQUIRE(isInOrder);
+
+	for (uint64_t count : nextMessages)
+	{
+		REQUIRE(count == messagesPerThread);
+	}
+}
+
+TEST_CASE("Nova/Core/Engine/Engine Stops When Idle", "Check that Run returns once the main loop stops on its own, stopping the other loops too")
+{
+	// The test app ticks nothing, so the main loop stops right away
+	Nova::ManagedPtr<Nova::Engine> engine(Nova::Engine::Init(TestApp::s_Args));
+	Nova::MainLoop* physics = engine->CreateLoop("Physics", 0);
+
+	auto run = std::async(std::launch::async, [&]() { return engine->Run(); });
+	const bool hasReturned = run.wait_for(std::chrono::seconds(10)) == std::future_status::ready;
+
+	// Let the engine finish so a failure doesn't hang the tests
+	if (!hasReturned)
+		physics->Stop();
+
+	REQUIRE(hasReturned);
+	REQUIRE(run.get() == Nova::AppExitCode::SUCCESS);
+	REQUIRE_FALSE(physics->GetIsRunning());
+}
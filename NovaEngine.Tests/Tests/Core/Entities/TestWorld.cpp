@@ -0,0 +1,288 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Entities/World.h>
+#include <Nova/Core/Nodes/NodeTree.h>
+
+#include <memory>
+#include <string>
+
+namespace
+{
+	struct Position
+	{
+		float X, Y;
+	};
+
+	struct Velocity
+	{
+		float X, Y;
+	};
+
+	/// <summary>
+	/// A component that counts how many copies of it are alive, to catch leaked or double-destroyed components
+	/// </summary>
+	struct Tracked
+	{
+		Tracked(int value) : Value(value), Token(std::make_shared<int>(0)) {}
+
+		int Value;
+		std::shared_ptr<int> Token;
+	};
+
+	/// <summary>
+	/// A node that moves itself every tick, to compare against a system doing the same
+	/// </summary>
+	class MovingNode : public Nova::Node
+	{
+	public:
+		MovingNode() : Nova::Node("Moving") {}
+
+		Position Pos = { 0.0f, 0.0f };
+		Velocity Vel = { 1.0f, 2.0f };
+
+	protected:
+		virtual void Tick(double deltaTime) override
+		{
+			Pos.X += Vel.X * (float)deltaTime;
+			Pos.Y += Vel.Y * (float)deltaTime;
+		}
+	};
+
+	class MovementSystem : public Nova::System
+	{
+	public:
+		int UpdateCount = 0;
+
+	protected:
+		virtual void Update(Nova::World& world, double deltaTime) override
+		{
+			UpdateCount++;
+
+			world.ForEach<Position, const Velocity>([deltaTime](Position& position, const Velocity& velocity)
+				{
+					position.X += velocity.X * (float)deltaTime;
+					position.Y += velocity.Y * (float)deltaTime;
+				});
+		}
+	};
+}
+
+TEST_CASE("Nova/Core/Entities/Entities", "Check creating and destroying entities and changing their components")
+{
+	Nova::World world;
+
+	Nova::Entity a = world.CreateEntity(Position{ 1.0f, 2.0f });
+	Nova::Entity b = world.CreateEntity(Position{ 3.0f, 4.0f }, Velocity{ 5.0f, 6.0f });
+
+	REQUIRE(world.GetEntityCount() == 2);
+	REQUIRE(world.HasComponent<Position>(a));
+	REQUIRE_FALSE(world.HasComponent<Velocity>(a));
+	REQUIRE(world.GetComponent<Velocity>(b)->Y == 6.0f);
+
+	SECTION("Adding and removing components keeps the others")
+	{
+		world.AddComponent<Velocity>(a, Velocity{ 7.0f, 8.0f });
+
+		REQUIRE(world.GetComponent<Position>(a)->X == 1.0f);
+		REQUIRE(world.GetComponent<Velocity>(a)->X == 7.0f);
+		REQUIRE_THROWS_AS(world.AddComponent<Velocity>(a, Velocity{}), Nova::EntityException);
+
+		world.RemoveComponent<Position>(a);
+
+		REQUIRE_FALSE(world.HasComponent<Position>(a));
+		REQUIRE(world.GetComponent<Velocity>(a)->Y == 8.0f);
+		REQUIRE(world.GetComponent<Position>(b)->X == 3.0f);
+	}
+
+	SECTION("Destroyed handles stay dead")
+	{
+		world.DestroyEntity(a);
+
+		REQUIRE_FALSE(world.IsAlive(a));
+		REQUIRE(world.GetComponent<Position>(a) == nullptr);
+
+		// The index is reused with a new generation
+		Nova::Entity c = world.CreateEntity(Position{ 9.0f, 9.0f });
+
+		REQUIRE(c.Index == a.Index);
+		REQUIRE_FALSE(world.IsAlive(a));
+		REQUIRE(world.IsAlive(c));
+		REQUIRE_THROWS_AS(world.AddComponent<Velocity>(a, Velocity{}), Nova::EntityException);
+	}
+}
+
+TEST_CASE("Nova/Core/Entities/Chunks", "Check that entities spanning many chunks keep their components through removals")
+{
+	Nova::World world;
+	Nova::List<Nova::Entity> entities;
+	std::weak_ptr<int> firstToken;
+
+	{
+		for (int i = 0; i < 5000; i++)
+		{
+			entities.push_back(world.CreateEntity(Tracked(i), Position{ (float)i, 0.0f }));
+		}
+
+		firstToken = world.GetComponent<Tracked>(entities[0])->Token;
+
+		// Removing from the middle of full chunks moves the last entity into the gap
+		for (int i = 0; i < 5000; i += 3)
+		{
+			world.DestroyEntity(entities[i]);
+		}
+
+		REQUIRE(firstToken.expired());
+
+		for (int i = 0; i < 5000; i++)
+		{
+			if (i % 3 == 0)
+				continue;
+
+			REQUIRE(world.GetComponent<Tracked>(entities[i])->Value == i);
+			REQUIRE(world.GetComponent<Position>(entities[i])->X == (float)i);
+		}
+
+		// Moving to another archetype keeps the tracked component alive exactly once
+		std::weak_ptr<int> token = world.GetComponent<Tracked>(entities[1])->Token;
+		world.AddComponent<Velocity>(entities[1], Velocity{});
+
+		REQUIRE(token.use_count() == 1);
+		REQUIRE(world.GetComponent<Tracked>(entities[1])->Value == 1);
+	}
+
+	REQUIRE(world.GetQuery<Tracked>().GetEntityCount() == 5000 - 1667);
+}
+
+TEST_CASE("Nova/Core/Entities/Queries", "Check that queries visit exactly the matching entities")
+{
+	Nova::World world;
+
+	world.CreateEntity(Position{ 0.0f, 0.0f });
+	Nova::Entity moving = world.CreateEntity(Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 0.0f });
+
+	auto& query = world.GetQuery<Position, const Velocity>();
+
+	REQUIRE(&query == &world.GetQuery<Position, const Velocity>());
+	REQUIRE(query.GetEntityCount() == 1);
+
+	SECTION("Archetypes created after the query are picked up")
+	{
+		world.CreateEntity(Velocity{ 2.0f, 0.0f }, Tracked(1), Position{ 0.0f, 0.0f });
+
+		float total = 0.0f;
+		query.ForEach([&](Nova::Entity entity, Position&, const Velocity& velocity) { total += velocity.X; });
+
+		REQUIRE(total == 3.0f);
+	}
+
+	SECTION("Structural changes while iterating throw")
+	{
+		REQUIRE_THROWS_AS(query.ForEach([&](Position&, const Velocity&) { world.CreateEntity(); }), Nova::EntityException);
+		REQUIRE_THROWS_AS(query.ForEach([&](Position&, const Velocity&) { world.RemoveComponent<Velocity>(moving); }), Nova::EntityException);
+
+		// The scope is released even when the function throws
+		REQUIRE_NOTHROW(world.CreateEntity());
+	}
+
+	SECTION("Chunks")
+	{
+		size_t count = 0;
+		query.ForEachChunk([&](size_t chunkCount, const Nova::Entity* entities, Position* positions, const Velocity* velocities)
+			{
+				REQUIRE(entities[0] == moving);
+				count += chunkCount;
+			});
+
+		REQUIRE(count == 1);
+	}
+}
+
+TEST_CASE("Nova/Core/Entities/Node Bindings", "Check that nodes bound to entities are unbound when they leave the tree")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::World& world = tree->GetWorld();
+
+	auto node = tree->CreateNode<Nova::Node>("Node");
+	REQUIRE_THROWS_AS(world.BindNode(*node), Nova::EntityException);
+
+	tree->GetRootNode()->AddChild(node);
+
+	Nova::Entity entity = world.BindNode(*node);
+	world.AddComponent<Position>(entity, Position{ 1.0f, 1.0f });
+
+	REQUIRE(node->GetEntity() == entity);
+	REQUIRE(world.BindNode(*node) == entity);
+	REQUIRE(world.GetComponent<Nova::NodeBinding>(entity)->NodePtr == node.get());
+
+	SECTION("Leaving the tree")
+	{
+		tree->GetRootNode()->RemoveChild(node);
+
+		REQUIRE_FALSE(world.IsAlive(entity));
+		REQUIRE_FALSE(node->GetEntity().IsValid());
+	}
+
+	SECTION("Destroying the entity")
+	{
+		world.DestroyEntity(entity);
+
+		REQUIRE_FALSE(node->GetEntity().IsValid());
+	}
+
+	SECTION("Destroying the tree")
+	{
+		tree.reset();
+
+		REQUIRE_FALSE(node->GetEntity().IsValid());
+	}
+}
+
+TEST_CASE("Nova/Core/Entities/Systems", "Check that systems tick over their world")
+{
+	Nova::World world;
+	Nova::Entity entity = world.CreateEntity(Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 2.0f });
+
+	auto system = world.AddSystem<MovementSystem>();
+	system->GetTickListener()->NotifyTick(0.5);
+
+	REQUIRE(system->UpdateCount == 1);
+	REQUIRE(world.GetComponent<Position>(entity)->Y == 1.0f);
+
+	world.RemoveSystem(system);
+	system->GetTickListener()->NotifyTick(0.5);
+
+	REQUIRE(system->UpdateCount == 1);
+	REQUIRE(system->GetWorld() == nullptr);
+}
+
+TEST_CASE("Nova/Core/Entities/Benchmark Movement", "[.][benchmark] Compare moving objects as ticking nodes and as components updated by a system")
+{
+	const size_t count = 100000;
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	for (size_t i = 0; i < count; i++)
+	{
+		tree->GetRootNode()->AddChild(tree->CreateNode<MovingNode>());
+	}
+
+	BENCHMARK("Tick 100000 nodes")
+	{
+		tree->Tick(1.0 / 60.0);
+	};
+
+	Nova::World& world = tree->GetWorld();
+
+	for (size_t i = 0; i < count; i++)
+	{
+		world.CreateEntity(Position{ 0.0f, 0.0f }, Velocity{ 1.0f, 2.0f });
+	}
+
+	auto system = world.AddSystem<MovementSystem>();
+
+	BENCHMARK("Update 100000 entities")
+	{
+		system->GetTickListener()->NotifyTick(1.0 / 60.0);
+	};
+}
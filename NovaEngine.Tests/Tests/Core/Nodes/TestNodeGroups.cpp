@@ -0,0 +1,219 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+
+namespace
+{
+	Nova::List<Nova::string> GetSortedNames(const Nova::List<Nova::Node*>& nodes)
+	{
+		Nova::List<Nova::string> names;
+
+		for (Nova::Node* node : nodes)
+		{
+			names.push_back(node->GetName());
+		}
+
+		std::sort(names.begin(), names.end());
+		return names;
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Node Groups", "Check that group members are tracked as nodes join and leave groups and trees")
+{
+	const Nova::NodeGroup enemies("Enemies");
+	const Nova::NodeGroup flying("Flying");
+	const Nova::NodeGroup unused("Unused");
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto level = tree->CreateNode<Nova::Node>("Level");
+	auto bat = tree->CreateNode<Nova::Node>("Bat");
+	auto goblin = tree->CreateNode<Nova::Node>("Goblin");
+	auto bird = tree->CreateNode<Nova::Node>("Bird");
+
+	bat->AddToGroup(enemies);
+	bat->AddToGroup(flying);
+	goblin->AddToGroup(enemies);
+	bird->AddToGroup(flying);
+
+	level->AddChild(bat);
+	level->AddChild(goblin);
+	level->AddChild(bird);
+
+	SECTION("Groups are interned by name")
+	{
+		REQUIRE(Nova::NodeGroup("Enemies") == enemies);
+		REQUIRE(Nova::NodeGroup(Nova::NameID("Flying")).GetIndex() == flying.GetIndex());
+		REQUIRE(enemies.GetName() == Nova::NameID("Enemies"));
+
+		Nova::NodeGroup found;
+		REQUIRE(Nova::NodeGroup::TryFind(Nova::NameID("Enemies"), found));
+		REQUIRE(found == enemies);
+
+		Nova::NodeGroup missing;
+		REQUIRE_FALSE(Nova::NodeGroup::TryFind(Nova::NameID("NeverUsedAsAGroup"), missing));
+		REQUIRE_FALSE(missing.IsValid());
+	}
+
+	SECTION("Nodes are only listed while they're in the tree")
+	{
+		REQUIRE(bat->IsInGroup(enemies));
+		REQUIRE_FALSE(bird->IsInGroup(enemies));
+		REQUIRE(tree->GetNodesInGroup(enemies).empty());
+
+		root->AddChild(level);
+
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(enemies)) == Nova::List<Nova::string>{ "Bat", "Goblin" });
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(flying)) == Nova::List<Nova::string>{ "Bat", "Bird" });
+		REQUIRE(tree->GetNodesInGroup(unused).empty());
+		REQUIRE(tree->GetNodesInGroup(Nova::NodeGroup()).empty());
+
+		level->RemoveChild(bat);
+
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(enemies)) == Nova::List<Nova::string>{ "Goblin" });
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(flying)) == Nova::List<Nova::string>{ "Bird" });
+
+		// Nodes keep their groups outside of the tree
+		REQUIRE(bat->IsInGroup(flying));
+
+		root->RemoveChild(level);
+
+		REQUIRE(tree->GetNodesInGroup(enemies).empty());
+		REQUIRE(tree->GetNodesInGroup(flying).empty());
+	}
+
+	SECTION("Joining and leaving groups in the tree updates the members")
+	{
+		root->AddChild(level);
+
+		goblin->RemoveFromGroup(enemies);
+		bird->AddToGroup(enemies);
+		bird->AddToGroup(enemies);
+
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(enemies)) == Nova::List<Nova::string>{ "Bat", "Bird" });
+		REQUIRE_FALSE(goblin->IsInGroup(enemies));
+
+		bat->RemoveFromGroup(enemies);
+		bat->RemoveFromGroup(enemies);
+		bird->RemoveFromGroup(enemies);
+
+		REQUIRE(tree->GetNodesInGroup(enemies).empty());
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(flying)) == Nova::List<Nova::string>{ "Bat", "Bird" });
+	}
+
+	SECTION("Combined queries find the nodes in every group")
+	{
+		root->AddChild(level);
+
+		Nova::NodeGroupMask mask;
+		mask.set(enemies.GetIndex());
+		mask.set(flying.GetIndex());
+
+		Nova::List<Nova::Node*> nodes;
+		tree->GetNodesInGroups(mask, nodes);
+
+		REQUIRE(GetSortedNames(nodes) == Nova::List<Nova::string>{ "Bat" });
+		REQUIRE(bat->IsInGroups(mask));
+		REQUIRE_FALSE(goblin->IsInGroups(mask));
+
+		mask.set(unused.GetIndex());
+		nodes.clear();
+		tree->GetNodesInGroups(mask, nodes);
+
+		REQUIRE(nodes.empty());
+
+		tree->GetNodesInGroups(Nova::NodeGroupMask(), nodes);
+		REQUIRE(nodes.empty());
+	}
+
+	SECTION("Moving nodes between trees moves their membership")
+	{
+		auto otherTree = Nova::MakeRef<Nova::NodeTree>();
+
+		root->AddChild(level);
+		otherTree->GetRootNode()->AddChild(goblin);
+
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(enemies)) == Nova::List<Nova::string>{ "Bat" });
+		REQUIRE(GetSortedNames(otherTree->GetNodesInGroup(enemies)) == Nova::List<Nova::string>{ "Goblin" });
+
+		// The goblin outlives its tree, and still joins the next one
+		otherTree.reset();
+		level->AddChild(goblin);
+
+		REQUIRE(GetSortedNames(tree->GetNodesInGroup(enemies)) == Nova::List<Nova::string>{ "Bat", "Goblin" });
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Node Groups", "[.][benchmark] Measure finding the members of a group against walking the tree")
+{
+	const Nova::NodeGroup enemies("Enemies");
+	const Nova::NodeGroup flying("Flying");
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	std::mt19937 random(42);
+
+	for (int i = 0; i < 100; i++)
+	{
+		auto room = tree->CreateNode<Nova::Node>("Room" + std::to_string(i));
+
+		for (int j = 0; j < 1000; j++)
+		{
+			auto node = tree->CreateNode<Nova::Node>("Prop" + std::to_string(j));
+
+			// One node in a hundred is an enemy, and a quarter of the nodes fly
+			if (random() % 100 == 0)
+				node->AddToGroup(enemies);
+
+			if (random() % 4 == 0)
+				node->AddToGroup(flying);
+
+			room->AddChild(node);
+		}
+
+		tree->GetRootNode()->AddChild(room);
+	}
+
+	// The walk a tree without groups would need, comparing a string tag on every node
+	Nova::List<Nova::string> tags(tree->GetNodeCount());
+	Nova::List<Nova::Node*> nodes;
+
+	tree->ForEachNode([&](Nova::Node& node) { nodes.push_back(&node); });
+
+	for (size_t i = 0; i < nodes.size(); i++)
+	{
+		tags[i] = nodes[i]->IsInGroup(enemies) ? "enemies" : "props";
+	}
+
+	BENCHMARK("Find 1% of 100K nodes by walking the tree and comparing tags")
+	{
+		size_t count = 0;
+		size_t i = 0;
+
+		tree->ForEachNode([&](Nova::Node& node) { count += tags[i++] == "enemies"; });
+
+		return count;
+	};
+
+	BENCHMARK("Find 1% of 100K nodes with GetNodesInGroup")
+	{
+		return tree->GetNodesInGroup(enemies).size();
+	};
+
+	Nova::NodeGroupMask mask;
+	mask.set(enemies.GetIndex());
+	mask.set(flying.GetIndex());
+
+	BENCHMARK("Find the flying enemies among 100K nodes with GetNodesInGroups")
+	{
+		Nova::List<Nova::Node*> found;
+		tree->GetNodesInGroups(mask, found);
+
+		return found.size();
+	};
+}
@@ -0,0 +1,154 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+
+#include <string>
+
+TEST_CASE("Nova/Core/Nodes/Name IDs", "Check that names are interned once")
+{
+	Nova::NameID a("Interned");
+	Nova::NameID b(std::string("Interned"));
+
+	REQUIRE(a == b);
+	REQUIRE(a.GetString() == "Interned");
+	REQUIRE(Nova::NameID().GetString().empty());
+
+	Nova::NameID found;
+	REQUIRE(Nova::NameID::TryFind("Interned", found));
+	REQUIRE(found == a);
+	REQUIRE_FALSE(Nova::NameID::TryFind("Never interned anywhere", found));
+}
+
+TEST_CASE("Nova/Core/Nodes/Find Node", "Check finding nodes by path with and without a child name index")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	auto world = tree->CreateNode<Nova::Node>("World");
+	auto enemies = tree->CreateNode<Nova::Node>("Enemies");
+	auto boss = tree->CreateNode<Nova::Node>("Boss");
+
+	tree->GetRootNode()->AddChild(world);
+	world->AddChild(enemies);
+
+	// Enough siblings for the parent to build its name index
+	const size_t minionCount = GENERATE(size_t(2), Nova::Node::ChildNameIndexThreshold * 2);
+
+	for (size_t i = 0; i < minionCount; i++)
+	{
+		enemies->AddChild(tree->CreateNode<Nova::Node>("Minion" + std::to_string(i)));
+	}
+
+	enemies->AddChild(boss);
+
+	REQUIRE(tree->FindNode("World/Enemies/Boss") == boss);
+	REQUIRE(tree->FindNode("/World//Enemies/Boss/") == boss);
+	REQUIRE(tree->FindNode("World/Enemies/Minion1")->GetName() == "Minion1");
+	REQUIRE(world->FindNode("Enemies/Boss") == boss);
+	REQUIRE(tree->FindNode("") == tree->GetRootNode());
+	REQUIRE(tree->FindNode("World/Boss") == nullptr);
+	REQUIRE(tree->FindNode("World/Enemies/Nobody by this name") == nullptr);
+
+	SECTION("Duplicate names find the first sibling")
+	{
+		auto otherBoss = tree->CreateNode<Nova::Node>("Boss");
+		enemies->AddChild(otherBoss);
+
+		REQUIRE(tree->FindNode("World/Enemies/Boss") == boss);
+
+		enemies->RemoveChild(boss);
+		REQUIRE(tree->FindNode("World/Enemies/Boss") == otherBoss);
+
+		enemies->AddChild(boss);
+		enemies->MoveChild(boss, 0);
+		REQUIRE(tree->FindNode("World/Enemies/Boss") == boss);
+	}
+
+	SECTION("Renaming")
+	{
+		boss->SetName("FinalBoss");
+
+		REQUIRE(tree->FindNode("World/Enemies/Boss") == nullptr);
+		REQUIRE(tree->FindNode("World/Enemies/FinalBoss") == boss);
+	}
+
+	SECTION("Cached paths")
+	{
+		Nova::NodePath path("World/Enemies/Boss");
+
+		REQUIRE(path.ToString() == "World/Enemies/Boss");
+		REQUIRE(tree->FindNode(path) == boss);
+		REQUIRE(tree->FindNode(path) == boss);
+
+		// Structural changes invalidate the cache
+		enemies->RemoveChild(boss);
+		REQUIRE(tree->FindNode(path) == nullptr);
+
+		world->AddChild(enemies->GetChildren()[0]);
+		enemies->AddChild(boss);
+		REQUIRE(tree->FindNode(path) == boss);
+
+		boss->SetName("Renamed");
+		REQUIRE(tree->FindNode(path) == nullptr);
+
+		// Other trees don't share the cache
+		auto otherTree = Nova::MakeRef<Nova::NodeTree>();
+		REQUIRE(otherTree->FindNode(path) == nullptr);
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Find Node", "[.][benchmark] Measure path lookups in a wide tree")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::Ref<Nova::Node> parent = tree->GetRootNode();
+
+	// Five levels of 100 children each, looking up the last child at each level
+	for (int depth = 0; depth < 5; depth++)
+	{
+		Nova::Ref<Nova::Node> last;
+
+		for (int i = 0; i < 100; i++)
+		{
+			last = tree->CreateNode<Nova::Node>("Child" + std::to_string(i));
+			parent->AddChild(last);
+		}
+
+		parent = last;
+	}
+
+	const std::string path = "Child99/Child99/Child99/Child99/Child99";
+	Nova::NodePath nodePath(path);
+
+	BENCHMARK("Walk children comparing names")
+	{
+		Nova::Ref<Nova::Node> node = tree->GetRootNode();
+
+		for (int depth = 0; depth < 5 && node; depth++)
+		{
+			Nova::Ref<Nova::Node> next;
+
+			for (const auto& child : node->GetChildren())
+			{
+				if (child->GetName() == "Child99")
+				{
+					next = child;
+					break;
+				}
+			}
+
+			node = next;
+		}
+
+		return node;
+	};
+
+	BENCHMARK("FindNode")
+	{
+		return tree->FindNode(path);
+	};
+
+	BENCHMARK("FindNode with a cached path")
+	{
+		return tree->FindNode(nodePath);
+	};
+}
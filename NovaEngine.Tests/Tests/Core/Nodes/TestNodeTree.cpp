@@ -0,0 +1,979 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node3D.h>
+
+#include <functional>
+#include <random>
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// A node that counts its ticks and can run a function when ticked
+	/// </summary>
+	class CountingNode : public Nova::Node
+	{
+	public:
+		CountingNode(const Nova::string& name) : Nova::Node(name) {}
+
+		int TickCount = 0;
+		std::function<void()> OnTick;
+
+	protected:
+		virtual void Tick(double deltaTime) override
+		{
+			TickCount++;
+
+			if (OnTick)
+				OnTick();
+		}
+	};
+
+	/// <summary>
+	/// A node that counts how many nodes of its kind were destroyed, and how many of them were still bound to an entity
+	/// </summary>
+	class BoundNode : public Nova::Node
+	{
+	public:
+		struct Counts
+		{
+			int Destroyed = 0;
+			int DestroyedWhileBound = 0;
+		};
+
+		BoundNode(const Nova::string& name, Counts& counts) : Nova::Node(name), m_Counts(counts) {}
+
+		~BoundNode()
+		{
+			m_Counts.Destroyed++;
+
+			if (GetEntity().IsValid())
+				m_Counts.DestroyedWhileBound++;
+		}
+
+	private:
+		Counts& m_Counts;
+	};
+
+	Nova::List<Nova::Node*> GetFlatOrder(Nova::NodeTree& tree)
+	{
+		Nova::List<Nova::Node*> nodes;
+		tree.ForEachNode([&](Nova::Node& node) { nodes.push_back(&node); });
+
+		return nodes;
+	}
+
+	void GetRecursiveOrder(Nova::Node* node, Nova::List<Nova::Node*>& nodes)
+	{
+		nodes.push_back(node);
+
+		for (const auto& child : node->GetChildren())
+		{
+			GetRecursiveOrder(child.get(), nodes);
+		}
+	}
+
+	Nova::List<Nova::string> GetNames(const Nova::List<Nova::Node*>& nodes)
+	{
+		Nova::List<Nova::string> names;
+
+		for (Nova::Node* node : nodes)
+		{
+			names.push_back(node->GetName());
+		}
+
+		return names;
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Flattened Order", "Check that the flattened order follows adds, moves and removes")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto a = Nova::MakeRef<Nova::Node>("A");
+	auto a1 = Nova::MakeRef<Nova::Node>("A1");
+	auto a2 = Nova::MakeRef<Nova::Node>("A2");
+	auto a2a = Nova::MakeRef<Nova::Node>("A2a");
+	auto b = Nova::MakeRef<Nova::Node>("B");
+
+	// Build part of the subtree before attaching it, and part after
+	a->AddChild(a1);
+	root->AddChild(a);
+	root->AddChild(b);
+	a->AddChild(a2);
+	a2->AddChild(a2a);
+
+	REQUIRE(tree->GetNodeCount() == 6);
+	REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "A", "A1", "A2", "A2a", "B" });
+
+	SECTION("Move")
+	{
+		root->MoveChild(b, 0);
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "B", "A", "A1", "A2", "A2a" });
+	}
+
+	SECTION("Reparent")
+	{
+		b->AddChild(a2);
+
+		REQUIRE(a2->GetParent() == b);
+		REQUIRE(a->GetChildren().size() == 1);
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "A", "A1", "B", "A2", "A2a" });
+	}
+
+	SECTION("Remove")
+	{
+		root->RemoveChild(a);
+
+		REQUIRE(a->GetParent() == nullptr);
+		REQUIRE(a2a->GetTree() == nullptr);
+		REQUIRE(tree->GetNodeCount() == 2);
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "B" });
+
+		// Nodes that left the tree are never visited
+		size_t visited = 0;
+		tree->ForEachNodeInSubtree(a, [&](Nova::Node&) { visited++; });
+		REQUIRE(visited == 0);
+	}
+
+	SECTION("Subtree")
+	{
+		Nova::List<Nova::Node*> nodes;
+		tree->ForEachNodeInSubtree(a2, [&](Nova::Node& node) { nodes.push_back(&node); });
+
+		REQUIRE(GetNames(nodes) == Nova::List<Nova::string>{ "A2", "A2a" });
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Random Structural Changes", "Check that the flattened order always matches a recursive walk")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::List<Nova::Ref<Nova::Node>> nodes = { tree->GetRootNode() };
+
+	std::mt19937 random(42);
+	auto pick = [&](size_t count) { return (size_t)(random() % count); };
+
+	for (int i = 0; i < 2000; i++)
+	{
+		const auto& target = nodes[pick(nodes.size())];
+
+		switch (pick(5))
+		{
+		case 0:
+		case 1:
+		{
+			auto node = Nova::MakeRef<Nova::Node>("Node" + std::to_string(i));
+			target->AddChild(node);
+			nodes.push_back(node);
+			break;
+		}
+
+		case 2:
+		{
+			// Move to a random position under a parent that isn't in the moved node's subtree
+			if (target == tree->GetRootNode())
+				break;
+
+			auto parent = nodes[pick(nodes.size())];
+			bool isDescendant = false;
+
+			for (auto ancestor = parent; ancestor; ancestor = ancestor->GetParent())
+			{
+				isDescendant |= ancestor == target;
+			}
+
+			if (!isDescendant && parent->GetTree() == tree)
+			{
+				parent->AddChild(target);
+				parent->MoveChild(target, pick(parent->GetChildren().size()));
+			}
+
+			break;
+		}
+
+		case 3:
+		{
+			if (auto parent = target->GetParent())
+				parent->RemoveChild(target);
+
+			break;
+		}
+
+		case 4:
+		{
+			target->SetTickOrder((int)pick(3) - 1);
+			break;
+		}
+		}
+
+		// Let a few changes pile up at times, so the order is rebuilt for several at once
+		if (pick(3) == 0)
+			continue;
+
+		// Detached nodes stay in the list, so some operations build subtrees outside the tree
+		Nova::List<Nova::Node*> expected;
+		GetRecursiveOrder(tree->GetRootNode().get(), expected);
+
+		REQUIRE(GetFlatOrder(*tree) == expected);
+		REQUIRE(tree->GetNodeCount() == expected.size());
+
+		for (Nova::Node* node : expected)
+		{
+			REQUIRE(std::is_sorted(node->GetChildren().begin(), node->GetChildren().end(), [](const Nova::Ref<Nova::Node>& lhs, const Nova::Ref<Nova::Node>& rhs) {
+				return lhs->GetTickOrder() < rhs->GetTickOrder();
+			}));
+		}
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Large Tree", "Check that building a large tree inside the tree doesn't shift the flattened order for each node")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::List<Nova::Ref<Nova::Node>> nodes = { tree->GetRootNode() };
+
+	// Breadth-first, so almost every node lands in the middle of the order. Shifting the order for each of them would take minutes
+	const size_t count = 200000;
+
+	for (size_t i = 1; i < count; i++)
+	{
+		auto node = tree->CreateNode<Nova::Node>("Node");
+		nodes[(i - 1) / 4]->AddChild(node);
+		nodes.push_back(node);
+	}
+
+	REQUIRE(tree->GetNodeCount() == count);
+
+	// Changes made between reads are applied once, when the order is next read
+	Nova::Ref<Nova::Node> moved = nodes[3]->GetChildren()[0];
+
+	nodes[1]->AddChild(tree->CreateNode<Nova::Node>("Extra"));
+	nodes[2]->RemoveChild(nodes[2]->GetChildren()[0]);
+	nodes[3]->MoveChild(moved, 3);
+
+	Nova::List<Nova::Node*> expected;
+	GetRecursiveOrder(tree->GetRootNode().get(), expected);
+
+	REQUIRE(GetFlatOrder(*tree) == expected);
+	REQUIRE(tree->GetNodeCount() == expected.size());
+
+	// Adding to the last node in the order splices it in right away
+	nodes.back()->AddChild(tree->CreateNode<Nova::Node>("Last"));
+
+	expected.clear();
+	GetRecursiveOrder(tree->GetRootNode().get(), expected);
+
+	REQUIRE(GetFlatOrder(*tree) == expected);
+}
+
+TEST_CASE("Nova/Core/Nodes/Tick Order", "Check that siblings tick by tick order, and keep their place when it changes")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	Nova::List<Nova::string> ticked;
+	Nova::List<Nova::Ref<CountingNode>> nodes;
+
+	for (const char* name : { "A", "B", "C", "D" })
+	{
+		auto node = Nova::MakeRef<CountingNode>(name);
+		node->OnTick = [&ticked, name]() { ticked.push_back(name); };
+		nodes.push_back(node);
+	}
+
+	const auto& a = nodes[0];
+	const auto& b = nodes[1];
+	const auto& c = nodes[2];
+	const auto& d = nodes[3];
+
+	auto a1 = Nova::MakeRef<CountingNode>("A1");
+	a1->OnTick = [&ticked]() { ticked.push_back("A1"); };
+	a->AddChild(a1);
+
+	SECTION("Children are added after the siblings with the same or a lower order")
+	{
+		b->SetTickOrder(-1);
+		d->SetTickOrder(1);
+
+		for (const auto& node : nodes)
+		{
+			root->AddChild(node);
+		}
+
+		tree->Tick(0.016);
+
+		REQUIRE(ticked == Nova::List<Nova::string>{ "B", "A", "A1", "C", "D" });
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "B", "A", "A1", "C", "D" });
+	}
+
+	SECTION("Changing the order moves the subtree")
+	{
+		for (const auto& node : nodes)
+		{
+			root->AddChild(node);
+		}
+
+		const uint64_t structureVersion = tree->GetStructureVersion();
+
+		a->SetTickOrder(5);
+		c->SetTickOrder(-5);
+		b->SetTickOrder(5);
+
+		REQUIRE(tree->GetStructureVersion() != structureVersion);
+		REQUIRE(a1->GetTree() == tree);
+
+		tree->Tick(0.016);
+
+		REQUIRE(ticked == Nova::List<Nova::string>{ "C", "D", "A", "A1", "B" });
+
+		// Moves stay within the siblings that share the order
+		root->MoveChild(b, 0);
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "C", "D", "B", "A", "A1" });
+
+		root->MoveChild(c, 10);
+		REQUIRE(root->GetChildren().front() == c);
+	}
+
+	SECTION("Orders changed during a tick take effect from the next tick")
+	{
+		for (const auto& node : nodes)
+		{
+			root->AddChild(node);
+		}
+
+		b->OnTick = [&]() { ticked.push_back("B"); d->SetTickOrder(-1); };
+		tree->Tick(0.016);
+
+		REQUIRE(ticked == Nova::List<Nova::string>{ "A", "A1", "B", "C" });
+
+		ticked.clear();
+		tree->Tick(0.016);
+
+		REQUIRE(ticked == Nova::List<Nova::string>{ "D", "A", "A1", "B", "C" });
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Changes During Tick", "Check that structural changes made while ticking are deferred safely")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto first = Nova::MakeRef<CountingNode>("First");
+	auto second = Nova::MakeRef<CountingNode>("Second");
+	auto secondChild = Nova::MakeRef<CountingNode>("SecondChild");
+	auto added = Nova::MakeRef<CountingNode>("Added");
+
+	root->AddChild(first);
+	root->AddChild(second);
+	second->AddChild(secondChild);
+
+	SECTION("Removed nodes are skipped")
+	{
+		Nova::WeakRef<CountingNode> weakSecond = second;
+
+		first->OnTick = [&]()
+			{
+				root->RemoveChild(second);
+
+				// Only the tree keeps the node alive now
+				second.reset();
+				secondChild.reset();
+
+				REQUIRE_FALSE(weakSecond.expired());
+			};
+
+		tree->Tick(0.0);
+
+		REQUIRE(weakSecond.expired());
+		REQUIRE(tree->GetNodeCount() == 2);
+	}
+
+	SECTION("Added nodes tick from the next tick")
+	{
+		first->OnTick = [&]()
+			{
+				if (added->GetParent() == nullptr)
+					second->AddChild(added);
+			};
+
+		tree->Tick(0.0);
+
+		REQUIRE(added->TickCount == 0);
+		REQUIRE(second->TickCount == 1);
+		REQUIRE(secondChild->TickCount == 1);
+
+		tree->Tick(0.0);
+
+		REQUIRE(added->TickCount == 1);
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "First", "Second", "SecondChild", "Added" });
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Queued Changes", "Check that queued adds and frees are applied at the end of a tick, and big subtrees are destroyed over several")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto first = Nova::MakeRef<CountingNode>("First");
+	auto second = Nova::MakeRef<CountingNode>("Second");
+	auto added = Nova::MakeRef<CountingNode>("Added");
+
+	root->AddChild(first);
+	root->AddChild(second);
+
+	SECTION("Changes wait for the end of the tick")
+	{
+		Nova::WeakRef<CountingNode> weakSecond = second;
+
+		first->OnTick = [&]()
+			{
+				if (first->TickCount > 1)
+					return;
+
+				second->QueueFree();
+				first->QueueAddChild(added);
+
+				// Nothing changed yet, so the freed node still ticks this time
+				REQUIRE(second->GetParent() == root);
+				REQUIRE(added->GetParent() == nullptr);
+			};
+
+		tree->Tick(0.0);
+
+		REQUIRE(second->GetParent() == nullptr);
+		REQUIRE(second->TickCount == 1);
+
+		// The tree doesn't hold on to freed nodes
+		second.reset();
+		REQUIRE(weakSecond.expired());
+
+		REQUIRE(added->GetParent() == first);
+		REQUIRE(added->TickCount == 0);
+		REQUIRE(GetNames(GetFlatOrder(*tree)) == Nova::List<Nova::string>{ "Root", "First", "Added" });
+
+		tree->Tick(0.0);
+
+		REQUIRE(added->TickCount == 1);
+	}
+
+	SECTION("Freed nodes are released even if freed twice")
+	{
+		Nova::WeakRef<CountingNode> weakSecond = second;
+
+		second->QueueFree();
+		second->QueueFree();
+		second.reset();
+
+		tree->Tick(0.0);
+
+		REQUIRE(weakSecond.expired());
+		REQUIRE(tree->GetNodeCount() == 2);
+	}
+
+	SECTION("Nodes outside a tree change right away")
+	{
+		auto detached = Nova::MakeRef<Nova::Node>("Detached");
+
+		detached->QueueAddChild(added);
+		REQUIRE(added->GetParent() == detached);
+
+		added->QueueFree();
+		REQUIRE(added->GetParent() == nullptr);
+	}
+
+	SECTION("Many changes are applied as one batch")
+	{
+		Nova::List<Nova::Ref<CountingNode>> nodes;
+
+		for (size_t i = 0; i < 32; i++)
+		{
+			nodes.push_back(Nova::MakeRef<CountingNode>("Node" + std::to_string(i)));
+			second->QueueAddChild(nodes.back());
+		}
+
+		first->QueueFree();
+		tree->Tick(0.0);
+
+		Nova::List<Nova::Node*> expected;
+		GetRecursiveOrder(root.get(), expected);
+
+		REQUIRE(GetFlatOrder(*tree) == expected);
+		REQUIRE(tree->GetNodeCount() == nodes.size() + 2);
+
+		for (const auto& node : nodes)
+		{
+			node->QueueFree();
+		}
+
+		tree->Tick(0.0);
+
+		REQUIRE(tree->GetNodeCount() == 2);
+	}
+
+	SECTION("Freed subtrees leave the tree a node at a time")
+	{
+		tree->SetDestroyBudget(1);
+
+		const Nova::NodeGroup props("Props");
+		auto& transforms = tree->GetTransformStorage(Nova::TransformSpace::Space3D);
+
+		auto level = tree->CreateNode<Nova::Node3D>("Level");
+		auto prop = tree->CreateNode<Nova::Node3D>("Prop");
+		auto kept = tree->CreateNode<Nova::Node3D>("Kept");
+
+		prop->AddToGroup(props);
+		level->AddChild(prop);
+		level->AddChild(tree->CreateNode<Nova::Node3D>("Other"));
+		second->AddChild(level);
+		root->AddChild(kept);
+
+		REQUIRE(transforms.GetCount() == 4);
+
+		level->QueueFree();
+		tree->Tick(0.0);
+
+		// Nodes still waiting for their turn stay registered, without getting in the way of the rest of the tree
+		REQUIRE(tree->FindNode("Second/Level") == nullptr);
+		REQUIRE(level->GetTree() == nullptr);
+		REQUIRE(prop->GetTree() == tree);
+		REQUIRE(tree->GetNodesInGroup(props).size() == 1);
+		REQUIRE(transforms.GetCount() == 3);
+
+		kept->SetPosition(Nova::Vector3(1.0f, 2.0f, 3.0f));
+		tree->UpdateTransforms();
+		REQUIRE(kept->GetWorldPosition() == Nova::Vector3(1.0f, 2.0f, 3.0f));
+
+		while (tree->GetPendingDestroyCount() > 0)
+		{
+			tree->Tick(0.0);
+		}
+
+		REQUIRE(prop->GetTree() == nullptr);
+		REQUIRE(prop->GetIsActiveInTree());
+		REQUIRE(tree->GetNodesInGroup(props).empty());
+		REQUIRE(transforms.GetCount() == 1);
+		REQUIRE(tree->GetNodeCount() == 4);
+	}
+
+	SECTION("Big subtrees are destroyed over several ticks")
+	{
+		tree->SetDestroyBudget(10);
+
+		// A chain deep enough that destroying it recursively could overflow the stack
+		Nova::WeakRef<Nova::Node> deepest;
+		Nova::Ref<Nova::Node> parent = second;
+
+		for (int i = 0; i < 100000; i++)
+		{
+			auto child = Nova::MakeRef<Nova::Node>("Link");
+			parent->AddChild(child);
+			parent = child;
+		}
+
+		deepest = parent;
+		parent.reset();
+
+		// A node held elsewhere survives along with its children
+		auto held = Nova::MakeRef<Nova::Node>("Held");
+		held->AddChild(Nova::MakeRef<Nova::Node>("HeldChild"));
+		second->AddChild(held);
+
+		second->QueueFree();
+		second.reset();
+
+		tree->Tick(0.0);
+
+		// The subtree is out of the order right away, but its nodes only leave the tree as they're destroyed
+		size_t visited = 0;
+		tree->ForEachNode([&visited](Nova::Node&) { visited++; });
+
+		REQUIRE(visited == 2);
+		REQUIRE(tree->GetNodeCount() > 2);
+		REQUIRE(tree->GetPendingDestroyCount() > 0);
+		REQUIRE_FALSE(deepest.expired());
+		REQUIRE(deepest.lock()->GetTree() == tree);
+
+		int ticks = 1;
+
+		while (tree->GetPendingDestroyCount() > 0)
+		{
+			tree->Tick(0.0);
+			ticks++;
+		}
+
+		REQUIRE(deepest.expired());
+		REQUIRE(ticks >= 10000);
+		REQUIRE(tree->GetNodeCount() == 2);
+		REQUIRE(held->GetParent() == nullptr);
+		REQUIRE(held->GetTree() == nullptr);
+		REQUIRE(held->GetChildren().size() == 1);
+		REQUIRE(held->GetChildren()[0]->GetTree() == nullptr);
+
+		// A held node can go back into the tree
+		tree->GetRootNode()->AddChild(held);
+		REQUIRE(tree->GetNodeCount() == 4);
+	}
+
+	SECTION("Trees can be destroyed while freed subtrees are waiting")
+	{
+		tree->SetDestroyBudget(4);
+
+		BoundNode::Counts counts;
+
+		{
+			auto level = tree->CreateNode<BoundNode>("Level", counts);
+			second->AddChild(level);
+			tree->GetWorld().BindNode(*level);
+
+			for (int i = 0; i < 1000; i++)
+			{
+				auto prop = tree->CreateNode<BoundNode>("Prop", counts);
+				level->AddChild(prop);
+				tree->GetWorld().BindNode(*prop);
+			}
+
+			level->QueueFree();
+		}
+
+		tree->Tick(0.0);
+		REQUIRE(tree->GetPendingDestroyCount() > 0);
+
+		// The nodes still waiting are bound to the world, which has to let go of them before they're destroyed
+		tree.reset();
+
+		REQUIRE(counts.Destroyed == 1001);
+		REQUIRE(counts.DestroyedWhileBound == 0);
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Active In Tree", "Check that the cached active-in-tree state follows active changes and reparenting")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto parent = Nova::MakeRef<CountingNode>("Parent");
+	auto child = Nova::MakeRef<CountingNode>("Child");
+	auto grandchild = Nova::MakeRef<CountingNode>("Grandchild");
+	auto other = Nova::MakeRef<CountingNode>("Other");
+
+	root->AddChild(parent);
+	root->AddChild(other);
+	parent->AddChild(child);
+	child->AddChild(grandchild);
+
+	parent->SetIsActive(false);
+
+	REQUIRE_FALSE(parent->GetIsActiveInTree());
+	REQUIRE_FALSE(grandchild->GetIsActiveInTree());
+	REQUIRE(grandchild->GetIsActive());
+	REQUIRE(other->GetIsActiveInTree());
+
+	// Inactive subtrees aren't ticked
+	tree->Tick(0.0);
+
+	REQUIRE(parent->TickCount == 0);
+	REQUIRE(grandchild->TickCount == 0);
+	REQUIRE(other->TickCount == 1);
+
+	SECTION("Reactivating")
+	{
+		// A node that is inactive itself stays inactive when its parent is reactivated
+		child->SetIsActive(false);
+		parent->SetIsActive(true);
+
+		REQUIRE(parent->GetIsActiveInTree());
+		REQUIRE_FALSE(child->GetIsActiveInTree());
+		REQUIRE_FALSE(grandchild->GetIsActiveInTree());
+
+		child->SetIsActive(true);
+		REQUIRE(grandchild->GetIsActiveInTree());
+	}
+
+	SECTION("Reparenting")
+	{
+		other->AddChild(child);
+		REQUIRE(grandchild->GetIsActiveInTree());
+
+		parent->AddChild(child);
+		REQUIRE_FALSE(grandchild->GetIsActiveInTree());
+
+		// Unparented nodes only depend on themselves
+		parent->RemoveChild(child);
+		REQUIRE(grandchild->GetIsActiveInTree());
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Node Pool", "Check that nodes created by a tree come from its pool and keep it alive")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	// Hold our own reference so the pool can be inspected after the tree is gone
+	Nova::NodeSlabPool* pool = tree->GetNodePool();
+	pool->AddRef();
+
+	const size_t usedBytes = pool->GetUsedBytes();
+
+	Nova::List<Nova::Ref<CountingNode>> nodes;
+	for (int i = 0; i < 1000; i++)
+	{
+		nodes.push_back(tree->CreateNode<CountingNode>("Node"));
+		tree->GetRootNode()->AddChild(nodes.back());
+	}
+
+	REQUIRE(pool->GetUsedBytes() >= usedBytes + 1000 * sizeof(CountingNode));
+
+	// Nodes created one after another are packed into the same slabs
+	REQUIRE(pool->GetSlabCount() < 1000 * sizeof(CountingNode) / 1024);
+
+	SECTION("Freed memory is reused")
+	{
+		tree->GetRootNode()->RemoveChild(nodes[10]);
+		CountingNode* freed = nodes[10].get();
+		nodes[10].reset();
+
+		REQUIRE(tree->CreateNode<CountingNode>("Reused").get() == freed);
+	}
+
+	SECTION("Nodes outlive their tree")
+	{
+		Nova::Ref<CountingNode> survivor = nodes[0];
+		nodes.clear();
+		tree.reset();
+
+		REQUIRE(survivor->GetName() == "Node");
+		REQUIRE(pool->GetUsedBytes() > 0);
+
+		survivor.reset();
+		REQUIRE(pool->GetUsedBytes() == 0);
+	}
+
+	nodes.clear();
+	tree.reset();
+	pool->Release();
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Tree Tick", "[.][benchmark] Measure a full tick of a large tree")
+{
+	for (size_t nodeCount : { 1000, 10000, 100000 })
+	{
+		auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+		// A bushy tree, a few levels deep
+		Nova::List<Nova::Ref<Nova::Node>> nodes = { tree->GetRootNode() };
+
+		for (size_t i = 1; i < nodeCount; i++)
+		{
+			auto node = Nova::MakeRef<CountingNode>("Node");
+			nodes[(i - 1) / 8]->AddChild(node);
+			nodes.push_back(node);
+		}
+
+		BENCHMARK("Tick " + std::to_string(nodeCount) + " nodes")
+		{
+			tree->Tick(1.0 / 60.0);
+		};
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Queued Changes", "[.][benchmark] Measure removing many nodes one by one against queueing them, and freeing a big subtree")
+{
+	constexpr size_t nodeCount = 100000;
+	constexpr size_t changeCount = 1000;
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	auto level = tree->CreateNode<Nova::Node>("Level");
+	auto container = tree->CreateNode<Nova::Node>("Container");
+
+	// The removed nodes sit before the rest of the level in the flattened order, so each removal shifts it
+	tree->GetRootNode()->AddChild(container);
+	tree->GetRootNode()->AddChild(level);
+
+	for (size_t i = 0; i < nodeCount; i++)
+	{
+		level->AddChild(tree->CreateNode<Nova::Node>("Node"));
+	}
+
+	auto addNodes = [&]()
+		{
+			Nova::List<Nova::Ref<Nova::Node>> nodes;
+
+			for (size_t i = 0; i < changeCount; i++)
+			{
+				nodes.push_back(tree->CreateNode<Nova::Node>("Removed"));
+				container->AddChild(nodes.back());
+			}
+
+			return nodes;
+		};
+
+	BENCHMARK_ADVANCED("Remove 1000 nodes from a tree of 100K one by one")(Catch::Benchmark::Chronometer meter)
+	{
+		Nova::List<Nova::List<Nova::Ref<Nova::Node>>> runs(meter.runs());
+
+		for (auto& nodes : runs)
+		{
+			nodes = addNodes();
+		}
+
+		meter.measure([&](int run)
+			{
+				for (const auto& node : runs[run])
+				{
+					container->RemoveChild(node);
+				}
+			});
+	};
+
+	BENCHMARK_ADVANCED("Queue 1000 nodes from a tree of 100K to be freed")(Catch::Benchmark::Chronometer meter)
+	{
+		Nova::List<Nova::List<Nova::Ref<Nova::Node>>> runs(meter.runs());
+
+		for (auto& nodes : runs)
+		{
+			nodes = addNodes();
+		}
+
+		meter.measure([&](int run)
+			{
+				for (const auto& node : runs[run])
+				{
+					node->QueueFree();
+				}
+
+				tree->Tick(0.0);
+			});
+	};
+
+	for (size_t budget : { SIZE_MAX, Nova::NodeTree::DefaultDestroyBudget })
+	{
+		const std::string name = budget == SIZE_MAX ? "Tick freeing a subtree of 100K nodes at once" : "First tick freeing a subtree of 100K nodes with the default budget";
+
+		BENCHMARK_ADVANCED(name.c_str())(Catch::Benchmark::Chronometer meter)
+		{
+			tree->SetDestroyBudget(budget);
+
+			// Only the freeing is measured, not ticking the nodes
+			level->SetIsActive(false);
+			container->SetIsActive(false);
+
+			Nova::List<Nova::Ref<Nova::Node>> runs(meter.runs());
+
+			for (auto& freed : runs)
+			{
+				freed = tree->CreateNode<Nova::Node>("Freed");
+
+				for (size_t i = 0; i < nodeCount; i++)
+				{
+					freed->AddChild(tree->CreateNode<Nova::Node>("Node"));
+				}
+
+				level->AddChild(freed);
+			}
+
+			// Freeing the last subtree first keeps each one at the end of the flattened order, so the rest of the runs aren't reordered every tick
+			meter.measure([&](int run)
+				{
+					Nova::Ref<Nova::Node>& freed = runs[runs.size() - 1 - run];
+					freed->QueueFree();
+					freed.reset();
+
+					tree->Tick(0.0);
+				});
+
+			while (tree->GetPendingDestroyCount() > 0)
+			{
+				tree->Tick(0.0);
+			}
+
+			container->SetIsActive(true);
+			level->SetIsActive(true);
+		};
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Tick Order", "[.][benchmark] Measure ticking by tick order against sorting the children every tick")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::List<Nova::Ref<Nova::Node>> nodes = { tree->GetRootNode() };
+	std::mt19937 random(42);
+
+	for (size_t i = 1; i < 100000; i++)
+	{
+		auto node = Nova::MakeRef<CountingNode>("Node");
+		node->SetTickOrder((int)(random() % 8));
+		nodes[(i - 1) / 8]->AddChild(node);
+		nodes.push_back(node);
+	}
+
+	BENCHMARK("Tick 100000 nodes with mixed tick orders")
+	{
+		tree->Tick(1.0 / 60.0);
+	};
+
+	// What ticking would cost if each node's children were sorted by tick order as it's ticked
+	std::function<void(Nova::Node&)> tickSorted = [&](Nova::Node& node)
+	{
+		Nova::List<Nova::Node*> children;
+
+		for (const auto& child : node.GetChildren())
+		{
+			children.push_back(child.get());
+		}
+
+		std::stable_sort(children.begin(), children.end(), [](Nova::Node* lhs, Nova::Node* rhs) { return lhs->GetTickOrder() < rhs->GetTickOrder(); });
+
+		for (Nova::Node* child : children)
+		{
+			static_cast<CountingNode*>(child)->TickCount++;
+			tickSorted(*child);
+		}
+	};
+
+	BENCHMARK("Tick 100000 nodes, sorting each node's children")
+	{
+		tickSorted(*tree->GetRootNode());
+	};
+
+	BENCHMARK("Change the tick order of 1000 leaf nodes")
+	{
+		for (size_t i = 0; i < 1000; i++)
+		{
+			nodes[nodes.size() - 1 - i * 50]->SetTickOrder((int)(random() % 8));
+		}
+	};
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Node Creation", "[.][benchmark] Compare creating nodes with MakeRef and from a tree's node pool")
+{
+	const size_t nodeCount = 100000;
+
+	BENCHMARK("MakeRef 100000 nodes")
+	{
+		Nova::List<Nova::Ref<Nova::Node>> nodes;
+		nodes.reserve(nodeCount);
+
+		for (size_t i = 0; i < nodeCount; i++)
+		{
+			nodes.push_back(Nova::MakeRef<CountingNode>("Node"));
+		}
+
+		return nodes.size();
+	};
+
+	BENCHMARK("CreateNode 100000 nodes")
+	{
+		auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+		Nova::List<Nova::Ref<Nova::Node>> nodes;
+		nodes.reserve(nodeCount);
+
+		for (size_t i = 0; i < nodeCount; i++)
+		{
+			nodes.push_back(tree->CreateNode<CountingNode>("Node"));
+		}
+
+		return nodes.size();
+	};
+}
@@ -0,0 +1,175 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/NodeTypeRegistry.h>
+#include <Nova/Core/Nodes/Node2D.h>
+
+#include <string>
+#include <unordered_map>
+
+namespace
+{
+	/// <summary>
+	/// A metrics sink that keeps the last value written under each name
+	/// </summary>
+	class RecordingMetricsSink : public Nova::MetricsSink
+	{
+	public:
+		std::unordered_map<Nova::string, double> Values;
+
+		virtual void Write(const Nova::string& name, double value) override
+		{
+			Values[name] = value;
+		}
+	};
+
+	class UnregisteredStatsNode : public Nova::Node
+	{
+	public:
+		UnregisteredStatsNode(const Nova::string& name) :
+			Node(name)
+		{}
+	};
+}
+
+TEST_CASE("Nova/Core/Nodes/Tree Counters", "Check that the live counters follow nodes entering and leaving the tree")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	REQUIRE(tree->GetCounters().NodeCount == 1);
+
+	auto parent = tree->CreateNode<Nova::Node>("Parent");
+
+	for (int i = 0; i < 9; i++)
+	{
+		parent->AddChild(tree->CreateNode<Nova::Node>("Child"));
+	}
+
+	root->AddChild(parent);
+
+	auto counters = tree->GetCounters();
+	REQUIRE(counters.NodeCount == 11);
+	REQUIRE(counters.NodeCount == tree->GetNodeCount());
+	REQUIRE(counters.NodesAdded == 11);
+	REQUIRE(counters.NodesRemoved == 0);
+
+	// The first tick counts everything since the tree was created
+	tree->Tick(0.0);
+	REQUIRE(tree->GetCounters().NodesAddedLastFrame == 11);
+
+	parent->GetChildren()[0]->QueueFree();
+	parent->GetChildren()[1]->QueueFree();
+	root->AddChild(tree->CreateNode<Nova::Node>("Extra"));
+
+	counters = tree->GetCounters();
+	REQUIRE(counters.QueuedChangeCount == 2);
+	REQUIRE(counters.NodeCount == 12);
+
+	tree->Tick(0.0);
+
+	counters = tree->GetCounters();
+	REQUIRE(counters.NodeCount == 10);
+	REQUIRE(counters.NodeCount == tree->GetNodeCount());
+	REQUIRE(counters.NodesAddedLastFrame == 1);
+	REQUIRE(counters.NodesRemovedLastFrame == 2);
+	REQUIRE(counters.NodesRemoved == 2);
+	REQUIRE(counters.QueuedChangeCount == 0);
+
+	tree->Tick(0.0);
+	REQUIRE(tree->GetCounters().NodesAddedLastFrame == 0);
+	REQUIRE(tree->GetCounters().NodesRemovedLastFrame == 0);
+
+	RecordingMetricsSink sink;
+	tree->GetCounters().WriteMetrics(sink);
+
+	REQUIRE(sink.Values["NodeTree.NodeCount"] == 10.0);
+	REQUIRE(sink.Values["NodeTree.NodesRemoved"] == 2.0);
+	REQUIRE(tree->GetCounters().ToString().find("10 nodes") != Nova::string::npos);
+}
+
+TEST_CASE("Nova/Core/Nodes/Tree Report", "Check that the deep report breaks the tree down by class")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto level = tree->CreateNode<Nova::Node>("Level");
+	root->AddChild(level);
+
+	for (int i = 0; i < 20; i++)
+	{
+		auto sprite = tree->CreateNode<Nova::Node2D>("Sprite" + std::to_string(i % 5));
+		sprite->AddToGroup(Nova::NodeGroup("Sprites"));
+		level->AddChild(sprite);
+	}
+
+	auto deep = tree->CreateNode<UnregisteredStatsNode>("Deep");
+	level->GetChildren()[0]->AddChild(deep);
+	deep->SetIsActive(false);
+
+	auto report = tree->CreateReport();
+
+	REQUIRE(report.NodeCount == 23);
+	REQUIRE(report.ActiveNodeCount == 22);
+	REQUIRE(report.MaxDepth == 3);
+	REQUIRE(report.MaxChildCount == 20);
+	REQUIRE(report.UniqueNameCount == 8);
+	REQUIRE(report.NameBytes == Nova::string("RootLevelDeep").size() + 5 * Nova::string("Sprite0").size());
+	REQUIRE(report.ChildListBytes >= 22 * sizeof(Nova::Ref<Nova::Node>));
+	REQUIRE(report.ChildNameIndexBytes > 0);
+	REQUIRE(report.GroupBytes >= 20 * sizeof(Nova::Node*));
+	REQUIRE(report.PoolUsedBytes >= 20 * sizeof(Nova::Node2D));
+
+	// Most common first, with unregistered classes under their C++ name
+	REQUIRE(report.Types.size() == 3);
+	REQUIRE(report.Types[0].TypeName == "Node2D");
+	REQUIRE(report.Types[0].Count == 20);
+	REQUIRE(report.Types[0].InstanceBytes == 20 * sizeof(Nova::Node2D));
+	REQUIRE(report.Types[1].TypeName == "Node");
+	REQUIRE(report.Types[1].Count == 2);
+	REQUIRE(report.Types[2].Count == 1);
+	REQUIRE(report.Types[2].InstanceBytes == 0);
+
+	RecordingMetricsSink sink;
+	report.WriteMetrics(sink, "Game.");
+
+	REQUIRE(sink.Values["Game.NodeCount"] == 23.0);
+	REQUIRE(sink.Values["Game.Types.Node2D.Count"] == 20.0);
+
+	const Nova::string text = report.ToString();
+	REQUIRE(text.find("23 nodes") != Nova::string::npos);
+	REQUIRE(text.find("Node2D: 20 nodes") != Nova::string::npos);
+	REQUIRE(text.find("1 nodes, unknown size") != Nova::string::npos);
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Tree Report", "[.][benchmark] Measure the live counters and the deep report of a large tree")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	// 100K nodes, a few levels deep
+	Nova::List<Nova::Ref<Nova::Node>> nodes = { tree->GetRootNode() };
+
+	for (size_t i = 1; i < 100000; i++)
+	{
+		Nova::Ref<Nova::Node> node;
+
+		if (i % 2 == 0)
+			node = tree->CreateNode<Nova::Node2D>("Node" + std::to_string(i % 100));
+		else
+			node = tree->CreateNode<Nova::Node>("Node" + std::to_string(i % 100));
+
+		nodes[(i - 1) / 8]->AddChild(node);
+		nodes.push_back(node);
+	}
+
+	BENCHMARK("Read the counters")
+	{
+		return tree->GetCounters();
+	};
+
+	BENCHMARK("Create a report of 100K nodes")
+	{
+		return tree->CreateReport();
+	};
+}
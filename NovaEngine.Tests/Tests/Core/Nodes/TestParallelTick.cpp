@@ -0,0 +1,267 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Spatial/SpatialIndex.h>
+#include <Nova/Core/Entities/World.h>
+#include <Nova/Services/Jobs/JobScheduler.h>
+
+#include <cmath>
+#include <functional>
+#include <mutex>
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// A node that logs its name when ticked and can run a function when ticked
+	/// </summary>
+	class LoggingNode : public Nova::Node
+	{
+	public:
+		LoggingNode(const Nova::string& name, Nova::List<Nova::string>* log) : Nova::Node(name), Log(log) {}
+
+		Nova::List<Nova::string>* Log;
+		std::function<void(LoggingNode&)> OnTick;
+
+	protected:
+		virtual void Tick(double deltaTime) override
+		{
+			Log->push_back(GetName());
+
+			if (OnTick)
+				OnTick(*this);
+		}
+	};
+
+	/// <summary>
+	/// A node that does a fixed amount of arithmetic each tick
+	/// </summary>
+	class BusyNode : public Nova::Node2D
+	{
+	public:
+		BusyNode(const Nova::string& name) : Nova::Node2D(name) {}
+
+		double Value = 1.0;
+
+	protected:
+		virtual void Tick(double deltaTime) override
+		{
+			for (int i = 0; i < 200; i++)
+			{
+				Value = std::sqrt(Value * Value + deltaTime);
+			}
+
+			SetPosition(Nova::Vector2(Value, 0.0));
+		}
+	};
+
+	/// <summary>
+	/// Builds a subtree of logging nodes: a root with two children, the first of which has a child of its own
+	/// </summary>
+	Nova::Ref<LoggingNode> AddLoggingSubtree(Nova::NodeTree& tree, const Nova::Ref<Nova::Node>& parent, const Nova::string& name, Nova::List<Nova::string>* log)
+	{
+		auto root = tree.CreateNode<LoggingNode>(name, log);
+		auto a = tree.CreateNode<LoggingNode>(name + "A", log);
+		a->AddChild(tree.CreateNode<LoggingNode>(name + "A1", log));
+		root->AddChild(a);
+		root->AddChild(tree.CreateNode<LoggingNode>(name + "B", log));
+
+		parent->AddChild(root);
+		return root;
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Parallel Tick", "Check that independent subtrees tick in parallel with their changes deferred")
+{
+	Nova::Jobs::JobScheduler scheduler(2);
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	Nova::List<Nova::string> serialLog;
+	Nova::List<Nova::string> logs[3];
+
+	auto level = AddLoggingSubtree(*tree, root, "Level", &serialLog);
+	Nova::Ref<LoggingNode> subtrees[3];
+
+	for (int i = 0; i < 3; i++)
+	{
+		subtrees[i] = AddLoggingSubtree(*tree, level, "Room" + std::to_string(i), &logs[i]);
+		subtrees[i]->SetIsTickIndependent(true);
+	}
+
+	auto after = tree->CreateNode<LoggingNode>("After", &serialLog);
+	root->AddChild(after);
+
+	SECTION("Subtrees tick parent before child, after the rest of the tree")
+	{
+		tree->SetJobScheduler(&scheduler);
+
+		bool wasParallel = false;
+		subtrees[1]->OnTick = [&](LoggingNode&) { wasParallel = tree->GetIsTickingInParallel(); };
+
+		// Serial nodes can't see the subtrees' changes until they've all been ticked
+		size_t loggedBeforeAfter = 0;
+		after->OnTick = [&](LoggingNode&) { loggedBeforeAfter = logs[0].size() + logs[1].size() + logs[2].size(); };
+
+		tree->Tick(0.016);
+
+		REQUIRE(wasParallel);
+		REQUIRE_FALSE(tree->GetIsTickingInParallel());
+		REQUIRE(loggedBeforeAfter == 0);
+		REQUIRE(serialLog == Nova::List<Nova::string>{ "Level", "LevelA", "LevelA1", "LevelB", "After" });
+
+		for (int i = 0; i < 3; i++)
+		{
+			const Nova::string name = "Room" + std::to_string(i);
+			REQUIRE(logs[i] == Nova::List<Nova::string>{ name, name + "A", name + "A1", name + "B" });
+		}
+	}
+
+	SECTION("Without a scheduler, subtrees tick in place")
+	{
+		Nova::List<Nova::string> log;
+		level->Log = &log;
+		after->Log = &log;
+
+		for (int i = 0; i < 3; i++)
+		{
+			subtrees[i]->Log = &log;
+		}
+
+		tree->Tick(0.016);
+
+		REQUIRE(log == Nova::List<Nova::string>{ "Level", "Room0", "Room1", "Room2", "After" });
+	}
+
+	SECTION("Structural changes are deferred until the subtrees are done")
+	{
+		tree->SetJobScheduler(&scheduler);
+
+		size_t childCountDuringTick = 0;
+		auto spawned = tree->CreateNode<Nova::Node>("Spawned");
+
+		subtrees[0]->OnTick = [&](LoggingNode& node)
+		{
+			node.AddChild(spawned);
+			node.RemoveChild(node.GetChildren().back());
+			node.SetName("Renamed");
+
+			childCountDuringTick = node.GetChildren().size();
+		};
+
+		// Moving a child out of another subtree is deferred too
+		subtrees[1]->OnTick = [&](LoggingNode& node) { node.MoveChild(node.GetChildren().front(), 1); };
+
+		bool deferredRan = false;
+		subtrees[2]->OnTick = [&](LoggingNode&) { tree->Defer([&]() { deferredRan = !tree->GetIsTickingInParallel(); }); };
+
+		tree->Tick(0.016);
+
+		REQUIRE(childCountDuringTick == 2);
+		REQUIRE(deferredRan);
+		REQUIRE(tree->FindNode("Level/Renamed/Spawned") == spawned);
+		REQUIRE(tree->FindNode("Level/Renamed/Room0B") == nullptr);
+		REQUIRE(subtrees[1]->GetChildren().back()->GetName() == "Room1A");
+		REQUIRE(tree->GetNodeCount() == 1 + 4 + 3 * 4 + 1);
+		REQUIRE(spawned->GetTree() == tree);
+	}
+
+	SECTION("Changes to the spatial index and the world are deferred")
+	{
+		tree->SetJobScheduler(&scheduler);
+
+		const Nova::Rect bounds(Nova::Vector2(1.0, 1.0), Nova::Vector2(0.0, 0.0));
+
+		auto bounded = tree->CreateNode<Nova::Node2D>("Bounded");
+		auto cleared = tree->CreateNode<Nova::Node2D>("Cleared");
+		cleared->SetBounds(bounds);
+
+		subtrees[0]->AddChild(bounded);
+		subtrees[1]->AddChild(cleared);
+
+		REQUIRE(tree->GetSpatialIndex().GetCount() == 1);
+
+		// Nothing else writes to the index during the tick, so reading its count is safe
+		size_t indexCountDuringTick = 0;
+		subtrees[0]->OnTick = [&](LoggingNode&)
+		{
+			bounded->SetBounds(bounds);
+			indexCountDuringTick = tree->GetSpatialIndex().GetCount();
+		};
+
+		subtrees[1]->OnTick = [&](LoggingNode&) { cleared->ClearBounds(); };
+
+		bool isBoundDuringTick = true;
+		subtrees[2]->OnTick = [&](LoggingNode& node) { isBoundDuringTick = tree->GetWorld().BindNode(node).IsValid(); };
+
+		tree->Tick(0.016);
+
+		REQUIRE(indexCountDuringTick == 1);
+		REQUIRE_FALSE(isBoundDuringTick);
+
+		Nova::List<Nova::Node2D*> found;
+		tree->GetSpatialIndex().QueryPoint(Nova::Vector2(0.5, 0.5), found);
+
+		REQUIRE(found == Nova::List<Nova::Node2D*>{ bounded.get() });
+		REQUIRE(tree->GetWorld().IsAlive(subtrees[2]->GetEntity()));
+	}
+
+	SECTION("Inactive and removed subtrees are skipped")
+	{
+		tree->SetJobScheduler(&scheduler);
+
+		subtrees[0]->SetIsActive(false);
+
+		// Removed by a serial node after the subtree was already collected
+		after->OnTick = [&](LoggingNode&) { level->RemoveChild(subtrees[2]); };
+
+		tree->Tick(0.016);
+
+		REQUIRE(logs[0].empty());
+		REQUIRE(logs[1].size() == 4);
+		REQUIRE(logs[2].empty());
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Parallel Tick", "[.][benchmark] Measure ticking independent subtrees in parallel against ticking them serially")
+{
+	const size_t subtreeCount = 16;
+	const size_t nodesPerSubtree = 2000;
+
+	Nova::Jobs::JobScheduler scheduler(Nova::Jobs::JobScheduler::GetDefaultWorkerCount());
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	for (size_t i = 0; i < subtreeCount; i++)
+	{
+		auto subtree = tree->CreateNode<BusyNode>("Room" + std::to_string(i));
+		subtree->SetIsTickIndependent(true);
+
+		for (size_t j = 1; j < nodesPerSubtree; j++)
+		{
+			subtree->AddChild(tree->CreateNode<BusyNode>("Prop" + std::to_string(j)));
+		}
+
+		tree->GetRootNode()->AddChild(subtree);
+	}
+
+	BENCHMARK("Tick 16 subtrees of 2000 nodes serially")
+	{
+		tree->SetJobScheduler(nullptr);
+		tree->Tick(0.016);
+
+		return tree->GetNodeCount();
+	};
+
+	BENCHMARK("Tick 16 subtrees of 2000 nodes in parallel")
+	{
+		tree->SetJobScheduler(&scheduler);
+		tree->Tick(0.016);
+
+		return tree->GetNodeCount();
+	};
+
+	tree->SetJobScheduler(nullptr);
+}
@@ -0,0 +1,280 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Nodes/Node3D.h>
+
+#include <cmath>
+#include <random>
+
+namespace
+{
+	bool ApproxEqual(const Nova::Vector3& lhs, const Nova::Vector3& rhs)
+	{
+		return std::abs(lhs.X - rhs.X) < 1e-4f && std::abs(lhs.Y - rhs.Y) < 1e-4f && std::abs(lhs.Z - rhs.Z) < 1e-4f;
+	}
+
+	bool ApproxEqual(const Nova::Matrix4& lhs, const Nova::Matrix4& rhs)
+	{
+		for (int i = 0; i < 16; i++)
+		{
+			if (std::abs(lhs.Elements[i] - rhs.Elements[i]) > 1e-4f)
+				return false;
+		}
+
+		return true;
+	}
+
+	/// <summary>
+	/// Computes a world matrix by walking up the parents, without any caching
+	/// </summary>
+	Nova::Matrix4 ComputeWorldMatrix(const Nova::Node3D& node)
+	{
+		Nova::Matrix4 world = node.ComputeLocalMatrix();
+
+		for (auto parent = node.GetParent(); parent; parent = parent->GetParent())
+		{
+			if (auto parent3D = dynamic_cast<const Nova::Node3D*>(parent.get()))
+				world = parent3D->ComputeLocalMatrix() * world;
+		}
+
+		return world;
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Transform Hierarchy", "Check that world matrices combine the transforms of transform ancestors")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	const auto& root = tree->GetRootNode();
+
+	auto a = tree->CreateNode<Nova::Node3D>("A");
+	auto plain = tree->CreateNode<Nova::Node>("Plain");
+	auto b = tree->CreateNode<Nova::Node3D>("B");
+	auto c = tree->CreateNode<Nova::Node3D>("C");
+
+	a->SetPosition(Nova::Vector3(10.0f, 0.0f, 0.0f));
+	a->SetRotation(Nova::Quaternion::FromAxisAngle(Nova::Vector3(0.0f, 0.0f, 1.0f), 3.14159265f / 2.0f));
+	b->SetPosition(Nova::Vector3(1.0f, 0.0f, 0.0f));
+	b->SetScale(Nova::Vector3(2.0f, 2.0f, 2.0f));
+	c->SetPosition(Nova::Vector3(0.0f, 1.0f, 0.0f));
+
+	// Plain nodes in between don't break the hierarchy
+	root->AddChild(a);
+	a->AddChild(plain);
+	plain->AddChild(b);
+	b->AddChild(c);
+
+	REQUIRE(tree->GetTransformStorage(Nova::TransformSpace::Space3D).GetCount() == 3);
+	REQUIRE(ApproxEqual(b->GetWorldPosition(), Nova::Vector3(10.0f, 1.0f, 0.0f)));
+	REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(8.0f, 1.0f, 0.0f)));
+	REQUIRE(ApproxEqual(c->GetWorldMatrix(), ComputeWorldMatrix(*c)));
+
+	SECTION("Moving a parent moves its subtree")
+	{
+		a->SetPosition(Nova::Vector3(0.0f, 0.0f, 5.0f));
+
+		REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(-2.0f, 1.0f, 5.0f)));
+
+		a->SetPosition(Nova::Vector3(0.0f, 0.0f, 0.0f));
+		tree->UpdateTransforms();
+
+		REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(-2.0f, 1.0f, 0.0f)));
+		REQUIRE(ApproxEqual(c->GetWorldMatrix(), ComputeWorldMatrix(*c)));
+	}
+
+	SECTION("Reparenting")
+	{
+		root->AddChild(c);
+
+		REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(0.0f, 1.0f, 0.0f)));
+
+		b->AddChild(c);
+
+		REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(8.0f, 1.0f, 0.0f)));
+	}
+
+	SECTION("Leaving the tree")
+	{
+		root->RemoveChild(a);
+
+		REQUIRE(tree->GetTransformStorage(Nova::TransformSpace::Space3D).GetCount() == 0);
+		REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(8.0f, 1.0f, 0.0f)));
+
+		// Nodes keep working once the tree is gone
+		tree.reset();
+		a->SetPosition(Nova::Vector3(0.0f, 0.0f, 0.0f));
+
+		REQUIRE(ApproxEqual(c->GetWorldPosition(), Nova::Vector3(-2.0f, 1.0f, 0.0f)));
+	}
+
+	SECTION("Changes during tick")
+	{
+		auto d = tree->CreateNode<Nova::Node3D>("D");
+		d->SetPosition(Nova::Vector3(0.0f, 0.0f, 1.0f));
+
+		tree->ForEachNode([&](Nova::Node& node)
+			{
+				if (&node == a.get())
+				{
+					c->AddChild(d);
+
+					// The order is rebuilt after the traversal, so this is computed by walking up the parents
+					REQUIRE(ApproxEqual(d->GetWorldPosition(), Nova::Vector3(8.0f, 1.0f, 2.0f)));
+				}
+			});
+
+		REQUIRE(ApproxEqual(d->GetWorldPosition(), Nova::Vector3(8.0f, 1.0f, 2.0f)));
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Transform Spaces", "Check that 2D and 3D nodes only inherit transforms from their own space")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	auto parent2D = tree->CreateNode<Nova::Node2D>("Parent2D");
+	auto child3D = tree->CreateNode<Nova::Node3D>("Child3D");
+	auto child2D = tree->CreateNode<Nova::Node2D>("Child2D");
+
+	parent2D->SetPosition(Nova::Vector2(5.0, 5.0));
+	parent2D->SetRotation(3.14159265358979 / 2.0);
+	child3D->SetPosition(Nova::Vector3(1.0f, 0.0f, 0.0f));
+	child2D->SetPosition(Nova::Vector2(1.0, 0.0));
+
+	tree->GetRootNode()->AddChild(parent2D);
+	parent2D->AddChild(child3D);
+	child3D->AddChild(child2D);
+
+	REQUIRE(ApproxEqual(child3D->GetWorldPosition(), Nova::Vector3(1.0f, 0.0f, 0.0f)));
+
+	Nova::Vector2 position = child2D->GetWorldPosition();
+	REQUIRE(std::abs(position.X - 5.0) < 1e-4);
+	REQUIRE(std::abs(position.Y - 6.0) < 1e-4);
+}
+
+TEST_CASE("Nova/Core/Nodes/Random Transform Changes", "Check that cached world matrices always match walking up the parents")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::List<Nova::Ref<Nova::Node3D>> nodes;
+
+	std::mt19937 random(1234);
+	std::uniform_real_distribution<float> offset(-1.0f, 1.0f);
+
+	for (int i = 0; i < 200; i++)
+	{
+		auto node = tree->CreateNode<Nova::Node3D>("Node");
+		node->SetPosition(Nova::Vector3(offset(random), offset(random), offset(random)));
+
+		if (nodes.empty())
+			tree->GetRootNode()->AddChild(node);
+		else
+			nodes[random() % nodes.size()]->AddChild(node);
+
+		nodes.push_back(node);
+	}
+
+	for (int step = 0; step < 500; step++)
+	{
+		auto& node = nodes[random() % nodes.size()];
+
+		if (random() % 4 == 0)
+		{
+			// Move a non-root node under a node outside of its subtree
+			auto& newParent = nodes[random() % nodes.size()];
+			bool isDescendant = false;
+
+			for (Nova::Ref<Nova::Node> ancestor = newParent; ancestor; ancestor = ancestor->GetParent())
+			{
+				isDescendant |= ancestor == node;
+			}
+
+			if (!isDescendant && node != nodes[0])
+				newParent->AddChild(node);
+		}
+		else
+		{
+			node->SetRotation(Nova::Quaternion::FromAxisAngle(Nova::Vector3(0.0f, 1.0f, 0.0f), offset(random)));
+		}
+
+		if (step % 10 == 0)
+			tree->UpdateTransforms();
+
+		auto& checked = nodes[random() % nodes.size()];
+		REQUIRE(ApproxEqual(checked->GetWorldMatrix(), ComputeWorldMatrix(*checked)));
+	}
+}
+
+TEST_CASE("Nova/Core/Nodes/Benchmark Transform Update", "[.][benchmark] Measure updating world matrices of a large hierarchy")
+{
+	const size_t nodeCount = 100000;
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::List<Nova::Ref<Nova::Node3D>> nodes;
+	nodes.reserve(nodeCount);
+
+	// A bushy hierarchy, a few levels deep
+	for (size_t i = 0; i < nodeCount; i++)
+	{
+		auto node = tree->CreateNode<Nova::Node3D>("Node");
+		node->SetPosition(Nova::Vector3(1.0f, 0.0f, 0.0f));
+
+		if (i == 0)
+			tree->GetRootNode()->AddChild(node);
+		else
+			nodes[(i - 1) / 8]->AddChild(node);
+
+		nodes.push_back(node);
+	}
+
+	tree->UpdateTransforms();
+
+	float time = 0.0f;
+
+	BENCHMARK("Recursive walk, 100000 moving nodes")
+	{
+		time += 0.01f;
+
+		for (auto& node : nodes)
+		{
+			node->SetRotation(Nova::Quaternion::FromAxisAngle(Nova::Vector3(0.0f, 0.0f, 1.0f), time));
+		}
+
+		// What updating without the storage looks like: every node walks its parents
+		float sum = 0.0f;
+		for (auto& node : nodes)
+		{
+			sum += ComputeWorldMatrix(*node).Elements[12];
+		}
+
+		return sum;
+	};
+
+	BENCHMARK("Linear pass, 100000 moving nodes")
+	{
+		time += 0.01f;
+
+		for (auto& node : nodes)
+		{
+			node->SetRotation(Nova::Quaternion::FromAxisAngle(Nova::Vector3(0.0f, 0.0f, 1.0f), time));
+		}
+
+		tree->UpdateTransforms();
+	};
+
+	BENCHMARK("Linear pass, 1000 moving leaves")
+	{
+		time += 0.01f;
+
+		for (size_t i = nodeCount - 1000; i < nodeCount; i++)
+		{
+			nodes[i]->SetRotation(Nova::Quaternion::FromAxisAngle(Nova::Vector3(0.0f, 0.0f, 1.0f), time));
+		}
+
+		tree->UpdateTransforms();
+	};
+
+	BENCHMARK("Linear pass, nothing moving")
+	{
+		tree->UpdateTransforms();
+	};
+}
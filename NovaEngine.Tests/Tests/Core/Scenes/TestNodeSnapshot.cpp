@@ -0,0 +1,266 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Scenes/NodeSnapshot.h>
+#include <Nova/Core/Scenes/PackedScene.h>
+#include <Nova/Core/Scenes/Prefab.h>
+#include <Nova/Core/Scenes/SceneExceptions.h>
+#include <Nova/Core/Scenes/SceneWriter.h>
+
+#include <string>
+#include <thread>
+
+namespace
+{
+	class UnregisteredNode : public Nova::Node
+	{
+	public:
+		UnregisteredNode(const Nova::string& name) :
+			Node(name)
+		{}
+	};
+
+	const Nova::NameID HealthProperty("Health");
+	const Nova::NameID TitleProperty("Title");
+
+	/// <summary>
+	/// Builds a level of rooms, each holding a few props
+	/// </summary>
+	Nova::Ref<Nova::Node> BuildLevel(Nova::NodeTree& tree, int roomCount, int propCount)
+	{
+		auto level = tree.CreateNode<Nova::Node>("Level");
+
+		for (int i = 0; i < roomCount; i++)
+		{
+			auto room = tree.CreateNode<Nova::Node>("Room" + std::to_string(i));
+			level->AddChild(room);
+
+			for (int j = 0; j < propCount; j++)
+			{
+				auto prop = tree.CreateNode<Nova::Node2D>("Prop" + std::to_string(j));
+				prop->SetPosition(Nova::Vector2(i, j));
+				room->AddChild(prop);
+			}
+		}
+
+		tree.GetRootNode()->AddChild(level);
+
+		return level;
+	}
+
+	Nova::Node2D& GetProp(const Nova::Ref<Nova::Node>& level, size_t room, size_t prop)
+	{
+		return static_cast<Nova::Node2D&>(*level->GetChildren()[room]->GetChildren()[prop]);
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Node Snapshot", "Check that snapshots share unchanged subtrees and can be rolled back to")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	auto level = BuildLevel(*tree, 3, 4);
+
+	auto first = Nova::NodeSnapshot::Take(*level);
+
+	REQUIRE(first->GetNodeCount() == 16);
+	REQUIRE(first->GetRoot()->Children.size() == 3);
+
+	SECTION("Snapshots of an unchanged tree are the same")
+	{
+		REQUIRE(Nova::NodeSnapshot::Take(*level)->GetRoot() == first->GetRoot());
+	}
+
+	SECTION("Only the changed nodes and their ancestors are saved again")
+	{
+		GetProp(level, 1, 2).SetPosition(Nova::Vector2(100.0, 200.0));
+
+		auto second = Nova::NodeSnapshot::Take(*level);
+		const auto& firstRooms = first->GetRoot()->Children;
+		const auto& secondRooms = second->GetRoot()->Children;
+
+		REQUIRE(second->GetRoot() != first->GetRoot());
+		REQUIRE(secondRooms[0] == firstRooms[0]);
+		REQUIRE(secondRooms[1] != firstRooms[1]);
+		REQUIRE(secondRooms[2] == firstRooms[2]);
+
+		REQUIRE(secondRooms[1]->Children[1] == firstRooms[1]->Children[1]);
+		REQUIRE(secondRooms[1]->Children[2] != firstRooms[1]->Children[2]);
+	}
+
+	SECTION("Structural changes are saved")
+	{
+		auto room = level->GetChildren()[2];
+		level->RemoveChild(room);
+		level->GetChildren()[0]->AddChild(room);
+		level->GetChildren()[1]->SetTickOrder(5);
+		level->GetChildren()[0]->AddToGroup(Nova::NodeGroup("Rooms"));
+		level->GetChildren()[0]->SetProperty(HealthProperty, (int64_t)10);
+
+		auto second = Nova::NodeSnapshot::Take(*level);
+		const auto& root = *second->GetRoot();
+
+		REQUIRE(second->GetNodeCount() == 16);
+		REQUIRE(root.Children.size() == 2);
+		REQUIRE(root.Children[0]->Name == Nova::NameID("Room0"));
+		REQUIRE(root.Children[0]->Children.back()->Name == Nova::NameID("Room2"));
+		REQUIRE(root.Children[0]->Groups.test(Nova::NodeGroup("Rooms").GetIndex()));
+		REQUIRE(Nova::NodePropertyTable::Find(root.Children[0]->PropertyOverrides, HealthProperty));
+		REQUIRE(root.Children[1]->TickOrder == 5);
+
+		// The moved room didn't change, so it's shared between both snapshots
+		REQUIRE(root.Children[0]->Children.back() == first->GetRoot()->Children[2]);
+	}
+
+	SECTION("Rolling back restores the snapshot")
+	{
+		GetProp(level, 0, 0).SetPosition(Nova::Vector2(-1.0, -1.0));
+		level->GetChildren()[1]->SetName("Renamed");
+		level->GetChildren()[2]->SetIsActive(false);
+		level->RemoveChild(level->GetChildren()[0]);
+
+		tree->GetRootNode()->RemoveChild(level);
+
+		auto restored = first->Instantiate(*tree);
+		tree->GetRootNode()->AddChild(restored);
+
+		REQUIRE(restored->GetChildren().size() == 3);
+		REQUIRE(restored->GetChildren()[1]->GetName() == "Room1");
+		REQUIRE(restored->GetChildren()[2]->GetIsActive());
+		REQUIRE(GetProp(restored, 0, 0).GetPosition().X == 0.0);
+		REQUIRE(GetProp(restored, 2, 3).GetPosition().Y == 3.0);
+		REQUIRE(tree->FindNode("Level/Room2/Prop3") != nullptr);
+
+		// The restored nodes match the snapshot, so the next one shares its records
+		REQUIRE(Nova::NodeSnapshot::Take(*restored)->GetRoot() == first->GetRoot());
+	}
+
+	SECTION("Rolling back keeps overrides apart from defaults")
+	{
+		auto defaults = Nova::MakeRef<Nova::NodePropertyTable>(Nova::List<Nova::NodePropertyTable::Entry>{ { HealthProperty, (int64_t)100 } });
+		auto room = level->GetChildren()[0];
+		room->SetDefaultProperties(defaults);
+		room->SetProperty(HealthProperty, (int64_t)10);
+
+		auto snapshot = Nova::NodeSnapshot::Take(*level);
+		room->ResetProperty(HealthProperty);
+		tree->GetRootNode()->RemoveChild(level);
+
+		auto restored = snapshot->Instantiate(*tree);
+		tree->GetRootNode()->AddChild(restored);
+
+		auto& restoredRoom = *restored->GetChildren()[0];
+		REQUIRE(restoredRoom.GetDefaultProperties() == defaults);
+		REQUIRE(restoredRoom.IsPropertyOverridden(HealthProperty));
+		REQUIRE(*restoredRoom.FindProperty<int64_t>(HealthProperty) == 10);
+
+		// Resetting the restored override goes back to the default, not to the value it overrode it with
+		restoredRoom.ResetProperty(HealthProperty);
+		REQUIRE(*restoredRoom.FindProperty<int64_t>(HealthProperty) == 100);
+	}
+
+	SECTION("Snapshots save on another thread while the tree changes")
+	{
+		auto defaults = Nova::MakeRef<Nova::NodePropertyTable>(Nova::List<Nova::NodePropertyTable::Entry>{
+			{ HealthProperty, (int64_t)100 },
+			{ TitleProperty, Nova::string("Room") } });
+
+		auto room = level->GetChildren()[0];
+		room->AddToGroup(Nova::NodeGroup("Rooms"));
+		room->SetIsTickIndependent(true);
+		room->SetDefaultProperties(defaults);
+		room->SetProperty(HealthProperty, (int64_t)10);
+		GetProp(level, 2, 0).SetDefaultProperties(defaults);
+		GetProp(level, 2, 3).SetTickOrder(5);
+
+		auto snapshot = Nova::NodeSnapshot::Take(*level);
+
+		Nova::List<uint8_t> bytes;
+		std::thread saver([&]() { bytes = Nova::SceneWriter::Write(*snapshot); });
+
+		for (int i = 0; i < 100; i++)
+		{
+			GetProp(level, i % 3, i % 4).SetPosition(Nova::Vector2(i, -i));
+			level->GetChildren()[i % 3]->SetName("Room" + std::to_string(i));
+			room->SetProperty(HealthProperty, (int64_t)i);
+		}
+
+		room->RemoveFromGroup(Nova::NodeGroup("Rooms"));
+		room->SetIsTickIndependent(false);
+
+		saver.join();
+
+		auto scene = Nova::MakeRef<Nova::PackedScene>(std::move(bytes));
+		auto loaded = scene->Instantiate(*tree);
+
+		REQUIRE(loaded->GetChildren().size() == 3);
+		REQUIRE(loaded->GetChildren()[2]->GetName() == "Room2");
+		REQUIRE(GetProp(loaded, 2, 3).GetPosition().X == 2.0);
+		REQUIRE(GetProp(loaded, 2, 3).GetPosition().Y == 3.0);
+		REQUIRE(GetProp(loaded, 2, 3).GetTickOrder() == 5);
+		REQUIRE(GetProp(loaded, 2, 2).GetTickOrder() == 0);
+
+		auto& loadedRoom = *loaded->GetChildren()[0];
+		REQUIRE(loadedRoom.IsInGroup(Nova::NodeGroup("Rooms")));
+		REQUIRE_FALSE(loaded->GetChildren()[1]->IsInGroup(Nova::NodeGroup("Rooms")));
+		REQUIRE(loadedRoom.GetIsTickIndependent());
+		REQUIRE_FALSE(loaded->GetChildren()[1]->GetIsTickIndependent());
+
+		// The override is loaded as an override, on top of defaults that are loaded once and shared
+		REQUIRE(loadedRoom.IsPropertyOverridden(HealthProperty));
+		REQUIRE(*loadedRoom.FindProperty<int64_t>(HealthProperty) == 10);
+		REQUIRE(*loadedRoom.FindProperty<Nova::string>(TitleProperty) == "Room");
+		REQUIRE(*loadedRoom.GetDefaultProperties()->Find(HealthProperty) == Nova::NodePropertyValue((int64_t)100));
+		REQUIRE(GetProp(loaded, 2, 0).GetDefaultProperties() == loadedRoom.GetDefaultProperties());
+		REQUIRE_FALSE(GetProp(loaded, 2, 0).IsPropertyOverridden(HealthProperty));
+	}
+
+	SECTION("Unregistered types can't be saved")
+	{
+		level->GetChildren()[0]->AddChild(tree->CreateNode<UnregisteredNode>("Unregistered"));
+
+		REQUIRE_THROWS_AS(Nova::NodeSnapshot::Take(*level), Nova::SceneException);
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Benchmark Node Snapshot", "[.][benchmark] Measure snapshots of a large tree with a few changes")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	// 100K nodes in 1000 rooms of 100 props
+	auto level = BuildLevel(*tree, 1000, 99);
+	Nova::NodeSnapshot::Take(*level);
+
+	int frame = 0;
+
+	BENCHMARK("Snapshot after moving 100 props")
+	{
+		frame++;
+
+		for (size_t i = 0; i < 100; i++)
+		{
+			GetProp(level, (i * 7 + frame) % 1000, i % 99).SetPosition(Nova::Vector2(frame, i));
+		}
+
+		return Nova::NodeSnapshot::Take(*level);
+	};
+
+	BENCHMARK("Copy the whole tree after moving 100 props")
+	{
+		frame++;
+
+		for (size_t i = 0; i < 100; i++)
+		{
+			GetProp(level, (i * 7 + frame) % 1000, i % 99).SetPosition(Nova::Vector2(frame, i));
+		}
+
+		return Nova::MakeRef<Nova::Prefab>(*level);
+	};
+
+	auto snapshot = Nova::NodeSnapshot::Take(*level);
+
+	BENCHMARK("Write a snapshot")
+	{
+		return Nova::SceneWriter::Write(*snapshot);
+	};
+}
@@ -0,0 +1,316 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Nodes/Node3D.h>
+#include <Nova/Core/Nodes/NodeExceptions.h>
+#include <Nova/Core/Nodes/NodeTypeRegistry.h>
+#include <Nova/Core/Scenes/PackedScene.h>
+#include <Nova/Core/Scenes/PropertyStream.h>
+#include <Nova/Core/Scenes/SceneExceptions.h>
+#include <Nova/Core/Scenes/SceneWriter.h>
+
+#include <filesystem>
+#include <string.h>
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// A node type with a custom property, registered under its own name
+	/// </summary>
+	class HealthNode : public Nova::Node
+	{
+	public:
+		HealthNode(const Nova::string& name) :
+			Node(name)
+		{}
+
+		int Health = 100;
+
+		virtual void WriteProperties(Nova::PropertyWriter& writer) const override
+		{
+			Node::WriteProperties(writer);
+			writer.Write(Health);
+		}
+
+		virtual void ReadProperties(Nova::PropertyReader& reader) override
+		{
+			Node::ReadProperties(reader);
+			Health = reader.Read<int>();
+		}
+	};
+
+	/// <summary>
+	/// A node type only registered by the registry test
+	/// </summary>
+	class RegistryTestNode : public Nova::Node
+	{
+	public:
+		RegistryTestNode(const Nova::string& name) :
+			Node(name)
+		{}
+	};
+
+	class UnregisteredNode : public Nova::Node
+	{
+	public:
+		UnregisteredNode(const Nova::string& name) :
+			Node(name)
+		{}
+	};
+
+	/// <summary>
+	/// Builds a small scene with every built-in node type
+	/// </summary>
+	Nova::Ref<Nova::Node> BuildScene(Nova::NodeTree& tree)
+	{
+		auto level = tree.CreateNode<Nova::Node>("Level");
+
+		auto player = tree.CreateNode<Nova::Node2D>("Player");
+		player->SetPosition(Nova::Vector2(3.0, 4.0));
+		player->SetRotation(0.5);
+		player->SetScale(Nova::Vector2(2.0, 2.0));
+		player->SetBounds(Nova::Rect(Nova::Vector2(1.0, 2.0), Nova::Vector2(-0.5, -1.0)));
+
+		auto sword = tree.CreateNode<Nova::Node2D>("Sword");
+		sword->SetPosition(Nova::Vector2(1.0, 0.0));
+
+		auto camera = tree.CreateNode<Nova::Node3D>("Camera");
+		camera->SetPosition(Nova::Vector3(0.0f, 10.0f, -5.0f));
+		camera->SetRotation(Nova::Quaternion::FromAxisAngle(Nova::Vector3(0.0f, 1.0f, 0.0f), 1.0f));
+
+		auto boss = tree.CreateNode<HealthNode>("Boss");
+		boss->Health = 5000;
+		boss->SetIsActive(false);
+
+		level->AddChild(player);
+		player->AddChild(sword);
+		level->AddChild(camera);
+		level->AddChild(boss);
+
+		return level;
+	}
+
+	/// <summary>
+	/// Builds a scene of many small nodes, a few levels deep. If a parent is given, the scene is added to it before the rest of its nodes are
+	/// </summary>
+	Nova::Ref<Nova::Node> BuildLargeScene(Nova::NodeTree& tree, size_t nodeCount, const Nova::Ref<Nova::Node>& parent = nullptr)
+	{
+		Nova::List<Nova::Ref<Nova::Node2D>> nodes;
+		nodes.reserve(nodeCount);
+
+		for (size_t i = 0; i < nodeCount; i++)
+		{
+			auto node = tree.CreateNode<Nova::Node2D>("Node" + std::to_string(i % 64));
+			node->SetPosition(Nova::Vector2((double)i, 1.0));
+
+			if (i > 0)
+				nodes[(i - 1) / 8]->AddChild(node);
+			else if (parent)
+				parent->AddChild(node);
+
+			nodes.push_back(node);
+		}
+
+		return nodes.front();
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Packed Scene", "Check that scenes survive a round trip through the binary format")
+{
+	Nova::NodeTypeRegistry::Register<HealthNode>("HealthNode");
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	auto original = BuildScene(*tree);
+
+	auto scene = Nova::MakeRef<Nova::PackedScene>(Nova::SceneWriter::Write(*original));
+	REQUIRE(scene->GetNodeCount() == 5);
+
+	auto level = scene->Instantiate(*tree);
+
+	// Instantiated nodes aren't in a tree until they're added to one
+	REQUIRE(level->GetTree() == nullptr);
+	tree->GetRootNode()->AddChild(level);
+	tree->UpdateTransforms();
+
+	REQUIRE(tree->GetNodeCount() == 6);
+	REQUIRE(level->GetName() == "Level");
+	REQUIRE(level->GetChildren().size() == 3);
+
+	auto player = std::dynamic_pointer_cast<Nova::Node2D>(tree->FindNode("Level/Player"));
+	REQUIRE(player);
+	REQUIRE(player->GetPosition().X == 3.0);
+	REQUIRE(player->GetPosition().Y == 4.0);
+	REQUIRE(player->GetRotation() == 0.5);
+	REQUIRE(player->GetScale().X == 2.0);
+	REQUIRE(player->GetHasBounds());
+	REQUIRE(player->GetBounds().Size.Y == 2.0);
+	REQUIRE(player->GetBounds().Position.X == -0.5);
+
+	auto sword = std::dynamic_pointer_cast<Nova::Node2D>(tree->FindNode("Level/Player/Sword"));
+	REQUIRE(sword);
+	REQUIRE_FALSE(sword->GetHasBounds());
+
+	// The sword's world position comes from the loaded parent transform
+	Nova::Vector2 swordPosition = sword->GetWorldPosition();
+	REQUIRE(swordPosition.X == Approx(3.0 + 2.0 * std::cos(0.5)).epsilon(1e-5));
+	REQUIRE(swordPosition.Y == Approx(4.0 + 2.0 * std::sin(0.5)).epsilon(1e-5));
+
+	auto camera = std::dynamic_pointer_cast<Nova::Node3D>(tree->FindNode("Level/Camera"));
+	REQUIRE(camera);
+	REQUIRE(camera->GetPosition().Z == -5.0f);
+	REQUIRE(camera->GetRotation().Y == std::dynamic_pointer_cast<Nova::Node3D>(original->FindNode("Camera"))->GetRotation().Y);
+
+	auto boss = std::dynamic_pointer_cast<HealthNode>(tree->FindNode("Level/Boss"));
+	REQUIRE(boss);
+	REQUIRE(boss->Health == 5000);
+	REQUIRE_FALSE(boss->GetIsActive());
+
+	// The player is indexed once its bounds are loaded and it joins the tree
+	REQUIRE(tree->GetSpatialIndex().GetCount() == 1);
+
+	SECTION("A scene can be instantiated many times")
+	{
+		auto second = scene->Instantiate(*tree);
+		tree->GetRootNode()->AddChild(second);
+
+		REQUIRE(tree->GetNodeCount() == 11);
+		REQUIRE(second != level);
+		REQUIRE(second->FindNode("Player/Sword") != sword);
+	}
+
+	SECTION("Scenes can be mapped from files")
+	{
+		const std::string path = (std::filesystem::temp_directory_path() / "NovaTestScene.nscn").string();
+		Nova::SceneWriter::WriteToFile(*original, path);
+
+		{
+			auto fileScene = Nova::PackedScene::Load(path);
+			auto fileLevel = fileScene->Instantiate(*tree);
+
+			REQUIRE(fileLevel->FindNode("Player/Sword") != nullptr);
+			REQUIRE(std::dynamic_pointer_cast<HealthNode>(fileLevel->FindNode("Boss"))->Health == 5000);
+		}
+
+		std::filesystem::remove(path);
+	}
+
+	SECTION("Unregistered node types can't be written")
+	{
+		original->AddChild(tree->CreateNode<UnregisteredNode>("Mystery"));
+
+		REQUIRE_THROWS_AS(Nova::SceneWriter::Write(*original), Nova::SceneException);
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Invalid Scenes", "Check that corrupted scenes are rejected when loaded")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	Nova::List<uint8_t> bytes = Nova::SceneWriter::Write(*BuildLargeScene(*tree, 20));
+
+	Nova::SceneHeader header;
+	memcpy(&header, bytes.data(), sizeof(header));
+
+	auto patch = [&bytes](size_t offset, uint32_t value) { memcpy(bytes.data() + offset, &value, sizeof(value)); };
+
+	SECTION("Bad magic")
+	{
+		patch(offsetof(Nova::SceneHeader, Magic), 0x12345678);
+	}
+
+	SECTION("Unsupported version")
+	{
+		patch(offsetof(Nova::SceneHeader, Version), Nova::SceneFormat::Version + 1);
+	}
+
+	SECTION("Truncated")
+	{
+		bytes.resize(bytes.size() - 3);
+	}
+
+	SECTION("Parent after child")
+	{
+		patch(header.NodesOffset + 2 * sizeof(Nova::SceneNodeRecord) + offsetof(Nova::SceneNodeRecord, Parent), 5);
+	}
+
+	SECTION("Second root")
+	{
+		patch(header.NodesOffset + 3 * sizeof(Nova::SceneNodeRecord) + offsetof(Nova::SceneNodeRecord, Parent), Nova::SceneFormat::NoParent);
+	}
+
+	SECTION("Name outside of the string table")
+	{
+		patch(header.NodesOffset + offsetof(Nova::SceneNodeRecord, Name), header.StringCount);
+	}
+
+	SECTION("Unknown type")
+	{
+		// Point the type at a node name, which isn't a registered type
+		patch(header.TypesOffset, 1);
+	}
+
+	REQUIRE_THROWS_AS(Nova::MakeRef<Nova::PackedScene>(std::move(bytes)), Nova::SceneException);
+}
+
+TEST_CASE("Nova/Core/Scenes/Node Type Registry", "Check that registrations never change once made")
+{
+	Nova::NodeTypeRegistry::Register<RegistryTestNode>("RegistryTestNode");
+
+	const Nova::NodeTypeInfo* info = Nova::NodeTypeRegistry::Find(Nova::NameID("RegistryTestNode"));
+
+	REQUIRE(info != nullptr);
+	REQUIRE(info == Nova::NodeTypeRegistry::Find(typeid(RegistryTestNode)));
+	REQUIRE(info->Size == sizeof(RegistryTestNode));
+
+	// Registering the same class under the same name is harmless
+	Nova::NodeTypeRegistry::Register<RegistryTestNode>("RegistryTestNode");
+	REQUIRE(Nova::NodeTypeRegistry::Find(typeid(RegistryTestNode)) == info);
+
+	REQUIRE_THROWS_AS(Nova::NodeTypeRegistry::Register<RegistryTestNode>("RenamedRegistryTestNode"), Nova::NodeTypeException);
+	REQUIRE_THROWS_AS(Nova::NodeTypeRegistry::Register<Nova::Node2D>("RegistryTestNode"), Nova::NodeTypeException);
+
+	REQUIRE(Nova::NodeTypeRegistry::Find(Nova::NameID("RenamedRegistryTestNode")) == nullptr);
+	REQUIRE(Nova::NodeTypeRegistry::Find(Nova::NameID("RegistryTestNode")) == info);
+	REQUIRE(Nova::NodeTypeRegistry::Find(typeid(Nova::Node2D))->Name == Nova::NameID("Node2D"));
+}
+
+TEST_CASE("Nova/Core/Scenes/Benchmark Scene Loading", "[.][benchmark] Measure instantiating a large scene against building it in code")
+{
+	const size_t nodeCount = 100000;
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	auto scene = Nova::MakeRef<Nova::PackedScene>(Nova::SceneWriter::Write(*BuildLargeScene(*tree, nodeCount)));
+
+	BENCHMARK("Build 100000 nodes in code")
+	{
+		auto root = BuildLargeScene(*tree, nodeCount, tree->GetRootNode());
+		tree->GetRootNode()->RemoveChild(root);
+
+		return root->GetChildren().size();
+	};
+
+	BENCHMARK("Build 100000 nodes in code, then attach them")
+	{
+		auto root = BuildLargeScene(*tree, nodeCount);
+		tree->GetRootNode()->AddChild(root);
+		tree->GetRootNode()->RemoveChild(root);
+
+		return root->GetChildren().size();
+	};
+
+	BENCHMARK("Instantiate 100000 nodes from a scene")
+	{
+		auto root = scene->Instantiate(*tree);
+		tree->GetRootNode()->AddChild(root);
+		tree->GetRootNode()->RemoveChild(root);
+
+		return root->GetChildren().size();
+	};
+
+	BENCHMARK("Write 100000 nodes")
+	{
+		return Nova::SceneWriter::Write(*scene->Instantiate(*tree)).size();
+	};
+}
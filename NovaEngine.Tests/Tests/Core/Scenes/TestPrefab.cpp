@@ -0,0 +1,246 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Scenes/PackedScene.h>
+#include <Nova/Core/Scenes/Prefab.h>
+#include <Nova/Core/Scenes/PropertyStream.h>
+#include <Nova/Core/Scenes/SceneExceptions.h>
+#include <Nova/Core/Scenes/SceneWriter.h>
+
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// An enemy with a property saved through WriteProperties
+	/// </summary>
+	class EnemyNode : public Nova::Node2D
+	{
+	public:
+		EnemyNode(const Nova::string& name) :
+			Node2D(name)
+		{}
+
+		int Damage = 10;
+
+		virtual void WriteProperties(Nova::PropertyWriter& writer) const override
+		{
+			Node2D::WriteProperties(writer);
+			writer.Write(Damage);
+		}
+
+		virtual void ReadProperties(Nova::PropertyReader& reader) override
+		{
+			Node2D::ReadProperties(reader);
+			Damage = reader.Read<int>();
+		}
+	};
+
+	class UnregisteredNode : public Nova::Node
+	{
+	public:
+		UnregisteredNode(const Nova::string& name) :
+			Node(name)
+		{}
+	};
+
+	const Nova::NameID HealthProperty("Health");
+	const Nova::NameID LootProperty("Loot");
+	const Nova::NameID SpeedProperty("Speed");
+
+	/// <summary>
+	/// Builds an enemy with a few child nodes
+	/// </summary>
+	Nova::Ref<EnemyNode> BuildEnemy(Nova::NodeTree& tree)
+	{
+		Nova::NodeTypeRegistry::Register<EnemyNode>("PrefabEnemyNode");
+
+		auto enemy = tree.CreateNode<EnemyNode>("Enemy");
+		enemy->Damage = 25;
+		enemy->SetPosition(Nova::Vector2(5.0, 6.0));
+		enemy->SetProperty(HealthProperty, (int64_t)100);
+		enemy->SetProperty(LootProperty, Nova::string("Gold"));
+		enemy->AddToGroup(Nova::NodeGroup("Enemies"));
+
+		auto weapon = tree.CreateNode<Nova::Node2D>("Weapon");
+		weapon->SetTickOrder(1);
+		weapon->SetProperty(SpeedProperty, 2.5);
+		enemy->AddChild(weapon);
+
+		auto sensor = tree.CreateNode<Nova::Node2D>("Sensor");
+		sensor->SetIsActive(false);
+		enemy->AddChild(sensor);
+
+		return enemy;
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Prefab", "Check that prefab instances copy the template and share its properties")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	auto prefab = Nova::MakeRef<Nova::Prefab>(*BuildEnemy(*tree));
+
+	REQUIRE(prefab->GetNodeCount() == 3);
+
+	SECTION("Instances match the template")
+	{
+		auto instance = prefab->Instantiate(*tree);
+		tree->GetRootNode()->AddChild(instance);
+
+		auto enemy = std::dynamic_pointer_cast<EnemyNode>(instance);
+		REQUIRE(enemy);
+		REQUIRE(enemy->GetName() == "Enemy");
+		REQUIRE(enemy->Damage == 25);
+		REQUIRE(enemy->GetPosition().X == 5.0);
+		REQUIRE(enemy->GetPosition().Y == 6.0);
+		REQUIRE(enemy->IsInGroup(Nova::NodeGroup("Enemies")));
+		REQUIRE(tree->GetNodesInGroup(Nova::NodeGroup("Enemies")).size() == 1);
+
+		// Children keep their tick order
+		REQUIRE(enemy->GetChildren().size() == 2);
+		REQUIRE(enemy->GetChildren()[0]->GetName() == "Sensor");
+		REQUIRE(enemy->GetChildren()[1]->GetName() == "Weapon");
+		REQUIRE(enemy->GetChildren()[1]->GetTickOrder() == 1);
+		REQUIRE_FALSE(enemy->GetChildren()[0]->GetIsActiveInTree());
+
+		REQUIRE(*enemy->FindProperty<int64_t>(HealthProperty) == 100);
+		REQUIRE(*enemy->FindProperty<Nova::string>(LootProperty) == "Gold");
+		REQUIRE(enemy->FindProperty<double>(HealthProperty) == nullptr);
+		REQUIRE(*enemy->GetChildren()[1]->FindProperty<double>(SpeedProperty) == 2.5);
+		REQUIRE(enemy->FindProperty(SpeedProperty) == nullptr);
+	}
+
+	SECTION("Instances share their defaults until they override them")
+	{
+		Nova::List<Nova::Ref<Nova::Node>> instances;
+		prefab->Instantiate(*tree, 100, instances);
+
+		REQUIRE(instances.size() == 100);
+
+		for (const auto& instance : instances)
+		{
+			REQUIRE(instance->GetDefaultProperties() == instances[0]->GetDefaultProperties());
+			REQUIRE(instance->GetPropertyOverrideCount() == 0);
+		}
+
+		instances[1]->SetProperty(HealthProperty, (int64_t)5);
+
+		REQUIRE(*instances[1]->FindProperty<int64_t>(HealthProperty) == 5);
+		REQUIRE(*instances[1]->FindProperty<Nova::string>(LootProperty) == "Gold");
+		REQUIRE(instances[1]->IsPropertyOverridden(HealthProperty));
+		REQUIRE_FALSE(instances[1]->IsPropertyOverridden(LootProperty));
+		REQUIRE(instances[1]->GetPropertyOverrideCount() == 1);
+
+		// The shared table is never written to
+		REQUIRE(*instances[0]->FindProperty<int64_t>(HealthProperty) == 100);
+		REQUIRE(*instances[2]->FindProperty<int64_t>(HealthProperty) == 100);
+
+		instances[1]->ResetProperty(HealthProperty);
+
+		REQUIRE(*instances[1]->FindProperty<int64_t>(HealthProperty) == 100);
+		REQUIRE(instances[1]->GetPropertyOverrideCount() == 0);
+	}
+
+	SECTION("Prefabs of instances flatten their overrides")
+	{
+		auto instance = prefab->Instantiate(*tree);
+		auto unchanged = Nova::MakeRef<Nova::Prefab>(*instance)->Instantiate(*tree);
+
+		// Nothing was overridden, so the original table is shared further
+		REQUIRE(unchanged->GetDefaultProperties() == instance->GetDefaultProperties());
+
+		instance->SetProperty(HealthProperty, (int64_t)200);
+		auto changed = Nova::MakeRef<Nova::Prefab>(*instance)->Instantiate(*tree);
+
+		REQUIRE(changed->GetDefaultProperties() != instance->GetDefaultProperties());
+		REQUIRE(changed->GetPropertyOverrideCount() == 0);
+		REQUIRE(*changed->FindProperty<int64_t>(HealthProperty) == 200);
+		REQUIRE(*changed->FindProperty<Nova::string>(LootProperty) == "Gold");
+	}
+
+	SECTION("Later changes to the template don't affect the prefab")
+	{
+		auto enemy = BuildEnemy(*tree);
+		auto laterPrefab = Nova::MakeRef<Nova::Prefab>(*enemy);
+
+		enemy->Damage = 1;
+		enemy->SetName("Changed");
+		enemy->AddChild(tree->CreateNode<Nova::Node>("Extra"));
+
+		auto instance = std::dynamic_pointer_cast<EnemyNode>(laterPrefab->Instantiate(*tree));
+
+		REQUIRE(instance->Damage == 25);
+		REQUIRE(instance->GetName() == "Enemy");
+		REQUIRE(instance->GetChildren().size() == 2);
+	}
+
+	SECTION("Unregistered types can't be made into prefabs")
+	{
+		auto root = tree->CreateNode<Nova::Node>("Root");
+		root->AddChild(tree->CreateNode<UnregisteredNode>("Unregistered"));
+
+		REQUIRE_THROWS_AS(Nova::Prefab(*root), Nova::SceneException);
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Benchmark Prefab", "[.][benchmark] Measure spawning copies of an enemy subtree")
+{
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	// An enemy of 10 nodes, each with a few default properties
+	auto enemy = BuildEnemy(*tree);
+
+	for (int i = 0; i < 7; i++)
+	{
+		auto part = tree->CreateNode<Nova::Node2D>("Part" + std::to_string(i));
+		part->SetProperty(HealthProperty, (int64_t)i);
+		part->SetProperty(LootProperty, Nova::string("A longer loot table name that won't fit inline"));
+		enemy->AddChild(part);
+	}
+
+	auto prefab = Nova::MakeRef<Nova::Prefab>(*enemy);
+	auto scene = Nova::MakeRef<Nova::PackedScene>(Nova::SceneWriter::Write(*enemy));
+
+	BENCHMARK("Spawn 10K enemies of 10 nodes from a prefab")
+	{
+		Nova::List<Nova::Ref<Nova::Node>> instances;
+		prefab->Instantiate(*tree, 10000, instances);
+
+		return instances.size();
+	};
+
+	BENCHMARK("Spawn 10K enemies of 10 nodes from a packed scene")
+	{
+		Nova::List<Nova::Ref<Nova::Node>> instances;
+
+		for (int i = 0; i < 10000; i++)
+		{
+			instances.push_back(scene->Instantiate(*tree));
+		}
+
+		return instances.size();
+	};
+
+	BENCHMARK("Spawn 10K enemies of 10 nodes, copying their properties")
+	{
+		Nova::List<Nova::Ref<Nova::Node>> instances;
+
+		for (int i = 0; i < 10000; i++)
+		{
+			auto instance = scene->Instantiate(*tree);
+
+			// What every instance would allocate without shared defaults
+			for (const auto& part : instance->GetChildren())
+			{
+				part->SetProperty(HealthProperty, (int64_t)i);
+				part->SetProperty(LootProperty, Nova::string("A longer loot table name that won't fit inline"));
+			}
+
+			instances.push_back(instance);
+		}
+
+		return instances.size();
+	};
+}
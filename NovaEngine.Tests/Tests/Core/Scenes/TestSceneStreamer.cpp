@@ -0,0 +1,260 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Scenes/SceneStreamer.h>
+#include <Nova/Core/Scenes/SceneWriter.h>
+#include <Nova/Services/Jobs/JobScheduler.h>
+
+#include <filesystem>
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// Writes chunk scene files to a temporary directory, and removes them when destroyed
+	/// </summary>
+	struct ChunkFiles
+	{
+		std::filesystem::path Directory = std::filesystem::temp_directory_path() / "NovaTestChunks";
+		Nova::List<std::string> Paths;
+
+		ChunkFiles(size_t chunkCount, size_t nodesPerChunk)
+		{
+			std::filesystem::create_directories(Directory);
+			auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+			for (size_t i = 0; i < chunkCount; i++)
+			{
+				auto root = tree->CreateNode<Nova::Node2D>("Chunk" + std::to_string(i));
+
+				for (size_t j = 1; j < nodesPerChunk; j++)
+				{
+					root->AddChild(tree->CreateNode<Nova::Node2D>("Prop" + std::to_string(j)));
+				}
+
+				Paths.push_back((Directory / ("Chunk" + std::to_string(i) + ".nscn")).string());
+				Nova::SceneWriter::WriteToFile(*root, Paths.back());
+			}
+		}
+
+		~ChunkFiles()
+		{
+			std::filesystem::remove_all(Directory);
+		}
+	};
+
+	/// <summary>
+	/// Adds one chunk per file, spaced 100 units apart along the X axis
+	/// </summary>
+	Nova::List<Nova::Ref<Nova::SceneChunk>> AddChunks(Nova::SceneStreamer& streamer, const ChunkFiles& files)
+	{
+		Nova::List<Nova::Ref<Nova::SceneChunk>> chunks;
+
+		for (size_t i = 0; i < files.Paths.size(); i++)
+		{
+			chunks.push_back(streamer.AddChunk(files.Paths[i], Nova::Vector3(i * 100.0f, 0.0f, 0.0f)));
+		}
+
+		return chunks;
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Scene Streamer", "Check that chunks stream in and out around the focus")
+{
+	ChunkFiles files(10, 20);
+	Nova::Jobs::JobScheduler scheduler(2);
+
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+	auto streamer = Nova::MakeRef<Nova::SceneStreamer>(tree, scheduler, Nova::TimeSpan::FromSeconds(0.0));
+	auto chunks = AddChunks(*streamer, files);
+
+	SECTION("Chunks near the focus are loaded, and far ones unloaded")
+	{
+		streamer->StreamAround(Nova::Vector3(0.0f, 0.0f, 0.0f), 250.0, 400.0);
+		REQUIRE(streamer->GetProgress().Queued == 3);
+		REQUIRE(streamer->GetProgress().GetLoadedFraction() == 0.0);
+
+		streamer->Flush();
+
+		REQUIRE(streamer->GetProgress().Loaded == 3);
+		REQUIRE(streamer->GetProgress().GetLoadedFraction() == 1.0);
+		REQUIRE(tree->GetNodeCount() == 1 + 3 * 20);
+		REQUIRE(tree->FindNode("Chunk2/Prop19") != nullptr);
+		REQUIRE(chunks[2]->GetRoot()->GetTree() == tree);
+
+		streamer->StreamAround(Nova::Vector3(900.0f, 0.0f, 0.0f), 250.0, 400.0);
+		streamer->Flush();
+
+		REQUIRE(chunks[0]->GetState() == Nova::SceneChunkState::Unloaded);
+		REQUIRE(chunks[0]->GetRoot() == nullptr);
+		REQUIRE(chunks[9]->GetState() == Nova::SceneChunkState::Loaded);
+		REQUIRE(tree->FindNode("Chunk0") == nullptr);
+		REQUIRE(tree->FindNode("Chunk7/Prop1") != nullptr);
+
+		// Unloaded chunks leave the tree as it ticks
+		tree->Tick(0.0);
+		REQUIRE(tree->GetNodeCount() == 1 + 3 * 20);
+
+		// Chunks between the radii keep their state
+		streamer->StreamAround(Nova::Vector3(550.0f, 0.0f, 0.0f), 100.0, 400.0);
+		streamer->Flush();
+
+		REQUIRE(chunks[7]->GetState() == Nova::SceneChunkState::Loaded);
+		REQUIRE(chunks[5]->GetState() == Nova::SceneChunkState::Loaded);
+		REQUIRE(chunks[3]->GetState() == Nova::SceneChunkState::Unloaded);
+	}
+
+	SECTION("The nearest chunks load first")
+	{
+		auto oneAtATime = Nova::MakeRef<Nova::SceneStreamer>(tree, scheduler, Nova::TimeSpan::FromSeconds(0.0), 1);
+		auto ordered = AddChunks(*oneAtATime, files);
+
+		oneAtATime->SetFocus(Nova::Vector3(650.0f, 0.0f, 0.0f));
+
+		for (const auto& chunk : ordered)
+		{
+			oneAtATime->RequestLoad(chunk);
+		}
+
+		Nova::List<size_t> loadOrder;
+
+		while (loadOrder.size() < ordered.size())
+		{
+			oneAtATime->Update();
+
+			for (size_t i = 0; i < ordered.size(); i++)
+			{
+				if (ordered[i]->GetState() == Nova::SceneChunkState::Loaded && std::find(loadOrder.begin(), loadOrder.end(), i) == loadOrder.end())
+					loadOrder.push_back(i);
+			}
+		}
+
+		// Ties are broken by the order the chunks were added in
+		REQUIRE(loadOrder == Nova::List<size_t>{ 6, 7, 5, 8, 4, 9, 3, 2, 1, 0 });
+	}
+
+	SECTION("Each update attaches at least one chunk, but no more than the budget allows")
+	{
+		auto budgeted = Nova::MakeRef<Nova::SceneStreamer>(tree, scheduler, Nova::TimeSpan::FromNanoseconds(1), 10);
+		auto budgetedChunks = AddChunks(*budgeted, files);
+
+		for (const auto& chunk : budgetedChunks)
+		{
+			budgeted->RequestLoad(chunk);
+		}
+
+		// Let every load finish before the first update collects them
+		budgeted->Update();
+		scheduler.Wait(scheduler.Run([]() {}));
+
+		size_t updates = 0;
+
+		while (budgeted->GetProgress().Loaded < budgetedChunks.size())
+		{
+			const size_t before = budgeted->GetProgress().Loaded;
+			budgeted->Update();
+
+			REQUIRE(budgeted->GetProgress().Loaded - before <= 1);
+			updates++;
+		}
+
+		REQUIRE(updates >= budgetedChunks.size() - 1);
+	}
+
+	SECTION("Unloading a chunk while it loads discards it")
+	{
+		streamer->RequestLoad(chunks[4]);
+		streamer->Update();
+
+		REQUIRE(chunks[4]->GetState() == Nova::SceneChunkState::Loading);
+
+		streamer->RequestUnload(chunks[4]);
+		streamer->Flush();
+
+		REQUIRE(chunks[4]->GetState() == Nova::SceneChunkState::Unloaded);
+		REQUIRE(tree->GetNodeCount() == 1);
+
+		// Loading again reuses the scene that was read the first time
+		streamer->RequestLoad(chunks[4]);
+		streamer->Flush();
+
+		REQUIRE(chunks[4]->GetState() == Nova::SceneChunkState::Loaded);
+		REQUIRE(tree->GetNodeCount() == 21);
+	}
+
+	SECTION("Chunks are attached to their parent")
+	{
+		auto level = tree->CreateNode<Nova::Node>("Level");
+		tree->GetRootNode()->AddChild(level);
+
+		auto child = streamer->AddChunk(files.Paths[0], Nova::Vector3(), level);
+		streamer->RequestLoad(child);
+		streamer->Flush();
+
+		REQUIRE(tree->FindNode("Level/Chunk0/Prop3") != nullptr);
+
+		streamer->RemoveChunk(child);
+
+		REQUIRE(tree->FindNode("Level/Chunk0") == nullptr);
+		REQUIRE(streamer->GetChunks().size() == chunks.size());
+	}
+
+	SECTION("Missing files fail without being retried")
+	{
+		auto missing = streamer->AddChunk((files.Directory / "Missing.nscn").string(), Nova::Vector3());
+
+		streamer->StreamAround(Nova::Vector3(), 50.0, 100.0);
+		streamer->Flush();
+
+		REQUIRE(missing->GetState() == Nova::SceneChunkState::Failed);
+		REQUIRE_FALSE(missing->GetError().empty());
+		REQUIRE(chunks[0]->GetState() == Nova::SceneChunkState::Loaded);
+
+		streamer->StreamAround(Nova::Vector3(), 50.0, 100.0);
+		REQUIRE(missing->GetState() == Nova::SceneChunkState::Failed);
+		REQUIRE(streamer->GetProgress().Failed == 1);
+	}
+}
+
+TEST_CASE("Nova/Core/Scenes/Benchmark Scene Streaming", "[.][benchmark] Measure the main thread time of loading chunks")
+{
+	const size_t chunkCount = 16;
+
+	ChunkFiles files(chunkCount, 2000);
+	Nova::Jobs::JobScheduler scheduler(Nova::Jobs::JobScheduler::GetDefaultWorkerCount());
+	auto tree = Nova::MakeRef<Nova::NodeTree>();
+
+	BENCHMARK("Load and attach 16 chunks of 2000 nodes on the main thread")
+	{
+		Nova::List<Nova::Ref<Nova::Node>> roots;
+
+		for (const std::string& path : files.Paths)
+		{
+			roots.push_back(Nova::PackedScene::Load(path)->Instantiate(*tree));
+			tree->GetRootNode()->AddChild(roots.back());
+		}
+
+		for (const auto& root : roots)
+		{
+			tree->GetRootNode()->RemoveChild(root);
+		}
+
+		return roots.size();
+	};
+
+	auto streamer = Nova::MakeRef<Nova::SceneStreamer>(tree, scheduler);
+	auto chunks = AddChunks(*streamer, files);
+
+	BENCHMARK("Stream 16 chunks of 2000 nodes in and out")
+	{
+		streamer->StreamAround(Nova::Vector3(), 1e9, 2e9);
+		streamer->Flush();
+
+		streamer->StreamAround(Nova::Vector3(), -1.0, -1.0);
+		streamer->Flush();
+
+		return streamer->GetProgress().Loaded;
+	};
+}
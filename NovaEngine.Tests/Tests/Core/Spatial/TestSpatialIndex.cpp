@@ -0,0 +1,423 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Nodes/NodeTree.h>
+#include <Nova/Core/Nodes/Node2D.h>
+#include <Nova/Core/Spatial/DynamicAABBTree.h>
+#include <Nova/Core/Spatial/SpatialIndex.h>
+#include <Nova/Services/Jobs/JobScheduler.h>
+
+#include <algorithm>
+#include <random>
+
+namespace
+{
+	Nova::AABB MakeRandomBounds(std::mt19937& random, double worldSize, double maxSize)
+	{
+		std::uniform_real_distribution<double> position(0.0, worldSize);
+		std::uniform_real_distribution<double> size(0.1, maxSize);
+
+		const double x = position(random);
+		const double y = position(random);
+
+		return { x, y, x + size(random), y + size(random) };
+	}
+
+	/// <summary>
+	/// Collects every proxy whose bounds overlap, by checking them all
+	/// </summary>
+	Nova::List<int32_t> BruteForceQuery(const Nova::Map<int32_t, Nova::AABB>& proxies, const Nova::AABB& bounds)
+	{
+		Nova::List<int32_t> results;
+
+		for (const auto& [proxy, proxyBounds] : proxies)
+		{
+			if (proxyBounds.Overlaps(bounds))
+				results.push_back(proxy);
+		}
+
+		return results;
+	}
+
+	/// <summary>
+	/// A tree of nodes scattered over a square, each with a small box around its origin
+	/// </summary>
+	struct ScatteredNodes
+	{
+		Nova::Ref<Nova::NodeTree> Tree = Nova::MakeRef<Nova::NodeTree>();
+		Nova::List<Nova::Ref<Nova::Node2D>> Nodes;
+
+		ScatteredNodes(size_t count, double worldSize, uint32_t seed = 1234)
+		{
+			std::mt19937 random(seed);
+			std::uniform_real_distribution<double> position(0.0, worldSize);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				auto node = Tree->CreateNode<Nova::Node2D>("Node");
+				node->SetPosition(Nova::Vector2(position(random), position(random)));
+				node->SetBounds(Nova::Rect(Nova::Vector2(2.0, 2.0), Nova::Vector2(-1.0, -1.0)));
+
+				Tree->GetRootNode()->AddChild(node);
+				Nodes.push_back(node);
+			}
+
+			Tree->UpdateTransforms();
+		}
+
+		Nova::List<Nova::Node2D*> BruteForceQuery(const Nova::Rect& rect) const
+		{
+			const Nova::AABB bounds = Nova::AABB::FromRect(rect);
+			Nova::List<Nova::Node2D*> results;
+
+			for (const auto& node : Nodes)
+			{
+				if (Nova::AABB::FromRect(node->GetWorldBounds()).Overlaps(bounds))
+					results.push_back(node.get());
+			}
+
+			std::sort(results.begin(), results.end());
+			return results;
+		}
+	};
+
+	Nova::List<Nova::Node2D*> Sorted(Nova::List<Nova::Node2D*> nodes)
+	{
+		std::sort(nodes.begin(), nodes.end());
+		return nodes;
+	}
+}
+
+TEST_CASE("Nova/Core/Spatial/Dynamic AABB Tree", "Check that the tree stays balanced and matches a brute force search")
+{
+	std::mt19937 random(1234);
+	Nova::DynamicAABBTree tree(0.5);
+	Nova::Map<int32_t, Nova::AABB> proxies;
+
+	for (int i = 0; i < 2000; i++)
+	{
+		Nova::AABB bounds = MakeRandomBounds(random, 500.0, 5.0);
+		proxies[tree.CreateProxy(bounds, nullptr)] = bounds;
+	}
+
+	REQUIRE(tree.GetProxyCount() == 2000);
+	REQUIRE(tree.Validate());
+
+	// A balanced tree of 2000 leaves should be nowhere near as deep as a list
+	REQUIRE(tree.GetHeight() < 25);
+
+	SECTION("Queries match a brute force search")
+	{
+		for (int i = 0; i < 100; i++)
+		{
+			Nova::AABB bounds = MakeRandomBounds(random, 500.0, 50.0);
+
+			Nova::List<int32_t> results;
+			tree.Query(bounds, [&](int32_t proxy)
+				{
+					// The tree only knows the fat bounds
+					if (proxies[proxy].Overlaps(bounds))
+						results.push_back(proxy);
+
+					return true;
+				});
+
+			std::sort(results.begin(), results.end());
+			REQUIRE(results == BruteForceQuery(proxies, bounds));
+		}
+	}
+
+	SECTION("Moving and destroying proxies keeps the tree valid")
+	{
+		std::uniform_real_distribution<double> step(-2.0, 2.0);
+
+		for (int frame = 0; frame < 20; frame++)
+		{
+			for (auto& [proxy, bounds] : proxies)
+			{
+				const double dx = step(random);
+				const double dy = step(random);
+				bounds = { bounds.MinX + dx, bounds.MinY + dy, bounds.MaxX + dx, bounds.MaxY + dy };
+
+				tree.MoveProxy(proxy, bounds, dx, dy);
+				REQUIRE(tree.GetFatBounds(proxy).Contains(bounds));
+			}
+		}
+
+		for (auto it = proxies.begin(); it != proxies.end();)
+		{
+			tree.DestroyProxy(it->first);
+			it = proxies.erase(it);
+
+			if (it != proxies.end())
+				++it;
+		}
+
+		REQUIRE(tree.GetProxyCount() == proxies.size());
+		REQUIRE(tree.Validate());
+
+		Nova::AABB bounds = { 100.0, 100.0, 300.0, 300.0 };
+
+		Nova::List<int32_t> results;
+		tree.Query(bounds, [&](int32_t proxy)
+			{
+				if (proxies[proxy].Overlaps(bounds))
+					results.push_back(proxy);
+
+				return true;
+			});
+
+		std::sort(results.begin(), results.end());
+		REQUIRE(results == BruteForceQuery(proxies, bounds));
+	}
+
+	SECTION("Small moves don't touch the tree")
+	{
+		auto& [proxy, bounds] = *proxies.begin();
+		Nova::AABB moved = { bounds.MinX + 0.1, bounds.MinY, bounds.MaxX + 0.1, bounds.MaxY };
+
+		REQUIRE_FALSE(tree.MoveProxy(proxy, moved, 0.1, 0.0));
+	}
+}
+
+TEST_CASE("Nova/Core/Spatial/Spatial Index", "Check that nodes with bounds are indexed and can be queried")
+{
+	ScatteredNodes scattered(1000, 200.0);
+	Nova::SpatialIndex& index = scattered.Tree->GetSpatialIndex();
+
+	REQUIRE(index.GetCount() == 1000);
+
+	SECTION("Rect queries match a brute force search")
+	{
+		std::mt19937 random(42);
+		std::uniform_real_distribution<double> position(-10.0, 200.0);
+
+		for (int i = 0; i < 50; i++)
+		{
+			Nova::Rect rect(Nova::Vector2(20.0, 15.0), Nova::Vector2(position(random), position(random)));
+
+			Nova::List<Nova::Node2D*> results;
+			index.QueryRect(rect, results);
+
+			REQUIRE(Sorted(results) == scattered.BruteForceQuery(rect));
+		}
+
+		Nova::List<Nova::Node2D*> results;
+		index.QueryRect(Nova::Recti(Nova::Vector2i(30, 30), Nova::Vector2i(50, 50)), results);
+
+		REQUIRE(Sorted(results) == scattered.BruteForceQuery(Nova::Rect(Nova::Vector2(30.0, 30.0), Nova::Vector2(50.0, 50.0))));
+	}
+
+	SECTION("Point queries find the nodes under the point")
+	{
+		Nova::Node2D* node = scattered.Nodes[10].get();
+		Nova::Vector2 position = node->GetWorldPosition();
+
+		Nova::List<Nova::Node2D*> results;
+		index.QueryPoint(Nova::Vector2(position.X + 0.5, position.Y - 0.5), results);
+
+		REQUIRE(std::find(results.begin(), results.end(), node) != results.end());
+
+		for (Nova::Node2D* result : results)
+		{
+			REQUIRE(Nova::AABB::FromRect(result->GetWorldBounds()).Contains(position.X + 0.5, position.Y - 0.5));
+		}
+	}
+
+	SECTION("Ray casts find the closest node")
+	{
+		auto target = scattered.Tree->CreateNode<Nova::Node2D>("Target");
+		target->SetPosition(Nova::Vector2(-50.0, -50.0));
+		target->SetBounds(Nova::Rect(Nova::Vector2(4.0, 4.0), Nova::Vector2(-2.0, -2.0)));
+
+		auto blocker = scattered.Tree->CreateNode<Nova::Node2D>("Blocker");
+		blocker->SetPosition(Nova::Vector2(-50.0, -80.0));
+		blocker->SetBounds(Nova::Rect(Nova::Vector2(4.0, 4.0), Nova::Vector2(-2.0, -2.0)));
+
+		scattered.Tree->GetRootNode()->AddChild(target);
+		scattered.Tree->GetRootNode()->AddChild(blocker);
+		scattered.Tree->UpdateTransforms();
+
+		// Straight down the column both nodes are in, hitting the blocker first
+		Nova::SpatialRayHit hit;
+		REQUIRE(index.RayCast(Nova::Vector2(-50.0, -100.0), Nova::Vector2(0.0, 1.0), 100.0, hit));
+		REQUIRE(hit.NodePtr == blocker.get());
+		REQUIRE(hit.Distance == Approx(18.0));
+
+		Nova::List<Nova::SpatialRayHit> hits;
+		index.QueryRay(Nova::Vector2(-50.0, -100.0), Nova::Vector2(0.0, 1.0), 100.0, hits);
+
+		REQUIRE(hits.size() == 2);
+		REQUIRE(hits[0].NodePtr == blocker.get());
+		REQUIRE(hits[1].NodePtr == target.get());
+		REQUIRE(hits[1].Distance == Approx(48.0));
+
+		// Too short to reach either
+		REQUIRE_FALSE(index.RayCast(Nova::Vector2(-50.0, -100.0), Nova::Vector2(0.0, 1.0), 10.0, hit));
+	}
+
+	SECTION("Moving a parent moves its children's bounds")
+	{
+		auto parent = scattered.Tree->CreateNode<Nova::Node2D>("Parent");
+		auto child = scattered.Tree->CreateNode<Nova::Node2D>("Child");
+		child->SetPosition(Nova::Vector2(10.0, 0.0));
+		child->SetBounds(Nova::Rect(Nova::Vector2(2.0, 2.0), Nova::Vector2(-1.0, -1.0)));
+
+		parent->AddChild(child);
+		scattered.Tree->GetRootNode()->AddChild(parent);
+
+		parent->SetPosition(Nova::Vector2(1000.0, 1000.0));
+		scattered.Tree->UpdateTransforms();
+
+		Nova::List<Nova::Node2D*> results;
+		index.QueryPoint(Nova::Vector2(1010.0, 1000.0), results);
+		REQUIRE(results == Nova::List<Nova::Node2D*>{ child.get() });
+
+		// Rotating the parent by a quarter turn swings the child round to above it
+		parent->SetRotation(3.14159265358979 / 2.0);
+		scattered.Tree->UpdateTransforms();
+
+		results.clear();
+		index.QueryPoint(Nova::Vector2(1010.0, 1000.0), results);
+		REQUIRE(results.empty());
+
+		index.QueryPoint(Nova::Vector2(1000.0, 1010.0), results);
+		REQUIRE(results == Nova::List<Nova::Node2D*>{ child.get() });
+	}
+
+	SECTION("Nodes leave the index when removed or when their bounds are cleared")
+	{
+		scattered.Tree->GetRootNode()->RemoveChild(scattered.Nodes[0]);
+		scattered.Nodes[1]->ClearBounds();
+
+		REQUIRE(index.GetCount() == 998);
+
+		scattered.Tree->GetRootNode()->AddChild(scattered.Nodes[0]);
+		scattered.Nodes[1]->SetBounds(Nova::Rect(Nova::Vector2(2.0, 2.0), Nova::Vector2(-1.0, -1.0)));
+
+		REQUIRE(index.GetCount() == 1000);
+
+		scattered.Nodes.clear();
+		scattered.Tree->GetRootNode()->RemoveChild(scattered.Tree->GetRootNode()->GetChildren().front());
+		scattered.Tree->UpdateTransforms();
+
+		REQUIRE(index.GetCount() == 999);
+		REQUIRE(index.GetTree().Validate());
+	}
+
+	SECTION("Batched queries match single queries")
+	{
+		Nova::Jobs::JobScheduler scheduler(4);
+
+		Nova::List<Nova::Rect> rects;
+
+		for (int i = 0; i < 500; i++)
+		{
+			rects.push_back(Nova::Rect(Nova::Vector2(10.0, 10.0), Nova::Vector2(i % 20 * 10.0, i / 20 * 8.0)));
+		}
+
+		Nova::List<Nova::List<Nova::Node2D*>> results;
+		index.QueryRectBatch(scheduler, rects, results);
+
+		REQUIRE(results.size() == rects.size());
+
+		for (size_t i = 0; i < rects.size(); i++)
+		{
+			REQUIRE(Sorted(results[i]) == scattered.BruteForceQuery(rects[i]));
+		}
+	}
+}
+
+TEST_CASE("Nova/Core/Spatial/Benchmark Spatial Queries", "[.][benchmark] Measure updating and querying many moving nodes")
+{
+	const size_t nodeCount = 50000;
+	const double worldSize = 2000.0;
+
+	ScatteredNodes scattered(nodeCount, worldSize);
+	Nova::SpatialIndex& index = scattered.Tree->GetSpatialIndex();
+
+	std::mt19937 random(99);
+	std::uniform_real_distribution<double> position(0.0, worldSize);
+	std::uniform_real_distribution<double> step(-0.5, 0.5);
+
+	Nova::List<Nova::Vector2> velocities;
+
+	for (size_t i = 0; i < nodeCount; i++)
+	{
+		velocities.push_back(Nova::Vector2(step(random), step(random)));
+	}
+
+	Nova::List<Nova::Rect> rects;
+
+	for (int i = 0; i < 1000; i++)
+	{
+		rects.push_back(Nova::Rect(Nova::Vector2(50.0, 50.0), Nova::Vector2(position(random), position(random))));
+	}
+
+	BENCHMARK("Move 50000 nodes and update the index")
+	{
+		for (size_t i = 0; i < nodeCount; i++)
+		{
+			const Nova::Vector2& current = scattered.Nodes[i]->GetPosition();
+			scattered.Nodes[i]->SetPosition(Nova::Vector2(current.X + velocities[i].X, current.Y + velocities[i].Y));
+		}
+
+		scattered.Tree->UpdateTransforms();
+	};
+
+	Nova::List<Nova::Node2D*> results;
+
+	BENCHMARK("1000 rect queries, brute force")
+	{
+		size_t found = 0;
+
+		for (const Nova::Rect& rect : rects)
+		{
+			const Nova::AABB bounds = Nova::AABB::FromRect(rect);
+
+			for (const auto& node : scattered.Nodes)
+			{
+				if (Nova::AABB::FromRect(node->GetWorldBounds()).Overlaps(bounds))
+					found++;
+			}
+		}
+
+		return found;
+	};
+
+	BENCHMARK("1000 rect queries, spatial index")
+	{
+		size_t found = 0;
+
+		for (const Nova::Rect& rect : rects)
+		{
+			results.clear();
+			index.QueryRect(rect, results);
+			found += results.size();
+		}
+
+		return found;
+	};
+
+	Nova::Jobs::JobScheduler scheduler(Nova::Jobs::JobScheduler::GetDefaultWorkerCount());
+	Nova::List<Nova::List<Nova::Node2D*>> batchResults;
+
+	BENCHMARK("1000 rect queries, batched on workers")
+	{
+		index.QueryRectBatch(scheduler, rects, batchResults);
+		return batchResults.size();
+	};
+
+	BENCHMARK("1000 ray casts, spatial index")
+	{
+		size_t hits = 0;
+		Nova::SpatialRayHit hit;
+
+		for (const Nova::Rect& rect : rects)
+		{
+			hits += index.RayCast(rect.Position, Nova::Vector2(1.0, 0.3), 200.0, hit);
+		}
+
+		return hits;
+	};
+}
@@ -0,0 +1,60 @@
+#include <catch.hpp>
+
+#include <Nova/Core/Threading/CpuTopology.h>
+
+#include <algorithm>
+
+TEST_CASE("Nova/Core/Threading/CPU Topology", "Check that the detected topology is consistent")
+{
+	const Nova::CpuTopology& topology = Nova::CpuTopology::Get();
+
+	REQUIRE(topology.GetProcessorCount() > 0);
+	REQUIRE(topology.GetCoreCount() > 0);
+	REQUIRE(topology.GetCoreCount() <= topology.GetProcessorCount());
+	REQUIRE(topology.GetNumaNodeCount() > 0);
+
+	SECTION("Every processor belongs to a core and node")
+	{
+		size_t nodeProcessors = 0;
+
+		for (uint32_t node = 0; node < topology.GetNumaNodeCount(); node++)
+		{
+			nodeProcessors += topology.GetNodeProcessors(node).size();
+		}
+
+		REQUIRE(nodeProcessors == topology.GetProcessorCount());
+
+		for (size_t i = 0; i < topology.GetProcessorCount(); i++)
+		{
+			REQUIRE(topology.GetProcessors()[i].Index == i);
+			REQUIRE(topology.GetProcessors()[i].Core < topology.GetCoreCount());
+		}
+	}
+
+	SECTION("Placement order uses each processor once, with separate cores first")
+	{
+		Nova::List<uint32_t> order = topology.GetPlacementOrder();
+		REQUIRE(order.size() == topology.GetProcessorCount());
+
+		Nova::List<uint32_t> firstCores;
+		for (size_t i = 0; i < topology.GetCoreCount(); i++)
+		{
+			firstCores.push_back(topology.GetProcessors()[order[i]].Core);
+		}
+
+		std::sort(firstCores.begin(), firstCores.end());
+		REQUIRE(std::unique(firstCores.begin(), firstCores.end()) == firstCores.end());
+
+		std::sort(order.begin(), order.end());
+		REQUIRE(std::unique(order.begin(), order.end()) == order.end());
+	}
+
+	SECTION("Affinity modes parse")
+	{
+		Nova::WorkerAffinity affinity = Nova::WorkerAffinity::None;
+
+		REQUIRE(Nova::CpuTopology::ParseWorkerAffinity("numa", affinity));
+		REQUIRE(affinity == Nova::WorkerAffinity::NumaNode);
+		REQUIRE_FALSE(Nova::CpuTopology::ParseWorkerAffinity("sockets", affinity));
+	}
+}
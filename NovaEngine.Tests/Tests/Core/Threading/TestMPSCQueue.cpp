@@ -0,0 +1,99 @@
+#include <catch.hpp>
+
+#include <Nova/Core/Threading/MPSCQueue.h>
+#include <Nova/Core/Types/List.h>
+
+#include <atomic>
+#include <stdint.h>
+#include <string>
+#include <thread>
+
+TEST_CASE("Nova/Core/Threading/MPSC Queue", "Check that values come out in the order they were pushed")
+{
+	Nova::MPSCQueue<std::string> queue;
+	std::string value;
+
+	REQUIRE(queue.IsEmpty());
+	REQUIRE_FALSE(queue.Pop(value));
+
+	queue.Push("First");
+	queue.Push("Second");
+
+	REQUIRE_FALSE(queue.IsEmpty());
+	REQUIRE(queue.Pop(value));
+	REQUIRE(value == "First");
+
+	queue.Push("Third");
+
+	REQUIRE(queue.Pop(value));
+	REQUIRE(value == "Second");
+	REQUIRE(queue.Pop(value));
+	REQUIRE(value == "Third");
+	REQUIRE(queue.IsEmpty());
+
+	// Values left in the queue are freed with it
+	queue.Push("Left behind");
+}
+
+TEST_CASE("Nova/Core/Threading/MPSC Queue Contention", "Check that values from many producers all arrive, each producer's in order")
+{
+	constexpr uint64_t producerCount = 4;
+	constexpr uint64_t valuesPerProducer = 100000;
+
+	Nova::MPSCQueue<uint64_t> queue;
+	std::atomic<bool> isGo = false;
+	Nova::List<std::thread> producers;
+
+	for (uint64_t producer = 0; producer < producerCount; producer++)
+	{
+		producers.emplace_back([&, producer]()
+			{
+				while (!isGo.load())
+					std::this_thread::yield();
+
+				for (uint64_t i = 0; i < valuesPerProducer; i++)
+				{
+					queue.Push(producer << 32 | i);
+				}
+			});
+	}
+
+	isGo = true;
+
+	// Pop while the producers are still pushing
+	Nova::List<uint64_t> nextValues(producerCount, 0);
+	uint64_t popped = 0;
+	bool isInOrder = true;
+
+	while (popped < producerCount * valuesPerProducer)
+	{
+		uint64_t value;
+
+		if (!queue.Pop(value))
+		{
+			std::this_thread::yield();
+			continue;
+		}
+
+		const uint64_t producer = value >> 32;
+		isInOrder &= producer < producerCount && (value & 0xFFFFFFFF) == nextValues[producer];
+
+		if (producer < producerCount)
+			nextValues[producer]++;
+
+		popped++;
+	}
+
+	for (std::thread& producer : producers)
+	{
+		producer.join();
+	}
+
+	REQUIRE(isInOrder);
+	REQUIRE(queue.IsEmpty());
+
+	for (uint64_t count : nextValues)
+	{
+		REQUIRE(count == valuesPerProducer);
+	}
+}
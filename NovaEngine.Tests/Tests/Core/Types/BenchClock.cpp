@@ -0,0 +1,132 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Core/Types/Clock.h>
+#include <Nova/Core/Types/DateTime.h>
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+TEST_CASE("Nova/Core/Types/Clock Monotonic", "Check that the clock never goes backwards")
+{
+	int64_t last = Nova::Clock::GetNanoseconds();
+
+	for (int i = 0; i < 100000; i++)
+	{
+		int64_t now = Nova::Clock::GetNanoseconds();
+
+		REQUIRE(now >= last);
+		last = now;
+	}
+}
+
+TEST_CASE("Nova/Core/Types/Clock Source Changes", "Check that threads reading the clock stay monotonic while its source changes")
+{
+	REQUIRE(Nova::Clock::GetTickFrequency() > 1);
+
+	std::atomic<bool> isDone = false;
+	std::atomic<int> backwardsCount = 0;
+	std::vector<std::thread> readers;
+
+	for (int i = 0; i < 4; i++)
+	{
+		readers.emplace_back([&]()
+			{
+				int64_t last = Nova::Clock::GetNanoseconds();
+
+				while (!isDone.load())
+				{
+					int64_t now = Nova::Clock::GetNanoseconds();
+
+					if (now < last)
+						backwardsCount++;
+
+					last = now;
+				}
+			});
+	}
+
+	const Nova::ClockSource original = Nova::Clock::GetSource();
+
+	for (int i = 0; i < 4; i++)
+	{
+		// Falls back to the performance counter on machines without an invariant cycle counter
+		REQUIRE(Nova::Clock::SetSource(Nova::ClockSource::CycleCounter) == Nova::Clock::IsCycleCounterInvariant());
+		REQUIRE(Nova::Clock::SetSource(Nova::ClockSource::PerformanceCounter));
+	}
+
+	Nova::Clock::SetSource(original);
+
+	isDone = true;
+
+	for (std::thread& reader : readers)
+	{
+		reader.join();
+	}
+
+	REQUIRE(backwardsCount == 0);
+}
+
+TEST_CASE("Nova/Core/Types/Clock Sub-Microsecond Resolution", "Check that TimeSpans keep nanosecond precision")
+{
+	Nova::TimeSpan span = Nova::TimeSpan::FromNanoseconds(1500);
+
+	REQUIRE(span.GetNanoseconds() == 1500);
+	REQUIRE(span.GetMicroseconds() == 1);
+	REQUIRE(span.GetTotalMicroseconds() == 1.5);
+	REQUIRE((Nova::DateTime::FromNanoseconds(2000) - Nova::DateTime::FromNanoseconds(500)).GetNanoseconds() == 1500);
+}
+
+TEST_CASE("Nova/Core/Types/Clock Early Times", "Check that times shortly before the first reads of the clock can be represented")
+{
+	const Nova::DateTime now = Nova::DateTime::Now();
+	const Nova::DateTime earlier = now - Nova::TimeSpan::FromSeconds(1.0);
+
+	REQUIRE((now - earlier) == Nova::TimeSpan::FromSeconds(1.0));
+	REQUIRE((earlier - Nova::DateTime::FromNanoseconds(0)).GetNanoseconds() > 0);
+}
+
+TEST_CASE("Nova/Core/Types/Clock Per-Call Cost", "[!benchmark]")
+{
+	BENCHMARK("std::chrono::steady_clock::now")
+	{
+		return std::chrono::time_point_cast<std::chrono::microseconds>(std::chrono::steady_clock::now()).time_since_epoch().count();
+	};
+
+	BENCHMARK("Clock::GetTicks (performance counter)")
+	{
+		return Nova::Clock::GetTicks();
+	};
+
+	BENCHMARK("Clock::GetCycles")
+	{
+		return Nova::Clock::GetCycles();
+	};
+
+	BENCHMARK("Clock::GetNanoseconds (performance counter)")
+	{
+		return Nova::Clock::GetNanoseconds();
+	};
+
+	BENCHMARK("DateTime::Now (performance counter)")
+	{
+		return Nova::DateTime::Now();
+	};
+
+	if (Nova::Clock::SetSource(Nova::ClockSource::CycleCounter))
+	{
+		BENCHMARK("Clock::GetNanoseconds (cycle counter)")
+		{
+			return Nova::Clock::GetNanoseconds();
+		};
+
+		BENCHMARK("DateTime::Now (cycle counter)")
+		{
+			return Nova::DateTime::Now();
+		};
+
+		Nova::Clock::SetSource(Nova::ClockSource::PerformanceCounter);
+	}
+}
\ No newline at end of file
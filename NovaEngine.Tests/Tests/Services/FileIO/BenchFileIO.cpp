@@ -0,0 +1,276 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Services/FileIO/ThreadPool/ThreadPoolFileIOBackend.h>
+#include <Nova/Services/FileIO/CompletionPort/CompletionPortFileIOBackend.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+
+namespace
+{
+	/// <summary>
+	/// Writes a set of files filled with a known pattern to a temporary folder, and deletes them afterwards
+	/// </summary>
+	struct TestFiles
+	{
+		TestFiles(size_t count, size_t size) :
+			Folder(std::filesystem::temp_directory_path() / "NovaFileIOTests")
+		{
+			std::filesystem::create_directories(Folder);
+
+			for (size_t i = 0; i < count; i++)
+			{
+				Nova::string path = (Folder / ("File" + std::to_string(i) + ".bin")).string();
+				std::ofstream file(path, std::ios::binary);
+
+				for (size_t j = 0; j < size; j++)
+				{
+					file.put(GetByte(i, j));
+				}
+
+				Paths.push_back(path);
+			}
+		}
+
+		~TestFiles()
+		{
+			std::filesystem::remove_all(Folder);
+		}
+
+		static char GetByte(size_t file, size_t offset) { return (char)((file * 31 + offset) & 0xFF); }
+
+		std::filesystem::path Folder;
+		Nova::List<Nova::string> Paths;
+	};
+
+	/// <summary>
+	/// Collects reads from a backend's completion callback
+	/// </summary>
+	struct Completions
+	{
+		void Add(const Nova::Ref<Nova::FileIO::FileReadRequest>& request)
+		{
+			std::lock_guard lock(Mutex);
+
+			Requests.push_back(request);
+			Condition.notify_all();
+		}
+
+		void WaitFor(size_t count)
+		{
+			std::unique_lock lock(Mutex);
+			Condition.wait(lock, [&]() { return Requests.size() >= count; });
+		}
+
+		std::mutex Mutex;
+		std::condition_variable Condition;
+		Nova::List<Nova::Ref<Nova::FileIO::FileReadRequest>> Requests;
+	};
+
+	Nova::List<Nova::Ref<Nova::FileIO::FileReadRequest>> MakeRequests(const Nova::List<Nova::FileIO::FileReadParams>& params, const Nova::Ref<Nova::FileIO::FileBufferPool>& pool)
+	{
+		Nova::List<Nova::Ref<Nova::FileIO::FileReadRequest>> requests;
+
+		for (const auto& readParams : params)
+		{
+			requests.push_back(Nova::MakeRef<Nova::FileIO::FileReadRequest>(readParams, pool));
+		}
+
+		return requests;
+	}
+}
+
+TEST_CASE("Nova/Services/FileIO/Thread Pool Reads", "Check that the thread pool backend reads the right data and handles errors and cancellation")
+{
+	using namespace Nova::FileIO;
+
+	TestFiles files(4, 10000);
+	auto pool = Nova::MakeRef<FileBufferPool>();
+	Completions completions;
+
+	SECTION("Whole files and ranges")
+	{
+		ThreadPoolFileIOBackend backend([&](const auto& request) { completions.Add(request); }, 2);
+
+		Nova::List<FileReadParams> params;
+		for (const auto& path : files.Paths)
+		{
+			params.emplace_back(path);
+		}
+		params.emplace_back(files.Paths[1], 9000, 5000);
+
+		auto requests = MakeRequests(params, pool);
+		backend.Submit(requests);
+		completions.WaitFor(requests.size());
+
+		for (size_t i = 0; i < files.Paths.size(); i++)
+		{
+			REQUIRE(requests[i]->GetStatus() == FileReadStatus::Completed);
+			REQUIRE(requests[i]->GetBytesRead() == 10000);
+
+			for (size_t j = 0; j < 10000; j++)
+			{
+				REQUIRE((char)requests[i]->GetData()[j] == TestFiles::GetByte(i, j));
+			}
+		}
+
+		// The range runs past the end of the file, so only the rest of the file is read
+		const auto& range = requests.back();
+		REQUIRE(range->GetStatus() == FileReadStatus::Completed);
+		REQUIRE(range->GetBytesRead() == 1000);
+		REQUIRE((char)range->GetData()[0] == TestFiles::GetByte(1, 9000));
+	}
+
+	SECTION("Missing files fail")
+	{
+		ThreadPoolFileIOBackend backend([&](const auto& request) { completions.Add(request); }, 1);
+
+		auto requests = MakeRequests({ FileReadParams((files.Folder / "Missing.bin").string()) }, pool);
+		backend.Submit(requests);
+		completions.WaitFor(1);
+
+		REQUIRE(requests[0]->GetStatus() == FileReadStatus::Failed);
+		REQUIRE_FALSE(requests[0]->GetError().empty());
+	}
+
+	SECTION("Queued reads are cancelled when the backend is destroyed")
+	{
+		Nova::List<Nova::Ref<FileReadRequest>> requests;
+
+		{
+			ThreadPoolFileIOBackend backend([&](const auto& request) { completions.Add(request); }, 1);
+
+			Nova::List<FileReadParams> params;
+			for (size_t i = 0; i < 64; i++)
+			{
+				params.emplace_back(files.Paths[i % files.Paths.size()]);
+			}
+
+			requests = MakeRequests(params, pool);
+			backend.Submit(requests);
+		}
+
+		// Every read is reported exactly once, whether it finished or not
+		REQUIRE(completions.Requests.size() == requests.size());
+
+		for (const auto& request : requests)
+		{
+			REQUIRE(request->IsDone());
+			REQUIRE(request->GetStatus() != FileReadStatus::Failed);
+		}
+	}
+}
+
+TEST_CASE("Nova/Services/FileIO/Request Priorities", "Check that queued reads are issued by priority and then in submission order")
+{
+	using namespace Nova::FileIO;
+
+	auto pool = Nova::MakeRef<FileBufferPool>();
+	FileRequestQueue queue;
+
+	Nova::List<int> priorities = { 0, 5, -1, 5, 2, 0 };
+	Nova::List<Nova::Ref<FileReadRequest>> requests;
+
+	for (int priority : priorities)
+	{
+		FileReadParams params("File.bin");
+		params.Priority = priority;
+
+		requests.push_back(Nova::MakeRef<FileReadRequest>(params, pool));
+	}
+
+	queue.Push(requests);
+	REQUIRE(queue.Remove(requests[4]));
+
+	Nova::List<Nova::Ref<FileReadRequest>> expected = { requests[1], requests[3], requests[0], requests[5], requests[2] };
+
+	for (const auto& request : expected)
+	{
+		Nova::Ref<FileReadRequest> popped;
+
+		REQUIRE(queue.TryPop(popped));
+		REQUIRE(popped == request);
+	}
+
+	Nova::Ref<FileReadRequest> popped;
+	REQUIRE_FALSE(queue.TryPop(popped));
+}
+
+TEST_CASE("Nova/Services/FileIO/Benchmark Reads", "[.][benchmark] Compare synchronous reads with batched asynchronous reads on each backend")
+{
+	using namespace Nova::FileIO;
+
+	const size_t fileCount = 64;
+	const size_t fileSize = 256 * 1024;
+
+	TestFiles files(fileCount, fileSize);
+	auto pool = Nova::MakeRef<FileBufferPool>(fileCount);
+
+	BENCHMARK("Synchronous ifstream reads")
+	{
+		Nova::List<char> buffer(fileSize);
+		size_t bytesRead = 0;
+
+		for (const auto& path : files.Paths)
+		{
+			std::ifstream file(path, std::ios::binary);
+			file.read(buffer.data(), fileSize);
+			bytesRead += (size_t)file.gcount();
+		}
+
+		return bytesRead;
+	};
+
+	for (size_t threadCount : { 1, 2, 4, 8 })
+	{
+		Completions completions;
+		ThreadPoolFileIOBackend backend([&](const auto& request) { completions.Add(request); }, threadCount);
+
+		Nova::List<FileReadParams> params;
+		for (const auto& path : files.Paths)
+		{
+			params.emplace_back(path);
+		}
+
+		BENCHMARK("Thread pool batch, " + std::to_string(threadCount) + " threads")
+		{
+			completions.Requests.clear();
+
+			backend.Submit(MakeRequests(params, pool));
+			completions.WaitFor(fileCount);
+
+			return completions.Requests.size();
+		};
+	}
+
+#ifdef PLATFORM_WINDOWS
+	// The completion port backend is the default on Windows, so it is compared against the thread pool on the same batch
+	for (size_t maxInFlight : { 8, 16, 32, 64 })
+	{
+		Completions completions;
+		CompletionPortFileIOBackend backend([&](const auto& request) { completions.Add(request); }, maxInFlight);
+
+		Nova::List<FileReadParams> params;
+		for (const auto& path : files.Paths)
+		{
+			params.emplace_back(path);
+		}
+
+		BENCHMARK("Completion port batch, " + std::to_string(maxInFlight) + " in flight")
+		{
+			completions.Requests.clear();
+
+			backend.Submit(MakeRequests(params, pool));
+			completions.WaitFor(fileCount);
+
+			return completions.Requests.size();
+		};
+	}
+#endif
+}
@@ -0,0 +1,163 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Services/Jobs/JobScheduler.h>
+
+#include <atomic>
+#include <cmath>
+#include <string>
+#include <thread>
+
+namespace
+{
+	// A chunk of pure ALU work with no shared state, so it should scale with the number of workers
+	double BusyWork(int seed)
+	{
+		double value = (double)seed;
+
+		for (int i = 0; i < 20000; i++)
+		{
+			value = std::sin(value) + std::sqrt(value * value + 1.0);
+		}
+
+		return value;
+	}
+}
+
+TEST_CASE("Nova/Services/Jobs/Job Counter", "Check that counters track jobs and run continuations")
+{
+	Nova::Jobs::JobScheduler scheduler(4);
+
+	std::atomic<int> jobsRun = 0;
+	std::atomic<int> continuationsRun = 0;
+	std::atomic<int> jobsRunBeforeContinuation = 0;
+
+	Nova::Ref<Nova::Jobs::JobCounter> counter = Nova::MakeRef<Nova::Jobs::JobCounter>();
+	Nova::Ref<Nova::Jobs::JobCounter> continuationCounter = Nova::MakeRef<Nova::Jobs::JobCounter>();
+
+	for (int i = 0; i < 1000; i++)
+	{
+		scheduler.Run([&jobsRun]() { jobsRun++; }, counter);
+	}
+
+	scheduler.ContinueWith(counter, [&jobsRun, &continuationsRun, &jobsRunBeforeContinuation]()
+		{
+			jobsRunBeforeContinuation = jobsRun.load();
+			continuationsRun++;
+		}, continuationCounter);
+
+	scheduler.Wait(continuationCounter);
+
+	REQUIRE(counter->IsComplete());
+	REQUIRE(jobsRun == 1000);
+	REQUIRE(continuationsRun == 1);
+	REQUIRE(jobsRunBeforeContinuation == 1000);
+}
+
+TEST_CASE("Nova/Services/Jobs/Waiting Jobs", "Check that jobs can wait for child jobs without blocking their worker")
+{
+	// Fewer workers than waiting jobs, so the workers must run children while their parents are suspended
+	Nova::Jobs::JobScheduler scheduler(2);
+
+	std::atomic<int> childrenRun = 0;
+	std::atomic<int> parentsFinished = 0;
+	std::atomic<bool> childrenDoneAfterWait = true;
+
+	Nova::Ref<Nova::Jobs::JobCounter> parentCounter = Nova::MakeRef<Nova::Jobs::JobCounter>();
+
+	for (int i = 0; i < 16; i++)
+	{
+		scheduler.Run([&]()
+			{
+				Nova::Ref<Nova::Jobs::JobCounter> childCounter = Nova::MakeRef<Nova::Jobs::JobCounter>();
+
+				for (int j = 0; j < 100; j++)
+				{
+					scheduler.Run([&childrenRun]() { childrenRun++; }, childCounter);
+				}
+
+				scheduler.Wait(childCounter);
+
+				if (!childCounter->IsComplete())
+					childrenDoneAfterWait = false;
+
+				parentsFinished++;
+			}, parentCounter);
+	}
+
+	scheduler.Wait(parentCounter);
+
+	REQUIRE(parentsFinished == 16);
+	REQUIRE(childrenRun == 1600);
+	REQUIRE(childrenDoneAfterWait);
+}
+
+TEST_CASE("Nova/Services/Jobs/Reused Jobs", "Check that jobs the caller owns can be queued again once they have finished")
+{
+	Nova::Jobs::JobScheduler scheduler(4);
+
+	std::atomic<int> jobsRun = 0;
+	Nova::Ref<Nova::Jobs::JobCounter> counter = Nova::MakeRef<Nova::Jobs::JobCounter>();
+
+	Nova::List<Nova::Jobs::Job> jobs;
+	Nova::List<Nova::Jobs::Job*> batch;
+	jobs.reserve(8);
+
+	for (int i = 0; i < 8; i++)
+	{
+		jobs.emplace_back([&jobsRun]() { jobsRun++; }, counter, false);
+		batch.push_back(&jobs.back());
+	}
+
+	for (int frame = 0; frame < 100; frame++)
+	{
+		scheduler.Run(batch);
+		scheduler.Wait(counter);
+
+		// A job can only be queued again once it has finished
+		scheduler.Run(jobs[0]);
+		scheduler.Wait(counter);
+
+		REQUIRE(jobsRun == (frame + 1) * 9);
+	}
+
+	REQUIRE(counter->IsComplete());
+}
+
+TEST_CASE("Nova/Services/Jobs/Job Scaling", "[!benchmark]")
+{
+	const int jobCount = 256;
+	const size_t maxWorkers = Nova::Jobs::JobScheduler::GetDefaultWorkerCount();
+
+	BENCHMARK("Serial")
+	{
+		double total = 0.0;
+
+		for (int i = 0; i < jobCount; i++)
+		{
+			total += BusyWork(i);
+		}
+
+		return total;
+	};
+
+	for (size_t workers = 1; workers <= maxWorkers; workers *= 2)
+	{
+		Nova::Jobs::JobScheduler scheduler(workers);
+		Nova::List<double> results(jobCount);
+
+		BENCHMARK(std::to_string(workers) + " workers")
+		{
+			Nova::Ref<Nova::Jobs::JobCounter> counter = Nova::MakeRef<Nova::Jobs::JobCounter>();
+
+			for (int i = 0; i < jobCount; i++)
+			{
+				scheduler.Run([&results, i]() { results[i] = BusyWork(i); }, counter);
+			}
+
+			scheduler.Wait(counter);
+
+			return results[0];
+		};
+	}
+}
\ No newline at end of file
@@ -0,0 +1,192 @@
+#define CATCH_CONFIG_ENABLE_BENCHMARKING
+#include <catch.hpp>
+
+#include <Nova/Services/Jobs/Parallel.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace
+{
+	Nova::List<uint32_t> MakeRandomValues(size_t count)
+	{
+		std::mt19937 random(1234);
+		Nova::List<uint32_t> values(count);
+
+		for (uint32_t& value : values)
+		{
+			value = random();
+		}
+
+		return values;
+	}
+}
+
+TEST_CASE("Nova/Services/Jobs/Parallel Algorithms", "Check that the parallel algorithms match their serial versions")
+{
+	Nova::Jobs::JobScheduler scheduler(4);
+
+	// Not a multiple of the grain size, so the chunks are uneven
+	const size_t count = 100003;
+	const size_t grainSize = 1000;
+	Nova::List<uint32_t> values = MakeRandomValues(count);
+
+	SECTION("ParallelFor")
+	{
+		Nova::List<uint32_t> doubled(count, 0);
+
+		Nova::Jobs::ParallelFor(scheduler, 0, count, [&](size_t i) { doubled[i] = values[i] * 2; }, grainSize);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			REQUIRE(doubled[i] == values[i] * 2);
+		}
+	}
+
+	SECTION("ParallelReduce")
+	{
+		uint64_t expected = std::accumulate(values.begin(), values.end(), (uint64_t)0);
+
+		uint64_t sum = Nova::Jobs::ParallelReduce(scheduler, 0, count, (uint64_t)0,
+			[&](size_t i) { return (uint64_t)values[i]; },
+			[](uint64_t lhs, uint64_t rhs) { return lhs + rhs; }, grainSize);
+
+		REQUIRE(sum == expected);
+	}
+
+	SECTION("ParallelScan")
+	{
+		Nova::List<uint64_t> wideValues(values.begin(), values.end());
+		Nova::List<uint64_t> expected(count);
+		std::inclusive_scan(wideValues.begin(), wideValues.end(), expected.begin());
+
+		Nova::Jobs::ParallelScan(scheduler, wideValues.begin(), wideValues.end(), wideValues.begin(), std::plus<>(), grainSize);
+
+		REQUIRE(wideValues == expected);
+	}
+
+	SECTION("ParallelSort")
+	{
+		Nova::List<uint32_t> expected(values);
+		std::sort(expected.begin(), expected.end());
+
+		Nova::Jobs::ParallelSort(scheduler, values.begin(), values.end(), std::less<>(), grainSize);
+
+		REQUIRE(values == expected);
+	}
+}
+
+TEST_CASE("Nova/Services/Jobs/Parallel Exceptions", "Check that an exception from any chunk waits for the other chunks before it's rethrown")
+{
+	Nova::Jobs::JobScheduler scheduler(4);
+
+	const size_t count = 16;
+	std::atomic<size_t> finished = 0;
+
+	// Index 0 is always in the first chunk, which runs on the calling thread
+	auto throwFirst = [&](size_t i)
+		{
+			if (i == 0)
+				throw std::runtime_error("First chunk failed");
+
+			// Keep the other chunks running long after the first one has thrown
+			std::this_thread::sleep_for(std::chrono::milliseconds(20));
+			finished++;
+		};
+
+	REQUIRE_THROWS_AS(Nova::Jobs::ParallelFor(scheduler, 0, count, throwFirst, 1), std::runtime_error);
+	REQUIRE(finished == count - 1);
+
+	// Chunks on the workers fail the call the same way, whichever of them throws
+	for (size_t failed = 1; failed < count; failed += 5)
+	{
+		finished = 0;
+
+		auto throwOne = [&](size_t i)
+			{
+				if (i == failed)
+					throw std::runtime_error("Chunk failed");
+
+				finished++;
+			};
+
+		REQUIRE_THROWS_AS(Nova::Jobs::ParallelFor(scheduler, 0, count, throwOne, 1), std::runtime_error);
+		REQUIRE(finished == count - 1);
+	}
+
+	// Only one of several exceptions is rethrown
+	REQUIRE_THROWS_AS(Nova::Jobs::ParallelFor(scheduler, 0, count, [](size_t) { throw std::runtime_error("Every chunk failed"); }, 1), std::runtime_error);
+}
+
+TEST_CASE("Nova/Services/Jobs/Parallel Algorithm Scaling", "[!benchmark]")
+{
+	Nova::Jobs::JobScheduler scheduler;
+
+	for (size_t count = 1000; count <= 10000000; count *= 10)
+	{
+		const Nova::List<uint32_t> values = MakeRandomValues(count);
+		Nova::List<uint32_t> output(count);
+
+		BENCHMARK("Serial transform " + std::to_string(count))
+		{
+			std::transform(values.begin(), values.end(), output.begin(), [](uint32_t value) { return value * 3 + 1; });
+			return output[0];
+		};
+
+		BENCHMARK("ParallelFor " + std::to_string(count))
+		{
+			Nova::Jobs::ParallelFor(scheduler, 0, count, [&](size_t i) { output[i] = values[i] * 3 + 1; });
+			return output[0];
+		};
+
+		BENCHMARK("Serial reduce " + std::to_string(count))
+		{
+			return std::accumulate(values.begin(), values.end(), (uint64_t)0);
+		};
+
+		BENCHMARK("ParallelReduce " + std::to_string(count))
+		{
+			return Nova::Jobs::ParallelReduce(scheduler, 0, count, (uint64_t)0,
+				[&](size_t i) { return (uint64_t)values[i]; },
+				[](uint64_t lhs, uint64_t rhs) { return lhs + rhs; });
+		};
+
+		BENCHMARK("Serial scan " + std::to_string(count))
+		{
+			std::inclusive_scan(values.begin(), values.end(), output.begin());
+			return output.back();
+		};
+
+		BENCHMARK("ParallelScan " + std::to_string(count))
+		{
+			Nova::Jobs::ParallelScan(scheduler, values.begin(), values.end(), output.begin());
+			return output.back();
+		};
+
+		BENCHMARK_ADVANCED("std::sort " + std::to_string(count))(Catch::Benchmark::Chronometer meter)
+		{
+			meter.measure([&]
+				{
+					output = values;
+					std::sort(output.begin(), output.end());
+					return output[0];
+				});
+		};
+
+		BENCHMARK_ADVANCED("ParallelSort " + std::to_string(count))(Catch::Benchmark::Chronometer meter)
+		{
+			meter.measure([&]
+				{
+					output = values;
+					Nova::Jobs::ParallelSort(scheduler, output.begin(), output.end());
+					return output[0];
+				});
+		};
+	}
+}
@@ -0,0 +1,80 @@
+#include <catch.hpp>
+
+#include <Nova/Services/Jobs/Future.h>
+
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+
+TEST_CASE("Nova/Services/Jobs/Futures", "Check that futures run continuations on the requested thread")
+{
+	Nova::Jobs::JobScheduler scheduler(2);
+	Nova::Jobs::ContinuationQueue mainQueue;
+
+	SECTION("Continuations chain values")
+	{
+		Nova::Jobs::Promise<int> promise;
+
+		Nova::Jobs::Future<std::string> future = promise.GetFuture()
+			.Then([](int value) { return value * 2; })
+			.Then([](int value) { return std::to_string(value); });
+
+		REQUIRE_FALSE(future.IsReady());
+
+		promise.SetValue(21);
+
+		REQUIRE(future.IsReady());
+		REQUIRE(future.GetValue() == "42");
+	}
+
+	SECTION("Worker results come back through the queue")
+	{
+		const std::thread::id mainThread = std::this_thread::get_id();
+		std::atomic<bool> ranOnMainThread = false;
+
+		Nova::Jobs::Future<void> done = Nova::Jobs::RunAsync(scheduler, []() { return 7; })
+			.Then(mainQueue, [&](int value)
+				{
+					ranOnMainThread = std::this_thread::get_id() == mainThread && value == 7;
+				});
+
+		// Nothing runs on our thread until we drain the queue
+		while (!done.IsReady())
+		{
+			mainQueue.Drain(Nova::TimeSpan());
+			std::this_thread::yield();
+		}
+
+		REQUIRE(ranOnMainThread);
+	}
+
+	SECTION("Exceptions skip continuations")
+	{
+		bool continuationRan = false;
+
+		Nova::Jobs::Promise<int> promise;
+		Nova::Jobs::Future<void> future = promise.GetFuture().Then([&](int) { continuationRan = true; });
+
+		promise.SetException(std::make_exception_ptr(std::runtime_error("Failed")));
+
+		REQUIRE(future.HasException());
+		REQUIRE_FALSE(continuationRan);
+		REQUIRE_THROWS_AS(future.GetValue(), std::runtime_error);
+		REQUIRE_THROWS_AS(promise.SetValue(1), Nova::Jobs::FutureException);
+	}
+
+	SECTION("Draining stops once the budget is spent")
+	{
+		for (int i = 0; i < 10; i++)
+		{
+			mainQueue.Post([]() { std::this_thread::sleep_for(std::chrono::milliseconds(2)); });
+		}
+
+		size_t ran = mainQueue.Drain(Nova::TimeSpan::FromSeconds(0.001));
+
+		REQUIRE(ran == 1);
+		REQUIRE(mainQueue.GetPendingCount() == 9);
+
+		REQUIRE(mainQueue.Drain(Nova::TimeSpan()) == 9);
+	}
+}
@@ -0,0 +1,63 @@
+#include <catch.hpp>
+
+#include <Nova/Services/Jobs/TaskGraph.h>
+#include <Nova/Services/Jobs/JobExceptions.h>
+
+#include <atomic>
+
+TEST_CASE("Nova/Services/Jobs/Task Graph", "Check that task graphs run tasks after their dependencies every execution")
+{
+	Nova::Jobs::JobScheduler scheduler(4);
+	Nova::Ref<Nova::Jobs::TaskGraph> graph = Nova::MakeRef<Nova::Jobs::TaskGraph>(&scheduler);
+
+	// A diamond: input -> (physics, animation) -> render
+	std::atomic<int> step = 0;
+	std::atomic<int> inputStep = -1, physicsStep = -1, animationStep = -1, renderStep = -1;
+
+	Nova::Jobs::TaskID input = graph->AddTask("Input", [&](double) { inputStep = step++; });
+	Nova::Jobs::TaskID physics = graph->AddTask("Physics", [&](double) { physicsStep = step++; });
+	Nova::Jobs::TaskID animation = graph->AddTask("Animation", [&](double) { animationStep = step++; });
+	Nova::Jobs::TaskID render = graph->AddTask("Render", [&](double) { renderStep = step++; });
+
+	graph->AddDependency(physics, input);
+	graph->AddDependency(animation, input);
+	graph->AddDependency(render, physics);
+	graph->AddDependency(render, animation);
+
+	SECTION("Dependencies run first")
+	{
+		for (int frame = 0; frame < 100; frame++)
+		{
+			step = 0;
+			graph->Execute(1.0 / 60.0);
+
+			REQUIRE(step == 4);
+			REQUIRE(inputStep == 0);
+			REQUIRE(physicsStep > inputStep);
+			REQUIRE(animationStep > inputStep);
+			REQUIRE(renderStep == 3);
+		}
+
+		REQUIRE_FALSE(graph->IsDirty());
+	}
+
+	SECTION("Removing tasks rebuilds the schedule")
+	{
+		graph->RemoveTask(animation);
+		REQUIRE(graph->IsDirty());
+
+		step = 0;
+		graph->Execute(1.0 / 60.0);
+
+		REQUIRE(graph->GetScheduledTaskCount() == 3);
+		REQUIRE(step == 3);
+		REQUIRE(renderStep == 2);
+	}
+
+	SECTION("Cycles are rejected")
+	{
+		graph->AddDependency(input, render);
+
+		REQUIRE_THROWS_AS(graph->Compile(), Nova::Jobs::TaskGraphException);
+	}
+}
@@ -28,6 +28,9 @@ project "NovaEngine"
     filter "system:windows"
         systemversion "latest"
 
+        -- Jobs can resume on a different thread, so thread-local storage must not be cached across fiber switches
+        buildoptions { "/GT" }
+
     filter "configurations:Debug"
         runtime "Debug"
         symbols "on"
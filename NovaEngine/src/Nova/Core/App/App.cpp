@@ -22,9 +22,13 @@ namespace Nova
 	App::~App()
 	{
 		// Cleanup the NodeTree
+		Engine::Get()->RemoveTickListener(m_NodeTree->GetTickListener());
 		m_NodeTree.reset();
 
 		Log(LogLevel::Verbose, "App destroyed");
+
+		if (s_Instance == this)
+			s_Instance = nullptr;
 	}
 
 	App* App::s_Instance = nullptr;
@@ -58,5 +62,8 @@ namespace Nova
 	void App::CreateNodeTree()
 	{
 		m_NodeTree = MakeRef<NodeTree>();
+
+		// Tick the tree as part of the main loop
+		Engine::Get()->AddTickListener(m_NodeTree->GetTickListener());
 	}
 }
\ No newline at end of file
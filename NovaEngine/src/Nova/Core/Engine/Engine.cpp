@@ -17,17 +17,28 @@ namespace Nova
 		m_Logger->CreateSink<ConsoleLogSink>(LogLevel::Verbose);
 
 		CreateSingleton();
+		ParseStartupArgs();
+		PinMainThread();
 		CreateApp();
 	}
 
 	Engine::~Engine()
 	{
+		// Shutdown our other loops first, as they may still be ticking the app
+		StopLoops();
+		JoinLoops();
+		m_Loops.clear();
+
 		// Cleanup the app before we exit
 		m_App.reset();
 		m_Services.clear();
 		m_MainLoop.reset();
 
 		Log(LogLevel::Verbose, "Engine destroyed");
+
+		// Allow another engine to be created, such as by tests
+		if (s_Instance == this)
+			s_Instance = nullptr;
 	}
 
 	Engine* Engine::Init(const List<string>& args)
@@ -49,9 +60,12 @@ namespace Nova
 
 		try
 		{
+			StartLoops();
 			m_MainLoop->Run();
 
-			return m_ExitCode;
+			// The main loop stops on its own once it has nothing left to tick, which is a normal exit
+			if (m_ExitCode == AppExitCode::NONE)
+				SetExitCode(AppExitCode::SUCCESS);
 		}
 		catch (...)
 		{
@@ -60,18 +74,97 @@ namespace Nova
 			Log(LogLevel::Error, "An unhandled {0} exception occurred while running the application: {1}", typeid(ex).name(), ex.what());
 
 			Stop(AppExitCode::UNHANDLED_EXCEPTION);
-
-			return AppExitCode::UNHANDLED_EXCEPTION;
 		}
+
+		// Only Stop tells our other loops to stop, and the main loop doesn't go through it when it stops on its own
+		StopLoops();
+		JoinLoops();
+
+		return m_ExitCode;
 	}
 
 	void Engine::Stop(AppExitCode exitCode)
 	{
+		// Stopping touches state owned by the main thread, so defer it there if we're on another loop
+		if (!m_MainLoop->IsLoopThread())
+		{
+			m_MainLoop->Post([this, exitCode]() { Stop(exitCode); });
+			return;
+		}
+
 		m_MainLoop->Stop();
+		StopLoops();
 		SetExitCode(exitCode);
 		OnStop.EmitAnonymous();
 	}
 
+	void Engine::AddTickListener(const Ref<TickListener>& listener, const string& loopName)
+	{
+		if (MainLoop* loop = GetLoop(loopName))
+		{
+			loop->AddTickListener(listener);
+		}
+		else
+		{
+			Log(LogLevel::Warning, "Cannot add a TickListener to loop \"{0}\" because it doesn't exist", loopName);
+		}
+	}
+
+	void Engine::RemoveTickListener(const Ref<TickListener>& listener, const string& loopName)
+	{
+		if (MainLoop* loop = GetLoop(loopName))
+		{
+			loop->RemoveTickListener(listener);
+		}
+	}
+
+	MainLoop* Engine::CreateLoop(const string& name, int targetTickrate)
+	{
+		std::unique_lock lock(m_LoopsMutex);
+
+		auto it = m_Loops.find(name);
+
+		if (it != m_Loops.end())
+		{
+			Log(LogLevel::Warning, "A loop named \"{0}\" already exists!", name);
+			return it->second->GetLoop();
+		}
+
+		LoopThread* loopThread = new LoopThread(name, targetTickrate);
+		m_Loops.emplace(name, ManagedPtr<LoopThread>(loopThread));
+
+		// Loops created while we're running start right away, otherwise they start with the main loop
+		if (m_MainLoop->GetIsRunning())
+			loopThread->Start();
+
+		Log(LogLevel::Verbose, "Created loop \"{0}\"", name);
+
+		return loopThread->GetLoop();
+	}
+
+	MainLoop* Engine::GetLoop(const string& name)
+	{
+		std::shared_lock lock(m_LoopsMutex);
+
+		auto it = m_Loops.find(name);
+
+		if (it != m_Loops.end())
+			return it->second->GetLoop();
+
+		return nullptr;
+	}
+
+	bool Engine::PostToLoop(const string& loopName, LoopMessage message)
+	{
+		MainLoop* loop = GetLoop(loopName);
+
+		if (!loop)
+			return false;
+
+		loop->Post(std::move(message));
+		return true;
+	}
+
 	TimeSpan Engine::GetRunningTime() const
 	{
 		return DateTime::Now() - m_StartTime;
@@ -87,6 +180,52 @@ namespace Nova
 		Log(LogLevel::Verbose, "Engine singleton created");
 	}
 
+	void Engine::ParseStartupArgs()
+	{
+		const string affinityArg = "--affinity=";
+		const string workersArg = "--workers=";
+
+		for (const string& arg : m_StartupArgs)
+		{
+			if (arg.starts_with(affinityArg))
+			{
+				if (!CpuTopology::ParseWorkerAffinity(arg.substr(affinityArg.size()), m_WorkerAffinity))
+					Log(LogLevel::Warning, "Unknown affinity \"{0}\". Expected none, core or numa", arg.substr(affinityArg.size()));
+			}
+			else if (arg.starts_with(workersArg))
+			{
+				try
+				{
+					m_WorkerCount = (size_t)std::stoul(arg.substr(workersArg.size()));
+				}
+				catch (const std::exception&)
+				{
+					Log(LogLevel::Warning, "Invalid worker count \"{0}\"", arg.substr(workersArg.size()));
+				}
+			}
+		}
+	}
+
+	void Engine::PinMainThread()
+	{
+		const CpuTopology& topology = CpuTopology::Get();
+
+		Log(LogLevel::Verbose, "CPU topology: {0}", topology.ToString());
+
+		if (m_WorkerAffinity == WorkerAffinity::None)
+			return;
+
+		// Workers skip the first processor in the placement order, so it's ours
+		uint32_t processor = topology.GetPlacementOrder()[0];
+
+		bool pinned = m_WorkerAffinity == WorkerAffinity::Core ?
+			CpuTopology::PinCurrentThread(processor) :
+			CpuTopology::PinCurrentThreadToNode(topology.GetProcessors()[processor].NumaNode);
+
+		if (!pinned)
+			Log(LogLevel::Warning, "Failed to pin the main thread to processor {0}", processor);
+	}
+
 	void Engine::CreateApp()
 	{
 		try
@@ -103,4 +242,34 @@ namespace Nova
 			return;
 		}
 	}
+
+	void Engine::StartLoops()
+	{
+		std::shared_lock lock(m_LoopsMutex);
+
+		for (const auto& [name, loopThread] : m_Loops)
+		{
+			loopThread->Start();
+		}
+	}
+
+	void Engine::StopLoops()
+	{
+		std::shared_lock lock(m_LoopsMutex);
+
+		for (const auto& [name, loopThread] : m_Loops)
+		{
+			loopThread->Stop();
+		}
+	}
+
+	void Engine::JoinLoops()
+	{
+		std::shared_lock lock(m_LoopsMutex);
+
+		for (const auto& [name, loopThread] : m_Loops)
+		{
+			loopThread->Join();
+		}
+	}
 }
\ No newline at end of file
@@ -5,16 +5,21 @@
 #include "Nova/Core/Types/String.h"
 #include "Nova/Core/Types/RefCounted.h"
 #include "Nova/Core/Types/DateTime.h"
+#include "Nova/Core/Types/Map.h"
 #include "Nova/Core/Logging/Logger.h"
 #include "Nova/Core/App/App.h"
 #include "Nova/Core/Events/Event.h"
 #include "Nova/Core/Events/EventSource.h"
 #include "Nova/Core/Services/EngineService.h"
 #include "Nova/Core/Services/EngineServiceExceptions.h"
+#include "Nova/Core/Threading/CpuTopology.h"
 #include "MainLoop.h"
+#include "LoopThread.h"
 #include "AppExitCode.h"
 
 #include <typeinfo>
+#include <mutex>
+#include <shared_mutex>
 
 namespace Nova
 {
@@ -60,7 +65,7 @@ namespace Nova
 		AppExitCode Run();
 
 		/// <summary>
-		/// Immediately stops the application
+		/// Immediately stops the application and all of its loops. If called from a thread other than the main loop's, the stop happens before the main loop's next tick
 		/// </summary>
 		void Stop(AppExitCode exitCode = AppExitCode::SUCCESS);
 
@@ -76,6 +81,49 @@ namespace Nova
 		/// <param name="listener">The listener to remove</param>
 		void RemoveTickListener(const Ref<TickListener>& listener) { m_MainLoop->RemoveTickListener(listener); }
 
+		/// <summary>
+		/// Adds a TickListener to the loop with the given name
+		/// </summary>
+		/// <param name="listener">The listener to add</param>
+		/// <param name="loopName">The name of the loop</param>
+		void AddTickListener(const Ref<TickListener>& listener, const string& loopName);
+
+		/// <summary>
+		/// Removes a TickListener from the loop with the given name
+		/// </summary>
+		/// <param name="listener">The listener to remove</param>
+		/// <param name="loopName">The name of the loop</param>
+		void RemoveTickListener(const Ref<TickListener>& listener, const string& loopName);
+
+		/// <summary>
+		/// Creates a named loop that runs on its own thread with its own tickrate and listeners. The loop starts with the engine, or immediately if the engine is already running
+		/// </summary>
+		/// <param name="name">The name of the loop</param>
+		/// <param name="targetTickrate">The target tickrate for the loop. Set to 0 to tick as fast as possible</param>
+		/// <returns>The created loop, or the existing loop if one with the same name already exists</returns>
+		MainLoop* CreateLoop(const string& name, int targetTickrate = 0);
+
+		/// <summary>
+		/// Gets the loop with the given name. The returned pointer stays valid until the engine is destroyed, so it can be cached to post messages without a lookup
+		/// </summary>
+		/// <param name="name">The name of the loop</param>
+		/// <returns>The loop, or nullptr if no loop exists with the given name</returns>
+		MainLoop* GetLoop(const string& name);
+
+		/// <summary>
+		/// Gets the engine's main loop
+		/// </summary>
+		/// <returns>The main loop</returns>
+		MainLoop* GetMainLoop() const { return m_MainLoop.get(); }
+
+		/// <summary>
+		/// Posts a message to the loop with the given name. The message is invoked on that loop's thread before its next tick
+		/// </summary>
+		/// <param name="loopName">The name of the loop</param>
+		/// <param name="message">The message to invoke</param>
+		/// <returns>True if a loop with the given name exists</returns>
+		bool PostToLoop(const string& loopName, LoopMessage message);
+
 		/// <summary>
 		/// Logs to the engine logger
 		/// </summary>
@@ -158,17 +206,54 @@ namespace Nova
 		/// <param name="ticksPerSecond">The target number of ticks per second, or an unlimited speed if set to 0</param>
 		void SetTargetTickrate(int ticksPerSecond) { m_MainLoop->SetTargetTickrate(ticksPerSecond); }
 
+		/// <summary>
+		/// Gets how worker threads should be pinned to processors. Set with the "--affinity=none|core|numa" startup arg
+		/// </summary>
+		/// <returns>The worker affinity</returns>
+		WorkerAffinity GetWorkerAffinity() const { return m_WorkerAffinity; }
+
+		/// <summary>
+		/// Gets the number of worker threads services should create. Set with the "--workers=N" startup arg
+		/// </summary>
+		/// <returns>The number of worker threads, or 0 to pick based on the machine</returns>
+		size_t GetWorkerCount() const { return m_WorkerCount; }
+
 	private:
 		/// <summary>
 		/// Creates an engine singleton
 		/// </summary>
 		void CreateSingleton();
 
+		/// <summary>
+		/// Reads engine settings from the startup args
+		/// </summary>
+		void ParseStartupArgs();
+
+		/// <summary>
+		/// Pins the main thread based on the worker affinity, leaving the rest of the machine for workers
+		/// </summary>
+		void PinMainThread();
+
 		/// <summary>
 		/// Creates and initializes the app
 		/// </summary>
 		void CreateApp();
 
+		/// <summary>
+		/// Starts all named loops that are not yet running
+		/// </summary>
+		void StartLoops();
+
+		/// <summary>
+		/// Signals all named loops to stop after their current tick
+		/// </summary>
+		void StopLoops();
+
+		/// <summary>
+		/// Waits for all named loops to finish
+		/// </summary>
+		void JoinLoops();
+
 	public:
 		/// <summary>
 		/// Invoked when the application stops
@@ -181,6 +266,16 @@ namespace Nova
 		/// </summary>
 		const List<string> m_StartupArgs;
 
+		/// <summary>
+		/// How worker threads should be pinned to processors
+		/// </summary>
+		WorkerAffinity m_WorkerAffinity = WorkerAffinity::None;
+
+		/// <summary>
+		/// The number of worker threads services should create, or 0 to pick based on the machine
+		/// </summary>
+		size_t m_WorkerCount = 0;
+
 		/// <summary>
 		/// Gets the time that the engine was started
 		/// </summary>
@@ -201,6 +296,16 @@ namespace Nova
 		/// </summary>
 		ManagedPtr<MainLoop> m_MainLoop;
 
+		/// <summary>
+		/// Additional named loops that run on their own threads
+		/// </summary>
+		Map<string, ManagedPtr<LoopThread>> m_Loops;
+
+		/// <summary>
+		/// Guards the map of named loops
+		/// </summary>
+		mutable std::shared_mutex m_LoopsMutex;
+
 		/// <summary>
 		/// The engine's logger
 		/// </summary>
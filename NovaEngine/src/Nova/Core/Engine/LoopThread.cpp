@@ -0,0 +1,60 @@
+#include "LoopThread.h"
+
+#include "Engine.h"
+
+namespace Nova
+{
+	LoopThread::LoopThread(const string& name, int targetTickrate) :
+		m_Loop(MakeManagedPtr<MainLoop>(targetTickrate, name))
+	{
+		// Dedicated loops idle instead of stopping when they have nothing to tick
+		m_Loop->SetStopWhenIdle(false);
+	}
+
+	LoopThread::~LoopThread()
+	{
+		Stop();
+		Join();
+	}
+
+	void LoopThread::Start()
+	{
+		if (m_Thread.joinable())
+			return;
+
+		// Everything touching the loop from now on must be posted to it
+		m_Loop->ReleaseThread();
+		m_Thread = std::thread(&LoopThread::ThreadMain, this);
+	}
+
+	void LoopThread::Stop()
+	{
+		m_Loop->Stop();
+
+		// The thread may not have started running the loop yet, in which case Run would clear the stop
+		if (m_Thread.joinable())
+			m_Loop->Post([loop = m_Loop.get()]() { loop->Stop(); });
+	}
+
+	void LoopThread::Join()
+	{
+		if (m_Thread.joinable())
+			m_Thread.join();
+	}
+
+	void LoopThread::ThreadMain()
+	{
+		try
+		{
+			m_Loop->Run();
+		}
+		catch (...)
+		{
+			Exception ex = Exception::GetException();
+
+			Engine::Get()->Log(LogLevel::Error, "An unhandled {0} exception occurred while running the \"{1}\" loop: {2}", typeid(ex).name(), m_Loop->GetName(), ex.what());
+
+			Engine::Get()->Stop(AppExitCode::UNHANDLED_EXCEPTION);
+		}
+	}
+}
\ No newline at end of file
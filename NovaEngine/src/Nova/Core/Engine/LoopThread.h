@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/String.h"
+#include "MainLoop.h"
+
+#include <thread>
+
+namespace Nova
+{
+	/// <summary>
+	/// Owns a MainLoop that runs on its own dedicated thread
+	/// </summary>
+	class NovaAPI LoopThread
+	{
+	public:
+		/// <summary>
+		/// Creates a loop with the given name and target tickrate. The loop does not start running until Start is called
+		/// </summary>
+		/// <param name="name">The name of the loop</param>
+		/// <param name="targetTickrate">The target tickrate of the loop. Set to 0 to tick as fast as possible</param>
+		LoopThread(const string& name, int targetTickrate);
+
+		~LoopThread();
+
+	public:
+		/// <summary>
+		/// Starts running the loop on its own thread
+		/// </summary>
+		void Start();
+
+		/// <summary>
+		/// Signals the loop to stop after its current tick. Safe to call from any thread
+		/// </summary>
+		void Stop();
+
+		/// <summary>
+		/// Waits for the loop's thread to finish. Must not be called from the loop's own thread
+		/// </summary>
+		void Join();
+
+		/// <summary>
+		/// Gets if the loop's thread has been started and not yet joined
+		/// </summary>
+		/// <returns>True if the loop's thread is running</returns>
+		bool GetIsStarted() const { return m_Thread.joinable(); }
+
+		/// <summary>
+		/// Gets the loop that runs on this thread
+		/// </summary>
+		/// <returns>The loop</returns>
+		MainLoop* GetLoop() const { return m_Loop.get(); }
+
+	private:
+		/// <summary>
+		/// The entrypoint for the loop's thread
+		/// </summary>
+		void ThreadMain();
+
+	private:
+		/// <summary>
+		/// The loop that runs on this thread
+		/// </summary>
+		ManagedPtr<MainLoop> m_Loop;
+
+		/// <summary>
+		/// The thread the loop runs on
+		/// </summary>
+		std::thread m_Thread;
+	};
+}
\ No newline at end of file
@@ -6,7 +6,9 @@
 
 namespace Nova
 {
-	MainLoop::MainLoop(int targetTickrate) :
+	MainLoop::MainLoop(int targetTickrate, const string& name) :
+		m_Name(name),
+		m_ThreadID(std::this_thread::get_id()),
 		m_LastTickTime(DateTime::Now() - TimeSpan::FromSeconds(s_StartupTickDuration)),
 		m_CurrentDeltaTime(s_StartupTickDuration),
 		m_TargetTickrate(targetTickrate)
@@ -30,6 +32,13 @@ namespace Nova
 
 	void MainLoop::AddTickListener(const Ref<TickListener>& listener)
 	{
+		// Hand the listener over to our thread if someone else is adding it
+		if (!IsLoopThread())
+		{
+			Post([this, listener]() { AddTickListener(listener); });
+			return;
+		}
+
 		m_TickListeners.push_back(listener);
 
 		m_IsListenerSortDirty = true;
@@ -37,6 +46,12 @@ namespace Nova
 
 	void MainLoop::RemoveTickListener(const Ref<TickListener>& listener)
 	{
+		if (!IsLoopThread())
+		{
+			Post([this, listener]() { RemoveTickListener(listener); });
+			return;
+		}
+
 		auto it = std::find_if(m_TickListeners.begin(), m_TickListeners.end(), [listener](const Ref<TickListener>& other) {
 			return listener.get() == other.get();
 			});
@@ -47,29 +62,55 @@ namespace Nova
 		}
 	}
 
+	void MainLoop::Post(LoopMessage message)
+	{
+		m_Messages.Push(std::move(message));
+		Wake();
+	}
+
 	void MainLoop::Run()
 	{
-		m_IsRunning = true;
+		m_ThreadID.store(std::this_thread::get_id(), std::memory_order_release);
+		m_IsRunning.store(true, std::memory_order_release);
 
-		while (m_IsRunning)
+		while (GetIsRunning())
 		{
-			if (m_TargetTickrate > 0)
+			if (m_TargetTickrate.load(std::memory_order_acquire) > 0)
 			{
 				WaitForTargetTickrate();
 			}
 
+			ProcessMessages();
 			PerformTick();
 		}
 	}
 
 	void MainLoop::Stop()
 	{
-		m_IsRunning = false;
+		m_IsRunning.store(false, std::memory_order_release);
+		Wake();
+	}
+
+	void MainLoop::WaitForMessages()
+	{
+		std::unique_lock lock(m_WakeMutex);
+
+		m_WakeCondition.wait(lock, [this]() { return !m_Messages.IsEmpty() || !GetIsRunning(); });
+	}
+
+	void MainLoop::Wake()
+	{
+		// Taking the lock orders this with the waiting loop's check, so it can't miss the wake between checking and sleeping
+		{
+			std::lock_guard lock(m_WakeMutex);
+		}
+
+		m_WakeCondition.notify_one();
 	}
 
 	void MainLoop::WaitForTargetTickrate()
 	{
-		DateTime nextTickTime = m_LastTickTime + TimeSpan::FromSeconds(1.0 / (double)m_TargetTickrate);
+		DateTime nextTickTime = m_LastTickTime + TimeSpan::FromSeconds(1.0 / (double)m_TargetTickrate.load(std::memory_order_acquire));
 		TimeSpan waitTime = nextTickTime - DateTime::Now();
 
 		if (waitTime.GetMicroseconds() > 0)
@@ -85,13 +126,36 @@ namespace Nova
 		m_IsListenerSortDirty = false;
 	}
 
+	void MainLoop::ProcessMessages()
+	{
+		LoopMessage message;
+
+		while (m_Messages.Pop(message))
+		{
+			message();
+		}
+	}
+
 	void MainLoop::PerformTick()
 	{
-		// HACK: Quit if no listeners to handle, as we'd have an infinite loop with nothing to handle it
 		if (m_TickListeners.size() == 0)
 		{
-			Stop();
-			return;
+			// HACK: Quit if no listeners to handle, as we'd have an infinite loop with nothing to handle it
+			if (m_StopWhenIdle)
+			{
+				Stop();
+				return;
+			}
+
+			// Loops on dedicated threads sleep until listeners are posted to them instead. With a tickrate, they already sleep between ticks
+			if (m_TargetTickrate.load(std::memory_order_acquire) <= 0)
+			{
+				WaitForMessages();
+
+				// Don't count the time spent waiting towards the next delta time
+				m_LastTickTime = DateTime::Now();
+				return;
+			}
 		}
 
 		// Only sort listeners if there's more than one and the list has changed since we last sorted
@@ -6,9 +6,22 @@
 #include "Nova/Core/Types/DateTime.h"
 #include "Nova/Core/Types/RefCounted.h"
 #include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/String.h"
+#include "Nova/Core/Threading/MPSCQueue.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
 
 namespace Nova
 {
+	/// <summary>
+	/// A message that is posted to a loop and invoked on that loop's thread before its next tick
+	/// </summary>
+	using LoopMessage = std::function<void()>;
+
 	/// <summary>
 	/// Runs a loop for the engine, ticking all registered listeners
 	/// </summary>
@@ -19,7 +32,8 @@ namespace Nova
 		/// Creates a MainLoop with the given target tickrate
 		/// </summary>
 		/// <param name="targetTickrate">The target tickrate. Set to 0 to tick as fast as possible</param>
-		MainLoop(int targetTickrate = 0);
+		/// <param name="name">The name of this loop</param>
+		MainLoop(int targetTickrate = 0, const string& name = "Main");
 
 		~MainLoop();
 
@@ -40,32 +54,61 @@ namespace Nova
 
 	public:
 		/// <summary>
-		/// Adds a listener for ticks from this loop
+		/// Adds a listener for ticks from this loop. If called from a thread other than this loop's thread, the listener is added before the next tick
 		/// </summary>
 		/// <param name="listener">The listener to add</param>
 		void AddTickListener(const Ref<TickListener>& listener);
 
 		/// <summary>
-		/// Stops the listener from receiving ticks from this loop
+		/// Stops the listener from receiving ticks from this loop. If called from a thread other than this loop's thread, the listener is removed before the next tick
 		/// </summary>
 		/// <param name="listener">The listener to remove</param>
 		void RemoveTickListener(const Ref<TickListener>& listener);
 
 		/// <summary>
-		/// Starts this loop
+		/// Posts a message to this loop. The message is invoked on this loop's thread before its next tick. Safe to call from any thread
+		/// </summary>
+		/// <param name="message">The message to invoke</param>
+		void Post(LoopMessage message);
+
+		/// <summary>
+		/// Starts this loop on the calling thread
 		/// </summary>
 		void Run();
 
 		/// <summary>
-		/// Stops this loop after the current tick
+		/// Stops this loop after the current tick, waking it if it's waiting for messages. Safe to call from any thread
 		/// </summary>
 		void Stop();
 
 		/// <summary>
-		/// Sets the target tickrate for this loop. A value of 0 means tick as fast as possible
+		/// Gets if this loop is currently running
+		/// </summary>
+		/// <returns>True if this loop is running</returns>
+		bool GetIsRunning() const { return m_IsRunning.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// Gets if the calling thread is the thread this loop is running on
+		/// </summary>
+		/// <returns>True if called from this loop's thread</returns>
+		bool IsLoopThread() const { return std::this_thread::get_id() == m_ThreadID.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// Releases this loop from the thread that created it so that it can be run on a different thread. Changes made afterwards are posted to the loop
+		/// </summary>
+		void ReleaseThread() { m_ThreadID.store(std::thread::id(), std::memory_order_release); }
+
+		/// <summary>
+		/// Sets the target tickrate for this loop. A value of 0 means tick as fast as possible. Safe to call from any thread
 		/// </summary>
 		/// <param name="ticksPerSecond">The target number of ticks per second, or 0 to tick as fast as possible</param>
-		void SetTargetTickrate(int ticksPerSecond) { m_TargetTickrate = ticksPerSecond; }
+		void SetTargetTickrate(int ticksPerSecond) { m_TargetTickrate.store(ticksPerSecond, std::memory_order_release); }
+
+		/// <summary>
+		/// Sets if this loop should stop once it has no listeners left to tick
+		/// </summary>
+		/// <param name="stopWhenIdle">If true, this loop stops when it has no listeners</param>
+		void SetStopWhenIdle(bool stopWhenIdle) { m_StopWhenIdle = stopWhenIdle; }
 
 		/// <summary>
 		/// Gets the time between the current tick and the last tick
@@ -73,38 +116,89 @@ namespace Nova
 		/// <returns>The time between ticks (in seconds)</returns>
 		double GetDeltaTime() const { return m_CurrentDeltaTime; }
 
+		/// <summary>
+		/// Gets the name of this loop
+		/// </summary>
+		/// <returns>The name of this loop</returns>
+		const string& GetName() const { return m_Name; }
+
 	private:
 		/// <summary>
 		/// Sorts the list of tick listeners based on their order
 		/// </summary>
 		void SortTickListeners();
 
+		/// <summary>
+		/// Invokes all messages that have been posted to this loop
+		/// </summary>
+		void ProcessMessages();
+
 		/// <summary>
 		/// Performs a tick
 		/// </summary>
 		void PerformTick();
 
+		/// <summary>
+		/// Blocks until a message is posted or the loop is stopped
+		/// </summary>
+		void WaitForMessages();
+
+		/// <summary>
+		/// Wakes the loop if it's waiting for messages
+		/// </summary>
+		void Wake();
+
 		/// <summary>
 		/// Waits for the next tick time
 		/// </summary>
 		void WaitForTargetTickrate();
 
 	private:
+		/// <summary>
+		/// The name of this loop
+		/// </summary>
+		const string m_Name;
+
 		/// <summary>
 		/// Gets the running state of this loop
 		/// </summary>
-		bool m_IsRunning = false;
+		std::atomic<bool> m_IsRunning = false;
+
+		/// <summary>
+		/// If true, this loop will stop once it has no listeners
+		/// </summary>
+		bool m_StopWhenIdle = true;
 
 		/// <summary>
 		/// If true, the list of TickListeners needs to be re-sorted for the next tick
 		/// </summary>
 		bool m_IsListenerSortDirty = false;
 
+		/// <summary>
+		/// The thread this loop is running on
+		/// </summary>
+		std::atomic<std::thread::id> m_ThreadID;
+
 		/// <summary>
 		/// A list of all TickListeners listening to ticks from this loop
 		/// </summary>
 		List<Ref<TickListener>> m_TickListeners;
 
+		/// <summary>
+		/// Messages posted to this loop from any thread
+		/// </summary>
+		MPSCQueue<LoopMessage> m_Messages;
+
+		/// <summary>
+		/// Guards waiting for messages, so a message posted just as the loop goes to sleep always wakes it
+		/// </summary>
+		std::mutex m_WakeMutex;
+
+		/// <summary>
+		/// Signalled when a message is posted or the loop is stopped
+		/// </summary>
+		std::condition_variable m_WakeCondition;
+
 		/// <summary>
 		/// The time listeners were last ticked
 		/// </summary>
@@ -118,6 +212,6 @@ namespace Nova
 		/// <summary>
 		/// The target ticks per second for this loop
 		/// </summary>
-		int m_TargetTickrate;
+		std::atomic<int> m_TargetTickrate;
 	};
 }
\ No newline at end of file
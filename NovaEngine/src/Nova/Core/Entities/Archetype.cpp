@@ -0,0 +1,125 @@
+#include "Archetype.h"
+
+#include <algorithm>
+#include <cstring>
+#include <new>
+
+namespace Nova
+{
+	namespace
+	{
+		size_t AlignUp(size_t value, size_t alignment)
+		{
+			return (value + alignment - 1) / alignment * alignment;
+		}
+	}
+
+	Archetype::Archetype(const List<ComponentTypeID>& types) :
+		m_Types(types)
+	{
+		m_ColumnOfType.fill(-1);
+
+		// Chunks are cache line aligned so the first element of every column is too
+		m_ChunkAlignment = std::max<size_t>(64, alignof(Entity));
+		size_t bytesPerEntity = sizeof(Entity);
+		size_t padding = 0;
+
+		for (size_t column = 0; column < m_Types.size(); column++)
+		{
+			const ComponentTypeInfo& info = GetComponentTypeInfo(m_Types[column]);
+
+			m_Mask.set(m_Types[column]);
+			m_ColumnOfType[m_Types[column]] = (int16_t)column;
+			m_ColumnInfos.push_back(info);
+
+			m_ChunkAlignment = std::max(m_ChunkAlignment, info.Alignment);
+			bytesPerEntity += info.Size;
+			padding += info.Alignment - 1;
+		}
+
+		m_ChunkCapacity = (uint32_t)std::max<size_t>(1, (ChunkSize - std::min(padding, ChunkSize)) / bytesPerEntity);
+
+		// Lay out the columns one after another after the entity handles
+		size_t offset = sizeof(Entity) * m_ChunkCapacity;
+
+		for (const ComponentTypeInfo& info : m_ColumnInfos)
+		{
+			offset = AlignUp(offset, info.Alignment);
+			m_ColumnOffsets.push_back(offset);
+			offset += info.Size * m_ChunkCapacity;
+		}
+
+		m_ChunkBytes = AlignUp(std::max<size_t>(offset, 1), m_ChunkAlignment);
+	}
+
+	Archetype::~Archetype()
+	{
+		for (Chunk& chunk : m_Chunks)
+		{
+			for (size_t column = 0; column < m_ColumnInfos.size(); column++)
+			{
+				const ComponentTypeInfo& info = m_ColumnInfos[column];
+				std::byte* data = chunk.Data + m_ColumnOffsets[column];
+
+				for (uint32_t row = 0; row < chunk.Count; row++)
+				{
+					info.Destroy(data + row * info.Size);
+				}
+			}
+
+			::operator delete(chunk.Data, std::align_val_t(m_ChunkAlignment));
+		}
+	}
+
+	Archetype::Location Archetype::AllocateRow(Entity entity)
+	{
+		if (m_Chunks.empty() || m_Chunks.back().Count == m_ChunkCapacity)
+			m_Chunks.push_back({ static_cast<std::byte*>(::operator new(m_ChunkBytes, std::align_val_t(m_ChunkAlignment))), 0 });
+
+		Chunk& chunk = m_Chunks.back();
+		Location location = { (uint32_t)(m_Chunks.size() - 1), chunk.Count++ };
+
+		GetEntities(chunk)[location.Row] = entity;
+		m_EntityCount++;
+
+		return location;
+	}
+
+	Entity Archetype::RemoveRow(const Location& location, bool destroyComponents)
+	{
+		Chunk& chunk = m_Chunks[location.ChunkIndex];
+		Chunk& lastChunk = m_Chunks.back();
+		const uint32_t lastRow = lastChunk.Count - 1;
+		const bool isLast = &chunk == &lastChunk && location.Row == lastRow;
+
+		for (size_t column = 0; column < m_ColumnInfos.size(); column++)
+		{
+			const ComponentTypeInfo& info = m_ColumnInfos[column];
+			std::byte* removed = chunk.Data + m_ColumnOffsets[column] + location.Row * info.Size;
+
+			if (destroyComponents)
+				info.Destroy(removed);
+
+			if (!isLast)
+				info.MoveAndDestroy(removed, lastChunk.Data + m_ColumnOffsets[column] + lastRow * info.Size);
+		}
+
+		Entity moved = Entity::INVALID;
+
+		if (!isLast)
+		{
+			moved = GetEntities(lastChunk)[lastRow];
+			GetEntities(chunk)[location.Row] = moved;
+		}
+
+		m_EntityCount--;
+
+		if (--lastChunk.Count == 0)
+		{
+			::operator delete(lastChunk.Data, std::align_val_t(m_ChunkAlignment));
+			m_Chunks.pop_back();
+		}
+
+		return moved;
+	}
+}
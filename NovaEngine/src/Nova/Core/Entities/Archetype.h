@@ -0,0 +1,209 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/Map.h"
+#include "ComponentType.h"
+#include "Entity.h"
+
+#include <array>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	class World;
+
+	/// <summary>
+	/// Stores every entity with one exact set of component types. Entities are packed into fixed-size chunks, each holding an array of entity handles
+	/// followed by one array per component type, so iterating a single component over many entities is a linear walk through memory. Every chunk but
+	/// the last is full
+	/// </summary>
+	class NovaAPI Archetype
+	{
+	public:
+		/// <summary>
+		/// The size of a chunk. Archetypes with components bigger than this get chunks that hold a single entity
+		/// </summary>
+		static constexpr size_t ChunkSize = 16 * 1024;
+
+		/// <summary>
+		/// A block of entities and their components
+		/// </summary>
+		struct Chunk
+		{
+			/// <summary>
+			/// The chunk's memory
+			/// </summary>
+			std::byte* Data;
+
+			/// <summary>
+			/// The number of entities in the chunk
+			/// </summary>
+			uint32_t Count;
+		};
+
+		/// <summary>
+		/// Where an entity is stored in an archetype
+		/// </summary>
+		struct Location
+		{
+			uint32_t ChunkIndex;
+			uint32_t Row;
+		};
+
+	public:
+		/// <summary>
+		/// Creates an archetype for a set of component types
+		/// </summary>
+		/// <param name="types">The component types, sorted by ID</param>
+		Archetype(const List<ComponentTypeID>& types);
+		~Archetype();
+
+		Archetype(const Archetype&) = delete;
+		Archetype& operator=(const Archetype&) = delete;
+
+	public:
+		/// <summary>
+		/// Gets the component types of this archetype, sorted by ID
+		/// </summary>
+		/// <returns>The component types</returns>
+		const List<ComponentTypeID>& GetTypes() const { return m_Types; }
+
+		/// <summary>
+		/// Gets the component types of this archetype as a mask
+		/// </summary>
+		/// <returns>The component mask</returns>
+		const ComponentMask& GetMask() const { return m_Mask; }
+
+		/// <summary>
+		/// Gets the column that stores a component type
+		/// </summary>
+		/// <param name="type">The component type</param>
+		/// <returns>The column, or -1 if this archetype doesn't have the type</returns>
+		int32_t GetColumn(ComponentTypeID type) const { return m_ColumnOfType[type]; }
+
+		/// <summary>
+		/// Gets the number of entities a chunk can hold
+		/// </summary>
+		/// <returns>The chunk capacity</returns>
+		uint32_t GetChunkCapacity() const { return m_ChunkCapacity; }
+
+		/// <summary>
+		/// Gets this archetype's chunks
+		/// </summary>
+		/// <returns>The chunks</returns>
+		const List<Chunk>& GetChunks() const { return m_Chunks; }
+
+		/// <summary>
+		/// Gets the number of entities in this archetype
+		/// </summary>
+		/// <returns>The number of entities</returns>
+		size_t GetEntityCount() const { return m_EntityCount; }
+
+		/// <summary>
+		/// Gets the entity handles stored in a chunk
+		/// </summary>
+		/// <param name="chunk">The chunk</param>
+		/// <returns>The start of the chunk's entity array</returns>
+		Entity* GetEntities(const Chunk& chunk) const { return reinterpret_cast<Entity*>(chunk.Data); }
+
+		/// <summary>
+		/// Gets the start of a column in a chunk
+		/// </summary>
+		/// <param name="chunk">The chunk</param>
+		/// <param name="column">The column</param>
+		/// <returns>The start of the column's component array</returns>
+		void* GetColumnData(const Chunk& chunk, size_t column) const { return chunk.Data + m_ColumnOffsets[column]; }
+
+		/// <summary>
+		/// Gets a component of an entity
+		/// </summary>
+		/// <param name="location">Where the entity is stored</param>
+		/// <param name="column">The column of the component</param>
+		/// <returns>The component</returns>
+		void* GetComponent(const Location& location, size_t column) const
+		{
+			return m_Chunks[location.ChunkIndex].Data + m_ColumnOffsets[column] + location.Row * m_ColumnInfos[column].Size;
+		}
+
+	private:
+		/// <summary>
+		/// Adds a row for an entity at the end of the last chunk. The components are left uninitialized
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		/// <returns>Where the entity is stored</returns>
+		Location AllocateRow(Entity entity);
+
+		/// <summary>
+		/// Removes a row, moving the very last row into its place so the chunks stay packed
+		/// </summary>
+		/// <param name="location">The row to remove</param>
+		/// <param name="destroyComponents">True to destroy the row's components. False if they were already moved out</param>
+		/// <returns>The entity that was moved into the row, or an invalid entity if the removed row was the last</returns>
+		Entity RemoveRow(const Location& location, bool destroyComponents);
+
+	private:
+		/// <summary>
+		/// The component types, sorted by ID
+		/// </summary>
+		List<ComponentTypeID> m_Types;
+
+		/// <summary>
+		/// The component types as a mask
+		/// </summary>
+		ComponentMask m_Mask;
+
+		/// <summary>
+		/// The column of each component type, or -1 for types this archetype doesn't have
+		/// </summary>
+		std::array<int16_t, MaxComponentTypes> m_ColumnOfType;
+
+		/// <summary>
+		/// How to store each column's type
+		/// </summary>
+		List<ComponentTypeInfo> m_ColumnInfos;
+
+		/// <summary>
+		/// The offset of each column from the start of a chunk
+		/// </summary>
+		List<size_t> m_ColumnOffsets;
+
+		/// <summary>
+		/// The number of entities a chunk can hold
+		/// </summary>
+		uint32_t m_ChunkCapacity = 0;
+
+		/// <summary>
+		/// The size of each chunk's memory
+		/// </summary>
+		size_t m_ChunkBytes = 0;
+
+		/// <summary>
+		/// The alignment of each chunk's memory
+		/// </summary>
+		size_t m_ChunkAlignment = 0;
+
+		/// <summary>
+		/// The chunks, all full except the last
+		/// </summary>
+		List<Chunk> m_Chunks;
+
+		/// <summary>
+		/// The number of entities in this archetype
+		/// </summary>
+		size_t m_EntityCount = 0;
+
+		/// <summary>
+		/// The archetypes reached by adding a component type to this one, filled in as they're used
+		/// </summary>
+		Map<ComponentTypeID, Archetype*> m_AddEdges;
+
+		/// <summary>
+		/// The archetypes reached by removing a component type from this one, filled in as they're used
+		/// </summary>
+		Map<ComponentTypeID, Archetype*> m_RemoveEdges;
+
+		friend World;
+	};
+}
@@ -0,0 +1,61 @@
+#include "ComponentType.h"
+#include "EntityExceptions.h"
+
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/Map.h"
+
+#include <mutex>
+
+namespace Nova
+{
+	namespace
+	{
+		/// <summary>
+		/// Every registered component type. Types are looked up by type_index so each type gets one ID, even if several modules register it
+		/// </summary>
+		struct ComponentTypeRegistry
+		{
+			std::mutex Mutex;
+			Map<std::type_index, ComponentTypeID> IDs;
+			List<ComponentTypeInfo> Infos;
+		};
+
+		ComponentTypeRegistry& GetRegistry()
+		{
+			static ComponentTypeRegistry registry;
+			return registry;
+		}
+	}
+
+	ComponentTypeID RegisterComponentType(const std::type_index& type, const ComponentTypeInfo& info)
+	{
+		ComponentTypeRegistry& registry = GetRegistry();
+		std::lock_guard lock(registry.Mutex);
+
+		auto it = registry.IDs.find(type);
+
+		if (it != registry.IDs.end())
+			return it->second;
+
+		if (registry.Infos.size() >= MaxComponentTypes)
+			throw EntityException(FormatString("Can't register component type \"{0}\" as there are already {1} component types", info.Name, MaxComponentTypes));
+
+		// The list is reserved up front so references returned by GetComponentTypeInfo stay valid while other types register
+		if (registry.Infos.empty())
+			registry.Infos.reserve(MaxComponentTypes);
+
+		ComponentTypeID id = (ComponentTypeID)registry.Infos.size();
+		registry.Infos.push_back(info);
+		registry.IDs.emplace(type, id);
+
+		return id;
+	}
+
+	const ComponentTypeInfo& GetComponentTypeInfo(ComponentTypeID id)
+	{
+		ComponentTypeRegistry& registry = GetRegistry();
+		std::lock_guard lock(registry.Mutex);
+
+		return registry.Infos[id];
+	}
+}
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/String.h"
+
+#include <bitset>
+#include <new>
+#include <stddef.h>
+#include <stdint.h>
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+#include <utility>
+
+namespace Nova
+{
+	/// <summary>
+	/// Identifies a component type. IDs are assigned in registration order and are only stable for the lifetime of the process
+	/// </summary>
+	using ComponentTypeID = uint32_t;
+
+	/// <summary>
+	/// The maximum number of component types that can be registered
+	/// </summary>
+	constexpr size_t MaxComponentTypes = 256;
+
+	/// <summary>
+	/// A set of component types, used to match archetypes against queries
+	/// </summary>
+	using ComponentMask = std::bitset<MaxComponentTypes>;
+
+	/// <summary>
+	/// Describes how to store a component type without knowing it at compile time
+	/// </summary>
+	struct ComponentTypeInfo
+	{
+		/// <summary>
+		/// The name of the type, for diagnostics
+		/// </summary>
+		string Name;
+
+		/// <summary>
+		/// The size of the type
+		/// </summary>
+		size_t Size;
+
+		/// <summary>
+		/// The alignment of the type
+		/// </summary>
+		size_t Alignment;
+
+		/// <summary>
+		/// Move-constructs a component into uninitialized memory and destroys the source
+		/// </summary>
+		void(*MoveAndDestroy)(void* destination, void* source);
+
+		/// <summary>
+		/// Destroys a component
+		/// </summary>
+		void(*Destroy)(void* component);
+	};
+
+	/// <summary>
+	/// Registers a component type, or finds its ID if it has already been registered
+	/// </summary>
+	/// <param name="type">The type</param>
+	/// <param name="info">How to store the type</param>
+	/// <returns>The ID of the type</returns>
+	NovaAPI ComponentTypeID RegisterComponentType(const std::type_index& type, const ComponentTypeInfo& info);
+
+	/// <summary>
+	/// Gets the storage info of a registered component type
+	/// </summary>
+	/// <param name="id">The ID of the type</param>
+	/// <returns>The type's info</returns>
+	NovaAPI const ComponentTypeInfo& GetComponentTypeInfo(ComponentTypeID id);
+
+	/// <summary>
+	/// Gets the ID of a component type, registering it the first time it's used
+	/// </summary>
+	/// <returns>The ID of the type</returns>
+	template<typename T>
+	ComponentTypeID GetComponentTypeID()
+	{
+		static_assert(std::is_same_v<T, std::decay_t<T>>, "Components must be plain value types");
+		static_assert(std::is_move_constructible_v<T>, "Components must be move constructible");
+
+		static const ComponentTypeID id = RegisterComponentType(typeid(T), ComponentTypeInfo{
+			typeid(T).name(),
+			sizeof(T),
+			alignof(T),
+			[](void* destination, void* source)
+			{
+				new (destination) T(std::move(*static_cast<T*>(source)));
+				static_cast<T*>(source)->~T();
+			},
+			[](void* component) { static_cast<T*>(component)->~T(); }
+		});
+
+		return id;
+	}
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A handle to an entity in a World. Handles to destroyed entities are never reused, as each reuse of an index bumps its generation
+	/// </summary>
+	struct Entity
+	{
+		/// <summary>
+		/// The index of the entity's record in its world
+		/// </summary>
+		uint32_t Index = UINT32_MAX;
+
+		/// <summary>
+		/// Which use of the index this handle refers to
+		/// </summary>
+		uint32_t Generation = 0;
+
+		/// <summary>
+		/// Gets if this handle was ever assigned an entity. The entity may have since been destroyed
+		/// </summary>
+		/// <returns>True if the handle isn't null</returns>
+		bool IsValid() const { return Index != UINT32_MAX; }
+
+		bool operator==(const Entity& other) const { return Index == other.Index && Generation == other.Generation; }
+		bool operator!=(const Entity& other) const { return !(*this == other); }
+
+		static const Entity INVALID;
+	};
+
+	inline const Entity Entity::INVALID = Entity();
+}
@@ -0,0 +1,8 @@
+#include "EntityExceptions.h"
+
+namespace Nova
+{
+	EntityException::EntityException(const string& error) :
+		Exception(error)
+	{}
+}
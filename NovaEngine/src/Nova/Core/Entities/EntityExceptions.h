@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Exception.h"
+#include "Nova/Core/Types/String.h"
+
+namespace Nova
+{
+	class NovaAPI EntityException : public Exception
+	{
+	public:
+		EntityException(const string& error);
+	};
+}
@@ -0,0 +1,173 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "World.h"
+
+#include <array>
+#include <stddef.h>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace Nova
+{
+	/// <summary>
+	/// Base class for queries, so the world can cache queries of any type
+	/// </summary>
+	class NovaAPI QueryBase
+	{
+	public:
+		virtual ~QueryBase() = default;
+	};
+
+	/// <summary>
+	/// Iterates every entity that has all of a set of components. Matching archetypes are remembered, and only archetypes created since the last run
+	/// are checked. Components declared const are read-only
+	/// </summary>
+	template<typename ... Components>
+	class Query : public QueryBase
+	{
+		static_assert(sizeof...(Components) > 0, "A query needs at least one component");
+
+	public:
+		/// <summary>
+		/// Creates a query over a world. Prefer World::GetQuery, which caches queries
+		/// </summary>
+		/// <param name="world">The world to query</param>
+		Query(World& world) :
+			m_World(world),
+			m_Types{ GetComponentTypeID<std::remove_const_t<Components>>()... }
+		{
+			for (ComponentTypeID type : m_Types)
+			{
+				m_Mask.set(type);
+			}
+		}
+
+	public:
+		/// <summary>
+		/// Calls a function once per non-empty chunk with the chunk's entities and component arrays, for loops the compiler can vectorize
+		/// </summary>
+		/// <param name="func">The function to call, taking (size_t count, const Entity* entities, Components* ...columns)</param>
+		template<typename Func>
+		void ForEachChunk(const Func& func)
+		{
+			Refresh();
+
+			World::IterationScope scope(m_World);
+
+			for (const MatchedArchetype& match : m_Matches)
+			{
+				for (const Archetype::Chunk& chunk : match.ArchetypePtr->GetChunks())
+				{
+					CallWithColumns(func, match, chunk, std::index_sequence_for<Components...>());
+				}
+			}
+		}
+
+		/// <summary>
+		/// Calls a function for every matching entity
+		/// </summary>
+		/// <param name="func">The function to call, taking the components by reference, optionally preceded by the Entity</param>
+		template<typename Func>
+		void ForEach(const Func& func)
+		{
+			ForEachChunk([&func](size_t count, const Entity* entities, Components* ... columns)
+				{
+					for (size_t i = 0; i < count; i++)
+					{
+						if constexpr (std::is_invocable_v<const Func&, Entity, Components&...>)
+							func(entities[i], columns[i]...);
+						else
+							func(columns[i]...);
+					}
+				});
+		}
+
+		/// <summary>
+		/// Gets the number of matching entities
+		/// </summary>
+		/// <returns>The number of entities</returns>
+		size_t GetEntityCount()
+		{
+			Refresh();
+
+			size_t count = 0;
+
+			for (const MatchedArchetype& match : m_Matches)
+			{
+				count += match.ArchetypePtr->GetEntityCount();
+			}
+
+			return count;
+		}
+
+	private:
+		/// <summary>
+		/// An archetype that has all of the query's components, with the column of each
+		/// </summary>
+		struct MatchedArchetype
+		{
+			Archetype* ArchetypePtr;
+			std::array<int32_t, sizeof...(Components)> Columns;
+		};
+
+	private:
+		/// <summary>
+		/// Checks the archetypes created since the last run
+		/// </summary>
+		void Refresh()
+		{
+			for (; m_ArchetypesSeen < m_World.m_Archetypes.size(); m_ArchetypesSeen++)
+			{
+				Archetype* archetype = m_World.m_Archetypes[m_ArchetypesSeen].get();
+
+				if ((archetype->GetMask() & m_Mask) != m_Mask)
+					continue;
+
+				MatchedArchetype match = { archetype, {} };
+
+				for (size_t i = 0; i < m_Types.size(); i++)
+				{
+					match.Columns[i] = archetype->GetColumn(m_Types[i]);
+				}
+
+				m_Matches.push_back(match);
+			}
+		}
+
+		template<typename Func, size_t ... Indices>
+		static void CallWithColumns(const Func& func, const MatchedArchetype& match, const Archetype::Chunk& chunk, std::index_sequence<Indices...>)
+		{
+			func((size_t)chunk.Count, match.ArchetypePtr->GetEntities(chunk),
+				static_cast<Components*>(match.ArchetypePtr->GetColumnData(chunk, match.Columns[Indices]))...);
+		}
+
+	private:
+		/// <summary>
+		/// The world being queried
+		/// </summary>
+		World& m_World;
+
+		/// <summary>
+		/// The component types, in the order they're passed to functions
+		/// </summary>
+		std::array<ComponentTypeID, sizeof...(Components)> m_Types;
+
+		/// <summary>
+		/// The component types as a mask
+		/// </summary>
+		ComponentMask m_Mask;
+
+		/// <summary>
+		/// The archetypes that match
+		/// </summary>
+		List<MatchedArchetype> m_Matches;
+
+		/// <summary>
+		/// The number of the world's archetypes that have been checked
+		/// </summary>
+		size_t m_ArchetypesSeen = 0;
+	};
+}
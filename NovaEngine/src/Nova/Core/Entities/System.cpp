@@ -0,0 +1,23 @@
+#include "System.h"
+#include "World.h"
+
+namespace Nova
+{
+	System::System(int tickOrder) :
+		m_TickOrder(tickOrder)
+	{}
+
+	// RefCounted ----------
+	void System::Init()
+	{
+		m_TickListener = MakeRef<TickListener>(m_TickOrder, GetSelfRef<System>(), &System::Tick);
+	}
+
+	// RefCounted ----------
+
+	void System::Tick(double deltaTime)
+	{
+		if (m_World)
+			Update(*m_World, deltaTime);
+	}
+}
@@ -0,0 +1,73 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Events/TickListener.h"
+#include "Nova/Core/Types/RefCounted.h"
+
+namespace Nova
+{
+	class World;
+
+	/// <summary>
+	/// Base class for logic that runs over a World's components each tick. Systems are created with World::AddSystem and tick through their own
+	/// TickListener, so their order relative to the node tree and to each other is set by their tick order
+	/// </summary>
+	class NovaAPI System : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a system
+		/// </summary>
+		/// <param name="tickOrder">The order to tick at. Lower values tick earlier</param>
+		System(int tickOrder = 0);
+		virtual ~System() = default;
+
+	public:
+		/// <summary>
+		/// Gets the listener that ticks this system
+		/// </summary>
+		/// <returns>The tick listener</returns>
+		const Ref<TickListener>& GetTickListener() const { return m_TickListener; }
+
+		/// <summary>
+		/// Gets the world this system was added to
+		/// </summary>
+		/// <returns>The world, or nullptr if the system was removed</returns>
+		World* GetWorld() const { return m_World; }
+
+	protected:
+		/// <summary>
+		/// Called once per tick while the system is in a world
+		/// </summary>
+		/// <param name="world">The world</param>
+		/// <param name="deltaTime">The time since the last tick (in seconds)</param>
+		virtual void Update(World& world, double deltaTime) = 0;
+
+	// RefCounted ----------
+	protected:
+		virtual void Init() override;
+
+	// RefCounted ----------
+
+	private:
+		void Tick(double deltaTime);
+
+	private:
+		/// <summary>
+		/// The order to tick at
+		/// </summary>
+		int m_TickOrder;
+
+		/// <summary>
+		/// The world this system was added to
+		/// </summary>
+		World* m_World = nullptr;
+
+		/// <summary>
+		/// The listener that ticks this system
+		/// </summary>
+		Ref<TickListener> m_TickListener;
+
+		friend World;
+	};
+}
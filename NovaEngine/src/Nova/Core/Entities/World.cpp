@@ -0,0 +1,231 @@
+#include "World.h"
+
+#include "Nova/Core/Engine/Engine.h"
+#include "Nova/Core/Nodes/NodeTree.h"
+
+namespace Nova
+{
+	World::World(NodeTree* tree) :
+		m_Tree(tree)
+	{
+		m_EmptyArchetype = GetOrCreateArchetype({});
+	}
+
+	World::~World()
+	{
+		while (!m_Systems.empty())
+		{
+			RemoveSystem(m_Systems.back());
+		}
+
+		// Nodes can outlive the world, so make sure they don't keep handles into it
+		ForEach<NodeBinding>([](NodeBinding& binding) { binding.NodePtr->m_Entity = Entity::INVALID; });
+	}
+
+	Entity World::CreateEntity()
+	{
+		CheckNotIterating();
+
+		return AllocateEntity(m_EmptyArchetype);
+	}
+
+	void World::DestroyEntity(Entity entity)
+	{
+		CheckNotIterating();
+
+		if (!IsAlive(entity))
+			return;
+
+		EntityRecord& record = m_Records[entity.Index];
+
+		// Destroying a bound entity directly unbinds its node
+		if (const int32_t column = record.ArchetypePtr->GetColumn(GetComponentTypeID<NodeBinding>()); column >= 0)
+			static_cast<NodeBinding*>(record.ArchetypePtr->GetComponent(record.Location, column))->NodePtr->m_Entity = Entity::INVALID;
+
+		RemoveFromArchetype(record, true);
+
+		record.ArchetypePtr = nullptr;
+		record.Generation++;
+
+		m_FreeIndices.push_back(entity.Index);
+		m_EntityCount--;
+	}
+
+	Entity World::BindNode(Node& node)
+	{
+		if (node.m_Entity.IsValid() && IsAlive(node.m_Entity))
+			return node.m_Entity;
+
+		if (!m_Tree || node.m_Tree.lock().get() != m_Tree)
+			throw EntityException(FormatString("Can't bind node \"{0}\" to an entity as it isn't in this world's tree", node.GetName()));
+
+		// The archetypes are shared by the whole tree, so independent subtrees bind once they're all done
+		if (m_Tree->GetIsTickingInParallel())
+		{
+			m_Tree->Defer([this, node = node.GetSelfRef<Node>()]() { BindNode(*node); });
+			return Entity::INVALID;
+		}
+
+		node.m_Entity = CreateEntity(NodeBinding{ &node });
+		return node.m_Entity;
+	}
+
+	void World::UnbindNode(Node& node)
+	{
+		if (m_Tree && m_Tree->GetIsTickingInParallel())
+		{
+			m_Tree->Defer([this, node = node.GetSelfRef<Node>()]() { UnbindNode(*node); });
+			return;
+		}
+
+		if (node.m_Entity.IsValid())
+			DestroyEntity(node.m_Entity);
+
+		node.m_Entity = Entity::INVALID;
+	}
+
+	void World::RemoveSystem(const Ref<System>& system)
+	{
+		auto it = std::find(m_Systems.begin(), m_Systems.end(), system);
+
+		if (it == m_Systems.end())
+			return;
+
+		if (Engine* engine = Engine::Get())
+			engine->RemoveTickListener(system->GetTickListener());
+
+		system->m_World = nullptr;
+		m_Systems.erase(it);
+	}
+
+	void World::CheckNotIterating() const
+	{
+		if (m_IterationDepth > 0)
+			throw EntityException("Entities and components can't be created, destroyed, added or removed while a query is iterating");
+	}
+
+	World::EntityRecord& World::GetRecord(Entity entity)
+	{
+		if (!IsAlive(entity))
+			throw EntityException(FormatString("Entity {0} (generation {1}) doesn't exist", entity.Index, entity.Generation));
+
+		return m_Records[entity.Index];
+	}
+
+	Entity World::AllocateEntity(Archetype* archetype)
+	{
+		Entity entity;
+
+		if (!m_FreeIndices.empty())
+		{
+			entity.Index = m_FreeIndices.back();
+			m_FreeIndices.pop_back();
+		}
+		else
+		{
+			entity.Index = (uint32_t)m_Records.size();
+			m_Records.emplace_back();
+		}
+
+		EntityRecord& record = m_Records[entity.Index];
+		entity.Generation = record.Generation;
+
+		record.ArchetypePtr = archetype;
+		record.Location = archetype->AllocateRow(entity);
+
+		m_EntityCount++;
+
+		return entity;
+	}
+
+	Archetype* World::GetOrCreateArchetype(const List<ComponentTypeID>& types)
+	{
+		auto it = m_ArchetypeLookup.find(types);
+
+		if (it != m_ArchetypeLookup.end())
+			return it->second;
+
+		Archetype* archetype = new Archetype(types);
+		m_Archetypes.push_back(ManagedPtr<Archetype>(archetype));
+		m_ArchetypeLookup.emplace(types, archetype);
+
+		return archetype;
+	}
+
+	Archetype* World::GetArchetypeWithAdded(Archetype* archetype, ComponentTypeID type)
+	{
+		auto it = archetype->m_AddEdges.find(type);
+
+		if (it != archetype->m_AddEdges.end())
+			return it->second;
+
+		List<ComponentTypeID> types = archetype->GetTypes();
+		types.insert(std::upper_bound(types.begin(), types.end(), type), type);
+
+		Archetype* destination = GetOrCreateArchetype(types);
+		archetype->m_AddEdges.emplace(type, destination);
+		destination->m_RemoveEdges.emplace(type, archetype);
+
+		return destination;
+	}
+
+	Archetype* World::GetArchetypeWithRemoved(Archetype* archetype, ComponentTypeID type)
+	{
+		auto it = archetype->m_RemoveEdges.find(type);
+
+		if (it != archetype->m_RemoveEdges.end())
+			return it->second;
+
+		List<ComponentTypeID> types = archetype->GetTypes();
+		types.erase(std::find(types.begin(), types.end(), type));
+
+		Archetype* destination = GetOrCreateArchetype(types);
+		archetype->m_RemoveEdges.emplace(type, destination);
+		destination->m_AddEdges.emplace(type, archetype);
+
+		return destination;
+	}
+
+	void World::MoveEntity(Entity entity, Archetype* destination)
+	{
+		EntityRecord& record = m_Records[entity.Index];
+		Archetype* source = record.ArchetypePtr;
+
+		const Archetype::Location destinationLocation = destination->AllocateRow(entity);
+
+		// Move the components both archetypes share, and destroy the ones the destination doesn't have
+		for (size_t column = 0; column < source->m_ColumnInfos.size(); column++)
+		{
+			const ComponentTypeInfo& info = source->m_ColumnInfos[column];
+			void* component = source->GetComponent(record.Location, column);
+			const int32_t destinationColumn = destination->GetColumn(source->m_Types[column]);
+
+			if (destinationColumn >= 0)
+				info.MoveAndDestroy(destination->GetComponent(destinationLocation, destinationColumn), component);
+			else
+				info.Destroy(component);
+		}
+
+		RemoveFromArchetype(record, false);
+
+		record.ArchetypePtr = destination;
+		record.Location = destinationLocation;
+	}
+
+	void World::RemoveFromArchetype(EntityRecord& record, bool destroyComponents)
+	{
+		const Entity moved = record.ArchetypePtr->RemoveRow(record.Location, destroyComponents);
+
+		if (moved.IsValid())
+			m_Records[moved.Index].Location = record.Location;
+	}
+
+	void World::AttachSystem(const Ref<System>& system)
+	{
+		system->m_World = this;
+		m_Systems.push_back(system);
+
+		if (Engine* engine = Engine::Get())
+			engine->AddTickListener(system->GetTickListener());
+	}
+}
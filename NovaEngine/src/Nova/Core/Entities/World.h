@@ -0,0 +1,384 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/Map.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Archetype.h"
+#include "ComponentType.h"
+#include "Entity.h"
+#include "EntityExceptions.h"
+#include "System.h"
+
+#include <algorithm>
+#include <stdint.h>
+#include <typeindex>
+#include <utility>
+
+namespace Nova
+{
+	class Node;
+	class NodeTree;
+	class QueryBase;
+
+	template<typename ... Components>
+	class Query;
+
+	/// <summary>
+	/// The component that links an entity to the node it was bound to
+	/// </summary>
+	struct NodeBinding
+	{
+		/// <summary>
+		/// The bound node. The binding is removed before the node leaves the tree
+		/// </summary>
+		Node* NodePtr;
+	};
+
+	/// <summary>
+	/// Stores entities and their components grouped by archetype, for systems that iterate a few components over many objects without virtual calls.
+	/// Each NodeTree owns a world, and nodes can be bound to an entity in it. Entities and components can't be created, destroyed, added or removed
+	/// while a query is iterating
+	/// </summary>
+	class NovaAPI World
+	{
+	public:
+		/// <summary>
+		/// Creates an empty world
+		/// </summary>
+		/// <param name="tree">The tree that owns this world, if any. Only nodes in it can be bound to entities</param>
+		World(NodeTree* tree = nullptr);
+		~World();
+
+		World(const World&) = delete;
+		World& operator=(const World&) = delete;
+
+	public:
+		/// <summary>
+		/// Creates an entity with no components
+		/// </summary>
+		/// <returns>The entity</returns>
+		Entity CreateEntity();
+
+		/// <summary>
+		/// Creates an entity with the given components
+		/// </summary>
+		/// <param name="...components">The components to move into the entity</param>
+		/// <returns>The entity</returns>
+		template<typename ... Components>
+		Entity CreateEntity(Components&& ... components)
+		{
+			static_assert(sizeof...(Components) > 0, "Use the overload without components");
+
+			CheckNotIterating();
+
+			List<ComponentTypeID> types = { GetComponentTypeID<std::decay_t<Components>>()... };
+			std::sort(types.begin(), types.end());
+
+			if (std::adjacent_find(types.begin(), types.end()) != types.end())
+				throw EntityException("An entity can't have the same component type twice");
+
+			Archetype* archetype = GetOrCreateArchetype(types);
+			Entity entity = AllocateEntity(archetype);
+			const Archetype::Location& location = m_Records[entity.Index].Location;
+
+			(new (archetype->GetComponent(location, archetype->GetColumn(GetComponentTypeID<std::decay_t<Components>>()))) std::decay_t<Components>(std::forward<Components>(components)), ...);
+
+			return entity;
+		}
+
+		/// <summary>
+		/// Destroys an entity and its components. Does nothing if the entity has already been destroyed
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		void DestroyEntity(Entity entity);
+
+		/// <summary>
+		/// Gets if an entity exists in this world
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		/// <returns>True if the entity hasn't been destroyed</returns>
+		bool IsAlive(Entity entity) const
+		{
+			return entity.Index < m_Records.size() && m_Records[entity.Index].Generation == entity.Generation && m_Records[entity.Index].ArchetypePtr;
+		}
+
+		/// <summary>
+		/// Adds a component to an entity, moving it to the archetype with the component
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		/// <param name="...args">Parameters to pass to the constructor of the component</param>
+		/// <returns>The added component</returns>
+		template<typename T, typename ... Args>
+		T& AddComponent(Entity entity, Args&& ... args)
+		{
+			CheckNotIterating();
+
+			const ComponentTypeID type = GetComponentTypeID<T>();
+			EntityRecord& record = GetRecord(entity);
+
+			if (record.ArchetypePtr->GetColumn(type) >= 0)
+				throw EntityException(FormatString("The entity already has a component of type \"{0}\"", typeid(T).name()));
+
+			MoveEntity(entity, GetArchetypeWithAdded(record.ArchetypePtr, type));
+
+			void* component = record.ArchetypePtr->GetComponent(record.Location, record.ArchetypePtr->GetColumn(type));
+			return *new (component) T(std::forward<Args>(args)...);
+		}
+
+		/// <summary>
+		/// Removes a component from an entity. Does nothing if the entity doesn't have one
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		template<typename T>
+		void RemoveComponent(Entity entity)
+		{
+			CheckNotIterating();
+
+			const ComponentTypeID type = GetComponentTypeID<T>();
+			EntityRecord& record = GetRecord(entity);
+
+			if (record.ArchetypePtr->GetColumn(type) < 0)
+				return;
+
+			MoveEntity(entity, GetArchetypeWithRemoved(record.ArchetypePtr, type));
+		}
+
+		/// <summary>
+		/// Gets if an entity has a component
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		/// <returns>True if the entity is alive and has the component</returns>
+		template<typename T>
+		bool HasComponent(Entity entity) const
+		{
+			return IsAlive(entity) && m_Records[entity.Index].ArchetypePtr->GetColumn(GetComponentTypeID<T>()) >= 0;
+		}
+
+		/// <summary>
+		/// Gets a component of an entity. The pointer is invalidated when any entity in the same archetype is created, destroyed or changes components
+		/// </summary>
+		/// <param name="entity">The entity</param>
+		/// <returns>The component, or nullptr if the entity is dead or doesn't have one</returns>
+		template<typename T>
+		T* GetComponent(Entity entity)
+		{
+			if (!IsAlive(entity))
+				return nullptr;
+
+			const EntityRecord& record = m_Records[entity.Index];
+			const int32_t column = record.ArchetypePtr->GetColumn(GetComponentTypeID<T>());
+
+			return column >= 0 ? static_cast<T*>(record.ArchetypePtr->GetComponent(record.Location, column)) : nullptr;
+		}
+
+		/// <summary>
+		/// Gets the number of living entities
+		/// </summary>
+		/// <returns>The number of entities</returns>
+		size_t GetEntityCount() const { return m_EntityCount; }
+
+		/// <summary>
+		/// Gets the number of archetypes that have been created. Archetypes are kept once created, even when empty
+		/// </summary>
+		/// <returns>The number of archetypes</returns>
+		size_t GetArchetypeCount() const { return m_Archetypes.size(); }
+
+		/// <summary>
+		/// Gets the query for a set of components. Queries are cached by the world and only look at archetypes created since they were last run
+		/// </summary>
+		/// <returns>The query</returns>
+		template<typename ... Components>
+		Query<Components...>& GetQuery()
+		{
+			auto it = m_Queries.find(typeid(Query<Components...>));
+
+			if (it == m_Queries.end())
+				it = m_Queries.emplace(typeid(Query<Components...>), ManagedPtr<QueryBase>(new Query<Components...>(*this))).first;
+
+			return static_cast<Query<Components...>&>(*it->second);
+		}
+
+		/// <summary>
+		/// Calls a function for every entity that has all of the given components. See Query::ForEach
+		/// </summary>
+		/// <param name="func">The function to call, taking the components by reference (optionally preceded by the Entity)</param>
+		template<typename ... Components, typename Func>
+		void ForEach(const Func& func)
+		{
+			GetQuery<Components...>().ForEach(func);
+		}
+
+		/// <summary>
+		/// Binds a node to a new entity with a NodeBinding component. The entity is destroyed when the node leaves the tree. While the tree ticks
+		/// independent subtrees in parallel, the binding is deferred until they're done, and Node::GetEntity has the entity from then on
+		/// </summary>
+		/// <param name="node">The node, which must be in this world's tree</param>
+		/// <returns>The node's entity. If the node is already bound, its existing entity. Entity::INVALID if the binding was deferred</returns>
+		Entity BindNode(Node& node);
+
+		/// <summary>
+		/// Destroys the entity bound to a node. Does nothing if the node isn't bound. Deferred like BindNode while the tree ticks in parallel
+		/// </summary>
+		/// <param name="node">The node</param>
+		void UnbindNode(Node& node);
+
+		/// <summary>
+		/// Creates a system and registers its tick listener with the engine's main loop (if the engine is running)
+		/// </summary>
+		/// <param name="...args">Parameters to pass to the constructor of the system class</param>
+		/// <returns>The created system</returns>
+		template<typename SystemClass, typename ... Args>
+		Ref<SystemClass> AddSystem(Args&& ... args)
+		{
+			static_assert(std::is_base_of<System, SystemClass>::value, "The class must inherit from System");
+
+			Ref<SystemClass> system = MakeRef<SystemClass>(std::forward<Args>(args)...);
+			AttachSystem(system);
+
+			return system;
+		}
+
+		/// <summary>
+		/// Removes a system and unregisters its tick listener
+		/// </summary>
+		/// <param name="system">The system</param>
+		void RemoveSystem(const Ref<System>& system);
+
+	private:
+		/// <summary>
+		/// Where an entity is stored, or the next free index if it's dead
+		/// </summary>
+		struct EntityRecord
+		{
+			/// <summary>
+			/// The entity's archetype, or nullptr if the index is free
+			/// </summary>
+			Archetype* ArchetypePtr = nullptr;
+
+			/// <summary>
+			/// Where the entity is stored in its archetype
+			/// </summary>
+			Archetype::Location Location = { 0, 0 };
+
+			/// <summary>
+			/// The generation of the entity currently using the index
+			/// </summary>
+			uint32_t Generation = 0;
+		};
+
+		/// <summary>
+		/// Marks the world as being iterated for as long as it exists, so structural changes throw instead of corrupting the iteration
+		/// </summary>
+		struct IterationScope
+		{
+			IterationScope(World& world) : WorldRef(world) { WorldRef.m_IterationDepth++; }
+			~IterationScope() { WorldRef.m_IterationDepth--; }
+
+			World& WorldRef;
+		};
+
+	private:
+		/// <summary>
+		/// Throws if a query is iterating
+		/// </summary>
+		void CheckNotIterating() const;
+
+		/// <summary>
+		/// Gets the record of a living entity. Throws if the entity is dead
+		/// </summary>
+		EntityRecord& GetRecord(Entity entity);
+
+		/// <summary>
+		/// Reserves an entity index and a row in an archetype
+		/// </summary>
+		Entity AllocateEntity(Archetype* archetype);
+
+		/// <summary>
+		/// Finds or creates the archetype for a set of component types
+		/// </summary>
+		/// <param name="types">The component types, sorted by ID</param>
+		Archetype* GetOrCreateArchetype(const List<ComponentTypeID>& types);
+
+		/// <summary>
+		/// Gets the archetype with the given archetype's types plus one more
+		/// </summary>
+		Archetype* GetArchetypeWithAdded(Archetype* archetype, ComponentTypeID type);
+
+		/// <summary>
+		/// Gets the archetype with the given archetype's types minus one
+		/// </summary>
+		Archetype* GetArchetypeWithRemoved(Archetype* archetype, ComponentTypeID type);
+
+		/// <summary>
+		/// Moves an entity to another archetype, moving the components both archetypes have and destroying the rest
+		/// </summary>
+		void MoveEntity(Entity entity, Archetype* destination);
+
+		/// <summary>
+		/// Removes an entity's row from its archetype and updates the record of the entity moved into its place
+		/// </summary>
+		void RemoveFromArchetype(EntityRecord& record, bool destroyComponents);
+
+		/// <summary>
+		/// Stores a system and registers its tick listener
+		/// </summary>
+		void AttachSystem(const Ref<System>& system);
+
+	private:
+		/// <summary>
+		/// The tree that owns this world, if any
+		/// </summary>
+		NodeTree* m_Tree;
+
+		/// <summary>
+		/// A record for every entity index ever used
+		/// </summary>
+		List<EntityRecord> m_Records;
+
+		/// <summary>
+		/// Indices of dead entities, ready for reuse
+		/// </summary>
+		List<uint32_t> m_FreeIndices;
+
+		/// <summary>
+		/// The number of living entities
+		/// </summary>
+		size_t m_EntityCount = 0;
+
+		/// <summary>
+		/// Every archetype, in creation order. Queries remember how many they've seen
+		/// </summary>
+		List<ManagedPtr<Archetype>> m_Archetypes;
+
+		/// <summary>
+		/// Archetypes by their sorted component types
+		/// </summary>
+		Map<List<ComponentTypeID>, Archetype*> m_ArchetypeLookup;
+
+		/// <summary>
+		/// The archetype of entities without components
+		/// </summary>
+		Archetype* m_EmptyArchetype = nullptr;
+
+		/// <summary>
+		/// Cached queries by type
+		/// </summary>
+		Map<std::type_index, ManagedPtr<QueryBase>> m_Queries;
+
+		/// <summary>
+		/// The number of queries iterating
+		/// </summary>
+		int m_IterationDepth = 0;
+
+		/// <summary>
+		/// The systems added to this world
+		/// </summary>
+		List<Ref<System>> m_Systems;
+
+		template<typename ... Components>
+		friend class Query;
+	};
+}
+
+#include "Query.h"
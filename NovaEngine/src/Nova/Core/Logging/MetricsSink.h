@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/String.h"
+
+namespace Nova
+{
+	/// <summary>
+	/// Base class for receivers of named values, such as a metrics service or a debug overlay
+	/// </summary>
+	class NovaAPI MetricsSink : public RefCounted
+	{
+	public:
+		virtual ~MetricsSink() = default;
+
+	public:
+		/// <summary>
+		/// Writes a value to this sink
+		/// </summary>
+		/// <param name="name">The name of the value, with parts separated by '.'</param>
+		/// <param name="value">The value</param>
+		virtual void Write(const string& name, double value) = 0;
+	};
+}
@@ -1,54 +1,108 @@
 #include "Node.h"
 #include "NodeTree.h"
 
+#include <algorithm>
+
 namespace Nova
 {
+	namespace
+	{
+		/// <summary>
+		/// Compares children with tick orders, for searching a list of children sorted by tick order
+		/// </summary>
+		struct TickOrderLess
+		{
+			bool operator()(const Ref<Node>& node, int tickOrder) const { return node->GetTickOrder() < tickOrder; }
+			bool operator()(int tickOrder, const Ref<Node>& node) const { return tickOrder < node->GetTickOrder(); }
+		};
+	}
+
 	Node::Node(const string& name) :
 		m_Name(name)
 	{}
 
-	//bool Node::TickPriorityComparator(const Ref<Node>& lhs, const Ref<Node>& rhs)
-	//{
-	//	 lhs->GetTickOrder() > rhs->GetTickOrder();
-	//}
+	void Node::SetName(const string& name)
+	{
+		SetName(NameID(name));
+	}
+
+	void Node::SetName(NameID name)
+	{
+		if (NodeCommandBuffer* commands = GetDeferredCommands())
+		{
+			commands->Add([self = GetSelfRef<Node>(), name]() { self->SetName(name); });
+			return;
+		}
+
+		NameID previousName = m_Name;
+		m_Name = name;
+
+		if (previousName == m_Name)
+			return;
+
+		if (auto parent = m_Parent.lock())
+		{
+			parent->UpdateChildNameIndex(previousName);
+			parent->UpdateChildNameIndex(m_Name);
+		}
+
+		if (auto tree = m_Tree.lock())
+			tree->m_StructureVersion++;
+
+		MarkSnapshotDirty();
+	}
 
 	void Node::SetIsActive(bool isActive)
 	{
+		if (m_IsActive == isActive)
+			return;
+
 		m_IsActive = isActive;
+
+		auto parent = m_Parent.lock();
+		UpdateIsActiveInTree(!parent || parent->m_IsActiveInTree);
+
+		MarkSnapshotDirty();
 	}
 
-	bool Node::GetIsActiveInTree() const
+	void Node::SetTickOrder(int tickOrder)
 	{
-		const Node* current = this;
-		bool isActive = true;
+		if (m_TickOrder == tickOrder)
+			return;
 
-		// Go up our parent hierarchy until we reach the end or a parent is in-active
-		while (isActive && current != nullptr)
+		if (NodeCommandBuffer* commands = GetDeferredCommands())
 		{
-			isActive = current->m_IsActive;
-			
-			// If we should continue, make the parent (if one exists) the current node 
-			if (isActive)
-			{
-				auto parent = current->m_Parent.lock();
-
-				if (parent)
-				{
-					current = parent.get();
-				}
-				else
-				{
-					current = nullptr;
-				}
-			}
+			commands->Add([self = GetSelfRef<Node>(), tickOrder]() { self->SetTickOrder(tickOrder); });
+			return;
 		}
 
-		return isActive;
+		m_TickOrder = tickOrder;
+		MarkSnapshotDirty();
+
+		// Go after the siblings that already have the new order, as if we were added with it
+		if (auto parent = m_Parent.lock())
+			parent->RepositionChild(GetSelfRef<Node>(), SIZE_MAX);
 	}
 
 	void Node::SetTree(const WeakRef<NodeTree>& tree)
 	{
+		Ref<NodeTree> previousTree = m_Tree.lock();
+		Ref<NodeTree> newTree = tree.lock();
+
+		if (previousTree && previousTree != newTree)
+			LeaveTree(*previousTree);
+
+		// Whether or not we were still leaving a freed subtree, we've now been moved
 		m_Tree = tree;
+		m_IsLeavingTree = false;
+
+		if (newTree && newTree != previousTree)
+		{
+			newTree->m_Counters.NodesAdded++;
+
+			newTree->AddGroupMembers(*this);
+			OnEnterTree(*newTree);
+		}
 
 		// Recursively set the tree for our children
 		for (const auto& child : m_Children)
@@ -57,27 +111,322 @@ namespace Nova
 		}
 	}
 
+	void Node::AddToGroup(NodeGroup group)
+	{
+		if (!group.IsValid() || m_Groups.test(group.GetIndex()))
+			return;
+
+		if (NodeCommandBuffer* commands = GetDeferredCommands())
+		{
+			commands->Add([self = GetSelfRef<Node>(), group]() { self->AddToGroup(group); });
+			return;
+		}
+
+		m_Groups.set(group.GetIndex());
+		MarkSnapshotDirty();
+
+		if (auto tree = m_Tree.lock())
+			tree->AddGroupMember(*this, group.GetIndex());
+	}
+
+	void Node::RemoveFromGroup(NodeGroup group)
+	{
+		if (!IsInGroup(group))
+			return;
+
+		if (NodeCommandBuffer* commands = GetDeferredCommands())
+		{
+			commands->Add([self = GetSelfRef<Node>(), group]() { self->RemoveFromGroup(group); });
+			return;
+		}
+
+		m_Groups.reset(group.GetIndex());
+		MarkSnapshotDirty();
+
+		if (auto tree = m_Tree.lock())
+			tree->RemoveGroupMember(*this, group.GetIndex());
+	}
+
+	void Node::SetProperty(NameID name, NodePropertyValue value)
+	{
+		if (!m_PropertyOverrides)
+			m_PropertyOverrides = MakeManagedPtr<List<NodePropertyTable::Entry>>();
+
+		NodePropertyTable::Set(*m_PropertyOverrides, name, std::move(value));
+		MarkSnapshotDirty();
+	}
+
+	const NodePropertyValue* Node::FindProperty(NameID name) const
+	{
+		if (m_PropertyOverrides)
+		{
+			if (const NodePropertyValue* value = NodePropertyTable::Find(*m_PropertyOverrides, name))
+				return value;
+		}
+
+		return m_DefaultProperties ? m_DefaultProperties->Find(name) : nullptr;
+	}
+
+	void Node::ResetProperty(NameID name)
+	{
+		if (!m_PropertyOverrides)
+			return;
+
+		auto it = std::find_if(m_PropertyOverrides->begin(), m_PropertyOverrides->end(), [name](const NodePropertyTable::Entry& entry) { return entry.first == name; });
+
+		if (it != m_PropertyOverrides->end())
+		{
+			m_PropertyOverrides->erase(it);
+			MarkSnapshotDirty();
+		}
+
+		// Nodes that stop overriding anything go back to only sharing their defaults
+		if (m_PropertyOverrides->empty())
+			m_PropertyOverrides.reset();
+	}
+
+	Ref<const NodePropertyTable> Node::FreezeProperties() const
+	{
+		if (!m_PropertyOverrides)
+			return m_DefaultProperties;
+
+		List<NodePropertyTable::Entry> entries = m_DefaultProperties ? m_DefaultProperties->GetEntries() : List<NodePropertyTable::Entry>();
+		entries.insert(entries.end(), m_PropertyOverrides->begin(), m_PropertyOverrides->end());
+
+		return MakeRef<NodePropertyTable>(std::move(entries));
+	}
+
+	Ref<Node> Node::FindChild(NameID name)
+	{
+		Node* child = FindChildPtr(name);
+
+		return child ? child->GetSelfRef<Node>() : nullptr;
+	}
+
+	Ref<Node> Node::FindNode(std::string_view path)
+	{
+		Node* node = this;
+
+		for (size_t start = 0; node && start < path.size();)
+		{
+			size_t end = std::min(path.find('/', start), path.size());
+			std::string_view segment = path.substr(start, end - start);
+
+			if (!segment.empty())
+			{
+				// A name that was never interned can't belong to any node
+				NameID name;
+				node = NameID::TryFind(segment, name) ? node->FindChildPtr(name) : nullptr;
+			}
+
+			start = end + 1;
+		}
+
+		return node ? node->GetSelfRef<Node>() : nullptr;
+	}
+
 	void Node::AddChild(const Ref<Node>& node)
 	{
-		m_Children.push_back(node);
+		InsertChild(node, m_Children.size());
+	}
 
-		// Notify the new child that its parent changed
-		node->SetParent(GetSelfWeakRef<Node>());
+	void Node::MoveChild(const Ref<Node>& node, size_t index)
+	{
+		if (node->m_Parent.lock().get() != this)
+			return;
+
+		if (NodeCommandBuffer* commands = GetDeferredCommands())
+		{
+			commands->Add([self = GetSelfRef<Node>(), node, index]() { self->MoveChild(node, index); });
+			return;
+		}
+
+		RepositionChild(node, index);
 	}
 
 	void Node::RemoveChild(const Ref<Node>& node)
+	{
+		if (NodeCommandBuffer* commands = GetDeferredCommands())
+		{
+			commands->Add([self = GetSelfRef<Node>(), node]() { self->RemoveChild(node); });
+			return;
+		}
+
+		// Keep the child alive until it has been unparented
+		if (Ref<Node> child = UnlinkChild(node))
+		{
+			// Notify the child that its parent changed
+			child->SetParent(WeakRef<Node>());
+		}
+	}
+
+	void Node::QueueAddChild(const Ref<Node>& node)
+	{
+		Ref<NodeTree> tree = m_Tree.lock();
+
+		if (!tree)
+		{
+			AddChild(node);
+			return;
+		}
+
+		// The queue belongs to the main thread, so independent subtrees add to it once they're done
+		tree->Defer([tree = tree.get(), self = GetSelfRef<Node>(), node]() { tree->m_QueuedAdds.push_back({ self, node }); });
+	}
+
+	void Node::QueueFree()
+	{
+		Ref<NodeTree> tree = m_Tree.lock();
+
+		if (!tree)
+		{
+			if (auto parent = m_Parent.lock())
+				parent->RemoveChild(GetSelfRef<Node>());
+
+			return;
+		}
+
+		tree->Defer([tree = tree.get(), self = GetSelfRef<Node>()]() { tree->m_QueuedFrees.push_back(self); });
+	}
+
+	void Node::InsertChild(const Ref<Node>& node, size_t index)
+	{
+		// The child may be leaving a tree that's ticking in parallel even if we aren't in one
+		NodeCommandBuffer* commands = GetDeferredCommands();
+
+		if (!commands)
+			commands = node->GetDeferredCommands();
+
+		if (commands)
+		{
+			commands->Add([self = GetSelfRef<Node>(), node, index]() { self->InsertChild(node, index); });
+			return;
+		}
+
+		Ref<Node> child = node;
+
+		// A node can only have one parent
+		if (auto previousParent = child->m_Parent.lock())
+			previousParent->RemoveChild(child);
+
+		index = ClampToTickOrder(index, child->m_TickOrder);
+		m_Children.insert(m_Children.begin() + index, child);
+		OnChildAdded(child.get());
+		MarkSnapshotDirty();
+
+		// Notify the new child that its parent changed
+		child->SetParent(GetSelfWeakRef<Node>());
+
+		if (auto tree = m_Tree.lock())
+			tree->AttachSubtree(this, index);
+	}
+
+	NodeCommandBuffer* Node::GetDeferredCommands() const
+	{
+		Ref<NodeTree> tree = m_Tree.lock();
+
+		return tree ? tree->GetParallelCommandBuffer() : nullptr;
+	}
+
+	void Node::RepositionChild(const Ref<Node>& child, size_t index)
+	{
+		auto it = std::find(m_Children.begin(), m_Children.end(), child);
+
+		if (it == m_Children.end())
+			return;
+
+		const size_t previousIndex = it - m_Children.begin();
+		m_Children.erase(it);
+
+		index = ClampToTickOrder(index, child->m_TickOrder);
+		m_Children.insert(m_Children.begin() + index, child);
+
+		if (index == previousIndex)
+			return;
+
+		// The child may have passed a sibling with the same name
+		UpdateChildNameIndex(child->m_Name);
+		MarkSnapshotDirty();
+
+		// The child doesn't leave the tree, so only the flattened order needs to change
+		if (auto tree = m_Tree.lock())
+			tree->MoveSubtree(this, previousIndex, index);
+	}
+
+	size_t Node::ClampToTickOrder(size_t index, int tickOrder) const
+	{
+		auto range = std::equal_range(m_Children.begin(), m_Children.end(), tickOrder, TickOrderLess());
+
+		return std::clamp(index, (size_t)(range.first - m_Children.begin()), (size_t)(range.second - m_Children.begin()));
+	}
+
+	void Node::AppendDetachedChild(const Ref<Node>& child)
+	{
+		// Appending keeps the children sorted unless the node set a lower tick order of its own
+		m_Children.insert(m_Children.begin() + ClampToTickOrder(SIZE_MAX, child->m_TickOrder), child);
+		OnChildAdded(child.get());
+		MarkSnapshotDirty();
+
+		// Neither node has a tree to pass on, so only the active state follows the parent
+		child->m_Parent = GetSelfWeakRef<Node>();
+		child->UpdateIsActiveInTree(m_IsActiveInTree);
+	}
+
+	void Node::MarkSnapshotDirty()
+	{
+		// Once a node is dirty, so are all of its ancestors, so the walk stops at the first dirty one
+		for (Node* node = this; node && node->m_SnapshotRecord;)
+		{
+			node->m_SnapshotRecord.reset();
+
+			Ref<Node> parent = node->m_Parent.lock();
+
+			// Ancestors of an independent subtree are shared with the other subtrees while they tick in parallel, so they're marked once they're done
+			if (parent && node->m_IsTickIndependent)
+			{
+				if (NodeCommandBuffer* commands = parent->GetDeferredCommands())
+				{
+					commands->Add([parent]() { parent->MarkSnapshotDirty(); });
+					return;
+				}
+			}
+
+			node = parent.get();
+		}
+	}
+
+	Ref<Node> Node::UnlinkChild(const Ref<Node>& node)
 	{
 		auto it = std::find_if(m_Children.begin(), m_Children.end(), [node](const Ref<Node>& other) {
 			return node.get() == other.get();
 		});
 
-		if (it != m_Children.end())
-		{
-			m_Children.erase(it);
+		if (it == m_Children.end())
+			return nullptr;
 
-			// Notify the new child that its parent changed
-			(*it)->SetParent(WeakRef<Node>());
-		}
+		Ref<Node> child = *it;
+
+		if (auto tree = m_Tree.lock())
+			tree->DetachSubtree(child);
+
+		m_Children.erase(it);
+		OnChildRemoved(child.get());
+		MarkSnapshotDirty();
+
+		child->m_Parent = WeakRef<Node>();
+		return child;
+	}
+
+	void Node::LeaveTree(NodeTree& tree)
+	{
+		tree.m_Counters.NodesRemoved++;
+
+		OnExitTree(tree);
+		tree.RemoveGroupMembers(*this);
+
+		// Bound entities belong to the tree's world, so they don't follow us out of it
+		if (m_Entity.IsValid())
+			tree.GetWorld().UnbindNode(*this);
 	}
 
 	void Node::SetParent(const WeakRef<Node>& node)
@@ -88,11 +437,101 @@ namespace Nova
 		{
 			// Set our tree to our parent's tree
 			SetTree(parent->m_Tree);
+			UpdateIsActiveInTree(parent->m_IsActiveInTree);
 		}
 		else
 		{
 			// No parent, so no tree
 			SetTree(WeakRef<NodeTree>());
+			UpdateIsActiveInTree(true);
+		}
+	}
+
+	void Node::UpdateIsActiveInTree(bool isParentActiveInTree)
+	{
+		bool isActiveInTree = m_IsActive && isParentActiveInTree;
+
+		// Nothing below us changes if we didn't
+		if (m_IsActiveInTree == isActiveInTree)
+			return;
+
+		m_IsActiveInTree = isActiveInTree;
+
+		for (const auto& child : m_Children)
+		{
+			child->UpdateIsActiveInTree(isActiveInTree);
+		}
+	}
+
+	Node* Node::FindChildPtr(NameID name) const
+	{
+		if (m_ChildNameIndex)
+		{
+			auto it = m_ChildNameIndex->find(name);
+			return it != m_ChildNameIndex->end() ? it->second : nullptr;
+		}
+
+		for (const Ref<Node>& child : m_Children)
+		{
+			if (child->m_Name == name)
+				return child.get();
 		}
+
+		return nullptr;
+	}
+
+	void Node::UpdateChildNameIndex(NameID name)
+	{
+		if (!m_ChildNameIndex)
+			return;
+
+		auto it = std::find_if(m_Children.begin(), m_Children.end(), [name](const Ref<Node>& child) { return child->m_Name == name; });
+
+		if (it != m_Children.end())
+			(*m_ChildNameIndex)[name] = it->get();
+		else
+			m_ChildNameIndex->erase(name);
+	}
+
+	void Node::OnChildAdded(Node* child)
+	{
+		if (!m_ChildNameIndex)
+		{
+			if (m_Children.size() <= ChildNameIndexThreshold)
+				return;
+
+			// Build the index from scratch, keeping the first child with each name
+			m_ChildNameIndex = MakeManagedPtr<std::unordered_map<NameID, Node*>>();
+			m_ChildNameIndex->reserve(m_Children.size());
+
+			for (const Ref<Node>& other : m_Children)
+			{
+				m_ChildNameIndex->emplace(other->m_Name, other.get());
+			}
+
+			return;
+		}
+
+		// Siblings rarely share a name, so only look for the first one when they do
+		if (!m_ChildNameIndex->emplace(child->m_Name, child).second)
+			UpdateChildNameIndex(child->m_Name);
+	}
+
+	void Node::OnChildRemoved(Node* child)
+	{
+		if (!m_ChildNameIndex)
+			return;
+
+		// Drop the index once it's well below the threshold, so nodes hovering around it don't rebuild it over and over
+		if (m_Children.size() <= ChildNameIndexThreshold / 2)
+		{
+			m_ChildNameIndex.reset();
+			return;
+		}
+
+		auto it = m_ChildNameIndex->find(child->m_Name);
+
+		if (it != m_ChildNameIndex->end() && it->second == child)
+			UpdateChildNameIndex(child->m_Name);
 	}
-}
+}
\ No newline at end of file
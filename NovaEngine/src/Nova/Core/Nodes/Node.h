@@ -2,13 +2,30 @@
 
 #include "Nova/Core/EngineAPI.h"
 
+#include "Nova/Core/Entities/Entity.h"
 #include "Nova/Core/Events/TickListener.h"
 #include "Nova/Core/Types/String.h"
 #include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/NameID.h"
+#include "NodeGroup.h"
+#include "NodePropertyTable.h"
+
+#include <stdint.h>
+#include <string_view>
+#include <unordered_map>
 
 namespace Nova
 {
+	class NodeCommandBuffer;
+	class NodeSnapshot;
 	class NodeTree;
+	class PackedScene;
+	class Prefab;
+	class PropertyReader;
+	class PropertyWriter;
+	class TransformStorage;
+	class World;
+	struct NodeSnapshotRecord;
 
 	/// <summary>
 	/// Base class for all nodes that live in a NodeTree
@@ -26,13 +43,35 @@ namespace Nova
 
 	public:
 		/// <summary>
-		/// Comparator function to compare tick priorities between 2 nodes
+		/// The number of children a node needs before it indexes them by name. Smaller nodes just compare the name IDs of their children
 		/// </summary>
-		/// <param name="lhs">The first node</param>
-		/// <param name="rhs">The second node</param>
-		//static bool TickPriorityComparator(const Ref<Node>& lhs, const Ref<Node>& rhs);
-	
+		static constexpr size_t ChildNameIndexThreshold = 8;
+
 	public:
+		/// <summary>
+		/// Gets the name of this node
+		/// </summary>
+		/// <returns>The name of this node</returns>
+		const string& GetName() const { return m_Name.GetString(); }
+
+		/// <summary>
+		/// Gets the interned name of this node
+		/// </summary>
+		/// <returns>The name ID of this node</returns>
+		NameID GetNameID() const { return m_Name; }
+
+		/// <summary>
+		/// Renames this node. Deferred while the tree ticks independent subtrees in parallel
+		/// </summary>
+		/// <param name="name">The new name</param>
+		void SetName(const string& name);
+
+		/// <summary>
+		/// Renames this node to an interned name. Deferred while the tree ticks independent subtrees in parallel
+		/// </summary>
+		/// <param name="name">The new name</param>
+		void SetName(NameID name);
+
 		/// <summary>
 		/// Sets if this node is active
 		/// </summary>
@@ -49,7 +88,34 @@ namespace Nova
 		/// Gets if this node is active in the tree. Will return false if a parent of this node is in-active, even if this node itself is active
 		/// </summary>
 		/// <returns>True if this node is active in the tree</returns>
-		bool GetIsActiveInTree() const;
+		bool GetIsActiveInTree() const { return m_IsActiveInTree; }
+
+		/// <summary>
+		/// Sets the order this node ticks in among its siblings. Lower orders tick first, and siblings with the same order tick in the order they were added.
+		/// The node is moved to its new place among its parent's children right away, so ticks never have to sort
+		/// </summary>
+		/// <param name="tickOrder">The tick order</param>
+		void SetTickOrder(int tickOrder);
+
+		/// <summary>
+		/// Gets the order this node ticks in among its siblings
+		/// </summary>
+		/// <returns>The tick order</returns>
+		int GetTickOrder() const { return m_TickOrder; }
+
+		/// <summary>
+		/// Marks this node's subtree as independent of the rest of the tree, so it can be ticked on a worker thread alongside other independent subtrees.
+		/// The nodes of an independent subtree must only touch each other while ticking. Adding, removing, moving and renaming nodes is deferred until every
+		/// subtree has been ticked, and anything else that reaches outside the subtree must go through NodeTree::Defer
+		/// </summary>
+		/// <param name="isTickIndependent">True to tick this subtree independently</param>
+		void SetIsTickIndependent(bool isTickIndependent) { m_IsTickIndependent = isTickIndependent; MarkSnapshotDirty(); }
+
+		/// <summary>
+		/// Gets if this node's subtree is ticked independently of the rest of the tree
+		/// </summary>
+		/// <returns>True if this subtree is independent</returns>
+		bool GetIsTickIndependent() const { return m_IsTickIndependent; }
 
 		/// <summary>
 		/// Sets the owning tree for this node
@@ -58,23 +124,305 @@ namespace Nova
 		void SetTree(const WeakRef<NodeTree>& tree);
 
 		/// <summary>
-		/// Adds a node as a child of this node
+		/// Gets the tree this node is located in
+		/// </summary>
+		/// <returns>The owning tree, or nullptr if this node isn't in a tree</returns>
+		Ref<NodeTree> GetTree() const { return m_Tree.lock(); }
+
+		/// <summary>
+		/// Gets the parent of this node
+		/// </summary>
+		/// <returns>The parent, or nullptr if this node has no parent</returns>
+		Ref<Node> GetParent() const { return m_Parent.lock(); }
+
+		/// <summary>
+		/// Gets this node's children in tick order
+		/// </summary>
+		/// <returns>The children of this node</returns>
+		const List<Ref<Node>>& GetChildren() const { return m_Children; }
+
+		/// <summary>
+		/// Gets the entity this node is bound to in its tree's world. See World::BindNode
+		/// </summary>
+		/// <returns>The entity, or an invalid entity if this node isn't bound</returns>
+		Entity GetEntity() const { return m_Entity; }
+
+		/// <summary>
+		/// Adds this node to a group. While the node is in a tree, it's listed in the tree's members of the group
+		/// </summary>
+		/// <param name="group">The group to join</param>
+		void AddToGroup(NodeGroup group);
+
+		/// <summary>
+		/// Removes this node from a group
+		/// </summary>
+		/// <param name="group">The group to leave</param>
+		void RemoveFromGroup(NodeGroup group);
+
+		/// <summary>
+		/// Gets if this node is in a group
+		/// </summary>
+		/// <param name="group">The group</param>
+		/// <returns>True if this node is in the group</returns>
+		bool IsInGroup(NodeGroup group) const { return group.IsValid() && m_Groups.test(group.GetIndex()); }
+
+		/// <summary>
+		/// Gets if this node is in every one of a set of groups
+		/// </summary>
+		/// <param name="groups">The groups</param>
+		/// <returns>True if this node is in all of the groups</returns>
+		bool IsInGroups(const NodeGroupMask& groups) const { return (m_Groups & groups) == groups; }
+
+		/// <summary>
+		/// Gets the groups this node is in. Nodes keep their groups when they're moved between trees
+		/// </summary>
+		/// <returns>The group mask</returns>
+		const NodeGroupMask& GetGroups() const { return m_Groups; }
+
+		/// <summary>
+		/// Sets a named property on this node. Only overridden properties are stored per node, so the first one allocates this node's overrides
+		/// while its defaults stay shared
+		/// </summary>
+		/// <param name="name">The name of the property</param>
+		/// <param name="value">The value</param>
+		void SetProperty(NameID name, NodePropertyValue value);
+
+		/// <summary>
+		/// Finds a named property, looking in this node's overrides before its defaults
+		/// </summary>
+		/// <param name="name">The name of the property</param>
+		/// <returns>The value, or nullptr if the node doesn't have the property</returns>
+		const NodePropertyValue* FindProperty(NameID name) const;
+
+		/// <summary>
+		/// Finds a named property of a given type, looking in this node's overrides before its defaults
+		/// </summary>
+		/// <param name="name">The name of the property</param>
+		/// <returns>The value, or nullptr if the node doesn't have the property or it holds another type</returns>
+		template<typename T>
+		const T* FindProperty(NameID name) const
+		{
+			const NodePropertyValue* value = FindProperty(name);
+
+			return value ? std::get_if<T>(value) : nullptr;
+		}
+
+		/// <summary>
+		/// Gets if this node overrides a property
+		/// </summary>
+		/// <param name="name">The name of the property</param>
+		/// <returns>True if the property is set on this node itself</returns>
+		bool IsPropertyOverridden(NameID name) const { return m_PropertyOverrides && NodePropertyTable::Find(*m_PropertyOverrides, name); }
+
+		/// <summary>
+		/// Removes this node's override of a property, so it goes back to its default
+		/// </summary>
+		/// <param name="name">The name of the property</param>
+		void ResetProperty(NameID name);
+
+		/// <summary>
+		/// Sets the table this node's properties default to. Tables are immutable, so any number of nodes can share one
+		/// </summary>
+		/// <param name="properties">The default properties, or nullptr for none</param>
+		void SetDefaultProperties(const Ref<const NodePropertyTable>& properties) { m_DefaultProperties = properties; MarkSnapshotDirty(); }
+
+		/// <summary>
+		/// Gets the table this node's properties default to
+		/// </summary>
+		/// <returns>The default properties, or nullptr if there are none</returns>
+		const Ref<const NodePropertyTable>& GetDefaultProperties() const { return m_DefaultProperties; }
+
+		/// <summary>
+		/// Gets a table of this node's properties with its overrides applied. If nothing is overridden, the default table is shared as it is
+		/// </summary>
+		/// <returns>The properties, or nullptr if the node has none</returns>
+		Ref<const NodePropertyTable> FreezeProperties() const;
+
+		/// <summary>
+		/// Gets the number of properties this node overrides
+		/// </summary>
+		/// <returns>The number of overrides</returns>
+		size_t GetPropertyOverrideCount() const { return m_PropertyOverrides ? m_PropertyOverrides->size() : 0; }
+
+		/// <summary>
+		/// Gets the properties set on this node itself
+		/// </summary>
+		/// <returns>The overrides, sorted by name ID, or nullptr if the node doesn't override anything</returns>
+		const List<NodePropertyTable::Entry>* GetPropertyOverrides() const { return m_PropertyOverrides.get(); }
+
+		/// <summary>
+		/// Finds the first child with the given name
+		/// </summary>
+		/// <param name="name">The name of the child</param>
+		/// <returns>The child, or nullptr if there's no child with the name</returns>
+		Ref<Node> FindChild(NameID name);
+
+		/// <summary>
+		/// Finds a descendant by its path relative to this node, such as "Enemies/Boss". Each segment is the name of a child of the previous node,
+		/// and takes one hash probe (or a scan of a few name IDs) without allocating
+		/// </summary>
+		/// <param name="path">The names of the nodes to go through, separated by '/'. Empty segments are skipped</param>
+		/// <returns>The node, or nullptr if no node matches the path</returns>
+		Ref<Node> FindNode(std::string_view path);
+
+		/// <summary>
+		/// Adds a node as a child of this node, after the children with the same or a lower tick order. The node is removed from its previous parent first.
+		/// Deferred while the tree ticks independent subtrees in parallel, like the other structural changes
 		/// </summary>
 		/// <param name="node">The node to add as a child of this node</param>
 		void AddChild(const Ref<Node>& node);
 
+		/// <summary>
+		/// Moves one of this node's children to a new position among its siblings
+		/// </summary>
+		/// <param name="node">The child to move</param>
+		/// <param name="index">The new index of the child. Clamped to the range of siblings with the same tick order</param>
+		void MoveChild(const Ref<Node>& node, size_t index);
+
 		/// <summary>
 		/// Removes a node from this node's list of children
 		/// </summary>
 		/// <param name="node">The node to unparent</param>
 		void RemoveChild(const Ref<Node>& node);
 
+		/// <summary>
+		/// Adds a node as a child of this node at the end of its tree's next tick, along with the other queued changes. Safe to call at any point of
+		/// a tick, including from independent subtrees. Outside of a tree, the child is added right away
+		/// </summary>
+		/// <param name="node">The node to add as a child of this node</param>
+		void QueueAddChild(const Ref<Node>& node);
+
+		/// <summary>
+		/// Removes this node from its parent at the end of its tree's next tick, and releases it and its descendants. Large subtrees leave the tree and are
+		/// destroyed over several ticks, see NodeTree::FreeSubtree. Outside of a tree, the node is removed right away
+		/// </summary>
+		void QueueFree();
+
+		/// <summary>
+		/// Writes the properties of this node that are saved in scenes. The name, active state and children are saved separately.
+		/// Overrides must call the base version first
+		/// </summary>
+		/// <param name="writer">The writer for this node's property blob</param>
+		virtual void WriteProperties(PropertyWriter& writer) const {}
+
+		/// <summary>
+		/// Reads the properties written by WriteProperties when this node is loaded from a scene, before it has a parent.
+		/// Overrides must call the base version first
+		/// </summary>
+		/// <param name="reader">The reader for this node's property blob</param>
+		virtual void ReadProperties(PropertyReader& reader) {}
+
+	protected:
+		/// <summary>
+		/// Called once per tick by the owning tree. Parents are always ticked before their children
+		/// </summary>
+		/// <param name="deltaTime">The time since the last tick (in seconds)</param>
+		virtual void Tick(double deltaTime) {}
+
+		/// <summary>
+		/// Called after this node is added to a tree, either directly or along with one of its ancestors
+		/// </summary>
+		/// <param name="tree">The tree this node is now in</param>
+		virtual void OnEnterTree(NodeTree& tree) {}
+
+		/// <summary>
+		/// Called before this node is removed from a tree, either directly or along with one of its ancestors
+		/// </summary>
+		/// <param name="tree">The tree this node is leaving</param>
+		virtual void OnExitTree(NodeTree& tree) {}
+
+		/// <summary>
+		/// Tells snapshots that this node changed, so the next one saves it again instead of sharing its last record. Call it after changing
+		/// anything WriteProperties saves
+		/// </summary>
+		void MarkSnapshotDirty();
+
+	private:
+		/// <summary>
+		/// Where this node is listed in one of its tree's group member arrays
+		/// </summary>
+		struct GroupSlot
+		{
+			uint32_t Group;
+			uint32_t Position;
+		};
+
 	private:
 		void SetParent(const WeakRef<Node>& node);
 
+		/// <summary>
+		/// Updates the cached active-in-tree state of this node, and of its subtree if it changed
+		/// </summary>
+		/// <param name="isParentActiveInTree">True if this node's parent is active in the tree (or it has no parent)</param>
+		void UpdateIsActiveInTree(bool isParentActiveInTree);
+
+		/// <summary>
+		/// Takes a child out of this node's children and out of the tree's flattened order, without it leaving the tree
+		/// </summary>
+		/// <param name="node">The child to unlink</param>
+		/// <returns>The child, or nullptr if the node isn't one of our children</returns>
+		Ref<Node> UnlinkChild(const Ref<Node>& node);
+
+		/// <summary>
+		/// Unregisters this node alone from a tree it's leaving: its counters, groups and entity, and OnExitTree. Doesn't touch its children
+		/// </summary>
+		/// <param name="tree">The tree being left</param>
+		void LeaveTree(NodeTree& tree);
+
+		/// <summary>
+		/// Inserts a node into this node's children and tells the tree about it
+		/// </summary>
+		/// <param name="node">The node to insert</param>
+		/// <param name="index">The index among the children to insert at. Clamped to the range of siblings with the same tick order</param>
+		void InsertChild(const Ref<Node>& node, size_t index);
+
+		/// <summary>
+		/// Moves a child to another index without it leaving the tree, and moves its subtree in the tree's flattened order to match
+		/// </summary>
+		/// <param name="child">The child to move</param>
+		/// <param name="index">The new index. Clamped to the range of siblings with the same tick order</param>
+		void RepositionChild(const Ref<Node>& child, size_t index);
+
+		/// <summary>
+		/// Clamps an index into the range of children with the given tick order. Children are kept sorted by tick order, so this is a binary search
+		/// </summary>
+		size_t ClampToTickOrder(size_t index, int tickOrder) const;
+
+		/// <summary>
+		/// Gets the command buffer to record structural changes to this node in, if its tree is ticking independent subtrees in parallel
+		/// </summary>
+		/// <returns>The calling thread's command buffer, or nullptr if the change can be made right away</returns>
+		NodeCommandBuffer* GetDeferredCommands() const;
+
+		/// <summary>
+		/// Appends a child while neither node is in a tree. Skips the parent and tree bookkeeping AddChild has to do, for building loaded scenes
+		/// </summary>
+		/// <param name="child">The child, which must not have a parent</param>
+		void AppendDetachedChild(const Ref<Node>& child);
+
+		/// <summary>
+		/// Finds the first child with the given name without taking a reference to it
+		/// </summary>
+		Node* FindChildPtr(NameID name) const;
+
+		/// <summary>
+		/// Points the name index entry for a name at the first child with that name, or removes it if there is none
+		/// </summary>
+		void UpdateChildNameIndex(NameID name);
+
+		/// <summary>
+		/// Updates the name index after a child was added
+		/// </summary>
+		void OnChildAdded(Node* child);
+
+		/// <summary>
+		/// Updates the name index after a child was removed
+		/// </summary>
+		void OnChildRemoved(Node* child);
+
 	private:
 		/// The name of this node
-		string m_Name;
+		NameID m_Name;
 
 		/// The order of ticking for this node
 		int m_TickOrder = 0;
@@ -82,6 +430,15 @@ namespace Nova
 		/// This node's active state
 		bool m_IsActive = true;
 
+		/// True if this node and all of its parents are active. Kept up to date when the active state or the parent changes
+		bool m_IsActiveInTree = true;
+
+		/// True if this node's subtree can be ticked in parallel with other independent subtrees
+		bool m_IsTickIndependent = false;
+
+		/// True while this node is in a freed subtree that its tree hasn't taken it out of yet. See NodeTree::FreeSubtree
+		bool m_IsLeavingTree = false;
+
 		/// The parent of this node
 		WeakRef<Node> m_Parent;
 
@@ -91,6 +448,35 @@ namespace Nova
 		/// A list of this node's children
 		List<Ref<Node>> m_Children;
 
+		/// The first child with each name. Only built once there are enough children for hashing to beat a scan
+		ManagedPtr<std::unordered_map<NameID, Node*>> m_ChildNameIndex;
+
+		/// This node's position in the tree's flattened depth-first order, or SIZE_MAX if it isn't in one
+		size_t m_FlatIndex = SIZE_MAX;
+
+		/// The groups this node is in
+		NodeGroupMask m_Groups;
+
+		/// This node's position in its tree's member array of each of its groups. Empty while the node isn't in a tree
+		List<GroupSlot> m_GroupSlots;
+
+		/// The properties this node shares with other nodes, such as the other instances of its prefab
+		Ref<const NodePropertyTable> m_DefaultProperties;
+
+		/// The properties set on this node itself, sorted by name ID. Only allocated once one is set
+		ManagedPtr<List<NodePropertyTable::Entry>> m_PropertyOverrides;
+
+		/// The record of this node's subtree in the last snapshot, or nullptr if something in the subtree has changed since
+		Ref<const NodeSnapshotRecord> m_SnapshotRecord;
+
+		/// The entity this node is bound to in its tree's world
+		Entity m_Entity;
+
+		friend NodeSnapshot;
 		friend NodeTree;
+		friend PackedScene;
+		friend Prefab;
+		friend TransformStorage;
+		friend World;
 	};
-}
\ No newline at end of file
+}
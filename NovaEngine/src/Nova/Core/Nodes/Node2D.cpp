@@ -0,0 +1,164 @@
+#include "Node2D.h"
+#include "NodeTree.h"
+
+#include "Nova/Core/Scenes/PropertyStream.h"
+
+#include <cmath>
+
+namespace Nova
+{
+	static void WriteVector2(PropertyWriter& writer, const Vector2& value)
+	{
+		writer.Write(value.X);
+		writer.Write(value.Y);
+	}
+
+	static Vector2 ReadVector2(PropertyReader& reader)
+	{
+		const double x = reader.Read<double>();
+		return Vector2(x, reader.Read<double>());
+	}
+
+	Node2D::Node2D(const string& name) :
+		TransformNode(name)
+	{}
+
+	Node2D::~Node2D()
+	{
+		if (m_SpatialIndex)
+			m_SpatialIndex->Unregister(this);
+	}
+
+	void Node2D::SetPosition(const Vector2& position)
+	{
+		m_Position = position;
+		OnLocalTransformChanged();
+	}
+
+	void Node2D::SetRotation(double rotation)
+	{
+		m_Rotation = rotation;
+		OnLocalTransformChanged();
+	}
+
+	void Node2D::SetScale(const Vector2& scale)
+	{
+		m_Scale = scale;
+		OnLocalTransformChanged();
+	}
+
+	Vector2 Node2D::GetWorldPosition() const
+	{
+		Vector3 translation = GetWorldMatrix().GetTranslation();
+		return Vector2(translation.X, translation.Y);
+	}
+
+	void Node2D::SetBounds(const Rect& bounds)
+	{
+		m_Bounds = bounds;
+		MarkSnapshotDirty();
+
+		if (m_HasBounds)
+			return;
+
+		m_HasBounds = true;
+
+		// The index picks up the new bounds on its next update
+		if (Ref<NodeTree> tree = GetTree())
+			tree->Defer([self = GetSelfRef<Node2D>()]() { self->UpdateSpatialRegistration(); });
+	}
+
+	Rect Node2D::GetWorldBounds() const
+	{
+		const Matrix4 world = GetWorldMatrix();
+
+		// A rotated or scaled box covers the extent of each of its axes as transformed by the matrix
+		const Vector2 halfSize(m_Bounds.Size.X * 0.5, m_Bounds.Size.Y * 0.5);
+		const Vector3 center = world.TransformPoint(Vector3((float)(m_Bounds.Position.X + halfSize.X), (float)(m_Bounds.Position.Y + halfSize.Y), 0.0f));
+
+		const double extentX = std::abs(world.Elements[0] * halfSize.X) + std::abs(world.Elements[4] * halfSize.Y);
+		const double extentY = std::abs(world.Elements[1] * halfSize.X) + std::abs(world.Elements[5] * halfSize.Y);
+
+		return Rect(Vector2(extentX * 2.0, extentY * 2.0), Vector2(center.X - extentX, center.Y - extentY));
+	}
+
+	void Node2D::ClearBounds()
+	{
+		m_HasBounds = false;
+		MarkSnapshotDirty();
+
+		if (Ref<NodeTree> tree = GetTree())
+			tree->Defer([self = GetSelfRef<Node2D>()]() { self->UpdateSpatialRegistration(); });
+	}
+
+	void Node2D::UpdateSpatialRegistration()
+	{
+		// The bounds may have changed back, or the node left the tree, by the time a deferred update runs
+		Ref<NodeTree> tree = GetTree();
+
+		if (m_HasBounds && tree && !m_SpatialIndex)
+			tree->GetSpatialIndex().Register(this);
+		else if ((!m_HasBounds || !tree) && m_SpatialIndex)
+			m_SpatialIndex->Unregister(this);
+	}
+
+	// Node ----------
+	void Node2D::WriteProperties(PropertyWriter& writer) const
+	{
+		TransformNode::WriteProperties(writer);
+
+		WriteVector2(writer, m_Position);
+		writer.Write(m_Rotation);
+		WriteVector2(writer, m_Scale);
+		writer.Write(m_HasBounds);
+
+		if (m_HasBounds)
+		{
+			WriteVector2(writer, m_Bounds.Size);
+			WriteVector2(writer, m_Bounds.Position);
+		}
+	}
+
+	void Node2D::ReadProperties(PropertyReader& reader)
+	{
+		TransformNode::ReadProperties(reader);
+
+		m_Position = ReadVector2(reader);
+		m_Rotation = reader.Read<double>();
+		m_Scale = ReadVector2(reader);
+
+		if (reader.Read<bool>())
+		{
+			const Vector2 size = ReadVector2(reader);
+			SetBounds(Rect(size, ReadVector2(reader)));
+		}
+
+		OnLocalTransformChanged();
+	}
+
+	// Node ----------
+
+	// TransformNode ----------
+	Matrix4 Node2D::ComputeLocalMatrix() const
+	{
+		return Matrix4::FromTranslationRotationScale2D(m_Position, m_Rotation, m_Scale);
+	}
+
+	void Node2D::OnEnterTree(NodeTree& tree)
+	{
+		TransformNode::OnEnterTree(tree);
+
+		if (m_HasBounds)
+			tree.GetSpatialIndex().Register(this);
+	}
+
+	void Node2D::OnExitTree(NodeTree& tree)
+	{
+		if (m_SpatialIndex)
+			m_SpatialIndex->Unregister(this);
+
+		TransformNode::OnExitTree(tree);
+	}
+
+	// TransformNode ----------
+}
@@ -0,0 +1,144 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Rect.h"
+#include "Nova/Core/Types/Vector.h"
+#include "TransformNode.h"
+
+#include <stdint.h>
+
+namespace Nova
+{
+	class SpatialIndex;
+
+	/// <summary>
+	/// A node with a position, rotation and scale in 2D space
+	/// </summary>
+	class NovaAPI Node2D : public TransformNode
+	{
+	public:
+		Node2D(const string& name);
+		virtual ~Node2D();
+
+	public:
+		/// <summary>
+		/// Sets the position of this node relative to its transform parent
+		/// </summary>
+		/// <param name="position">The local position</param>
+		void SetPosition(const Vector2& position);
+
+		/// <summary>
+		/// Gets the position of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local position</returns>
+		const Vector2& GetPosition() const { return m_Position; }
+
+		/// <summary>
+		/// Sets the rotation of this node relative to its transform parent
+		/// </summary>
+		/// <param name="rotation">The local rotation (in radians)</param>
+		void SetRotation(double rotation);
+
+		/// <summary>
+		/// Gets the rotation of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local rotation (in radians)</returns>
+		double GetRotation() const { return m_Rotation; }
+
+		/// <summary>
+		/// Sets the scale of this node relative to its transform parent
+		/// </summary>
+		/// <param name="scale">The local scale</param>
+		void SetScale(const Vector2& scale);
+
+		/// <summary>
+		/// Gets the scale of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local scale</returns>
+		const Vector2& GetScale() const { return m_Scale; }
+
+		/// <summary>
+		/// Gets the position of this node in the world
+		/// </summary>
+		/// <returns>The world position</returns>
+		Vector2 GetWorldPosition() const;
+
+		/// <summary>
+		/// Sets the bounds of this node in its local space. Nodes with bounds are indexed by their tree's SpatialIndex. The index is shared by the whole
+		/// tree, so from an independent subtree the node joins it once the parallel part of the tick is done
+		/// </summary>
+		/// <param name="bounds">The local bounds</param>
+		void SetBounds(const Rect& bounds);
+
+		/// <summary>
+		/// Removes the bounds of this node, taking it out of its tree's SpatialIndex (once the parallel part of the tick is done, if it's in progress)
+		/// </summary>
+		void ClearBounds();
+
+		/// <summary>
+		/// Gets the bounds of this node in its local space
+		/// </summary>
+		/// <returns>The local bounds</returns>
+		const Rect& GetBounds() const { return m_Bounds; }
+
+		/// <summary>
+		/// Gets the axis-aligned box around this node's bounds in the world
+		/// </summary>
+		/// <returns>The world bounds</returns>
+		Rect GetWorldBounds() const;
+
+		/// <summary>
+		/// Gets if this node has bounds
+		/// </summary>
+		/// <returns>True if this node has bounds</returns>
+		bool GetHasBounds() const { return m_HasBounds; }
+
+	// Node ----------
+	public:
+		virtual void WriteProperties(PropertyWriter& writer) const override;
+		virtual void ReadProperties(PropertyReader& reader) override;
+
+	// Node ----------
+
+	// TransformNode ----------
+	public:
+		virtual Matrix4 ComputeLocalMatrix() const override;
+		virtual TransformSpace GetTransformSpace() const override { return TransformSpace::Space2D; }
+
+	protected:
+		virtual void OnEnterTree(NodeTree& tree) override;
+		virtual void OnExitTree(NodeTree& tree) override;
+
+	// TransformNode ----------
+
+	private:
+		/// <summary>
+		/// Registers with or unregisters from the tree's index to match whether this node has bounds. Must not run while the tree ticks in parallel
+		/// </summary>
+		void UpdateSpatialRegistration();
+
+	private:
+		/// The local position
+		Vector2 m_Position;
+
+		/// The local rotation (in radians)
+		double m_Rotation = 0.0;
+
+		/// The local scale
+		Vector2 m_Scale = Vector2(1.0, 1.0);
+
+		/// The local bounds
+		Rect m_Bounds;
+
+		/// True if this node has bounds
+		bool m_HasBounds = false;
+
+		/// The index this node is registered in, or nullptr if it isn't
+		SpatialIndex* m_SpatialIndex = nullptr;
+
+		/// This node's entry in the index
+		int32_t m_SpatialEntry = -1;
+
+		friend SpatialIndex;
+	};
+}
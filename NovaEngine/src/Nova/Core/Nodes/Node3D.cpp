@@ -0,0 +1,59 @@
+#include "Node3D.h"
+
+#include "Nova/Core/Scenes/PropertyStream.h"
+
+namespace Nova
+{
+	Node3D::Node3D(const string& name) :
+		TransformNode(name)
+	{}
+
+	void Node3D::SetPosition(const Vector3& position)
+	{
+		m_Position = position;
+		OnLocalTransformChanged();
+	}
+
+	void Node3D::SetRotation(const Quaternion& rotation)
+	{
+		m_Rotation = rotation;
+		OnLocalTransformChanged();
+	}
+
+	void Node3D::SetScale(const Vector3& scale)
+	{
+		m_Scale = scale;
+		OnLocalTransformChanged();
+	}
+
+	// Node ----------
+	void Node3D::WriteProperties(PropertyWriter& writer) const
+	{
+		TransformNode::WriteProperties(writer);
+
+		writer.Write(m_Position);
+		writer.Write(m_Rotation);
+		writer.Write(m_Scale);
+	}
+
+	void Node3D::ReadProperties(PropertyReader& reader)
+	{
+		TransformNode::ReadProperties(reader);
+
+		m_Position = reader.Read<Vector3>();
+		m_Rotation = reader.Read<Quaternion>();
+		m_Scale = reader.Read<Vector3>();
+
+		OnLocalTransformChanged();
+	}
+
+	// Node ----------
+
+	// TransformNode ----------
+	Matrix4 Node3D::ComputeLocalMatrix() const
+	{
+		return Matrix4::FromTranslationRotationScale(m_Position, m_Rotation, m_Scale);
+	}
+
+	// TransformNode ----------
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Vector.h"
+#include "Nova/Core/Types/Quaternion.h"
+#include "TransformNode.h"
+
+namespace Nova
+{
+	/// <summary>
+	/// A node with a position, rotation and scale in 3D space
+	/// </summary>
+	class NovaAPI Node3D : public TransformNode
+	{
+	public:
+		Node3D(const string& name);
+
+	public:
+		/// <summary>
+		/// Sets the position of this node relative to its transform parent
+		/// </summary>
+		/// <param name="position">The local position</param>
+		void SetPosition(const Vector3& position);
+
+		/// <summary>
+		/// Gets the position of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local position</returns>
+		const Vector3& GetPosition() const { return m_Position; }
+
+		/// <summary>
+		/// Sets the rotation of this node relative to its transform parent
+		/// </summary>
+		/// <param name="rotation">The local rotation</param>
+		void SetRotation(const Quaternion& rotation);
+
+		/// <summary>
+		/// Gets the rotation of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local rotation</returns>
+		const Quaternion& GetRotation() const { return m_Rotation; }
+
+		/// <summary>
+		/// Sets the scale of this node relative to its transform parent
+		/// </summary>
+		/// <param name="scale">The local scale</param>
+		void SetScale(const Vector3& scale);
+
+		/// <summary>
+		/// Gets the scale of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local scale</returns>
+		const Vector3& GetScale() const { return m_Scale; }
+
+		/// <summary>
+		/// Gets the position of this node in the world
+		/// </summary>
+		/// <returns>The world position</returns>
+		Vector3 GetWorldPosition() const { return GetWorldMatrix().GetTranslation(); }
+
+	// Node ----------
+	public:
+		virtual void WriteProperties(PropertyWriter& writer) const override;
+		virtual void ReadProperties(PropertyReader& reader) override;
+
+	// Node ----------
+
+	// TransformNode ----------
+	public:
+		virtual Matrix4 ComputeLocalMatrix() const override;
+		virtual TransformSpace GetTransformSpace() const override { return TransformSpace::Space3D; }
+
+	// TransformNode ----------
+
+	private:
+		/// The local position
+		Vector3 m_Position;
+
+		/// The local rotation
+		Quaternion m_Rotation;
+
+		/// The local scale
+		Vector3 m_Scale = Vector3::ONE;
+	};
+}
@@ -0,0 +1,21 @@
+#include "NodeCommandBuffer.h"
+
+namespace Nova
+{
+	void NodeCommandBuffer::Add(Command command)
+	{
+		m_Commands.push_back(std::move(command));
+	}
+
+	void NodeCommandBuffer::Execute()
+	{
+		// Commands can record more commands, which would invalidate iterators
+		for (size_t i = 0; i < m_Commands.size(); i++)
+		{
+			Command command = std::move(m_Commands[i]);
+			command();
+		}
+
+		m_Commands.clear();
+	}
+}
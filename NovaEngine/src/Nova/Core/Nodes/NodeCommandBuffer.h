@@ -0,0 +1,44 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+
+#include <functional>
+#include <stddef.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A list of changes to a NodeTree recorded by one thread while the tree ticks independent subtrees in parallel, and applied once they're done.
+	/// Aligned to a cache line so threads recording into neighbouring buffers don't share one
+	/// </summary>
+	class alignas(64) NovaAPI NodeCommandBuffer
+	{
+	public:
+		using Command = std::function<void()>;
+
+	public:
+		/// <summary>
+		/// Records a command to run later
+		/// </summary>
+		/// <param name="command">The command</param>
+		void Add(Command command);
+
+		/// <summary>
+		/// Runs the recorded commands in the order they were added, and clears the buffer. Commands added while running are run too
+		/// </summary>
+		void Execute();
+
+		/// <summary>
+		/// Gets the number of recorded commands
+		/// </summary>
+		/// <returns>The number of commands</returns>
+		size_t GetCount() const { return m_Commands.size(); }
+
+	private:
+		/// <summary>
+		/// The recorded commands
+		/// </summary>
+		List<Command> m_Commands;
+	};
+}
@@ -0,0 +1,12 @@
+#include "NodeExceptions.h"
+
+namespace Nova
+{
+	NodeGroupException::NodeGroupException(const string& error) :
+		Exception(error)
+	{}
+
+	NodeTypeException::NodeTypeException(const string& error) :
+		Exception(error)
+	{}
+}
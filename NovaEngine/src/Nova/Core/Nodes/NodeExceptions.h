@@ -0,0 +1,20 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Exception.h"
+#include "Nova/Core/Types/String.h"
+
+namespace Nova
+{
+	class NovaAPI NodeGroupException : public Exception
+	{
+	public:
+		NodeGroupException(const string& error);
+	};
+
+	class NovaAPI NodeTypeException : public Exception
+	{
+	public:
+		NodeTypeException(const string& error);
+	};
+}
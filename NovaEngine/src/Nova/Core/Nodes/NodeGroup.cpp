@@ -0,0 +1,96 @@
+#include "NodeGroup.h"
+#include "NodeExceptions.h"
+
+#include "Nova/Core/Types/List.h"
+
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Nova
+{
+	namespace
+	{
+		/// <summary>
+		/// The bit index of every group name used so far
+		/// </summary>
+		struct NodeGroupTable
+		{
+			std::shared_mutex Mutex;
+			std::unordered_map<NameID, uint32_t> Indices;
+			List<NameID> Names;
+		};
+
+		NodeGroupTable& GetNodeGroupTable()
+		{
+			static NodeGroupTable table;
+			return table;
+		}
+	}
+
+	NodeGroup::NodeGroup(NameID name) :
+		m_Name(name)
+	{
+		NodeGroupTable& table = GetNodeGroupTable();
+
+		{
+			std::shared_lock lock(table.Mutex);
+
+			auto it = table.Indices.find(name);
+
+			if (it != table.Indices.end())
+			{
+				m_Index = it->second;
+				return;
+			}
+		}
+
+		std::unique_lock lock(table.Mutex);
+
+		// Another thread may have added the group while we weren't holding the lock
+		auto it = table.Indices.find(name);
+
+		if (it != table.Indices.end())
+		{
+			m_Index = it->second;
+			return;
+		}
+
+		if (table.Indices.size() >= MaxGroups)
+			throw NodeGroupException(FormatString("Can't create node group \"{0}\", as all {1} groups are in use", name.GetString(), MaxGroups));
+
+		m_Index = (uint32_t)table.Indices.size();
+		table.Indices.emplace(name, m_Index);
+		table.Names.push_back(name);
+	}
+
+	bool NodeGroup::TryFind(NameID name, NodeGroup& group)
+	{
+		NodeGroupTable& table = GetNodeGroupTable();
+		std::shared_lock lock(table.Mutex);
+
+		auto it = table.Indices.find(name);
+
+		if (it == table.Indices.end())
+			return false;
+
+		group.m_Name = name;
+		group.m_Index = it->second;
+
+		return true;
+	}
+
+	bool NodeGroup::TryFindByIndex(uint32_t index, NodeGroup& group)
+	{
+		NodeGroupTable& table = GetNodeGroupTable();
+		std::shared_lock lock(table.Mutex);
+
+		if (index >= table.Names.size())
+			return false;
+
+		group.m_Name = table.Names[index];
+		group.m_Index = index;
+
+		return true;
+	}
+}
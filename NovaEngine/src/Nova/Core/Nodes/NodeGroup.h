@@ -0,0 +1,91 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/NameID.h"
+
+#include <bitset>
+#include <stdint.h>
+#include <string_view>
+
+namespace Nova
+{
+	/// <summary>
+	/// A named group of nodes, such as "Enemies". Each group name is given a bit index the first time it's used, shared by every tree,
+	/// so a node's groups fit in a fixed-size bitset. Keep groups around instead of constructing them from names, which takes a lookup
+	/// </summary>
+	class NovaAPI NodeGroup
+	{
+	public:
+		/// <summary>
+		/// The number of distinct group names that can be used
+		/// </summary>
+		static constexpr uint32_t MaxGroups = 128;
+
+	public:
+		/// <summary>
+		/// Constructs an invalid group
+		/// </summary>
+		NodeGroup() = default;
+
+		/// <summary>
+		/// Gets the group with the given name, giving it a bit index if it's new. Throws a NodeGroupException if every index is taken
+		/// </summary>
+		/// <param name="name">The name of the group</param>
+		explicit NodeGroup(NameID name);
+
+		/// <summary>
+		/// Gets the group with the given name, giving it a bit index if it's new. Throws a NodeGroupException if every index is taken
+		/// </summary>
+		/// <param name="name">The name of the group</param>
+		explicit NodeGroup(std::string_view name) : NodeGroup(NameID(name)) {}
+
+		/// <summary>
+		/// Finds a group that has been used before, without creating it
+		/// </summary>
+		/// <param name="name">The name of the group</param>
+		/// <param name="group">Set to the group if it exists</param>
+		/// <returns>True if the group exists</returns>
+		static bool TryFind(NameID name, NodeGroup& group);
+
+		/// <summary>
+		/// Finds the group that was given a bit index, such as to save the groups in a mask by name
+		/// </summary>
+		/// <param name="index">The bit index of the group</param>
+		/// <param name="group">Set to the group if it exists</param>
+		/// <returns>True if a group has the index</returns>
+		static bool TryFindByIndex(uint32_t index, NodeGroup& group);
+
+		/// <summary>
+		/// Gets the name of this group
+		/// </summary>
+		/// <returns>The group name</returns>
+		NameID GetName() const { return m_Name; }
+
+		/// <summary>
+		/// Gets this group's bit in node group masks
+		/// </summary>
+		/// <returns>The bit index</returns>
+		uint32_t GetIndex() const { return m_Index; }
+
+		/// <summary>
+		/// Gets if this group was constructed from a name
+		/// </summary>
+		/// <returns>True if the group is valid</returns>
+		bool IsValid() const { return m_Index < MaxGroups; }
+
+		bool operator==(const NodeGroup& other) const { return m_Index == other.m_Index; }
+		bool operator!=(const NodeGroup& other) const { return m_Index != other.m_Index; }
+
+	private:
+		/// The name of the group
+		NameID m_Name;
+
+		/// The bit index of the group
+		uint32_t m_Index = UINT32_MAX;
+	};
+
+	/// <summary>
+	/// A set of groups, with one bit for each group's index
+	/// </summary>
+	using NodeGroupMask = std::bitset<NodeGroup::MaxGroups>;
+}
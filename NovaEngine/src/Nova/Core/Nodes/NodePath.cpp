@@ -0,0 +1,52 @@
+#include "NodePath.h"
+#include "NodeTree.h"
+
+namespace Nova
+{
+	NodePath::NodePath(std::string_view path)
+	{
+		for (size_t start = 0; start < path.size();)
+		{
+			size_t end = std::min(path.find('/', start), path.size());
+
+			if (end > start)
+				m_Segments.emplace_back(path.substr(start, end - start));
+
+			start = end + 1;
+		}
+	}
+
+	Ref<Node> NodePath::Resolve(NodeTree& tree) const
+	{
+		if (m_CachedTree.lock().get() == &tree && m_CachedVersion == tree.GetStructureVersion())
+			return m_CachedNode.lock();
+
+		Ref<Node> node = tree.GetRootNode();
+
+		for (size_t i = 0; i < m_Segments.size() && node; i++)
+		{
+			node = node->FindChild(m_Segments[i]);
+		}
+
+		m_CachedTree = tree.GetRootNode()->GetTree();
+		m_CachedVersion = tree.GetStructureVersion();
+		m_CachedNode = node;
+
+		return node;
+	}
+
+	string NodePath::ToString() const
+	{
+		string path;
+
+		for (const NameID& segment : m_Segments)
+		{
+			if (!path.empty())
+				path += '/';
+
+			path += segment.GetString();
+		}
+
+		return path;
+	}
+}
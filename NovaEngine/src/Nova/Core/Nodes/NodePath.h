@@ -0,0 +1,71 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/NameID.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/String.h"
+
+#include <stdint.h>
+#include <string_view>
+
+namespace Nova
+{
+	class Node;
+	class NodeTree;
+
+	/// <summary>
+	/// A path from a tree's root to a node, with its names interned up front. Resolving it remembers the node it found, and returns it again
+	/// without any lookups until the tree's structure changes. Not thread safe, as resolving updates the cache
+	/// </summary>
+	class NovaAPI NodePath
+	{
+	public:
+		/// <summary>
+		/// Creates a path from its string form
+		/// </summary>
+		/// <param name="path">The names of the nodes to go through from the root, separated by '/'. Empty segments are skipped</param>
+		NodePath(std::string_view path);
+
+	public:
+		/// <summary>
+		/// Finds the node this path leads to
+		/// </summary>
+		/// <param name="tree">The tree to look in</param>
+		/// <returns>The node, or nullptr if no node matches the path</returns>
+		Ref<Node> Resolve(NodeTree& tree) const;
+
+		/// <summary>
+		/// Gets the names of the nodes along the path
+		/// </summary>
+		/// <returns>The names</returns>
+		const List<NameID>& GetSegments() const { return m_Segments; }
+
+		/// <summary>
+		/// Gets the string form of this path
+		/// </summary>
+		/// <returns>The names along the path, separated by '/'</returns>
+		string ToString() const;
+
+	private:
+		/// <summary>
+		/// The names of the nodes along the path
+		/// </summary>
+		List<NameID> m_Segments;
+
+		/// <summary>
+		/// The tree the cached result came from
+		/// </summary>
+		mutable WeakRef<NodeTree> m_CachedTree;
+
+		/// <summary>
+		/// The tree's structure version when the result was cached
+		/// </summary>
+		mutable uint64_t m_CachedVersion = 0;
+
+		/// <summary>
+		/// The node found last time, or empty if none was found
+		/// </summary>
+		mutable WeakRef<Node> m_CachedNode;
+	};
+}
@@ -0,0 +1,41 @@
+#include "NodePropertyTable.h"
+
+#include <algorithm>
+
+namespace Nova
+{
+	namespace
+	{
+		bool EntryNameLess(const NodePropertyTable::Entry& entry, NameID name)
+		{
+			return entry.first < name;
+		}
+	}
+
+	NodePropertyTable::NodePropertyTable(List<Entry>&& entries) :
+		m_Entries(std::move(entries))
+	{
+		// Stable, so the last of several values for a name ends up last among them
+		std::stable_sort(m_Entries.begin(), m_Entries.end(), [](const Entry& lhs, const Entry& rhs) { return lhs.first < rhs.first; });
+
+		auto last = std::unique(m_Entries.rbegin(), m_Entries.rend(), [](const Entry& lhs, const Entry& rhs) { return lhs.first == rhs.first; });
+		m_Entries.erase(m_Entries.begin(), last.base());
+	}
+
+	const NodePropertyValue* NodePropertyTable::Find(const List<Entry>& entries, NameID name)
+	{
+		auto it = std::lower_bound(entries.begin(), entries.end(), name, EntryNameLess);
+
+		return it != entries.end() && it->first == name ? &it->second : nullptr;
+	}
+
+	void NodePropertyTable::Set(List<Entry>& entries, NameID name, NodePropertyValue&& value)
+	{
+		auto it = std::lower_bound(entries.begin(), entries.end(), name, EntryNameLess);
+
+		if (it != entries.end() && it->first == name)
+			it->second = std::move(value);
+		else
+			entries.emplace(it, name, std::move(value));
+	}
+}
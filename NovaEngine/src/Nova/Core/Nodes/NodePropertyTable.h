@@ -0,0 +1,72 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/NameID.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/String.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <utility>
+#include <variant>
+
+namespace Nova
+{
+	/// <summary>
+	/// The value of a named node property
+	/// </summary>
+	using NodePropertyValue = std::variant<bool, int64_t, double, string>;
+
+	/// <summary>
+	/// An immutable table of named property values. Tables are shared by reference, so every instance of a prefab reads its defaults from one table
+	/// </summary>
+	class NovaAPI NodePropertyTable : public RefCounted
+	{
+	public:
+		using Entry = std::pair<NameID, NodePropertyValue>;
+
+	public:
+		/// <summary>
+		/// Creates a table from a list of properties. If a name is listed more than once, the last value is kept
+		/// </summary>
+		/// <param name="entries">The properties</param>
+		NodePropertyTable(List<Entry>&& entries);
+
+	public:
+		/// <summary>
+		/// Finds a property
+		/// </summary>
+		/// <param name="name">The name of the property</param>
+		/// <returns>The value, or nullptr if the table doesn't have the property</returns>
+		const NodePropertyValue* Find(NameID name) const { return Find(m_Entries, name); }
+
+		/// <summary>
+		/// Gets the properties, sorted by name ID
+		/// </summary>
+		/// <returns>The entries</returns>
+		const List<Entry>& GetEntries() const { return m_Entries; }
+
+		/// <summary>
+		/// Finds a property in a list of entries sorted by name ID
+		/// </summary>
+		/// <param name="entries">The sorted entries</param>
+		/// <param name="name">The name of the property</param>
+		/// <returns>The value, or nullptr if there's no entry with the name</returns>
+		static const NodePropertyValue* Find(const List<Entry>& entries, NameID name);
+
+		/// <summary>
+		/// Sets a property in a list of entries sorted by name ID, keeping it sorted
+		/// </summary>
+		/// <param name="entries">The sorted entries</param>
+		/// <param name="name">The name of the property</param>
+		/// <param name="value">The value</param>
+		static void Set(List<Entry>& entries, NameID name, NodePropertyValue&& value);
+
+	private:
+		/// <summary>
+		/// The properties, sorted by name ID for binary searches
+		/// </summary>
+		List<Entry> m_Entries;
+	};
+}
@@ -0,0 +1,129 @@
+#include "NodeSlabPool.h"
+
+#include <new>
+
+namespace Nova
+{
+	NodeSlabPool::NodeSlabPool(size_t slabSize) :
+		m_SlabSize(slabSize < MaxSlabAllocationSize ? MaxSlabAllocationSize : slabSize)
+	{}
+
+	NodeSlabPool::~NodeSlabPool()
+	{
+		// Everything allocated from a slab is gone by now, so the slabs can be freed in bulk
+		for (void* slab : m_Slabs)
+		{
+			::operator delete(slab, std::align_val_t(Granularity));
+		}
+	}
+
+	void NodeSlabPool::Release()
+	{
+		if (m_RefCount.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			delete this;
+	}
+
+	void* NodeSlabPool::Allocate(size_t size)
+	{
+		if (size == 0)
+			size = 1;
+
+		AddRef();
+
+		if (size > MaxSlabAllocationSize)
+		{
+			m_ReservedBytes.fetch_add(size, std::memory_order_relaxed);
+			m_OversizedBytes.fetch_add(size, std::memory_order_relaxed);
+
+			return ::operator new(size, std::align_val_t(Granularity));
+		}
+
+		const size_t classIndex = (size - 1) / Granularity;
+		const size_t classSize = (classIndex + 1) * Granularity;
+		SizeClass& sizeClass = m_SizeClasses[classIndex];
+
+		std::lock_guard lock(sizeClass.Mutex);
+
+		sizeClass.LiveCount++;
+
+		// Reuse freed memory first, as it's likely still in the cache
+		if (FreeBlock* block = sizeClass.FreeList)
+		{
+			sizeClass.FreeList = block->Next;
+			return block;
+		}
+
+		if (sizeClass.Cursor + classSize > sizeClass.End)
+			AddSlab(sizeClass);
+
+		void* memory = sizeClass.Cursor;
+		sizeClass.Cursor += classSize;
+
+		return memory;
+	}
+
+	void NodeSlabPool::Deallocate(void* memory, size_t size)
+	{
+		if (size == 0)
+			size = 1;
+
+		if (size > MaxSlabAllocationSize)
+		{
+			m_ReservedBytes.fetch_sub(size, std::memory_order_relaxed);
+			m_OversizedBytes.fetch_sub(size, std::memory_order_relaxed);
+
+			::operator delete(memory, std::align_val_t(Granularity));
+		}
+		else
+		{
+			SizeClass& sizeClass = m_SizeClasses[(size - 1) / Granularity];
+
+			std::lock_guard lock(sizeClass.Mutex);
+
+			FreeBlock* block = static_cast<FreeBlock*>(memory);
+			block->Next = sizeClass.FreeList;
+			sizeClass.FreeList = block;
+
+			sizeClass.LiveCount--;
+		}
+
+		// Done last, as this may destroy the pool
+		Release();
+	}
+
+	size_t NodeSlabPool::GetUsedBytes() const
+	{
+		size_t usedBytes = m_OversizedBytes.load(std::memory_order_relaxed);
+
+		for (size_t i = 0; i < m_SizeClasses.size(); i++)
+		{
+			std::lock_guard lock(m_SizeClasses[i].Mutex);
+			usedBytes += m_SizeClasses[i].LiveCount * (i + 1) * Granularity;
+		}
+
+		return usedBytes;
+	}
+
+	size_t NodeSlabPool::GetSlabCount() const
+	{
+		std::lock_guard lock(m_SlabsMutex);
+
+		return m_Slabs.size();
+	}
+
+	void NodeSlabPool::AddSlab(SizeClass& sizeClass)
+	{
+		// Whatever is left of the current slab is too small for this class, so it's abandoned
+		uint8_t* slab = static_cast<uint8_t*>(::operator new(m_SlabSize, std::align_val_t(Granularity)));
+
+		{
+			std::lock_guard lock(m_SlabsMutex);
+			m_Slabs.push_back(slab);
+		}
+
+		m_ReservedBytes.fetch_add(m_SlabSize, std::memory_order_relaxed);
+
+		sizeClass.Cursor = slab;
+		sizeClass.End = slab + m_SlabSize;
+	}
+}
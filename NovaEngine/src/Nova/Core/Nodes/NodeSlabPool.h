@@ -0,0 +1,211 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A pool that carves node allocations out of large slabs. Allocations are grouped into size classes, each with its own slabs and free list,
+	/// so nodes of the same type end up next to each other. Slabs are only returned to the system when the pool is destroyed. Thread-safe.
+	/// The pool is kept alive by an intrusive reference count held by its owner and by every live allocation, so it can't be destroyed under a node
+	/// </summary>
+	class NovaAPI NodeSlabPool
+	{
+	public:
+		/// <summary>
+		/// The largest allocation that is served from a slab. Larger ones go straight to the system allocator
+		/// </summary>
+		static constexpr size_t MaxSlabAllocationSize = 1024;
+
+		/// <summary>
+		/// The size classes are multiples of this, which is also the alignment of every allocation
+		/// </summary>
+		static constexpr size_t Granularity = 16;
+
+	public:
+		/// <summary>
+		/// Creates an empty pool. The caller owns a reference to it and must Release it
+		/// </summary>
+		/// <param name="slabSize">The size of each slab in bytes</param>
+		NodeSlabPool(size_t slabSize = 64 * 1024);
+
+		NodeSlabPool(const NodeSlabPool&) = delete;
+		NodeSlabPool& operator=(const NodeSlabPool&) = delete;
+
+	private:
+		~NodeSlabPool();
+
+	public:
+		/// <summary>
+		/// Adds a reference to the pool
+		/// </summary>
+		void AddRef() { m_RefCount.fetch_add(1, std::memory_order_relaxed); }
+
+		/// <summary>
+		/// Removes a reference from the pool, destroying it once there are none left
+		/// </summary>
+		void Release();
+
+		/// <summary>
+		/// Allocates memory
+		/// </summary>
+		/// <param name="size">The number of bytes to allocate</param>
+		/// <returns>The memory, aligned to Granularity</returns>
+		void* Allocate(size_t size);
+
+		/// <summary>
+		/// Returns memory to the pool. May destroy the pool if this was the last reference
+		/// </summary>
+		/// <param name="memory">The memory from Allocate</param>
+		/// <param name="size">The size that was passed to Allocate</param>
+		void Deallocate(void* memory, size_t size);
+
+		/// <summary>
+		/// Gets the number of slabs the pool has allocated
+		/// </summary>
+		/// <returns>The number of slabs</returns>
+		size_t GetSlabCount() const;
+
+		/// <summary>
+		/// Gets the number of bytes currently allocated from the pool, rounded up to size classes
+		/// </summary>
+		/// <returns>The number of bytes in use</returns>
+		size_t GetUsedBytes() const;
+
+		/// <summary>
+		/// Gets the number of bytes the pool has reserved from the system, including slabs and oversized allocations
+		/// </summary>
+		/// <returns>The number of bytes reserved</returns>
+		size_t GetReservedBytes() const { return m_ReservedBytes.load(std::memory_order_relaxed); }
+
+	private:
+		/// <summary>
+		/// A free allocation, linked to the next free allocation of the same size class
+		/// </summary>
+		struct FreeBlock
+		{
+			FreeBlock* Next;
+		};
+
+		/// <summary>
+		/// The allocations of a single size
+		/// </summary>
+		struct SizeClass
+		{
+			/// <summary>
+			/// Guards the size class
+			/// </summary>
+			mutable std::mutex Mutex;
+
+			/// <summary>
+			/// Allocations that have been returned
+			/// </summary>
+			FreeBlock* FreeList = nullptr;
+
+			/// <summary>
+			/// The next unused byte in the current slab
+			/// </summary>
+			uint8_t* Cursor = nullptr;
+
+			/// <summary>
+			/// The end of the current slab
+			/// </summary>
+			uint8_t* End = nullptr;
+
+			/// <summary>
+			/// The number of allocations that haven't been returned
+			/// </summary>
+			size_t LiveCount = 0;
+		};
+
+		/// <summary>
+		/// Allocates a new slab for a size class. The size class's lock must be held
+		/// </summary>
+		void AddSlab(SizeClass& sizeClass);
+
+	private:
+		/// <summary>
+		/// The size of each slab in bytes
+		/// </summary>
+		const size_t m_SlabSize;
+
+		/// <summary>
+		/// One size class for each multiple of the granularity
+		/// </summary>
+		std::array<SizeClass, MaxSlabAllocationSize / Granularity> m_SizeClasses;
+
+		/// <summary>
+		/// Every slab that has been allocated
+		/// </summary>
+		List<void*> m_Slabs;
+
+		/// <summary>
+		/// Guards the list of slabs
+		/// </summary>
+		mutable std::mutex m_SlabsMutex;
+
+		/// <summary>
+		/// The number of references held by the owner and live allocations
+		/// </summary>
+		std::atomic<size_t> m_RefCount = 1;
+
+		/// <summary>
+		/// The number of bytes allocated outside of slabs
+		/// </summary>
+		std::atomic<size_t> m_OversizedBytes = 0;
+
+		/// <summary>
+		/// The number of bytes reserved from the system
+		/// </summary>
+		std::atomic<size_t> m_ReservedBytes = 0;
+	};
+
+	/// <summary>
+	/// A standard allocator that allocates from a NodeSlabPool. Used with AllocateRef so a node and its reference count share one slab allocation.
+	/// Copies are just a pointer, as every live allocation keeps the pool alive
+	/// </summary>
+	template<typename T>
+	class NodeAllocator
+	{
+		static_assert(alignof(T) <= NodeSlabPool::Granularity, "NodeAllocator doesn't support over-aligned types");
+
+	public:
+		using value_type = T;
+
+	public:
+		NodeAllocator(NodeSlabPool* pool) :
+			m_Pool(pool)
+		{}
+
+		template<typename U>
+		NodeAllocator(const NodeAllocator<U>& other) :
+			m_Pool(other.m_Pool)
+		{}
+
+	public:
+		T* allocate(size_t count) { return static_cast<T*>(m_Pool->Allocate(count * sizeof(T))); }
+		void deallocate(T* memory, size_t count) { m_Pool->Deallocate(memory, count * sizeof(T)); }
+
+		template<typename U>
+		bool operator==(const NodeAllocator<U>& other) const { return m_Pool == other.m_Pool; }
+
+		template<typename U>
+		bool operator!=(const NodeAllocator<U>& other) const { return m_Pool != other.m_Pool; }
+
+	private:
+		/// <summary>
+		/// The pool to allocate from
+		/// </summary>
+		NodeSlabPool* m_Pool;
+
+		template<typename U>
+		friend class NodeAllocator;
+	};
+}
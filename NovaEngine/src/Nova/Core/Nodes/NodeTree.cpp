@@ -1,9 +1,14 @@
 #include "NodeTree.h"
+#include "NodeTypeRegistry.h"
 
 #include "Nova/Core/App/App.h"
+#include "Nova/Services/Jobs/Parallel.h"
 
 #include <algorithm>
 #include <format>
+#include <typeindex>
+#include <unordered_map>
+#include <unordered_set>
 
 namespace Nova
 {
@@ -12,42 +17,201 @@ namespace Nova
 	{}
 
 
+	NodeTree::~NodeTree()
+	{
+		// Our nodes hold their own references to the pool, so it's destroyed once the last of them is
+		if (m_NodePool)
+			m_NodePool->Release();
+	}
+
 	// RefCounted ----------
 	void NodeTree::Init()
 	{
-		m_RootNode = MakeRef<Node>("Root");
+		m_NodePool = new NodeSlabPool();
+		m_Transforms2D.reset(new TransformStorage(*this));
+		m_Transforms3D.reset(new TransformStorage(*this));
+		m_World.reset(new World(this));
+		m_SpatialIndex.reset(new SpatialIndex());
+
+		m_RootNode = CreateNode<Node>("Root");
 		m_RootNode->SetTree(GetSelfRef<NodeTree>());
+
+		RebuildFlatNodes();
+
+		m_TickListener = MakeRef<TickListener>(0, GetSelfRef<NodeTree>(), &NodeTree::Tick);
 	}
 
 	// RefCounted ----------
 
-	void NodeTree::TickNode(const Ref<Node>& node, double deltaTime)
+	void NodeTree::Tick(double deltaTime)
 	{
-		//node->Tick(deltaTime);
+		OnPreTreeTick.EmitAnonymous(deltaTime);
+
+		UpdateFlatNodes();
+
+		{
+			TraversalScope scope(*this);
+
+			TickSerialNodes(deltaTime);
+			TickIndependentSubtrees(deltaTime);
+		}
+
+		ApplyQueuedChanges();
+		UpdateTransforms();
+
+		m_Counters.NodesAddedLastFrame = m_Counters.NodesAdded - m_NodesAddedAtFrameEnd;
+		m_Counters.NodesRemovedLastFrame = m_Counters.NodesRemoved - m_NodesRemovedAtFrameEnd;
+		m_NodesAddedAtFrameEnd = m_Counters.NodesAdded;
+		m_NodesRemovedAtFrameEnd = m_Counters.NodesRemoved;
+
+		OnPostTreeTick.EmitAnonymous(deltaTime);
+	}
+
+	NodeTreeCounters NodeTree::GetCounters() const
+	{
+		NodeTreeCounters counters = m_Counters;
+		counters.NodeCount = (size_t)(m_Counters.NodesAdded - m_Counters.NodesRemoved);
+		counters.QueuedChangeCount = m_QueuedAdds.size() + m_QueuedFrees.size();
+		counters.PendingDestroyCount = m_NodesToDestroy.size();
+
+		return counters;
+	}
+
+	NodeTreeReport NodeTree::CreateReport() const
+	{
+		NodeTreeReport report;
+		std::unordered_map<std::type_index, size_t> typeCounts;
+		std::unordered_set<NameID> names;
+
+		// Walk with an explicit stack, as trees can be deeper than the call stack allows
+		List<std::pair<const Node*, size_t>> stack = { { m_RootNode.get(), 0 } };
+
+		while (!stack.empty())
+		{
+			auto [node, depth] = stack.back();
+			stack.pop_back();
+
+			report.NodeCount++;
+			report.ActiveNodeCount += node->m_IsActiveInTree ? 1 : 0;
+			report.MaxDepth = std::max(report.MaxDepth, depth);
+			report.MaxChildCount = std::max(report.MaxChildCount, node->m_Children.size());
+			report.ChildListBytes += node->m_Children.capacity() * sizeof(Ref<Node>);
+			report.GroupBytes += node->m_GroupSlots.capacity() * sizeof(Node::GroupSlot);
+
+			if (node->m_ChildNameIndex)
+			{
+				// Each entry is a heap node holding the pair and a link, on top of the bucket array
+				const auto& index = *node->m_ChildNameIndex;
+				report.ChildNameIndexBytes += index.bucket_count() * sizeof(void*) + index.size() * (sizeof(std::pair<const NameID, Node*>) + sizeof(void*));
+			}
+
+			if (node->m_PropertyOverrides)
+				report.PropertyOverrideBytes += node->m_PropertyOverrides->capacity() * sizeof(NodePropertyTable::Entry);
+
+			typeCounts[typeid(*node)]++;
+			names.insert(node->m_Name);
+
+			for (const Ref<Node>& child : node->m_Children)
+			{
+				stack.push_back({ child.get(), depth + 1 });
+			}
+		}
+
+		for (NameID name : names)
+		{
+			report.NameBytes += name.GetString().size();
+		}
 
-		if (node->m_Children.size() > 0)
+		report.UniqueNameCount = names.size();
+		report.FlatOrderBytes = m_FlatNodes.capacity() * sizeof(FlatNode);
+		report.PoolUsedBytes = m_NodePool->GetUsedBytes();
+		report.PoolReservedBytes = m_NodePool->GetReservedBytes();
+
+		for (const List<Node*>& members : m_GroupMembers)
 		{
-			List<Ref<Node>> childNodes(node->m_Children);
-			//std::sort(childNodes.begin(), childNodes.end(), Node::TickPriorityComparator);
-		
-			for (const Ref<Node>& child : childNodes)
+			report.GroupBytes += members.capacity() * sizeof(Node*);
+		}
+
+		for (const auto& [type, count] : typeCounts)
+		{
+			NodeTypeStats stats;
+			stats.Count = count;
+
+			if (const NodeTypeInfo* info = NodeTypeRegistry::Find(type))
 			{
-				TickNode(child, deltaTime);
+				stats.TypeName = info->Name.GetString();
+				stats.InstanceBytes = count * info->Size;
 			}
+			else
+			{
+				stats.TypeName = type.name();
+			}
+
+			report.Types.push_back(std::move(stats));
 		}
+
+		std::sort(report.Types.begin(), report.Types.end(), [](const NodeTypeStats& a, const NodeTypeStats& b)
+			{
+				return a.Count != b.Count ? a.Count > b.Count : a.TypeName < b.TypeName;
+			});
+
+		return report;
 	}
 
-	// TickListener ----------
-	//void NodeTree::Tick(double deltaTime)
-	//{
-	//	OnPreTreeTick.EmitAnonymous(deltaTime);
-	//
-	//	TickNode(m_RootNode, deltaTime);
-	//
-	//	OnPostTreeTick.EmitAnonymous(deltaTime);
-	//}
+	const List<Node*>& NodeTree::GetNodesInGroup(NodeGroup group) const
+	{
+		static const List<Node*> noNodes;
 
-	// TickListener ----------
+		return group.IsValid() && group.GetIndex() < m_GroupMembers.size() ? m_GroupMembers[group.GetIndex()] : noNodes;
+	}
+
+	void NodeTree::GetNodesInGroups(const NodeGroupMask& groups, List<Node*>& nodes) const
+	{
+		// Every match is a member of each of the groups, so the smallest one has the fewest nodes to check
+		const List<Node*>* smallest = nullptr;
+
+		for (uint32_t group = 0; group < NodeGroup::MaxGroups; group++)
+		{
+			if (!groups.test(group))
+				continue;
+
+			if (group >= m_GroupMembers.size())
+				return;
+
+			if (!smallest || m_GroupMembers[group].size() < smallest->size())
+				smallest = &m_GroupMembers[group];
+		}
+
+		if (!smallest)
+			return;
+
+		for (Node* node : *smallest)
+		{
+			if ((node->m_Groups & groups) == groups)
+				nodes.push_back(node);
+		}
+	}
+
+	void NodeTree::SetJobScheduler(Jobs::JobScheduler* scheduler)
+	{
+		m_Scheduler = scheduler;
+		m_CommandBuffers = List<NodeCommandBuffer>(scheduler ? scheduler->GetWorkerCount() + 1 : 0);
+	}
+
+	void NodeTree::Defer(NodeCommandBuffer::Command command)
+	{
+		if (NodeCommandBuffer* commands = GetParallelCommandBuffer())
+			commands->Add(std::move(command));
+		else
+			command();
+	}
+
+	void NodeTree::UpdateTransforms()
+	{
+		m_Transforms2D->Update();
+		m_Transforms3D->Update();
+		m_SpatialIndex->Update();
+	}
 
 	void NodeTree::LayerRenderingFrame(int layerID)
 	{
@@ -67,4 +231,505 @@ namespace Nova
 
 		return sourcePtr;
 	}
-}
\ No newline at end of file
+
+	NodeTree::TraversalScope::TraversalScope(NodeTree& tree) :
+		Tree(tree)
+	{
+		Tree.m_TraversalDepth++;
+	}
+
+	NodeTree::TraversalScope::~TraversalScope()
+	{
+		if (--Tree.m_TraversalDepth > 0)
+			return;
+
+		// Catch up on the changes made during the traversal
+		if (Tree.m_IsFlatNodesDirty)
+			Tree.RebuildFlatNodes();
+
+		Tree.m_DetachedDuringTraversal.clear();
+	}
+
+	void NodeTree::AttachSubtree(Node* parent, size_t childIndex)
+	{
+		Node* child = parent->m_Children[childIndex].get();
+		m_StructureVersion++;
+
+		// The child may still have an index from before it was moved, which would make a traversal visit it
+		child->m_FlatIndex = SIZE_MAX;
+
+		// Changing the order mid-traversal would move nodes under the traversal, so rebuild once it's over instead. The parent may also not be
+		// in the order yet if it's being added itself, such as when a node adds children as it enters the tree
+		if (m_TraversalDepth > 0 || m_IsFlatNodesDirty || !IsInFlatNodes(parent))
+		{
+			MarkFlatNodesDirty(parent);
+			return;
+		}
+
+		// The subtree goes right before the next sibling's, or at the end of the parent's subtree if it's the last child
+		const size_t position = childIndex + 1 < parent->m_Children.size() ?
+			parent->m_Children[childIndex + 1]->m_FlatIndex :
+			parent->m_FlatIndex + m_FlatNodes[parent->m_FlatIndex].SubtreeSize;
+
+		// Splicing into the middle would shift every node after it, so leave that to the next rebuild, which shifts them once for all the changes
+		if (position != m_FlatNodes.size())
+		{
+			MarkFlatNodesDirty(parent);
+			return;
+		}
+
+		CollectSubtree(child, m_FlatNodes);
+		UpdateFlatIndices(position);
+
+		const size_t size = m_FlatNodes.size() - position;
+
+		for (Node* ancestor = parent; ancestor; ancestor = ancestor->m_Parent.lock().get())
+		{
+			m_FlatNodes[ancestor->m_FlatIndex].SubtreeSize += size;
+		}
+	}
+
+	void NodeTree::DetachSubtree(const Ref<Node>& node)
+	{
+		m_StructureVersion++;
+
+		// Nodes in a freed subtree the tree is still taking apart are already out of the order
+		if (!m_IsFlatNodesDirty && !IsInFlatNodes(node.get()))
+			return;
+
+		Node* parent = node->m_Parent.lock().get();
+
+		if (m_TraversalDepth > 0)
+		{
+			// Skip the subtree for the rest of the traversal, and keep it alive as the flattened order still points into it
+			node->m_FlatIndex = SIZE_MAX;
+			m_DetachedDuringTraversal.push_back(node);
+			MarkFlatNodesDirty(parent);
+
+			return;
+		}
+
+		if (m_IsFlatNodesDirty)
+		{
+			node->m_FlatIndex = SIZE_MAX;
+			MarkFlatNodesDirty(parent);
+
+			return;
+		}
+
+		const size_t position = node->m_FlatIndex;
+		const size_t size = m_FlatNodes[position].SubtreeSize;
+
+		// As with attaching, only a subtree at the end of the order is cut out right away
+		if (position + size != m_FlatNodes.size())
+		{
+			node->m_FlatIndex = SIZE_MAX;
+			MarkFlatNodesDirty(parent);
+
+			return;
+		}
+
+		// The rest of the subtree keeps indices past the end of the order, which IsInFlatNodes doesn't accept, so only the root needs resetting
+		node->m_FlatIndex = SIZE_MAX;
+		m_FlatNodes.resize(position);
+
+		for (Node* ancestor = parent; ancestor; ancestor = ancestor->m_Parent.lock().get())
+		{
+			m_FlatNodes[ancestor->m_FlatIndex].SubtreeSize -= size;
+		}
+	}
+
+	void NodeTree::MoveSubtree(Node* parent, size_t previousIndex, size_t index)
+	{
+		Node* child = parent->m_Children[index].get();
+
+		if (m_TraversalDepth > 0)
+		{
+			// Moving nodes under a traversal isn't safe, so take the same path as removing and adding the child
+			DetachSubtree(child->GetSelfRef<Node>());
+			AttachSubtree(parent, index);
+
+			return;
+		}
+
+		m_StructureVersion++;
+
+		// The places of the subtrees around the child aren't known until the pending changes are rebuilt
+		if (m_IsFlatNodesDirty)
+		{
+			MarkFlatNodesDirty(parent);
+			return;
+		}
+
+		// As with detaching, a freed subtree the tree is still taking apart has nothing left to move
+		if (!IsInFlatNodes(child))
+			return;
+
+		const size_t start = child->m_FlatIndex;
+		const size_t size = m_FlatNodes[start].SubtreeSize;
+
+		// The siblings the child passed haven't moved in the flattened order yet, so their subtrees sit between its old and new place.
+		// Rotating that span moves the child's subtree over them, and leaves every ancestor's subtree size as it was
+		size_t begin;
+		size_t end;
+
+		if (index > previousIndex)
+		{
+			begin = start;
+			end = index + 1 < parent->m_Children.size() ?
+				parent->m_Children[index + 1]->m_FlatIndex :
+				parent->m_FlatIndex + m_FlatNodes[parent->m_FlatIndex].SubtreeSize;
+
+			std::rotate(m_FlatNodes.begin() + begin, m_FlatNodes.begin() + start + size, m_FlatNodes.begin() + end);
+		}
+		else
+		{
+			begin = parent->m_Children[index + 1]->m_FlatIndex;
+			end = start + size;
+
+			std::rotate(m_FlatNodes.begin() + begin, m_FlatNodes.begin() + start, m_FlatNodes.begin() + end);
+		}
+
+		UpdateFlatIndices(begin, end);
+	}
+
+	void NodeTree::CollectSubtree(Node* node, List<FlatNode>& nodes)
+	{
+		const size_t start = nodes.size();
+		nodes.push_back({ node, 1 });
+
+		for (const Ref<Node>& child : node->m_Children)
+		{
+			CollectSubtree(child.get(), nodes);
+		}
+
+		nodes[start].SubtreeSize = nodes.size() - start;
+	}
+
+	void NodeTree::UpdateFlatIndices(size_t begin, size_t end)
+	{
+		end = std::min(end, m_FlatNodes.size());
+
+		for (size_t i = begin; i < end; i++)
+		{
+			m_FlatNodes[i].NodePtr->m_FlatIndex = i;
+		}
+	}
+
+	void NodeTree::MarkFlatNodesDirty(Node* parent)
+	{
+		m_DirtySubtreeRoot = m_IsFlatNodesDirty ? GetCommonAncestor(m_DirtySubtreeRoot, parent) : parent;
+		m_IsFlatNodesDirty = true;
+	}
+
+	void NodeTree::UpdateFlatNodes()
+	{
+		if (m_IsFlatNodesDirty && m_TraversalDepth == 0)
+			RebuildFlatNodes();
+	}
+
+	void NodeTree::RebuildFlatNodes()
+	{
+		Node* subtreeRoot = m_DirtySubtreeRoot;
+
+		m_IsFlatNodesDirty = false;
+		m_DirtySubtreeRoot = nullptr;
+
+		// The changed subtree's root stayed in the tree, so its place in the order is still right even though what follows it isn't
+		if (!subtreeRoot || subtreeRoot == m_RootNode.get() || !IsInFlatNodes(subtreeRoot))
+		{
+			m_FlatNodes.clear();
+			CollectSubtree(m_RootNode.get(), m_FlatNodes);
+			UpdateFlatIndices(0);
+
+			return;
+		}
+
+		const size_t position = subtreeRoot->m_FlatIndex;
+		const size_t previousSize = m_FlatNodes[position].SubtreeSize;
+
+		List<FlatNode> subtree;
+		CollectSubtree(subtreeRoot, subtree);
+
+		// Overwrite the old subtree, then shift the rest of the order once if its size changed
+		const size_t sharedSize = std::min(previousSize, subtree.size());
+		std::copy(subtree.begin(), subtree.begin() + sharedSize, m_FlatNodes.begin() + position);
+
+		if (subtree.size() == previousSize)
+		{
+			UpdateFlatIndices(position, position + previousSize);
+			return;
+		}
+
+		if (subtree.size() > previousSize)
+			m_FlatNodes.insert(m_FlatNodes.begin() + position + sharedSize, subtree.begin() + sharedSize, subtree.end());
+		else
+			m_FlatNodes.erase(m_FlatNodes.begin() + position + sharedSize, m_FlatNodes.begin() + position + previousSize);
+
+		UpdateFlatIndices(position);
+
+		for (Node* ancestor = subtreeRoot->m_Parent.lock().get(); ancestor; ancestor = ancestor->m_Parent.lock().get())
+		{
+			m_FlatNodes[ancestor->m_FlatIndex].SubtreeSize = m_FlatNodes[ancestor->m_FlatIndex].SubtreeSize + subtree.size() - previousSize;
+		}
+	}
+
+	Node* NodeTree::GetCommonAncestor(Node* first, Node* second)
+	{
+		auto getDepth = [](Node* node)
+			{
+				size_t depth = 0;
+
+				for (Node* ancestor = node->m_Parent.lock().get(); ancestor; ancestor = ancestor->m_Parent.lock().get())
+				{
+					depth++;
+				}
+
+				return depth;
+			};
+
+		size_t firstDepth = getDepth(first);
+		size_t secondDepth = getDepth(second);
+
+		for (; firstDepth > secondDepth; firstDepth--)
+		{
+			first = first->m_Parent.lock().get();
+		}
+
+		for (; secondDepth > firstDepth; secondDepth--)
+		{
+			second = second->m_Parent.lock().get();
+		}
+
+		while (first != second)
+		{
+			first = first->m_Parent.lock().get();
+			second = second->m_Parent.lock().get();
+		}
+
+		return first;
+	}
+
+	void NodeTree::TickSerialNodes(double deltaTime)
+	{
+		m_IndependentSubtrees.clear();
+
+		// Without a scheduler, independent subtrees are ticked in place like any other
+		const bool collectIndependent = m_Scheduler != nullptr;
+
+		for (size_t i = 0; i < m_FlatNodes.size();)
+		{
+			const FlatNode& flatNode = m_FlatNodes[i];
+			Node* node = flatNode.NodePtr;
+
+			if (node->m_FlatIndex != i || !node->m_IsActiveInTree)
+			{
+				i += flatNode.SubtreeSize;
+				continue;
+			}
+
+			if (collectIndependent && node->m_IsTickIndependent && i > 0)
+			{
+				m_IndependentSubtrees.push_back(i);
+				i += flatNode.SubtreeSize;
+				continue;
+			}
+
+			node->Tick(deltaTime);
+			i++;
+		}
+	}
+
+	void NodeTree::TickIndependentSubtrees(double deltaTime)
+	{
+		if (m_IndependentSubtrees.empty())
+			return;
+
+		// With every world matrix clean, subtrees only ever compute the matrices of their own nodes
+		m_Transforms2D->Update();
+		m_Transforms3D->Update();
+
+		m_IsTickingInParallel = true;
+
+		// Nested independent subtrees are part of their outer subtree, so each job owns a disjoint range of the flattened order
+		Jobs::ParallelFor(*m_Scheduler, 0, m_IndependentSubtrees.size(), [this, deltaTime](size_t subtree)
+			{
+				const size_t begin = m_IndependentSubtrees[subtree];
+
+				ForEachNodeInRange<true>(begin, begin + m_FlatNodes[begin].SubtreeSize, [deltaTime](Node& node) { node.Tick(deltaTime); });
+			}, 1);
+
+		m_IsTickingInParallel = false;
+
+		// Subtrees don't touch each other, so only the order within each buffer matters
+		for (NodeCommandBuffer& commands : m_CommandBuffers)
+		{
+			commands.Execute();
+		}
+	}
+
+	void NodeTree::ApplyQueuedChanges()
+	{
+		if (!m_QueuedAdds.empty() || !m_QueuedFrees.empty())
+		{
+			// Nodes queued by the callbacks below are applied next tick
+			List<QueuedAdd> adds = std::move(m_QueuedAdds);
+			List<Ref<Node>> frees = std::move(m_QueuedFrees);
+
+			m_QueuedAdds.clear();
+			m_QueuedFrees.clear();
+
+			for (const QueuedAdd& add : adds)
+			{
+				add.Parent->AddChild(add.Child);
+			}
+
+			for (Ref<Node>& node : frees)
+			{
+				FreeSubtree(std::move(node));
+			}
+		}
+
+		DestroyFreedNodes();
+	}
+
+	void NodeTree::FreeSubtree(Ref<Node> node)
+	{
+		if (Ref<Node> parent = node->GetParent())
+		{
+			// A node that has moved to another tree since it was freed leaves that one all at once
+			if (node->m_Tree.lock().get() != this)
+			{
+				parent->RemoveChild(node);
+			}
+			else
+			{
+				parent->UnlinkChild(node);
+				node->m_IsLeavingTree = true;
+			}
+		}
+
+		m_NodesToDestroy.push_back(std::move(node));
+	}
+
+	void NodeTree::DestroyFreedNodes()
+	{
+		if (m_NodesToDestroy.empty())
+			return;
+
+		// Freed nodes can be where the order was last changed, so catch up before any of them are destroyed
+		UpdateFlatNodes();
+
+		for (size_t i = 0; i < m_DestroyBudget && !m_NodesToDestroy.empty(); i++)
+		{
+			Ref<Node> node = std::move(m_NodesToDestroy.back());
+			m_NodesToDestroy.pop_back();
+
+			// Freed subtrees leave the tree a node at a time, parents before their children
+			if (node->m_IsLeavingTree)
+			{
+				Ref<Node> parent = node->GetParent();
+
+				node->LeaveTree(*this);
+				node->m_Tree = WeakRef<NodeTree>();
+				node->m_IsLeavingTree = false;
+				node->m_IsActiveInTree = node->m_IsActive && (!parent || parent->m_IsActiveInTree);
+
+				for (const Ref<Node>& child : node->m_Children)
+				{
+					child->m_IsLeavingTree = true;
+				}
+
+				// The children of a node someone else still holds stay with it, but still have to leave the tree
+				if (node.use_count() > 1)
+				{
+					m_NodesToDestroy.insert(m_NodesToDestroy.end(), node->m_Children.begin(), node->m_Children.end());
+					continue;
+				}
+			}
+
+			// A node someone else still holds keeps its children, and they go whenever it does
+			if (node.use_count() == 1)
+			{
+				for (Ref<Node>& child : node->m_Children)
+				{
+					m_NodesToDestroy.push_back(std::move(child));
+				}
+
+				node->m_Children.clear();
+			}
+		}
+	}
+
+	NodeCommandBuffer* NodeTree::GetParallelCommandBuffer()
+	{
+		if (!m_IsTickingInParallel)
+			return nullptr;
+
+		// Threads that aren't workers, like the main thread running jobs while it waits, share the first buffer
+		return &m_CommandBuffers[m_Scheduler->GetCurrentWorkerIndex() + 1];
+	}
+
+	void NodeTree::AddGroupMember(Node& node, uint32_t group)
+	{
+		if (group >= m_GroupMembers.size())
+			m_GroupMembers.resize(group + 1);
+
+		List<Node*>& members = m_GroupMembers[group];
+
+		node.m_GroupSlots.push_back({ group, (uint32_t)members.size() });
+		members.push_back(&node);
+	}
+
+	void NodeTree::RemoveGroupMember(Node& node, uint32_t group)
+	{
+		auto slot = std::find_if(node.m_GroupSlots.begin(), node.m_GroupSlots.end(), [group](const Node::GroupSlot& other) { return other.Group == group; });
+
+		if (slot == node.m_GroupSlots.end())
+			return;
+
+		List<Node*>& members = m_GroupMembers[group];
+		Node* last = members.back();
+
+		// Move the last member into the gap, and point its slot at its new position
+		members[slot->Position] = last;
+		members.pop_back();
+
+		if (last != &node)
+		{
+			for (Node::GroupSlot& lastSlot : last->m_GroupSlots)
+			{
+				if (lastSlot.Group == group)
+				{
+					lastSlot.Position = slot->Position;
+					break;
+				}
+			}
+		}
+
+		node.m_GroupSlots.erase(slot);
+	}
+
+	void NodeTree::AddGroupMembers(Node& node)
+	{
+		// Slots left over from a tree that was destroyed under the node point nowhere
+		node.m_GroupSlots.clear();
+
+		if (node.m_Groups.none())
+			return;
+
+		for (uint32_t group = 0; group < NodeGroup::MaxGroups; group++)
+		{
+			if (node.m_Groups.test(group))
+				AddGroupMember(node, group);
+		}
+	}
+
+	void NodeTree::RemoveGroupMembers(Node& node)
+	{
+		while (!node.m_GroupSlots.empty())
+		{
+			RemoveGroupMember(node, node.m_GroupSlots.back().Group);
+		}
+	}
+}
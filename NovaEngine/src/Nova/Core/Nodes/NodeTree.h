@@ -2,12 +2,27 @@
 
 #include "Nova/Core/EngineAPI.h"
 
+#include "Nova/Core/Entities/World.h"
 #include "Nova/Core/Events/TickListener.h"
 #include "Nova/Core/Events/Event.h"
 #include "Nova/Core/Events/EventSource.h"
+#include "Nova/Core/Spatial/SpatialIndex.h"
 #include "Nova/Core/Types/Map.h"
 #include "Nova/Core/Types/RefCounted.h"
 #include "Node.h"
+#include "NodeCommandBuffer.h"
+#include "NodePath.h"
+#include "NodeSlabPool.h"
+#include "NodeTreeStats.h"
+#include "TransformStorage.h"
+
+#include <algorithm>
+#include <stddef.h>
+
+namespace Nova::Jobs
+{
+	class JobScheduler;
+}
 
 namespace Nova
 {
@@ -27,15 +42,221 @@ namespace Nova
 		using LayerRenderingEventType = Event;
 
 	public:
-		virtual ~NodeTree() = default;
+		virtual ~NodeTree();
 
 	public:
 		/// <summary>
-		/// Ticks the given node and all its children
+		/// Gets the root node of this tree
+		/// </summary>
+		/// <returns>The root node</returns>
+		const Ref<Node>& GetRootNode() const { return m_RootNode; }
+
+		/// <summary>
+		/// Creates a node in this tree's node pool. Nodes created together are laid out together in memory, and the pool's slabs are freed in bulk
+		/// once the tree and all of its nodes are gone. The node isn't added to the tree
+		/// </summary>
+		/// <param name="...args">Parameters to pass to the constructor of the node class</param>
+		/// <returns>The created node</returns>
+		template<typename NodeClass, typename ... Args>
+		Ref<NodeClass> CreateNode(Args&& ... args)
+		{
+			static_assert(std::is_base_of<Node, NodeClass>::value, "The class must inherit from Node");
+
+			return AllocateRef<NodeClass>(NodeAllocator<NodeClass>(m_NodePool), std::forward<Args>(args)...);
+		}
+
+		/// <summary>
+		/// Gets the pool that this tree's nodes are allocated from
+		/// </summary>
+		/// <returns>The node pool</returns>
+		NodeSlabPool* GetNodePool() const { return m_NodePool; }
+
+		/// <summary>
+		/// Gets the number of nodes in this tree, including the root
+		/// </summary>
+		/// <returns>The number of nodes</returns>
+		size_t GetNodeCount() const { return (size_t)(m_Counters.NodesAdded - m_Counters.NodesRemoved); }
+
+		/// <summary>
+		/// Finds a node by its path from the root, such as "World/Enemies/Boss". See Node::FindNode
+		/// </summary>
+		/// <param name="path">The names of the nodes to go through, separated by '/'</param>
+		/// <returns>The node, or nullptr if no node matches the path</returns>
+		Ref<Node> FindNode(std::string_view path) const { return m_RootNode->FindNode(path); }
+
+		/// <summary>
+		/// Finds a node by a cached path. Repeated lookups return the cached node until the tree's structure changes
+		/// </summary>
+		/// <param name="path">The path from the root</param>
+		/// <returns>The node, or nullptr if no node matches the path</returns>
+		Ref<Node> FindNode(const NodePath& path) { return path.Resolve(*this); }
+
+		/// <summary>
+		/// Gets the nodes in this tree that are in a group, in no particular order. The list changes as nodes join and leave the group
+		/// or the tree, so copy it first if that can happen while going through it
+		/// </summary>
+		/// <param name="group">The group</param>
+		/// <returns>The members of the group</returns>
+		const List<Node*>& GetNodesInGroup(NodeGroup group) const;
+
+		/// <summary>
+		/// Finds the nodes in this tree that are in every one of a set of groups. Only the members of the smallest group are checked,
+		/// each with a bitset AND
+		/// </summary>
+		/// <param name="groups">The groups. If empty, no nodes are found</param>
+		/// <param name="nodes">The list to append the nodes to</param>
+		void GetNodesInGroups(const NodeGroupMask& groups, List<Node*>& nodes) const;
+
+		/// <summary>
+		/// Gets a number that changes whenever nodes are added to, removed from or renamed in this tree
+		/// </summary>
+		/// <returns>The structure version</returns>
+		uint64_t GetStructureVersion() const { return m_StructureVersion; }
+
+		/// <summary>
+		/// Gets the listener that ticks this tree. The app adds its tree's listener to the main loop
+		/// </summary>
+		/// <returns>The tick listener</returns>
+		const Ref<TickListener>& GetTickListener() const { return m_TickListener; }
+
+		/// <summary>
+		/// Gets the storage that caches the world matrices of this tree's transform nodes in the given space
+		/// </summary>
+		/// <param name="space">The transform space</param>
+		/// <returns>The transform storage</returns>
+		TransformStorage& GetTransformStorage(TransformSpace space) { return space == TransformSpace::Space2D ? *m_Transforms2D : *m_Transforms3D; }
+
+		/// <summary>
+		/// Gets the world that stores this tree's entities and components
+		/// </summary>
+		/// <returns>The world</returns>
+		World& GetWorld() { return *m_World; }
+
+		/// <summary>
+		/// Gets the index of the bounds of this tree's 2D nodes. Updated by Tick after the transforms
+		/// </summary>
+		/// <returns>The spatial index</returns>
+		SpatialIndex& GetSpatialIndex() { return *m_SpatialIndex; }
+
+		/// <summary>
+		/// Recomputes the world matrices of every transform node whose transform (or an ancestor's) changed, and refreshes the spatial index. Called by Tick after the nodes are ticked
+		/// </summary>
+		void UpdateTransforms();
+
+		/// <summary>
+		/// Ticks every active node in the tree, parents before children and siblings by tick order. With a job scheduler set, subtrees marked with
+		/// Node::SetIsTickIndependent are ticked on its workers after the rest of the tree, each in its own parent-before-child order. Changes queued
+		/// by Node::QueueAddChild and Node::QueueFree are applied after the nodes are ticked and before the transforms are updated
 		/// </summary>
-		/// <param name="node">The node to tick (if it has ticking enabled)</param>
 		/// <param name="deltaTime">The delta time to use for the tick</param>
-		static void TickNode(const Ref<Node>& node, double deltaTime);
+		void Tick(double deltaTime);
+
+		/// <summary>
+		/// Sets the scheduler that independent subtrees are ticked on. Without one, they're ticked serially along with the rest of the tree
+		/// </summary>
+		/// <param name="scheduler">The job scheduler, or nullptr to tick serially. Must outlive the tree or be unset first</param>
+		void SetJobScheduler(Jobs::JobScheduler* scheduler);
+
+		/// <summary>
+		/// Gets the scheduler that independent subtrees are ticked on
+		/// </summary>
+		/// <returns>The job scheduler, or nullptr if the tree ticks serially</returns>
+		Jobs::JobScheduler* GetJobScheduler() const { return m_Scheduler; }
+
+		/// <summary>
+		/// Gets if independent subtrees are being ticked in parallel right now. Structural changes are deferred while they are
+		/// </summary>
+		/// <returns>True during the parallel part of Tick</returns>
+		bool GetIsTickingInParallel() const { return m_IsTickingInParallel; }
+
+		/// <summary>
+		/// Runs a function now, or once the parallel part of Tick is done if it's in progress. Use it from independent subtrees for changes
+		/// that reach outside of them, such as registering bounds or binding entities. Adding, removing, moving and renaming nodes is deferred automatically
+		/// </summary>
+		/// <param name="command">The function to run</param>
+		void Defer(NodeCommandBuffer::Command command);
+
+		/// <summary>
+		/// Takes a node and its subtree out of the tree's order right away, so they're no longer ticked or found, then takes them out of the tree and
+		/// releases them a node at a time, within the destroy budget of each tick. Until a node's turn comes it still counts towards the tree's nodes,
+		/// and stays in its groups, the spatial index and the world. Node::QueueFree calls this at the end of the tick
+		/// </summary>
+		/// <param name="node">The node to free</param>
+		void FreeSubtree(Ref<Node> node);
+
+		/// <summary>
+		/// Sets the most nodes released per tick by Node::QueueFree and FreeSubtree. Freed subtrees larger than this leave the tree and are destroyed
+		/// over several ticks, so freeing a whole level doesn't stall a frame
+		/// </summary>
+		/// <param name="budget">The number of nodes, or SIZE_MAX to destroy every freed node in the tick it's freed</param>
+		void SetDestroyBudget(size_t budget) { m_DestroyBudget = std::max<size_t>(budget, 1); }
+
+		/// <summary>
+		/// Gets the most nodes released per tick by Node::QueueFree
+		/// </summary>
+		/// <returns>The number of nodes</returns>
+		size_t GetDestroyBudget() const { return m_DestroyBudget; }
+
+		/// <summary>
+		/// Gets the number of freed subtrees and nodes waiting to be destroyed. Each waiting subtree counts once, however many nodes it has
+		/// </summary>
+		/// <returns>The number of waiting subtrees and nodes</returns>
+		size_t GetPendingDestroyCount() const { return m_NodesToDestroy.size(); }
+
+		/// <summary>
+		/// Gets the tree's live counters, such as to export them every frame
+		/// </summary>
+		/// <returns>The counters</returns>
+		NodeTreeCounters GetCounters() const;
+
+		/// <summary>
+		/// Walks the whole tree to break down its size by class and by what the memory is spent on. Classes are named through the NodeTypeRegistry.
+		/// This visits every node, so it's meant for debugging and occasional reporting rather than every frame
+		/// </summary>
+		/// <returns>The report</returns>
+		NodeTreeReport CreateReport() const;
+
+		/// <summary>
+		/// Calls a function for every node in the tree in depth-first order. Nodes removed by the function are skipped, while nodes added or moved by it
+		/// are only visited from the next traversal on. Removed nodes stay alive until the traversal ends
+		/// </summary>
+		/// <param name="func">The function to call, taking a Node&</param>
+		template<typename Func>
+		void ForEachNode(const Func& func)
+		{
+			UpdateFlatNodes();
+			TraversalScope scope(*this);
+
+			ForEachNodeInRange<false>(0, m_FlatNodes.size(), func);
+		}
+
+		/// <summary>
+		/// Calls a function for every node that is active in the tree, in depth-first order. Inactive subtrees are skipped without visiting their nodes
+		/// </summary>
+		/// <param name="func">The function to call, taking a Node&</param>
+		template<typename Func>
+		void ForEachActiveNode(const Func& func)
+		{
+			UpdateFlatNodes();
+			TraversalScope scope(*this);
+
+			ForEachNodeInRange<true>(0, m_FlatNodes.size(), func);
+		}
+
+		/// <summary>
+		/// Calls a function for the given node and its descendants in depth-first order. Does nothing if the node isn't in this tree
+		/// </summary>
+		/// <param name="node">The root of the subtree</param>
+		/// <param name="func">The function to call, taking a Node&</param>
+		template<typename Func>
+		void ForEachNodeInSubtree(const Ref<Node>& node, const Func& func)
+		{
+			UpdateFlatNodes();
+			TraversalScope scope(*this);
+
+			if (IsInFlatNodes(node.get()))
+				ForEachNodeInRange<false>(node->m_FlatIndex, node->m_FlatIndex + m_FlatNodes[node->m_FlatIndex].SubtreeSize, func);
+		}
 
 	// RefCounted ----------
 	protected:
@@ -43,13 +264,6 @@ namespace Nova
 
 	// RefCounted ----------
 
-	// TickListener ----------
-	protected:
-		//virtual int GetTickOrder() const { return 0; }
-		//virtual void Tick(double deltaTime) override;
-
-	// TickListener ----------
-
 	public:
 		/// <summary>
 		/// Called when a frame for a render layer starts rendering
@@ -119,9 +333,184 @@ namespace Nova
 			}
 		}
 
+	public:
+		/// <summary>
+		/// The default of SetDestroyBudget
+		/// </summary>
+		static constexpr size_t DefaultDestroyBudget = 4096;
+
+	private:
+		/// <summary>
+		/// A child waiting to be added by Node::QueueAddChild
+		/// </summary>
+		struct QueuedAdd
+		{
+			Ref<Node> Parent;
+			Ref<Node> Child;
+		};
+
+		/// <summary>
+		/// An entry in the flattened depth-first order
+		/// </summary>
+		struct FlatNode
+		{
+			/// <summary>
+			/// The node. Owned by its parent's list of children
+			/// </summary>
+			Node* NodePtr;
+
+			/// <summary>
+			/// The number of nodes in the node's subtree, including itself, so a traversal can skip over it
+			/// </summary>
+			size_t SubtreeSize;
+		};
+
 	private:
 		EventSource<LayerRenderingEventType>* GetLayerRenderEventSourcePtr(int layerID);
 
+		/// <summary>
+		/// Marks the tree as being traversed for as long as it exists, so structural changes are deferred until the outermost traversal ends
+		/// </summary>
+		struct TraversalScope
+		{
+			TraversalScope(NodeTree& tree);
+			~TraversalScope();
+
+			NodeTree& Tree;
+		};
+
+		/// <summary>
+		/// Calls a function for each node in a range of the flattened order, skipping subtrees that were removed during the traversal (and inactive ones if requested)
+		/// </summary>
+		template<bool SkipInactive, typename Func>
+		void ForEachNodeInRange(size_t begin, size_t end, const Func& func)
+		{
+			for (size_t i = begin; i < end;)
+			{
+				const FlatNode& flatNode = m_FlatNodes[i];
+
+				if (flatNode.NodePtr->m_FlatIndex != i || (SkipInactive && !flatNode.NodePtr->m_IsActiveInTree))
+				{
+					i += flatNode.SubtreeSize;
+					continue;
+				}
+
+				func(*flatNode.NodePtr);
+				i++;
+			}
+		}
+
+		/// <summary>
+		/// Adds a newly inserted child and its subtree to the flattened order. Only a subtree that lands at the end of the order is added right away,
+		/// otherwise the order is marked dirty and rebuilt before it's next read
+		/// </summary>
+		/// <param name="parent">The node the child was inserted into</param>
+		/// <param name="childIndex">The index of the child among its siblings</param>
+		void AttachSubtree(Node* parent, size_t childIndex);
+
+		/// <summary>
+		/// Removes a child that is about to be unparented and its subtree from the flattened order. As with AttachSubtree, only a subtree at the end
+		/// of the order is removed right away
+		/// </summary>
+		/// <param name="node">The child being removed</param>
+		void DetachSubtree(const Ref<Node>& node);
+
+		/// <summary>
+		/// Moves a child's subtree in the flattened order after the child was moved among its siblings. Only the nodes between its old and new place move
+		/// </summary>
+		/// <param name="parent">The parent of the child</param>
+		/// <param name="previousIndex">The index the child had among its siblings</param>
+		/// <param name="index">The index the child has now</param>
+		void MoveSubtree(Node* parent, size_t previousIndex, size_t index);
+
+		/// <summary>
+		/// Appends a node and its descendants to a list in depth-first order
+		/// </summary>
+		/// <param name="node">The root of the subtree</param>
+		/// <param name="nodes">The list to append to</param>
+		static void CollectSubtree(Node* node, List<FlatNode>& nodes);
+
+		/// <summary>
+		/// Updates the flattened index of every node in a range of positions
+		/// </summary>
+		/// <param name="begin">The first position to update</param>
+		/// <param name="end">One past the last position to update. Clamped to the number of nodes</param>
+		void UpdateFlatIndices(size_t begin, size_t end = SIZE_MAX);
+
+		/// <summary>
+		/// Marks the flattened order as out of date below a node whose children changed
+		/// </summary>
+		/// <param name="parent">The node whose children changed</param>
+		void MarkFlatNodesDirty(Node* parent);
+
+		/// <summary>
+		/// Gets if a node has its place in the flattened order. Only meaningful while the order is up to date
+		/// </summary>
+		bool IsInFlatNodes(const Node* node) const { return node->m_FlatIndex < m_FlatNodes.size() && m_FlatNodes[node->m_FlatIndex].NodePtr == node; }
+
+		/// <summary>
+		/// Rebuilds the flattened order if it's out of date and no traversal is in progress. Called before anything reads the order
+		/// </summary>
+		void UpdateFlatNodes();
+
+		/// <summary>
+		/// Collects the changed subtree again and shifts the rest of the order once to fit it, or rebuilds the whole order from the root if the
+		/// root's children changed
+		/// </summary>
+		void RebuildFlatNodes();
+
+		/// <summary>
+		/// Gets the deepest node that two nodes in the same tree both descend from (or are)
+		/// </summary>
+		static Node* GetCommonAncestor(Node* first, Node* second);
+
+		/// <summary>
+		/// Lists a node in the member array of one of its groups
+		/// </summary>
+		void AddGroupMember(Node& node, uint32_t group);
+
+		/// <summary>
+		/// Swap-removes a node from the member array of one of its groups
+		/// </summary>
+		void RemoveGroupMember(Node& node, uint32_t group);
+
+		/// <summary>
+		/// Lists a node that entered the tree in the member arrays of all of its groups
+		/// </summary>
+		void AddGroupMembers(Node& node);
+
+		/// <summary>
+		/// Removes a node that is leaving the tree from the member arrays of all of its groups
+		/// </summary>
+		void RemoveGroupMembers(Node& node);
+
+		/// <summary>
+		/// Ticks the nodes outside of independent subtrees, collecting the flat index of each independent subtree's root on the way
+		/// </summary>
+		void TickSerialNodes(double deltaTime);
+
+		/// <summary>
+		/// Ticks the collected independent subtrees on the scheduler, then applies the changes they deferred
+		/// </summary>
+		void TickIndependentSubtrees(double deltaTime);
+
+		/// <summary>
+		/// Applies the additions and removals queued by Node::QueueAddChild and Node::QueueFree, in that order, then destroys freed nodes up to the budget
+		/// </summary>
+		void ApplyQueuedChanges();
+
+		/// <summary>
+		/// Takes freed nodes out of the tree and destroys them until the budget runs out. A node nothing else references hands its children over to be
+		/// destroyed in turn, so a subtree leaves the tree and is released one node at a time rather than all at once
+		/// </summary>
+		void DestroyFreedNodes();
+
+		/// <summary>
+		/// Gets the command buffer of the calling thread if independent subtrees are being ticked in parallel
+		/// </summary>
+		/// <returns>The command buffer, or nullptr if changes can be made right away</returns>
+		NodeCommandBuffer* GetParallelCommandBuffer();
+
 	public:
 		/// <summary>
 		/// Invoked before all nodes are ticked
@@ -134,12 +523,129 @@ namespace Nova
 		EventSource<TickEvent> OnPostTreeTick;
 
 	private:
+		/// <summary>
+		/// The pool that nodes created by this tree are allocated from. Each node keeps it alive, so nodes can outlive the tree
+		/// </summary>
+		NodeSlabPool* m_NodePool = nullptr;
+
 		/// The root node of this tree
 		Ref<Node> m_RootNode;
 
+		/// <summary>
+		/// Freed nodes that are out of the tree's order and waiting to leave it and be destroyed, popped from the back. They're still registered
+		/// like the root's nodes, so they're declared with the root to be destroyed after everything that registers them
+		/// </summary>
+		List<Ref<Node>> m_NodesToDestroy;
+
+		/// <summary>
+		/// Every node in the tree in depth-first order, so full-tree passes are a linear scan. A node's subtree is the range starting at its flat index
+		/// </summary>
+		List<FlatNode> m_FlatNodes;
+
+		/// <summary>
+		/// The world matrix caches for 2D and 3D transform nodes. Declared after the root so they're destroyed before our nodes
+		/// </summary>
+		ManagedPtr<TransformStorage> m_Transforms2D;
+		ManagedPtr<TransformStorage> m_Transforms3D;
+
+		/// <summary>
+		/// The entities and components of this tree. Declared after the root so it's destroyed before our nodes, which it unbinds
+		/// </summary>
+		ManagedPtr<World> m_World;
+
+		/// <summary>
+		/// The bounds of this tree's 2D nodes. Declared after the root so it's destroyed before our nodes, which it forgets
+		/// </summary>
+		ManagedPtr<SpatialIndex> m_SpatialIndex;
+
+		/// <summary>
+		/// True if the structure changed in a way that wasn't applied to the flattened order yet. It's rebuilt before it's next read, or once the
+		/// traversal in progress ends
+		/// </summary>
+		bool m_IsFlatNodesDirty = false;
+
+		/// <summary>
+		/// The deepest node whose subtree holds every change that wasn't applied to the flattened order yet
+		/// </summary>
+		Node* m_DirtySubtreeRoot = nullptr;
+
+		/// <summary>
+		/// Incremented whenever nodes are added, removed or renamed, so cached lookups know when to redo their work
+		/// </summary>
+		uint64_t m_StructureVersion = 0;
+
+		/// <summary>
+		/// The lifetime and last frame counts of nodes added and removed. The other counters are filled in by GetCounters
+		/// </summary>
+		NodeTreeCounters m_Counters;
+
+		/// <summary>
+		/// The lifetime counts when the last tick ended, so the next one can tell how many nodes came and went in between
+		/// </summary>
+		uint64_t m_NodesAddedAtFrameEnd = 0;
+		uint64_t m_NodesRemovedAtFrameEnd = 0;
+
+		/// <summary>
+		/// The number of traversals in progress
+		/// </summary>
+		int m_TraversalDepth = 0;
+
+		/// <summary>
+		/// Nodes removed during a traversal. They are kept alive until it ends, as the flattened order still points to them
+		/// </summary>
+		List<Ref<Node>> m_DetachedDuringTraversal;
+
+		/// <summary>
+		/// The nodes in each group, indexed by the group's bit index. Only as long as the highest group index used in this tree
+		/// </summary>
+		List<List<Node*>> m_GroupMembers;
+
+		/// <summary>
+		/// Children waiting to be added at the end of the tick
+		/// </summary>
+		List<QueuedAdd> m_QueuedAdds;
+
+		/// <summary>
+		/// Nodes waiting to be removed at the end of the tick
+		/// </summary>
+		List<Ref<Node>> m_QueuedFrees;
+
+		/// <summary>
+		/// The most nodes destroyed per tick
+		/// </summary>
+		size_t m_DestroyBudget = DefaultDestroyBudget;
+
+		/// <summary>
+		/// The scheduler independent subtrees are ticked on
+		/// </summary>
+		Jobs::JobScheduler* m_Scheduler = nullptr;
+
+		/// <summary>
+		/// One command buffer for the main thread, then one for each of the scheduler's workers
+		/// </summary>
+		List<NodeCommandBuffer> m_CommandBuffers;
+
+		/// <summary>
+		/// The flat index of each independent subtree's root found during this tick
+		/// </summary>
+		List<size_t> m_IndependentSubtrees;
+
+		/// <summary>
+		/// True while independent subtrees are ticked in parallel
+		/// </summary>
+		bool m_IsTickingInParallel = false;
+
+		/// <summary>
+		/// The listener that ticks this tree
+		/// </summary>
+		Ref<TickListener> m_TickListener;
+
 		/// <summary>
 		/// The map of event sources that trigger for when each RenderLayer renders a frame
 		/// </summary>
 		Map<int, EventSource<LayerRenderingEventType>> m_LayerRenderingMap;
+
+		friend Node;
+		friend TransformStorage;
 	};
 }
\ No newline at end of file
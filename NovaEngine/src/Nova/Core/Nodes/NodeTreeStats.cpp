@@ -0,0 +1,65 @@
+#include "NodeTreeStats.h"
+
+namespace Nova
+{
+	string NodeTreeCounters::ToString() const
+	{
+		return FormatString("{0} nodes, {1} added and {2} removed last frame ({3} and {4} in total), {5} queued changes, {6} waiting to be destroyed",
+			NodeCount, NodesAddedLastFrame, NodesRemovedLastFrame, NodesAdded, NodesRemoved, QueuedChangeCount, PendingDestroyCount);
+	}
+
+	void NodeTreeCounters::WriteMetrics(MetricsSink& sink, const string& prefix) const
+	{
+		sink.Write(prefix + "NodeCount", (double)NodeCount);
+		sink.Write(prefix + "NodesAdded", (double)NodesAdded);
+		sink.Write(prefix + "NodesRemoved", (double)NodesRemoved);
+		sink.Write(prefix + "NodesAddedLastFrame", (double)NodesAddedLastFrame);
+		sink.Write(prefix + "NodesRemovedLastFrame", (double)NodesRemovedLastFrame);
+		sink.Write(prefix + "QueuedChangeCount", (double)QueuedChangeCount);
+		sink.Write(prefix + "PendingDestroyCount", (double)PendingDestroyCount);
+	}
+
+	string NodeTreeReport::ToString() const
+	{
+		string text = FormatString("{0} nodes ({1} active), {2} deep, at most {3} children per node\n", NodeCount, ActiveNodeCount, MaxDepth, MaxChildCount);
+
+		text += FormatString("Names: {0} unique, {1} bytes\n", UniqueNameCount, NameBytes);
+		text += FormatString("Child lists: {0} bytes, child name indices: {1} bytes\n", ChildListBytes, ChildNameIndexBytes);
+		text += FormatString("Property overrides: {0} bytes, groups: {1} bytes, flattened order: {2} bytes\n", PropertyOverrideBytes, GroupBytes, FlatOrderBytes);
+		text += FormatString("Node pool: {0} bytes used, {1} bytes reserved", PoolUsedBytes, PoolReservedBytes);
+
+		for (const NodeTypeStats& type : Types)
+		{
+			// Unregistered classes have no known size, which isn't the same as taking up no memory
+			if (type.InstanceBytes > 0)
+				text += FormatString("\n  {0}: {1} nodes, {2} bytes", type.TypeName, type.Count, type.InstanceBytes);
+			else
+				text += FormatString("\n  {0}: {1} nodes, unknown size", type.TypeName, type.Count);
+		}
+
+		return text;
+	}
+
+	void NodeTreeReport::WriteMetrics(MetricsSink& sink, const string& prefix) const
+	{
+		sink.Write(prefix + "NodeCount", (double)NodeCount);
+		sink.Write(prefix + "ActiveNodeCount", (double)ActiveNodeCount);
+		sink.Write(prefix + "MaxDepth", (double)MaxDepth);
+		sink.Write(prefix + "MaxChildCount", (double)MaxChildCount);
+		sink.Write(prefix + "UniqueNameCount", (double)UniqueNameCount);
+		sink.Write(prefix + "NameBytes", (double)NameBytes);
+		sink.Write(prefix + "ChildListBytes", (double)ChildListBytes);
+		sink.Write(prefix + "ChildNameIndexBytes", (double)ChildNameIndexBytes);
+		sink.Write(prefix + "PropertyOverrideBytes", (double)PropertyOverrideBytes);
+		sink.Write(prefix + "GroupBytes", (double)GroupBytes);
+		sink.Write(prefix + "FlatOrderBytes", (double)FlatOrderBytes);
+		sink.Write(prefix + "PoolUsedBytes", (double)PoolUsedBytes);
+		sink.Write(prefix + "PoolReservedBytes", (double)PoolReservedBytes);
+
+		for (const NodeTypeStats& type : Types)
+		{
+			sink.Write(prefix + "Types." + type.TypeName + ".Count", (double)type.Count);
+			sink.Write(prefix + "Types." + type.TypeName + ".InstanceBytes", (double)type.InstanceBytes);
+		}
+	}
+}
@@ -0,0 +1,178 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Logging/MetricsSink.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/String.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// Counters a NodeTree keeps up to date as nodes come and go. Cheap enough to read every frame
+	/// </summary>
+	struct NovaAPI NodeTreeCounters
+	{
+		/// <summary>
+		/// The number of nodes in the tree, including the root
+		/// </summary>
+		size_t NodeCount = 0;
+
+		/// <summary>
+		/// The number of nodes that entered the tree since it was created
+		/// </summary>
+		uint64_t NodesAdded = 0;
+
+		/// <summary>
+		/// The number of nodes that left the tree since it was created
+		/// </summary>
+		uint64_t NodesRemoved = 0;
+
+		/// <summary>
+		/// The number of nodes that entered the tree between the end of the tick before last and the end of the last tick
+		/// </summary>
+		uint64_t NodesAddedLastFrame = 0;
+
+		/// <summary>
+		/// The number of nodes that left the tree between the end of the tick before last and the end of the last tick
+		/// </summary>
+		uint64_t NodesRemovedLastFrame = 0;
+
+		/// <summary>
+		/// The number of adds and frees queued for the next tick
+		/// </summary>
+		size_t QueuedChangeCount = 0;
+
+		/// <summary>
+		/// The number of freed subtrees and nodes waiting to be destroyed
+		/// </summary>
+		size_t PendingDestroyCount = 0;
+
+		/// <summary>
+		/// Formats the counters on a single line, such as for the log
+		/// </summary>
+		/// <returns>The counters as text</returns>
+		string ToString() const;
+
+		/// <summary>
+		/// Writes each counter to a metrics sink
+		/// </summary>
+		/// <param name="sink">The sink to write to</param>
+		/// <param name="prefix">The text to start each name with</param>
+		void WriteMetrics(MetricsSink& sink, const string& prefix = "NodeTree.") const;
+	};
+
+	/// <summary>
+	/// The nodes of one class in a NodeTreeReport
+	/// </summary>
+	struct NovaAPI NodeTypeStats
+	{
+		/// <summary>
+		/// The name the class is registered under with the NodeTypeRegistry, or its C++ name if it isn't registered
+		/// </summary>
+		string TypeName;
+
+		/// <summary>
+		/// The number of nodes of the class
+		/// </summary>
+		size_t Count = 0;
+
+		/// <summary>
+		/// The size of the nodes themselves, not counting what they allocate. Zero if the class isn't registered, as its size is unknown, and reported as an unknown size by ToString
+		/// </summary>
+		size_t InstanceBytes = 0;
+	};
+
+	/// <summary>
+	/// A breakdown of a NodeTree's size, made by walking the whole tree. Memory sizes count what the tree's containers have reserved, and the sizes of
+	/// hash tables are estimates. Classes that aren't registered with the NodeTypeRegistry have an unknown instance size, which ToString reports as
+	/// unknown rather than as 0 bytes
+	/// </summary>
+	struct NovaAPI NodeTreeReport
+	{
+		/// <summary>
+		/// The number of nodes in the tree, including the root
+		/// </summary>
+		size_t NodeCount = 0;
+
+		/// <summary>
+		/// The number of nodes that are active in the tree, meaning they and all of their ancestors are active
+		/// </summary>
+		size_t ActiveNodeCount = 0;
+
+		/// <summary>
+		/// The depth of the deepest node, where the root's children have a depth of 1
+		/// </summary>
+		size_t MaxDepth = 0;
+
+		/// <summary>
+		/// The most children any one node has
+		/// </summary>
+		size_t MaxChildCount = 0;
+
+		/// <summary>
+		/// The number of distinct names. Nodes with the same name share its string
+		/// </summary>
+		size_t UniqueNameCount = 0;
+
+		/// <summary>
+		/// The size of the interned strings of the distinct names
+		/// </summary>
+		size_t NameBytes = 0;
+
+		/// <summary>
+		/// The memory of every node's list of children
+		/// </summary>
+		size_t ChildListBytes = 0;
+
+		/// <summary>
+		/// The estimated memory of the name indices of nodes with enough children to have one
+		/// </summary>
+		size_t ChildNameIndexBytes = 0;
+
+		/// <summary>
+		/// The memory of the properties nodes set on themselves. Default property tables are shared, so they aren't counted
+		/// </summary>
+		size_t PropertyOverrideBytes = 0;
+
+		/// <summary>
+		/// The memory of the tree's group member lists and each node's place in them
+		/// </summary>
+		size_t GroupBytes = 0;
+
+		/// <summary>
+		/// The memory of the tree's flattened depth-first order
+		/// </summary>
+		size_t FlatOrderBytes = 0;
+
+		/// <summary>
+		/// The memory of the tree's node pool in use by nodes, which may also include nodes that have left the tree
+		/// </summary>
+		size_t PoolUsedBytes = 0;
+
+		/// <summary>
+		/// The memory the tree's node pool has reserved, whether or not it's in use
+		/// </summary>
+		size_t PoolReservedBytes = 0;
+
+		/// <summary>
+		/// The nodes of each class, most common first
+		/// </summary>
+		List<NodeTypeStats> Types;
+
+		/// <summary>
+		/// Formats the report over several lines, such as for the log
+		/// </summary>
+		/// <returns>The report as text</returns>
+		string ToString() const;
+
+		/// <summary>
+		/// Writes each value to a metrics sink, with the counts of each class under "Types.(name)."
+		/// </summary>
+		/// <param name="sink">The sink to write to</param>
+		/// <param name="prefix">The text to start each name with</param>
+		void WriteMetrics(MetricsSink& sink, const string& prefix = "NodeTree.") const;
+	};
+}
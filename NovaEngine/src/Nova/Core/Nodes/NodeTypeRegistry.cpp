@@ -0,0 +1,89 @@
+#include "NodeTypeRegistry.h"
+#include "Node2D.h"
+#include "Node3D.h"
+#include "NodeExceptions.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Nova
+{
+	namespace
+	{
+		/// <summary>
+		/// Every registered node type. Infos live in a deque so pointers to them stay valid as more are registered
+		/// </summary>
+		struct NodeTypeTable
+		{
+			NodeTypeTable()
+			{
+				Add(NodeTypeInfo{ NameID("Node"), typeid(Node), sizeof(Node), [](NodeTree& tree) -> Ref<Node> { return tree.CreateNode<Node>(string()); } });
+				Add(NodeTypeInfo{ NameID("Node2D"), typeid(Node2D), sizeof(Node2D), [](NodeTree& tree) -> Ref<Node> { return tree.CreateNode<Node2D>(string()); } });
+				Add(NodeTypeInfo{ NameID("Node3D"), typeid(Node3D), sizeof(Node3D), [](NodeTree& tree) -> Ref<Node> { return tree.CreateNode<Node3D>(string()); } });
+			}
+
+			void Add(const NodeTypeInfo& info)
+			{
+				// Infos are read without the lock once they've been handed out, so they're never changed
+				auto typeIt = ByType.find(info.Type);
+
+				if (typeIt != ByType.end())
+				{
+					if (typeIt->second->Name == info.Name)
+						return;
+
+					throw NodeTypeException(FormatString("Can't register the node type \"{0}\", as its class is already registered as \"{1}\"",
+						info.Name.GetString(), typeIt->second->Name.GetString()));
+				}
+
+				auto nameIt = ByName.find(info.Name);
+
+				if (nameIt != ByName.end())
+					throw NodeTypeException(FormatString("Can't register the node type \"{0}\", as another class is already registered under the name", info.Name.GetString()));
+
+				Infos.push_back(info);
+				ByType.emplace(info.Type, &Infos.back());
+				ByName.emplace(info.Name, &Infos.back());
+			}
+
+			std::shared_mutex Mutex;
+			std::deque<NodeTypeInfo> Infos;
+			std::unordered_map<NameID, const NodeTypeInfo*> ByName;
+			std::unordered_map<std::type_index, const NodeTypeInfo*> ByType;
+		};
+
+		NodeTypeTable& GetNodeTypeTable()
+		{
+			static NodeTypeTable table;
+			return table;
+		}
+	}
+
+	const NodeTypeInfo* NodeTypeRegistry::Find(NameID typeName)
+	{
+		NodeTypeTable& table = GetNodeTypeTable();
+		std::shared_lock lock(table.Mutex);
+
+		auto it = table.ByName.find(typeName);
+		return it != table.ByName.end() ? it->second : nullptr;
+	}
+
+	const NodeTypeInfo* NodeTypeRegistry::Find(const std::type_index& type)
+	{
+		NodeTypeTable& table = GetNodeTypeTable();
+		std::shared_lock lock(table.Mutex);
+
+		auto it = table.ByType.find(type);
+		return it != table.ByType.end() ? it->second : nullptr;
+	}
+
+	void NodeTypeRegistry::Register(const NodeTypeInfo& info)
+	{
+		NodeTypeTable& table = GetNodeTypeTable();
+		std::unique_lock lock(table.Mutex);
+
+		table.Add(info);
+	}
+}
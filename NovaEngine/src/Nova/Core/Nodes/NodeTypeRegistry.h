@@ -0,0 +1,77 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/NameID.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "NodeTree.h"
+
+#include <type_traits>
+#include <typeindex>
+#include <typeinfo>
+
+namespace Nova
+{
+	/// <summary>
+	/// Describes a node class that can be created by name, such as when loading a scene
+	/// </summary>
+	struct NodeTypeInfo
+	{
+		/// <summary>
+		/// The name the type is saved under
+		/// </summary>
+		NameID Name;
+
+		/// <summary>
+		/// The C++ type
+		/// </summary>
+		std::type_index Type;
+
+		/// <summary>
+		/// The size of the C++ type in bytes
+		/// </summary>
+		size_t Size;
+
+		/// <summary>
+		/// Creates an unnamed node of the type in a tree's node pool
+		/// </summary>
+		Ref<Node>(*Create)(NodeTree& tree);
+	};
+
+	/// <summary>
+	/// Maps node classes to and from the names they are saved under. Node, Node2D and Node3D are always registered. Thread-safe
+	/// </summary>
+	class NovaAPI NodeTypeRegistry
+	{
+	public:
+		/// <summary>
+		/// Registers a node class. Registrations never change once made, as other threads may be using them, so registering a class again under
+		/// the same name does nothing, while registering it under another name or taking a name another class has throws a NodeTypeException
+		/// </summary>
+		/// <param name="typeName">The name to save the class under</param>
+		template<typename NodeClass>
+		static void Register(const string& typeName)
+		{
+			static_assert(std::is_base_of<Node, NodeClass>::value, "The class must inherit from Node");
+			static_assert(std::is_constructible<NodeClass, const string&>::value, "The class must be constructible from just a name");
+
+			Register(NodeTypeInfo{ NameID(typeName), typeid(NodeClass), sizeof(NodeClass), [](NodeTree& tree) -> Ref<Node> { return tree.CreateNode<NodeClass>(string()); } });
+		}
+
+		/// <summary>
+		/// Finds a registered type by name
+		/// </summary>
+		/// <param name="typeName">The name of the type</param>
+		/// <returns>The type, or nullptr if no type has the name</returns>
+		static const NodeTypeInfo* Find(NameID typeName);
+
+		/// <summary>
+		/// Finds a registered type by its C++ type
+		/// </summary>
+		/// <param name="type">The C++ type</param>
+		/// <returns>The type, or nullptr if the type isn't registered</returns>
+		static const NodeTypeInfo* Find(const std::type_index& type);
+
+	private:
+		static void Register(const NodeTypeInfo& info);
+	};
+}
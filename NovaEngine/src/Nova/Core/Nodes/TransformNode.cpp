@@ -0,0 +1,54 @@
+#include "TransformNode.h"
+#include "NodeTree.h"
+
+namespace Nova
+{
+	TransformNode::TransformNode(const string& name) :
+		Node(name)
+	{}
+
+	TransformNode::~TransformNode()
+	{
+		if (m_Storage)
+			m_Storage->Unregister(this);
+	}
+
+	Matrix4 TransformNode::GetWorldMatrix() const
+	{
+		if (m_Storage && m_Storage->PrepareForReads())
+			return m_Storage->GetWorldMatrix(m_Slot);
+
+		// Not cached, so walk up to the nearest transform ancestor in our space
+		for (Ref<Node> parent = GetParent(); parent; parent = parent->GetParent())
+		{
+			const TransformNode* transformParent = dynamic_cast<const TransformNode*>(parent.get());
+
+			if (transformParent && transformParent->GetTransformSpace() == GetTransformSpace())
+				return transformParent->GetWorldMatrix() * ComputeLocalMatrix();
+		}
+
+		return ComputeLocalMatrix();
+	}
+
+	void TransformNode::OnLocalTransformChanged()
+	{
+		if (m_Storage)
+			m_Storage->SetLocalMatrix(this, ComputeLocalMatrix());
+
+		MarkSnapshotDirty();
+	}
+
+	// Node ----------
+	void TransformNode::OnEnterTree(NodeTree& tree)
+	{
+		tree.GetTransformStorage(GetTransformSpace()).Register(this);
+	}
+
+	void TransformNode::OnExitTree(NodeTree& tree)
+	{
+		if (m_Storage)
+			m_Storage->Unregister(this);
+	}
+
+	// Node ----------
+}
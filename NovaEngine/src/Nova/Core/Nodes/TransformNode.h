@@ -0,0 +1,68 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Matrix4.h"
+#include "Node.h"
+#include "TransformStorage.h"
+
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// Base class for nodes with a transform. A transform node's world matrix combines its local transform with that of its nearest transform ancestor
+	/// in the same space, so plain nodes in between don't break the hierarchy. While in a tree, world matrices are cached by the tree's TransformStorage
+	/// and only recomputed for subtrees whose transforms changed
+	/// </summary>
+	class NovaAPI TransformNode : public Node
+	{
+	public:
+		TransformNode(const string& name);
+		virtual ~TransformNode();
+
+	public:
+		/// <summary>
+		/// Gets the transform of this node relative to the world
+		/// </summary>
+		/// <returns>The world matrix</returns>
+		Matrix4 GetWorldMatrix() const;
+
+		/// <summary>
+		/// Gets the transform of this node relative to its transform parent
+		/// </summary>
+		/// <returns>The local matrix</returns>
+		virtual Matrix4 ComputeLocalMatrix() const = 0;
+
+		/// <summary>
+		/// Gets which transform hierarchy this node belongs to
+		/// </summary>
+		/// <returns>The transform space</returns>
+		virtual TransformSpace GetTransformSpace() const = 0;
+
+	protected:
+		/// <summary>
+		/// Must be called by derived classes whenever their local transform changes
+		/// </summary>
+		void OnLocalTransformChanged();
+
+	// Node ----------
+	protected:
+		virtual void OnEnterTree(NodeTree& tree) override;
+		virtual void OnExitTree(NodeTree& tree) override;
+
+	// Node ----------
+
+	private:
+		/// <summary>
+		/// The storage caching this node's world matrix, or nullptr if it isn't in a tree
+		/// </summary>
+		TransformStorage* m_Storage = nullptr;
+
+		/// <summary>
+		/// This node's slot in the storage
+		/// </summary>
+		int32_t m_Slot = -1;
+
+		friend TransformStorage;
+	};
+}
@@ -0,0 +1,185 @@
+#include "TransformStorage.h"
+#include "TransformNode.h"
+#include "NodeTree.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace Nova
+{
+	TransformStorage::TransformStorage(NodeTree& tree) :
+		m_Tree(tree)
+	{}
+
+	TransformStorage::~TransformStorage()
+	{
+		// Nodes can outlive their tree, so make sure they don't point to us anymore
+		for (TransformNode* node : m_Nodes)
+		{
+			node->m_Storage = nullptr;
+			node->m_Slot = -1;
+		}
+	}
+
+	void TransformStorage::Update()
+	{
+		if (!PrepareForReads() || !m_HasDirty)
+			return;
+
+		// Parents come before their children, so a parent's world matrix is always ready by the time its children need it
+		const size_t count = m_Nodes.size();
+
+		for (size_t slot = 0; slot < count; slot++)
+		{
+			if (!m_IsDirty[slot])
+				continue;
+
+			const int32_t parent = m_Parents[slot];
+
+			if (parent >= 0)
+				Matrix4::Multiply(m_WorldMatrices[parent], m_LocalMatrices[slot], m_WorldMatrices[slot]);
+			else
+				m_WorldMatrices[slot] = m_LocalMatrices[slot];
+
+			m_IsDirty[slot] = 0;
+		}
+
+		m_HasDirty = false;
+	}
+
+	void TransformStorage::Register(TransformNode* node)
+	{
+		node->m_Storage = this;
+		node->m_Slot = (int32_t)m_Nodes.size();
+
+		m_Nodes.push_back(node);
+		m_IsOrderDirty = true;
+	}
+
+	void TransformStorage::Unregister(TransformNode* node)
+	{
+		// A node's slot is always its index in the list, even while the order is out of date
+		TransformNode* last = m_Nodes.back();
+		m_Nodes[node->m_Slot] = last;
+		last->m_Slot = node->m_Slot;
+		m_Nodes.pop_back();
+
+		node->m_Storage = nullptr;
+		node->m_Slot = -1;
+
+		m_IsOrderDirty = true;
+	}
+
+	bool TransformStorage::PrepareForReads()
+	{
+		if (!m_IsOrderDirty)
+			return true;
+
+		// The tree's depth-first order can only be brought up to date outside of traversals that changed the structure
+		m_Tree.UpdateFlatNodes();
+
+		if (m_Tree.m_IsFlatNodesDirty)
+			return false;
+
+		RebuildOrder();
+		return true;
+	}
+
+	void TransformStorage::SetLocalMatrix(const TransformNode* node, const Matrix4& localMatrix)
+	{
+		// The matrix is picked up from the node when the order is rebuilt
+		if (m_IsOrderDirty)
+			return;
+
+		const int32_t slot = node->m_Slot;
+		m_LocalMatrices[slot] = localMatrix;
+
+		// Slots in a subtree are contiguous, so marking it dirty is a single fill
+		std::memset(m_IsDirty.data() + slot, 1, (size_t)(m_SubtreeEnds[slot] - slot));
+		m_HasDirty.store(true, std::memory_order_relaxed);
+	}
+
+	const Matrix4& TransformStorage::GetWorldMatrix(int32_t slot)
+	{
+		if (m_IsDirty[slot])
+		{
+			const int32_t parent = m_Parents[slot];
+
+			if (parent >= 0)
+				Matrix4::Multiply(GetWorldMatrix(parent), m_LocalMatrices[slot], m_WorldMatrices[slot]);
+			else
+				m_WorldMatrices[slot] = m_LocalMatrices[slot];
+
+			m_IsDirty[slot] = 0;
+		}
+
+		return m_WorldMatrices[slot];
+	}
+
+	void TransformStorage::RebuildOrder()
+	{
+		// Nodes of freed subtrees stay registered until the tree takes them out, but have no place in its order anymore, so they go last
+		for (TransformNode* node : m_Nodes)
+		{
+			if (!m_Tree.IsInFlatNodes(node))
+				node->m_FlatIndex = SIZE_MAX;
+		}
+
+		std::sort(m_Nodes.begin(), m_Nodes.end(), [](const TransformNode* lhs, const TransformNode* rhs)
+			{
+				return lhs->m_FlatIndex < rhs->m_FlatIndex;
+			});
+
+		const size_t count = m_Nodes.size();
+
+		m_LocalMatrices.resize(count);
+		m_WorldMatrices.resize(count);
+		m_Parents.resize(count);
+		m_SubtreeEnds.resize(count);
+		m_IsDirty.assign(count, 1);
+
+		// The transform ancestors of the current node, with where each one's subtree ends in the tree's order
+		struct Ancestor
+		{
+			size_t FlatEnd;
+			int32_t Slot;
+		};
+
+		List<Ancestor> ancestors;
+
+		for (size_t slot = 0; slot < count; slot++)
+		{
+			TransformNode* node = m_Nodes[slot];
+			const size_t flatIndex = node->m_FlatIndex;
+
+			while (!ancestors.empty() && flatIndex >= ancestors.back().FlatEnd)
+			{
+				m_SubtreeEnds[ancestors.back().Slot] = (int32_t)slot;
+				ancestors.pop_back();
+			}
+
+			node->m_Slot = (int32_t)slot;
+			m_LocalMatrices[slot] = node->ComputeLocalMatrix();
+
+			if (flatIndex == SIZE_MAX)
+			{
+				m_Parents[slot] = -1;
+				m_SubtreeEnds[slot] = (int32_t)slot + 1;
+
+				continue;
+			}
+
+			m_Parents[slot] = ancestors.empty() ? -1 : ancestors.back().Slot;
+
+			ancestors.push_back({ flatIndex + m_Tree.m_FlatNodes[flatIndex].SubtreeSize, (int32_t)slot });
+		}
+
+		for (const Ancestor& ancestor : ancestors)
+		{
+			m_SubtreeEnds[ancestor.Slot] = (int32_t)count;
+		}
+
+		m_HasDirty = count > 0;
+		m_IsOrderDirty = false;
+	}
+}
@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/Matrix4.h"
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	class NodeTree;
+	class TransformNode;
+
+	/// <summary>
+	/// The kinds of transform hierarchies. Transform nodes only inherit transforms from ancestors in the same space
+	/// </summary>
+	enum class TransformSpace
+	{
+		Space2D = 0,
+		Space3D = 1,
+	};
+
+	/// <summary>
+	/// Stores the local and world matrices of a tree's transform nodes in contiguous arrays, ordered so parents always come before their children.
+	/// Changing a local transform marks its subtree dirty, and world matrices are recomputed either lazily when read or in a single linear pass
+	/// </summary>
+	class NovaAPI TransformStorage
+	{
+	public:
+		/// <summary>
+		/// Creates empty storage for a tree
+		/// </summary>
+		/// <param name="tree">The tree the transform nodes are in</param>
+		TransformStorage(NodeTree& tree);
+		~TransformStorage();
+
+		TransformStorage(const TransformStorage&) = delete;
+		TransformStorage& operator=(const TransformStorage&) = delete;
+
+	public:
+		/// <summary>
+		/// Recomputes every dirty world matrix
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Marks the order as out of date because the tree's structure changed. It's rebuilt before the next update or read
+		/// </summary>
+		void MarkOrderDirty() { m_IsOrderDirty = true; }
+
+		/// <summary>
+		/// Gets the number of transform nodes in the storage
+		/// </summary>
+		/// <returns>The number of transform nodes</returns>
+		size_t GetCount() const { return m_Nodes.size(); }
+
+	private:
+		/// <summary>
+		/// Adds a node that entered the tree
+		/// </summary>
+		void Register(TransformNode* node);
+
+		/// <summary>
+		/// Removes a node that left the tree
+		/// </summary>
+		void Unregister(TransformNode* node);
+
+		/// <summary>
+		/// Makes sure the order is up to date so world matrices can be read
+		/// </summary>
+		/// <returns>False if the tree is mid-traversal with structural changes pending, so the order can't be rebuilt yet</returns>
+		bool PrepareForReads();
+
+		/// <summary>
+		/// Sets a node's local matrix and marks its subtree dirty
+		/// </summary>
+		void SetLocalMatrix(const TransformNode* node, const Matrix4& localMatrix);
+
+		/// <summary>
+		/// Gets a node's world matrix, computing it and any dirty ancestors first. The order must be up to date
+		/// </summary>
+		const Matrix4& GetWorldMatrix(int32_t slot);
+
+		/// <summary>
+		/// Sorts the nodes into the tree's depth-first order and finds each one's transform parent
+		/// </summary>
+		void RebuildOrder();
+
+	private:
+		/// <summary>
+		/// The tree the transform nodes are in
+		/// </summary>
+		NodeTree& m_Tree;
+
+		/// <summary>
+		/// The transform nodes. In slot order while the order is up to date
+		/// </summary>
+		List<TransformNode*> m_Nodes;
+
+		/// <summary>
+		/// Each slot's local matrix
+		/// </summary>
+		List<Matrix4> m_LocalMatrices;
+
+		/// <summary>
+		/// Each slot's world matrix. Only valid for slots that aren't dirty
+		/// </summary>
+		List<Matrix4> m_WorldMatrices;
+
+		/// <summary>
+		/// The slot of each slot's transform parent, or -1 if it has none
+		/// </summary>
+		List<int32_t> m_Parents;
+
+		/// <summary>
+		/// One past the last slot in each slot's subtree
+		/// </summary>
+		List<int32_t> m_SubtreeEnds;
+
+		/// <summary>
+		/// True for slots whose world matrix needs recomputing
+		/// </summary>
+		List<uint8_t> m_IsDirty;
+
+		/// <summary>
+		/// True if any slot is dirty. Atomic as independent subtrees mark their slots dirty in parallel
+		/// </summary>
+		std::atomic<bool> m_HasDirty = false;
+
+		/// <summary>
+		/// True if the order must be rebuilt
+		/// </summary>
+		bool m_IsOrderDirty = false;
+
+		friend TransformNode;
+	};
+}
@@ -0,0 +1,93 @@
+#include "NodeSnapshot.h"
+#include "PropertyStream.h"
+#include "SceneExceptions.h"
+
+namespace Nova
+{
+	Ref<NodeSnapshot> NodeSnapshot::Take(Node& root)
+	{
+		return MakeRef<NodeSnapshot>(SaveNode(root));
+	}
+
+	Ref<Node> NodeSnapshot::Instantiate(NodeTree& tree) const
+	{
+		return Instantiate(tree, m_Root);
+	}
+
+	const Ref<const NodeSnapshotRecord>& NodeSnapshot::SaveNode(Node& node)
+	{
+		// Nothing in the subtree changed since it was last saved
+		if (node.m_SnapshotRecord)
+			return node.m_SnapshotRecord;
+
+		const NodeTypeInfo* type = NodeTypeRegistry::Find(typeid(node));
+
+		if (!type)
+			throw SceneException(FormatString("Node \"{0}\" has type {1}, which isn't registered with the NodeTypeRegistry", node.GetName(), typeid(node).name()));
+
+		auto record = MakeRef<NodeSnapshotRecord>();
+		record->Type = type;
+		record->Name = node.GetNameID();
+		record->TickOrder = node.GetTickOrder();
+		record->IsActive = node.GetIsActive();
+		record->IsTickIndependent = node.GetIsTickIndependent();
+		record->Groups = node.GetGroups();
+		record->DefaultProperties = node.m_DefaultProperties;
+		record->NodeCount = 1;
+
+		if (node.m_PropertyOverrides)
+			record->PropertyOverrides = *node.m_PropertyOverrides;
+
+		PropertyWriter writer(record->PropertyData);
+		node.WriteProperties(writer);
+
+		record->Children.reserve(node.m_Children.size());
+
+		for (const Ref<Node>& child : node.m_Children)
+		{
+			record->Children.push_back(SaveNode(*child));
+			record->NodeCount += record->Children.back()->NodeCount;
+		}
+
+		node.m_SnapshotRecord = std::move(record);
+
+		return node.m_SnapshotRecord;
+	}
+
+	Ref<Node> NodeSnapshot::Instantiate(NodeTree& tree, const Ref<const NodeSnapshotRecord>& record)
+	{
+		Ref<Node> node = record->Type->Create(tree);
+
+		// Nothing else can see the node yet, so the fields can be set directly
+		node->m_Name = record->Name;
+		node->m_TickOrder = record->TickOrder;
+		node->m_IsTickIndependent = record->IsTickIndependent;
+		node->m_Groups = record->Groups;
+		node->m_DefaultProperties = record->DefaultProperties;
+
+		if (!record->PropertyOverrides.empty())
+			node->m_PropertyOverrides = MakeManagedPtr<List<NodePropertyTable::Entry>>(record->PropertyOverrides);
+
+		node->m_Children.reserve(record->Children.size());
+
+		if (!record->IsActive)
+			node->SetIsActive(false);
+
+		if (!record->PropertyData.empty())
+		{
+			PropertyReader reader(record->PropertyData.data(), record->PropertyData.size());
+			node->ReadProperties(reader);
+		}
+
+		// Children were saved in tick order, so linking them up only appends
+		for (const Ref<const NodeSnapshotRecord>& child : record->Children)
+		{
+			node->AppendDetachedChild(Instantiate(tree, child));
+		}
+
+		// Restoring the node marked it as changed, but it matches the record exactly
+		node->m_SnapshotRecord = record;
+
+		return node;
+	}
+}
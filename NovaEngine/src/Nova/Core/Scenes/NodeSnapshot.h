@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Nodes/Node.h"
+#include "Nova/Core/Nodes/NodeTypeRegistry.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/NameID.h"
+#include "Nova/Core/Types/RefCounted.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// The saved state of one node and its descendants. Records are immutable once created, so snapshots share the records of every subtree that
+	/// didn't change between them
+	/// </summary>
+	struct NodeSnapshotRecord : public RefCounted
+	{
+		const NodeTypeInfo* Type;
+		NameID Name;
+		int TickOrder;
+		bool IsActive;
+		bool IsTickIndependent;
+		NodeGroupMask Groups;
+
+		/// <summary>
+		/// The table the node's properties default to, shared with the node rather than copied
+		/// </summary>
+		Ref<const NodePropertyTable> DefaultProperties;
+
+		/// <summary>
+		/// The properties set on the node itself, sorted by name ID. Kept apart from the defaults so rolling back restores them as overrides
+		/// </summary>
+		List<NodePropertyTable::Entry> PropertyOverrides;
+
+		/// <summary>
+		/// The blob written by the node's WriteProperties
+		/// </summary>
+		List<uint8_t> PropertyData;
+
+		/// <summary>
+		/// The records of the node's children, in tick order
+		/// </summary>
+		List<Ref<const NodeSnapshotRecord>> Children;
+
+		/// <summary>
+		/// The number of nodes in the subtree, including this one
+		/// </summary>
+		size_t NodeCount;
+	};
+
+	/// <summary>
+	/// A persistent copy of a subtree, such as for rolling back to or saving on a background thread while the tree keeps ticking. Each node keeps the
+	/// record it was last saved as until it changes, so taking a snapshot only saves the nodes that changed since the last one, and the ancestors
+	/// that lead to them. Every node must be of a type registered with the NodeTypeRegistry, otherwise a SceneException is thrown
+	/// </summary>
+	class NovaAPI NodeSnapshot : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a snapshot from a record
+		/// </summary>
+		/// <param name="root">The record of the root node</param>
+		NodeSnapshot(const Ref<const NodeSnapshotRecord>& root) : m_Root(root) {}
+
+	public:
+		/// <summary>
+		/// Takes a snapshot of a node and its descendants. This must run on the thread that owns the tree, between ticks
+		/// </summary>
+		/// <param name="root">The root of the snapshot</param>
+		/// <returns>The snapshot</returns>
+		static Ref<NodeSnapshot> Take(Node& root);
+
+		/// <summary>
+		/// Recreates the saved nodes in a tree's node pool, such as to roll back to the snapshot. The nodes are linked together before the root is
+		/// returned, and start out sharing their records with the snapshot, so taking another snapshot of them is free until they change
+		/// </summary>
+		/// <param name="tree">The tree whose pool the nodes are created in</param>
+		/// <returns>The root of the copy</returns>
+		Ref<Node> Instantiate(NodeTree& tree) const;
+
+		/// <summary>
+		/// Gets the record of the root node
+		/// </summary>
+		/// <returns>The root record</returns>
+		const Ref<const NodeSnapshotRecord>& GetRoot() const { return m_Root; }
+
+		/// <summary>
+		/// Gets the number of nodes in the snapshot
+		/// </summary>
+		/// <returns>The number of nodes</returns>
+		size_t GetNodeCount() const { return m_Root->NodeCount; }
+
+	private:
+		/// <summary>
+		/// Gets a node's record, saving it and any of its descendants that changed since they were last saved
+		/// </summary>
+		static const Ref<const NodeSnapshotRecord>& SaveNode(Node& node);
+
+		/// <summary>
+		/// Creates a node and its descendants from a record
+		/// </summary>
+		static Ref<Node> Instantiate(NodeTree& tree, const Ref<const NodeSnapshotRecord>& record);
+
+	private:
+		/// <summary>
+		/// The record of the root node
+		/// </summary>
+		Ref<const NodeSnapshotRecord> m_Root;
+	};
+}
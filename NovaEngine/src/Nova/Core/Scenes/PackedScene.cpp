@@ -0,0 +1,267 @@
+#include "PackedScene.h"
+#include "PropertyStream.h"
+#include "SceneExceptions.h"
+
+#include "Nova/Core/Nodes/NodeGroup.h"
+
+#include <algorithm>
+#include <string.h>
+#include <string_view>
+#include <type_traits>
+#include <variant>
+
+namespace Nova
+{
+	static_assert(std::is_same_v<std::variant_alternative_t<SceneFormat::PropertyBool, NodePropertyValue>, bool>
+		&& std::is_same_v<std::variant_alternative_t<SceneFormat::PropertyInt, NodePropertyValue>, int64_t>
+		&& std::is_same_v<std::variant_alternative_t<SceneFormat::PropertyDouble, NodePropertyValue>, double>
+		&& std::is_same_v<std::variant_alternative_t<SceneFormat::PropertyString, NodePropertyValue>, string>,
+		"The scene property types must match the order of NodePropertyValue");
+
+	PackedScene::PackedScene(FileIO::MappedFile&& file) :
+		m_File(std::move(file))
+	{
+		m_Data = m_File.GetData();
+		m_Size = m_File.GetSize();
+
+		Parse();
+	}
+
+	PackedScene::PackedScene(List<uint8_t>&& bytes) :
+		m_Bytes(std::move(bytes))
+	{
+		m_Data = m_Bytes.data();
+		m_Size = m_Bytes.size();
+
+		Parse();
+	}
+
+	Ref<PackedScene> PackedScene::Load(const string& path)
+	{
+		return MakeRef<PackedScene>(FileIO::MappedFile(path));
+	}
+
+	Ref<Node> PackedScene::Instantiate(NodeTree& tree) const
+	{
+		const uint32_t nodeCount = m_Header->NodeCount;
+
+		List<Ref<Node>> nodes(nodeCount);
+
+		for (uint32_t i = 0; i < nodeCount; i++)
+		{
+			const SceneNodeRecord& record = m_Nodes[i];
+
+			Ref<Node> node = m_Types[record.Type]->Create(tree);
+			node->SetName(m_Names[record.Name]);
+			node->m_TickOrder = record.TickOrder;
+			node->m_IsTickIndependent = (record.Flags & SceneFormat::FlagTickIndependent) != 0;
+			node->m_Children.reserve(std::min(record.ChildCount, nodeCount));
+
+			for (uint32_t j = 0; j < record.GroupCount; j++)
+			{
+				node->m_Groups.set(m_GroupIndices[record.FirstGroup + j]);
+			}
+
+			if (record.DefaultProperties != SceneFormat::NoPropertyTable)
+				node->m_DefaultProperties = m_PropertyTables[record.DefaultProperties];
+
+			// Name IDs differ between processes, so the overrides are sorted again as they're set
+			for (uint32_t j = 0; j < record.OverrideCount; j++)
+			{
+				const NodePropertyTable::Entry& entry = m_NamedProperties[record.FirstOverride + j];
+				node->SetProperty(entry.first, entry.second);
+			}
+
+			if (record.Flags & SceneFormat::FlagInactive)
+				node->SetIsActive(false);
+
+			if (record.PropertiesSize > 0)
+			{
+				PropertyReader reader(m_Properties + record.PropertiesOffset, record.PropertiesSize);
+				node->ReadProperties(reader);
+			}
+
+			// The nodes aren't in a tree yet, so linking them up doesn't touch the tree's flattened order
+			if (record.Parent != SceneFormat::NoParent)
+				nodes[record.Parent]->AppendDetachedChild(node);
+
+			nodes[i] = std::move(node);
+		}
+
+		return nodes.front();
+	}
+
+	void PackedScene::Parse()
+	{
+		if (m_Size < sizeof(SceneHeader))
+			throw SceneException("The data is too small to be a scene");
+
+		// Mappings are page aligned and heap allocations are at least 8 byte aligned, so the header can be used in place
+		if ((uintptr_t)m_Data % alignof(SceneHeader) != 0)
+			throw SceneException("The scene data isn't aligned");
+
+		m_Header = reinterpret_cast<const SceneHeader*>(m_Data);
+
+		if (m_Header->Magic != SceneFormat::Magic)
+			throw SceneException("The data isn't a scene");
+
+		if (m_Header->Version != SceneFormat::Version)
+			throw SceneException(FormatString("The scene has version {0}, but only version {1} is supported", m_Header->Version, SceneFormat::Version));
+
+		if (m_Header->NodeCount == 0)
+			throw SceneException("The scene has no nodes");
+
+		CheckSection(m_Header->NodesOffset, (uint64_t)m_Header->NodeCount * sizeof(SceneNodeRecord), alignof(SceneNodeRecord), "node");
+		CheckSection(m_Header->TypesOffset, (uint64_t)m_Header->TypeCount * sizeof(uint32_t), alignof(uint32_t), "type");
+		CheckSection(m_Header->GroupsOffset, (uint64_t)m_Header->GroupCount * sizeof(uint32_t), alignof(uint32_t), "group");
+		CheckSection(m_Header->PropertyTablesOffset, (uint64_t)m_Header->PropertyTableCount * sizeof(ScenePropertyTable), alignof(ScenePropertyTable), "property table");
+		CheckSection(m_Header->NamedPropertiesOffset, (uint64_t)m_Header->NamedPropertyCount * sizeof(SceneProperty), alignof(SceneProperty), "named property");
+		CheckSection(m_Header->StringsOffset, (uint64_t)m_Header->StringCount * sizeof(SceneString), alignof(SceneString), "string");
+		CheckSection(m_Header->StringDataOffset, m_Header->StringDataSize, 1, "string data");
+		CheckSection(m_Header->PropertiesOffset, m_Header->PropertiesSize, 1, "property");
+
+		m_Nodes = reinterpret_cast<const SceneNodeRecord*>(m_Data + m_Header->NodesOffset);
+		m_Properties = m_Data + m_Header->PropertiesOffset;
+
+		// Intern every string once, so instantiating only copies IDs
+		const SceneString* strings = reinterpret_cast<const SceneString*>(m_Data + m_Header->StringsOffset);
+		const char* stringData = reinterpret_cast<const char*>(m_Data + m_Header->StringDataOffset);
+
+		m_Names.reserve(m_Header->StringCount);
+
+		for (uint32_t i = 0; i < m_Header->StringCount; i++)
+		{
+			if ((uint64_t)strings[i].Offset + strings[i].Length > m_Header->StringDataSize)
+				throw SceneException(FormatString("String {0} is outside of the scene's string data", i));
+
+			m_Names.push_back(NameID(std::string_view(stringData + strings[i].Offset, strings[i].Length)));
+		}
+
+		const uint32_t* types = reinterpret_cast<const uint32_t*>(m_Data + m_Header->TypesOffset);
+		m_Types.reserve(m_Header->TypeCount);
+
+		for (uint32_t i = 0; i < m_Header->TypeCount; i++)
+		{
+			if (types[i] >= m_Header->StringCount)
+				throw SceneException(FormatString("The name of type {0} is outside of the scene's string table", i));
+
+			const NodeTypeInfo* type = NodeTypeRegistry::Find(m_Names[types[i]]);
+
+			if (!type)
+				throw SceneException(FormatString("The scene uses node type \"{0}\", which isn't registered", m_Names[types[i]].GetString()));
+
+			m_Types.push_back(type);
+		}
+
+		const uint32_t* groups = reinterpret_cast<const uint32_t*>(m_Data + m_Header->GroupsOffset);
+		m_GroupIndices.reserve(m_Header->GroupCount);
+
+		for (uint32_t i = 0; i < m_Header->GroupCount; i++)
+		{
+			if (groups[i] >= m_Header->StringCount)
+				throw SceneException(FormatString("The name of group {0} is outside of the scene's string table", i));
+
+			m_GroupIndices.push_back(NodeGroup(m_Names[groups[i]]).GetIndex());
+		}
+
+		const SceneProperty* properties = reinterpret_cast<const SceneProperty*>(m_Data + m_Header->NamedPropertiesOffset);
+		m_NamedProperties.reserve(m_Header->NamedPropertyCount);
+
+		for (uint32_t i = 0; i < m_Header->NamedPropertyCount; i++)
+		{
+			const SceneProperty& property = properties[i];
+
+			if (property.Name >= m_Header->StringCount)
+				throw SceneException(FormatString("The name of named property {0} is outside of the scene's string table", i));
+
+			m_NamedProperties.emplace_back(m_Names[property.Name], ReadPropertyValue(property, stringData, i));
+		}
+
+		const ScenePropertyTable* tables = reinterpret_cast<const ScenePropertyTable*>(m_Data + m_Header->PropertyTablesOffset);
+		m_PropertyTables.reserve(m_Header->PropertyTableCount);
+
+		for (uint32_t i = 0; i < m_Header->PropertyTableCount; i++)
+		{
+			if ((uint64_t)tables[i].FirstProperty + tables[i].PropertyCount > m_Header->NamedPropertyCount)
+				throw SceneException(FormatString("The properties of property table {0} are outside of the scene's named properties", i));
+
+			auto first = m_NamedProperties.begin() + tables[i].FirstProperty;
+			m_PropertyTables.push_back(MakeRef<NodePropertyTable>(List<NodePropertyTable::Entry>(first, first + tables[i].PropertyCount)));
+		}
+
+		// Check every reference up front, so instantiating can trust the records
+		for (uint32_t i = 0; i < m_Header->NodeCount; i++)
+		{
+			const SceneNodeRecord& record = m_Nodes[i];
+
+			if ((i == 0) != (record.Parent == SceneFormat::NoParent) || (i > 0 && record.Parent >= i))
+				throw SceneException(FormatString("Node {0} has an invalid parent. Only the first node can be the root, and parents must come before their children", i));
+
+			if (record.Type >= m_Header->TypeCount)
+				throw SceneException(FormatString("Node {0} has an invalid type", i));
+
+			if (record.Name >= m_Header->StringCount)
+				throw SceneException(FormatString("Node {0} has an invalid name", i));
+
+			if ((uint64_t)record.PropertiesOffset + record.PropertiesSize > m_Header->PropertiesSize)
+				throw SceneException(FormatString("The properties of node {0} are outside of the scene's property data", i));
+
+			if ((uint64_t)record.FirstGroup + record.GroupCount > m_Header->GroupCount)
+				throw SceneException(FormatString("The groups of node {0} are outside of the scene's group section", i));
+
+			if (record.DefaultProperties != SceneFormat::NoPropertyTable && record.DefaultProperties >= m_Header->PropertyTableCount)
+				throw SceneException(FormatString("Node {0} has an invalid default property table", i));
+
+			if ((uint64_t)record.FirstOverride + record.OverrideCount > m_Header->NamedPropertyCount)
+				throw SceneException(FormatString("The property overrides of node {0} are outside of the scene's named properties", i));
+		}
+	}
+
+	NodePropertyValue PackedScene::ReadPropertyValue(const SceneProperty& property, const char* stringData, uint32_t index) const
+	{
+		switch (property.Type)
+		{
+		case SceneFormat::PropertyBool:
+			return (property.Value & 0xFF) != 0;
+
+		case SceneFormat::PropertyInt:
+		{
+			int64_t value;
+			memcpy(&value, &property.Value, sizeof(value));
+
+			return value;
+		}
+
+		case SceneFormat::PropertyDouble:
+		{
+			double value;
+			memcpy(&value, &property.Value, sizeof(value));
+
+			return value;
+		}
+
+		case SceneFormat::PropertyString:
+		{
+			const uint64_t offset = property.Value & UINT32_MAX;
+			const uint64_t length = property.Value >> 32;
+
+			if (offset + length > m_Header->StringDataSize)
+				throw SceneException(FormatString("The value of named property {0} is outside of the scene's string data", index));
+
+			return string(stringData + offset, length);
+		}
+
+		default:
+			throw SceneException(FormatString("Named property {0} has an invalid type", index));
+		}
+	}
+
+	void PackedScene::CheckSection(uint64_t offset, uint64_t size, size_t alignment, const char* name) const
+	{
+		if (offset > m_Size || size > m_Size - offset)
+			throw SceneException(FormatString("The scene's {0} section is outside of its data", name));
+
+		if (offset % alignment != 0)
+			throw SceneException(FormatString("The scene's {0} section isn't aligned", name));
+	}
+}
@@ -0,0 +1,138 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Nodes/NodePropertyTable.h"
+#include "Nova/Core/Nodes/NodeTypeRegistry.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/NameID.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Services/FileIO/MappedFile.h"
+#include "SceneFormat.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A loaded binary scene, written by SceneWriter, that can be instantiated into trees any number of times. The scene is validated, its node
+	/// types and groups resolved, its names interned and its named properties decoded once when it's loaded. Node records and property blobs are then read in place from the file's mapping,
+	/// so instantiating doesn't parse anything. Throws a SceneException if the data isn't a valid scene
+	/// </summary>
+	class NovaAPI PackedScene : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a scene from a mapped file. Use Load to map and load a file in one go
+		/// </summary>
+		/// <param name="file">The mapped file, which the scene keeps open</param>
+		PackedScene(FileIO::MappedFile&& file);
+
+		/// <summary>
+		/// Creates a scene from bytes in memory
+		/// </summary>
+		/// <param name="bytes">The contents of a scene file</param>
+		PackedScene(List<uint8_t>&& bytes);
+
+	public:
+		/// <summary>
+		/// Maps and loads a scene file
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <returns>The loaded scene</returns>
+		static Ref<PackedScene> Load(const string& path);
+
+	public:
+		/// <summary>
+		/// Creates the scene's nodes in a tree's node pool. The nodes are linked together before the root is returned, so the whole scene joins the
+		/// tree in one step once the root is added to a node in it. Only the tree's node pool is used, so this can run on any thread while the tree
+		/// is in use
+		/// </summary>
+		/// <param name="tree">The tree whose pool the nodes are created in</param>
+		/// <returns>The root of the new nodes</returns>
+		Ref<Node> Instantiate(NodeTree& tree) const;
+
+		/// <summary>
+		/// Gets the number of nodes in the scene
+		/// </summary>
+		/// <returns>The number of nodes</returns>
+		size_t GetNodeCount() const { return m_Header->NodeCount; }
+
+	private:
+		/// <summary>
+		/// Validates the scene, resolves its types and interns its strings
+		/// </summary>
+		void Parse();
+
+		/// <summary>
+		/// Throws if a section doesn't fit in the data or isn't aligned for its elements
+		/// </summary>
+		void CheckSection(uint64_t offset, uint64_t size, size_t alignment, const char* name) const;
+
+		/// <summary>
+		/// Decodes the value of a named property, throwing if it's invalid
+		/// </summary>
+		NodePropertyValue ReadPropertyValue(const SceneProperty& property, const char* stringData, uint32_t index) const;
+
+	private:
+		/// <summary>
+		/// The mapped file, if the scene was loaded from one
+		/// </summary>
+		FileIO::MappedFile m_File;
+
+		/// <summary>
+		/// The bytes of the scene, if it was loaded from memory
+		/// </summary>
+		List<uint8_t> m_Bytes;
+
+		/// <summary>
+		/// The scene data, from either the file or the bytes
+		/// </summary>
+		const uint8_t* m_Data = nullptr;
+
+		/// <summary>
+		/// The size of the scene data
+		/// </summary>
+		size_t m_Size = 0;
+
+		/// <summary>
+		/// The header at the start of the data
+		/// </summary>
+		const SceneHeader* m_Header = nullptr;
+
+		/// <summary>
+		/// The node records in the data
+		/// </summary>
+		const SceneNodeRecord* m_Nodes = nullptr;
+
+		/// <summary>
+		/// The property blobs in the data
+		/// </summary>
+		const uint8_t* m_Properties = nullptr;
+
+		/// <summary>
+		/// The registered type for each entry of the type table
+		/// </summary>
+		List<const NodeTypeInfo*> m_Types;
+
+		/// <summary>
+		/// The interned name for each entry of the string table
+		/// </summary>
+		List<NameID> m_Names;
+
+		/// <summary>
+		/// The bit index for each entry of the group section
+		/// </summary>
+		List<uint32_t> m_GroupIndices;
+
+		/// <summary>
+		/// The decoded value for each entry of the named property section
+		/// </summary>
+		List<NodePropertyTable::Entry> m_NamedProperties;
+
+		/// <summary>
+		/// The default property tables, shared by every node instantiated from the scene that uses them
+		/// </summary>
+		List<Ref<const NodePropertyTable>> m_PropertyTables;
+	};
+}
@@ -0,0 +1,109 @@
+#include "Prefab.h"
+#include "PropertyStream.h"
+#include "SceneExceptions.h"
+
+#include <algorithm>
+
+namespace Nova
+{
+	Prefab::Prefab(const Node& root)
+	{
+		AddNode(root, UINT32_MAX);
+	}
+
+	Ref<Node> Prefab::Instantiate(NodeTree& tree) const
+	{
+		List<Ref<Node>> nodes;
+
+		return Instantiate(tree, nodes);
+	}
+
+	void Prefab::Instantiate(NodeTree& tree, size_t count, List<Ref<Node>>& roots) const
+	{
+		List<Ref<Node>> nodes;
+		roots.reserve(roots.size() + count);
+
+		for (size_t i = 0; i < count; i++)
+		{
+			roots.push_back(Instantiate(tree, nodes));
+		}
+	}
+
+	void Prefab::AddNode(const Node& node, uint32_t parent)
+	{
+		const NodeTypeInfo* type = NodeTypeRegistry::Find(typeid(node));
+
+		if (!type)
+			throw SceneException(FormatString("Node \"{0}\" has type {1}, which isn't registered with the NodeTypeRegistry", node.GetName(), typeid(node).name()));
+
+		const uint32_t index = (uint32_t)m_Nodes.size();
+		const size_t propertiesOffset = m_PropertyData.size();
+
+		PropertyWriter writer(m_PropertyData);
+		node.WriteProperties(writer);
+
+		PrefabNode prefabNode = {};
+		prefabNode.Type = type;
+		prefabNode.Name = node.GetNameID();
+		prefabNode.Parent = parent;
+		prefabNode.ChildCount = (uint32_t)node.GetChildren().size();
+		prefabNode.TickOrder = node.GetTickOrder();
+		prefabNode.IsActive = node.GetIsActive();
+		prefabNode.IsTickIndependent = node.GetIsTickIndependent();
+		prefabNode.Groups = node.GetGroups();
+		prefabNode.Properties = node.FreezeProperties();
+		prefabNode.PropertiesOffset = (uint32_t)propertiesOffset;
+		prefabNode.PropertiesSize = (uint32_t)(m_PropertyData.size() - propertiesOffset);
+
+		m_Nodes.push_back(std::move(prefabNode));
+
+		for (const Ref<Node>& child : node.GetChildren())
+		{
+			AddNode(*child, index);
+		}
+	}
+
+	Ref<Node> Prefab::Instantiate(NodeTree& tree, List<Ref<Node>>& nodes) const
+	{
+		nodes.clear();
+		nodes.reserve(m_Nodes.size());
+
+		// Create every node before filling any in, so each type's nodes sit next to each other in the pool
+		for (const PrefabNode& prefabNode : m_Nodes)
+		{
+			nodes.push_back(prefabNode.Type->Create(tree));
+		}
+
+		for (size_t i = 0; i < m_Nodes.size(); i++)
+		{
+			const PrefabNode& prefabNode = m_Nodes[i];
+			Node& node = *nodes[i];
+
+			// Nothing else can see the node yet, so the fields can be set directly
+			node.m_Name = prefabNode.Name;
+			node.m_TickOrder = prefabNode.TickOrder;
+			node.m_IsTickIndependent = prefabNode.IsTickIndependent;
+			node.m_Groups = prefabNode.Groups;
+			node.m_DefaultProperties = prefabNode.Properties;
+			node.m_Children.reserve(prefabNode.ChildCount);
+
+			if (!prefabNode.IsActive)
+				node.SetIsActive(false);
+
+			if (prefabNode.PropertiesSize > 0)
+			{
+				PropertyReader reader(m_PropertyData.data() + prefabNode.PropertiesOffset, prefabNode.PropertiesSize);
+				node.ReadProperties(reader);
+			}
+
+			// Children are in tick order already, so linking them up only appends
+			if (prefabNode.Parent != UINT32_MAX)
+				nodes[prefabNode.Parent]->AppendDetachedChild(nodes[i]);
+		}
+
+		Ref<Node> root = std::move(nodes.front());
+		nodes.clear();
+
+		return root;
+	}
+}
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Nodes/NodeTypeRegistry.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/NameID.h"
+#include "Nova/Core/Types/RefCounted.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A template of a subtree that can be instanced many times, such as an enemy. Each prefab node's named properties are frozen into an immutable table
+	/// that every instance of the node shares, so instances only allocate the properties they override. Every node must be of a type registered with
+	/// the NodeTypeRegistry, otherwise a SceneException is thrown
+	/// </summary>
+	class NovaAPI Prefab : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a prefab from a node and its descendants. Later changes to the nodes don't affect the prefab
+		/// </summary>
+		/// <param name="root">The root of the template</param>
+		Prefab(const Node& root);
+
+	public:
+		/// <summary>
+		/// Creates an instance of the prefab in a tree's node pool. The nodes are linked together before the root is returned, so the whole instance
+		/// joins the tree in one step once the root is added to a node in it. Only the tree's node pool is used, so this can run on any thread
+		/// </summary>
+		/// <param name="tree">The tree whose pool the nodes are created in</param>
+		/// <returns>The root of the instance</returns>
+		Ref<Node> Instantiate(NodeTree& tree) const;
+
+		/// <summary>
+		/// Creates many instances of the prefab in one go. The nodes of each instance are allocated back to back
+		/// </summary>
+		/// <param name="tree">The tree whose pool the nodes are created in</param>
+		/// <param name="count">The number of instances</param>
+		/// <param name="roots">The list to append the root of each instance to</param>
+		void Instantiate(NodeTree& tree, size_t count, List<Ref<Node>>& roots) const;
+
+		/// <summary>
+		/// Gets the number of nodes in each instance
+		/// </summary>
+		/// <returns>The number of nodes</returns>
+		size_t GetNodeCount() const { return m_Nodes.size(); }
+
+	private:
+		/// <summary>
+		/// Everything needed to create one node of an instance, in depth-first order
+		/// </summary>
+		struct PrefabNode
+		{
+			const NodeTypeInfo* Type;
+			NameID Name;
+			uint32_t Parent;
+			uint32_t ChildCount;
+			int TickOrder;
+			bool IsActive;
+			bool IsTickIndependent;
+			NodeGroupMask Groups;
+			Ref<const NodePropertyTable> Properties;
+			uint32_t PropertiesOffset;
+			uint32_t PropertiesSize;
+		};
+
+	private:
+		/// <summary>
+		/// Adds a node and its descendants to the template
+		/// </summary>
+		void AddNode(const Node& node, uint32_t parent);
+
+		/// <summary>
+		/// Creates one instance, using a scratch list for the nodes created so far
+		/// </summary>
+		Ref<Node> Instantiate(NodeTree& tree, List<Ref<Node>>& nodes) const;
+
+	private:
+		/// <summary>
+		/// The nodes of the template
+		/// </summary>
+		List<PrefabNode> m_Nodes;
+
+		/// <summary>
+		/// The property blobs written by each node's WriteProperties
+		/// </summary>
+		List<uint8_t> m_PropertyData;
+	};
+}
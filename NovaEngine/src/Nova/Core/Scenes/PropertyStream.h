@@ -0,0 +1,151 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "SceneExceptions.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+#include <string_view>
+#include <type_traits>
+
+namespace Nova
+{
+	/// <summary>
+	/// Appends a node's properties to its blob in a scene. Values are stored as raw bytes, so they must be read back in the same order and types
+	/// </summary>
+	class PropertyWriter
+	{
+	public:
+		/// <summary>
+		/// Creates a writer that appends to a buffer
+		/// </summary>
+		/// <param name="buffer">The buffer to append to</param>
+		PropertyWriter(List<uint8_t>& buffer) :
+			m_Buffer(buffer)
+		{}
+
+	public:
+		/// <summary>
+		/// Writes a value
+		/// </summary>
+		/// <param name="value">The value</param>
+		template<typename T>
+		void Write(const T& value)
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written directly");
+
+			WriteBytes(&value, sizeof(T));
+		}
+
+		/// <summary>
+		/// Writes a string, prefixed by its length
+		/// </summary>
+		/// <param name="value">The string</param>
+		void WriteString(std::string_view value)
+		{
+			Write((uint32_t)value.size());
+			WriteBytes(value.data(), value.size());
+		}
+
+		/// <summary>
+		/// Writes raw bytes
+		/// </summary>
+		/// <param name="data">The bytes</param>
+		/// <param name="size">The number of bytes</param>
+		void WriteBytes(const void* data, size_t size)
+		{
+			const uint8_t* bytes = static_cast<const uint8_t*>(data);
+			m_Buffer.insert(m_Buffer.end(), bytes, bytes + size);
+		}
+
+	private:
+		/// <summary>
+		/// The buffer to append to
+		/// </summary>
+		List<uint8_t>& m_Buffer;
+	};
+
+	/// <summary>
+	/// Reads a node's properties in place from its blob in a scene. Reading past the end of the blob throws a SceneException
+	/// </summary>
+	class PropertyReader
+	{
+	public:
+		/// <summary>
+		/// Creates a reader over a blob
+		/// </summary>
+		/// <param name="data">The blob, which must outlive the reader</param>
+		/// <param name="size">The size of the blob</param>
+		PropertyReader(const uint8_t* data, size_t size) :
+			m_Data(data), m_Size(size)
+		{}
+
+	public:
+		/// <summary>
+		/// Reads a value
+		/// </summary>
+		/// <returns>The value</returns>
+		template<typename T>
+		T Read()
+		{
+			static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read directly");
+
+			// Blobs aren't aligned, so copy rather than cast
+			T value;
+			memcpy(&value, ReadBytes(sizeof(T)), sizeof(T));
+
+			return value;
+		}
+
+		/// <summary>
+		/// Reads a string written by PropertyWriter::WriteString
+		/// </summary>
+		/// <returns>A view of the string in the blob</returns>
+		std::string_view ReadString()
+		{
+			const uint32_t length = Read<uint32_t>();
+
+			return std::string_view(reinterpret_cast<const char*>(ReadBytes(length)), length);
+		}
+
+		/// <summary>
+		/// Reads raw bytes
+		/// </summary>
+		/// <param name="size">The number of bytes</param>
+		/// <returns>A pointer to the bytes in the blob</returns>
+		const uint8_t* ReadBytes(size_t size)
+		{
+			if (size > m_Size - m_Position)
+				throw SceneException("Read past the end of a node's properties");
+
+			const uint8_t* bytes = m_Data + m_Position;
+			m_Position += size;
+
+			return bytes;
+		}
+
+		/// <summary>
+		/// Gets the number of bytes left to read
+		/// </summary>
+		/// <returns>The number of bytes left</returns>
+		size_t GetRemaining() const { return m_Size - m_Position; }
+
+	private:
+		/// <summary>
+		/// The blob
+		/// </summary>
+		const uint8_t* m_Data;
+
+		/// <summary>
+		/// The size of the blob
+		/// </summary>
+		size_t m_Size;
+
+		/// <summary>
+		/// The number of bytes read so far
+		/// </summary>
+		size_t m_Position = 0;
+	};
+}
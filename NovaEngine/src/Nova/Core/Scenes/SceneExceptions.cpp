@@ -0,0 +1,8 @@
+#include "SceneExceptions.h"
+
+namespace Nova
+{
+	SceneException::SceneException(const string& error) :
+		Exception(error)
+	{}
+}
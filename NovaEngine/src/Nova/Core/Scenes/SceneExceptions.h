@@ -0,0 +1,16 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Exception.h"
+
+namespace Nova
+{
+	/// <summary>
+	/// An exception for when a scene can't be read or written, such as a corrupted file or an unregistered node type
+	/// </summary>
+	class NovaAPI SceneException : public Exception
+	{
+	public:
+		SceneException(const string& error);
+	};
+}
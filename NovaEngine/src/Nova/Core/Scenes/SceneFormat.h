@@ -0,0 +1,225 @@
+#pragma once
+
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// The layout of a binary scene. Everything is little-endian and addressed by offsets from the start of the file, so a mapped file can be used in
+	/// place. The file is laid out as:
+	///   SceneHeader
+	///   SceneNodeRecord[NodeCount], in depth-first order so parents come before their children
+	///   uint32_t[TypeCount], the string index of each node type's name
+	///   uint32_t[GroupCount], the string index of each group name, listed node by node
+	///   ScenePropertyTable[PropertyTableCount], the default property tables, each written once however many nodes share it
+	///   SceneProperty[NamedPropertyCount], the named properties of the tables and of each node's overrides
+	///   SceneString[StringCount], the strings used for node names, type names, group names and property names
+	///   The bytes of the strings and of string property values
+	///   The property blobs of the nodes
+	/// Sections are 8 byte aligned
+	/// </summary>
+	namespace SceneFormat
+	{
+		/// <summary>
+		/// The magic number at the start of every scene file, "NSCN"
+		/// </summary>
+		constexpr uint32_t Magic = 0x4E43534E;
+
+		/// <summary>
+		/// The version written by this build. Bumped whenever the layout changes
+		/// </summary>
+		constexpr uint32_t Version = 2;
+
+		/// <summary>
+		/// The parent index of the root node
+		/// </summary>
+		constexpr uint32_t NoParent = UINT32_MAX;
+
+		/// <summary>
+		/// The alignment of each section
+		/// </summary>
+		constexpr uint64_t SectionAlignment = 8;
+
+		/// <summary>
+		/// Set in a node record's flags if the node is inactive
+		/// </summary>
+		constexpr uint32_t FlagInactive = 1 << 0;
+
+		/// <summary>
+		/// Set in a node record's flags if the node's subtree is ticked independently
+		/// </summary>
+		constexpr uint32_t FlagTickIndependent = 1 << 1;
+
+		/// <summary>
+		/// The default property table of a node that has none
+		/// </summary>
+		constexpr uint32_t NoPropertyTable = UINT32_MAX;
+
+		/// <summary>
+		/// The types of named property values, matching their index in NodePropertyValue
+		/// </summary>
+		constexpr uint32_t PropertyBool = 0;
+		constexpr uint32_t PropertyInt = 1;
+		constexpr uint32_t PropertyDouble = 2;
+		constexpr uint32_t PropertyString = 3;
+	}
+
+	/// <summary>
+	/// The start of a scene file
+	/// </summary>
+	struct SceneHeader
+	{
+		uint32_t Magic;
+		uint32_t Version;
+		uint32_t NodeCount;
+		uint32_t TypeCount;
+		uint32_t StringCount;
+		uint32_t GroupCount;
+		uint32_t PropertyTableCount;
+		uint32_t NamedPropertyCount;
+
+		uint64_t NodesOffset;
+		uint64_t TypesOffset;
+		uint64_t GroupsOffset;
+		uint64_t PropertyTablesOffset;
+		uint64_t NamedPropertiesOffset;
+		uint64_t StringsOffset;
+		uint64_t StringDataOffset;
+		uint64_t StringDataSize;
+		uint64_t PropertiesOffset;
+		uint64_t PropertiesSize;
+	};
+
+	/// <summary>
+	/// A node in a scene file
+	/// </summary>
+	struct SceneNodeRecord
+	{
+		/// <summary>
+		/// The index of the node's type in the type table
+		/// </summary>
+		uint32_t Type;
+
+		/// <summary>
+		/// The string index of the node's name
+		/// </summary>
+		uint32_t Name;
+
+		/// <summary>
+		/// The index of the parent's record, or NoParent for the root. Always less than the node's own index
+		/// </summary>
+		uint32_t Parent;
+
+		/// <summary>
+		/// The number of children the node has, so their list can be allocated once
+		/// </summary>
+		uint32_t ChildCount;
+
+		/// <summary>
+		/// A combination of the SceneFormat flags
+		/// </summary>
+		uint32_t Flags;
+
+		/// <summary>
+		/// The node's tick order
+		/// </summary>
+		int32_t TickOrder;
+
+		/// <summary>
+		/// The offset of the node's property blob in the properties section
+		/// </summary>
+		uint32_t PropertiesOffset;
+
+		/// <summary>
+		/// The size of the node's property blob
+		/// </summary>
+		uint32_t PropertiesSize;
+
+		/// <summary>
+		/// The index of the node's first group in the group section
+		/// </summary>
+		uint32_t FirstGroup;
+
+		/// <summary>
+		/// The number of groups the node is in
+		/// </summary>
+		uint32_t GroupCount;
+
+		/// <summary>
+		/// The index of the node's default property table, or NoPropertyTable if it has none
+		/// </summary>
+		uint32_t DefaultProperties;
+
+		/// <summary>
+		/// The index of the node's first property override in the named property section
+		/// </summary>
+		uint32_t FirstOverride;
+
+		/// <summary>
+		/// The number of properties the node overrides
+		/// </summary>
+		uint32_t OverrideCount;
+
+		uint32_t Reserved;
+	};
+
+	/// <summary>
+	/// A table of named properties that nodes default to, such as the one shared by every instance of a prefab
+	/// </summary>
+	struct ScenePropertyTable
+	{
+		/// <summary>
+		/// The index of the table's first property in the named property section
+		/// </summary>
+		uint32_t FirstProperty;
+
+		/// <summary>
+		/// The number of properties in the table
+		/// </summary>
+		uint32_t PropertyCount;
+	};
+
+	/// <summary>
+	/// A named property value
+	/// </summary>
+	struct SceneProperty
+	{
+		/// <summary>
+		/// The string index of the property's name
+		/// </summary>
+		uint32_t Name;
+
+		/// <summary>
+		/// The type of the value, one of the SceneFormat property types
+		/// </summary>
+		uint32_t Type;
+
+		/// <summary>
+		/// The bytes of a bool, int64_t or double. For strings, the offset of the value in the string data section is in the low 32 bits and
+		/// its length in the high 32 bits, so string values aren't interned as names
+		/// </summary>
+		uint64_t Value;
+	};
+
+	/// <summary>
+	/// A string in a scene file's string table
+	/// </summary>
+	struct SceneString
+	{
+		/// <summary>
+		/// The offset of the string in the string data section
+		/// </summary>
+		uint32_t Offset;
+
+		/// <summary>
+		/// The length of the string in bytes
+		/// </summary>
+		uint32_t Length;
+	};
+
+	static_assert(sizeof(SceneHeader) == 112, "The scene header must have no padding");
+	static_assert(sizeof(SceneNodeRecord) == 56, "Scene node records must have no padding");
+	static_assert(sizeof(ScenePropertyTable) == 8, "Scene property tables must have no padding");
+	static_assert(sizeof(SceneProperty) == 16, "Scene properties must have no padding");
+	static_assert(sizeof(SceneString) == 8, "Scene strings must have no padding");
+}
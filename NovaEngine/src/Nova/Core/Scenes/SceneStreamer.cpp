@@ -0,0 +1,331 @@
+#include "SceneStreamer.h"
+
+#include "Nova/Core/Engine/Engine.h"
+#include "Nova/Core/Types/Clock.h"
+#include "Nova/Services/Jobs/JobCounter.h"
+#include "Nova/Services/Jobs/JobScheduler.h"
+
+#include <algorithm>
+#include <cmath>
+#include <exception>
+
+namespace Nova
+{
+	SceneChunk::SceneChunk(const string& path, const Vector3& center, const WeakRef<Node>& parent) :
+		m_Path(path), m_Center(center), m_Parent(parent), m_HasParent(!parent.expired())
+	{}
+
+
+	SceneStreamer::SceneStreamer(const Ref<NodeTree>& tree, Jobs::JobScheduler& scheduler, TimeSpan frameBudget, size_t maxConcurrentLoads) :
+		m_Tree(tree), m_Scheduler(scheduler), m_Jobs(MakeRef<Jobs::JobCounter>()), m_FrameBudget(frameBudget), m_MaxConcurrentLoads(std::max<size_t>(maxConcurrentLoads, 1))
+	{}
+
+	SceneStreamer::~SceneStreamer()
+	{
+		if (Engine* engine = Engine::Get())
+			engine->RemoveTickListener(m_TickListener);
+
+		// Workers are still using the tree and writing results
+		m_Scheduler.Wait(m_Jobs);
+	}
+
+	// RefCounted ----------
+	void SceneStreamer::Init()
+	{
+		m_TickListener = MakeRef<TickListener>(TickOrder, GetSelfRef<SceneStreamer>(), &SceneStreamer::Tick);
+
+		if (Engine* engine = Engine::Get())
+			engine->AddTickListener(m_TickListener);
+	}
+
+	// RefCounted ----------
+
+	Ref<SceneChunk> SceneStreamer::AddChunk(const string& path, const Vector3& center, const Ref<Node>& parent)
+	{
+		Ref<SceneChunk> chunk = MakeRef<SceneChunk>(path, center, parent);
+		m_Chunks.push_back(chunk);
+
+		return chunk;
+	}
+
+	void SceneStreamer::RemoveChunk(const Ref<SceneChunk>& chunk)
+	{
+		RequestUnload(chunk);
+
+		// Detach right away, as nothing will update the chunk once it's gone
+		if (chunk->m_State == SceneChunkState::Unloading)
+		{
+			Remove(m_Unloading, chunk);
+
+			m_Tree->FreeSubtree(std::move(chunk->m_Root));
+			chunk->m_State = SceneChunkState::Unloaded;
+		}
+
+		Remove(m_Chunks, chunk);
+	}
+
+	void SceneStreamer::RequestLoad(const Ref<SceneChunk>& chunk)
+	{
+		chunk->m_WantsLoaded = true;
+
+		switch (chunk->m_State)
+		{
+		case SceneChunkState::Unloaded:
+		case SceneChunkState::Failed:
+			chunk->m_Error.clear();
+			chunk->m_State = SceneChunkState::Queued;
+			m_Queued.push_back(chunk);
+			break;
+
+		case SceneChunkState::Unloading:
+			// Still attached, so just keep it
+			Remove(m_Unloading, chunk);
+			chunk->m_State = SceneChunkState::Loaded;
+			break;
+
+		default:
+			break;
+		}
+	}
+
+	void SceneStreamer::RequestUnload(const Ref<SceneChunk>& chunk)
+	{
+		chunk->m_WantsLoaded = false;
+
+		switch (chunk->m_State)
+		{
+		case SceneChunkState::Queued:
+			Remove(m_Queued, chunk);
+			chunk->m_State = SceneChunkState::Unloaded;
+			break;
+
+		case SceneChunkState::Ready:
+			Remove(m_Ready, chunk);
+			DestroyInBackground(std::move(chunk->m_Root));
+			chunk->m_State = SceneChunkState::Unloaded;
+			break;
+
+		case SceneChunkState::Loaded:
+			chunk->m_State = SceneChunkState::Unloading;
+			m_Unloading.push_back(chunk);
+			break;
+
+		default:
+			// Loading chunks are discarded once their load finishes
+			break;
+		}
+	}
+
+	void SceneStreamer::StreamAround(const Vector3& focus, double loadRadius, double unloadRadius)
+	{
+		SetFocus(focus);
+		UpdateDistances();
+
+		for (const Ref<SceneChunk>& chunk : m_Chunks)
+		{
+			// Failed chunks stay failed until they're requested explicitly, so a missing file isn't retried every frame
+			if (chunk->m_Distance <= loadRadius && chunk->m_State != SceneChunkState::Failed)
+				RequestLoad(chunk);
+			else if (chunk->m_Distance > unloadRadius)
+				RequestUnload(chunk);
+		}
+	}
+
+	void SceneStreamer::Update()
+	{
+		const int64_t start = Clock::GetNanoseconds();
+		const int64_t budget = m_FrameBudget.GetNanoseconds();
+
+		CollectLoadResults();
+		UpdateDistances();
+		StartLoads();
+
+		bool hasAttached = false;
+		bool hasDetached = false;
+
+		// Attach the nearest chunks first, as they're the most likely to be seen
+		while (!m_Ready.empty() && (!hasAttached || budget <= 0 || Clock::GetNanoseconds() - start < budget))
+		{
+			Ref<SceneChunk> chunk = PopByDistance(m_Ready, true);
+			Ref<Node> parent = chunk->m_HasParent ? chunk->m_Parent.lock() : m_Tree->GetRootNode();
+
+			if (!parent)
+			{
+				DestroyInBackground(std::move(chunk->m_Root));
+				chunk->m_State = SceneChunkState::Failed;
+				chunk->m_Error = "The chunk's parent was destroyed";
+
+				continue;
+			}
+
+			// The chunk's nodes are already linked, so this is a single insert into the tree
+			parent->AddChild(chunk->m_Root);
+			chunk->m_State = SceneChunkState::Loaded;
+			hasAttached = true;
+		}
+
+		// Detach the farthest chunks first, as they're the least likely to be needed again soon
+		while (!m_Unloading.empty() && (!hasDetached || budget <= 0 || Clock::GetNanoseconds() - start < budget))
+		{
+			Ref<SceneChunk> chunk = PopByDistance(m_Unloading, false);
+
+			m_Tree->FreeSubtree(std::move(chunk->m_Root));
+			chunk->m_State = SceneChunkState::Unloaded;
+			hasDetached = true;
+		}
+	}
+
+	void SceneStreamer::Flush()
+	{
+		while (!m_Queued.empty() || m_LoadingCount > 0 || !m_Ready.empty() || !m_Unloading.empty())
+		{
+			Update();
+
+			// Help run the loads instead of spinning
+			if (m_LoadingCount > 0)
+				m_Scheduler.Wait(m_Jobs);
+		}
+	}
+
+	SceneStreamingProgress SceneStreamer::GetProgress() const
+	{
+		SceneStreamingProgress progress;
+
+		for (const Ref<SceneChunk>& chunk : m_Chunks)
+		{
+			switch (chunk->m_State)
+			{
+			case SceneChunkState::Queued: progress.Queued++; break;
+			case SceneChunkState::Loading: progress.Loading++; break;
+			case SceneChunkState::Ready: progress.Ready++; break;
+			case SceneChunkState::Loaded: progress.Loaded++; break;
+			case SceneChunkState::Unloading: progress.Unloading++; break;
+			case SceneChunkState::Failed: progress.Failed++; break;
+			default: break;
+			}
+		}
+
+		return progress;
+	}
+
+	void SceneStreamer::Tick(double deltaTime)
+	{
+		Update();
+	}
+
+	void SceneStreamer::CollectLoadResults()
+	{
+		List<LoadResult> results;
+
+		{
+			std::lock_guard lock(m_ResultsMutex);
+			results.swap(m_Results);
+		}
+
+		for (LoadResult& result : results)
+		{
+			SceneChunk& chunk = *result.Chunk;
+			m_LoadingCount--;
+
+			chunk.m_Scene = std::move(result.Scene);
+
+			if (!result.Error.empty())
+			{
+				chunk.m_State = chunk.m_WantsLoaded ? SceneChunkState::Failed : SceneChunkState::Unloaded;
+				chunk.m_Error = std::move(result.Error);
+			}
+			else if (!chunk.m_WantsLoaded)
+			{
+				// Unloaded while it was loading
+				DestroyInBackground(std::move(result.Root));
+				chunk.m_State = SceneChunkState::Unloaded;
+			}
+			else
+			{
+				chunk.m_Root = std::move(result.Root);
+				chunk.m_State = SceneChunkState::Ready;
+				m_Ready.push_back(result.Chunk);
+			}
+		}
+	}
+
+	void SceneStreamer::StartLoads()
+	{
+		while (!m_Queued.empty() && m_LoadingCount < m_MaxConcurrentLoads)
+		{
+			Ref<SceneChunk> chunk = PopByDistance(m_Queued, true);
+			chunk->m_State = SceneChunkState::Loading;
+			m_LoadingCount++;
+
+			m_Scheduler.Run([this, chunk, scene = chunk->m_Scene]()
+				{
+					Load(chunk, scene);
+				}, m_Jobs);
+		}
+	}
+
+	void SceneStreamer::Load(const Ref<SceneChunk>& chunk, Ref<PackedScene> scene)
+	{
+		LoadResult result;
+		result.Chunk = chunk;
+
+		try
+		{
+			if (!scene)
+				scene = PackedScene::Load(chunk->m_Path);
+
+			result.Root = scene->Instantiate(*m_Tree);
+			result.Scene = std::move(scene);
+		}
+		catch (const std::exception& ex)
+		{
+			result.Error = ex.what();
+		}
+
+		std::lock_guard lock(m_ResultsMutex);
+		m_Results.push_back(std::move(result));
+	}
+
+	void SceneStreamer::DestroyInBackground(Ref<Node> root)
+	{
+		if (!root)
+			return;
+
+		m_Scheduler.Run([root = std::move(root)]() mutable
+			{
+				root.reset();
+			}, m_Jobs);
+	}
+
+	void SceneStreamer::UpdateDistances()
+	{
+		for (const Ref<SceneChunk>& chunk : m_Chunks)
+		{
+			const double dx = (double)chunk->m_Center.X - m_Focus.X;
+			const double dy = (double)chunk->m_Center.Y - m_Focus.Y;
+			const double dz = (double)chunk->m_Center.Z - m_Focus.Z;
+
+			chunk->m_Distance = std::sqrt(dx * dx + dy * dy + dz * dz);
+		}
+	}
+
+	Ref<SceneChunk> SceneStreamer::PopByDistance(List<Ref<SceneChunk>>& chunks, bool nearest)
+	{
+		auto it = nearest ?
+			std::min_element(chunks.begin(), chunks.end(), [](const Ref<SceneChunk>& lhs, const Ref<SceneChunk>& rhs) { return lhs->m_Distance < rhs->m_Distance; }) :
+			std::max_element(chunks.begin(), chunks.end(), [](const Ref<SceneChunk>& lhs, const Ref<SceneChunk>& rhs) { return lhs->m_Distance < rhs->m_Distance; });
+
+		Ref<SceneChunk> chunk = std::move(*it);
+		chunks.erase(it);
+
+		return chunk;
+	}
+
+	void SceneStreamer::Remove(List<Ref<SceneChunk>>& chunks, const Ref<SceneChunk>& chunk)
+	{
+		auto it = std::find(chunks.begin(), chunks.end(), chunk);
+
+		if (it != chunks.end())
+			chunks.erase(it);
+	}
+}
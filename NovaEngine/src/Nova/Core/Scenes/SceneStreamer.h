@@ -0,0 +1,400 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Events/TickListener.h"
+#include "Nova/Core/Nodes/NodeTree.h"
+#include "Nova/Core/Types/DateTime.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/Vector.h"
+#include "PackedScene.h"
+
+#include <mutex>
+#include <stddef.h>
+
+namespace Nova::Jobs
+{
+	class JobCounter;
+	class JobScheduler;
+}
+
+namespace Nova
+{
+	class SceneStreamer;
+
+	/// <summary>
+	/// The loading state of a streamed chunk
+	/// </summary>
+	enum class SceneChunkState
+	{
+		// Not loaded, and not requested to be
+		Unloaded,
+
+		// Waiting for a free loading slot
+		Queued,
+
+		// Being read and instantiated on a worker
+		Loading,
+
+		// Instantiated and waiting to be attached to the tree
+		Ready,
+
+		// Attached to the tree
+		Loaded,
+
+		// Waiting to be detached from the tree
+		Unloading,
+
+		// The chunk's scene couldn't be loaded. See SceneChunk::GetError
+		Failed,
+	};
+
+	/// <summary>
+	/// A part of a world that is streamed in and out of a tree as a unit, loaded from a scene file
+	/// </summary>
+	class NovaAPI SceneChunk : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a chunk. Use SceneStreamer::AddChunk instead
+		/// </summary>
+		SceneChunk(const string& path, const Vector3& center, const WeakRef<Node>& parent);
+
+	public:
+		/// <summary>
+		/// Gets the path of the chunk's scene file
+		/// </summary>
+		/// <returns>The path</returns>
+		const string& GetPath() const { return m_Path; }
+
+		/// <summary>
+		/// Gets the point the chunk's distance to the focus is measured from
+		/// </summary>
+		/// <returns>The center of the chunk</returns>
+		const Vector3& GetCenter() const { return m_Center; }
+
+		/// <summary>
+		/// Gets the loading state of the chunk
+		/// </summary>
+		/// <returns>The state</returns>
+		SceneChunkState GetState() const { return m_State; }
+
+		/// <summary>
+		/// Gets the root of the chunk's nodes
+		/// </summary>
+		/// <returns>The root, or nullptr if the chunk isn't Ready or Loaded</returns>
+		const Ref<Node>& GetRoot() const { return m_Root; }
+
+		/// <summary>
+		/// Gets why the chunk failed to load
+		/// </summary>
+		/// <returns>The error, or an empty string if the chunk hasn't failed</returns>
+		const string& GetError() const { return m_Error; }
+
+	private:
+		/// <summary>
+		/// The path of the chunk's scene file
+		/// </summary>
+		string m_Path;
+
+		/// <summary>
+		/// The point distances are measured from
+		/// </summary>
+		Vector3 m_Center;
+
+		/// <summary>
+		/// The node to attach the chunk to. The tree's root is used if none was given
+		/// </summary>
+		WeakRef<Node> m_Parent;
+
+		/// <summary>
+		/// True if the chunk was given a parent, so a parent that has since been destroyed can be told apart from none
+		/// </summary>
+		bool m_HasParent;
+
+		/// <summary>
+		/// The loading state. Only changed on the main thread
+		/// </summary>
+		SceneChunkState m_State = SceneChunkState::Unloaded;
+
+		/// <summary>
+		/// True if the chunk should end up loaded. Used to cancel loads that are already running on a worker
+		/// </summary>
+		bool m_WantsLoaded = false;
+
+		/// <summary>
+		/// The loaded scene, kept so the chunk can be loaded again without reading and validating the file again
+		/// </summary>
+		Ref<PackedScene> m_Scene;
+
+		/// <summary>
+		/// The root of the chunk's nodes while it's Ready or Loaded
+		/// </summary>
+		Ref<Node> m_Root;
+
+		/// <summary>
+		/// Why the chunk failed to load
+		/// </summary>
+		string m_Error;
+
+		/// <summary>
+		/// The distance to the focus when the streamer last sorted its work
+		/// </summary>
+		double m_Distance = 0.0;
+
+		friend SceneStreamer;
+	};
+
+	/// <summary>
+	/// A summary of a streamer's chunks
+	/// </summary>
+	struct SceneStreamingProgress
+	{
+		size_t Queued = 0;
+		size_t Loading = 0;
+		size_t Ready = 0;
+		size_t Loaded = 0;
+		size_t Unloading = 0;
+		size_t Failed = 0;
+
+		/// <summary>
+		/// Gets how much of the requested loading has finished
+		/// </summary>
+		/// <returns>The fraction of chunks that should be loaded that are, or 1 if none should be</returns>
+		double GetLoadedFraction() const
+		{
+			const size_t requested = Queued + Loading + Ready + Loaded;
+			return requested > 0 ? (double)Loaded / requested : 1.0;
+		}
+	};
+
+	/// <summary>
+	/// Streams chunks of a world in and out of a live tree without stalling the main loop. Chunks are read and instantiated into detached nodes on
+	/// job workers, then attached to the tree between frames under a time budget, nearest to the focus point first. Unloading detaches chunks under
+	/// the same budget, farthest first, and frees them with NodeTree::FreeSubtree, so they leave the tree over the following ticks. Chunks and the streamer must only be used from the main thread
+	/// </summary>
+	class NovaAPI SceneStreamer : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a streamer for a tree. If the engine is running, the streamer updates itself every tick
+		/// </summary>
+		/// <param name="tree">The tree to stream chunks into</param>
+		/// <param name="scheduler">The scheduler to load chunks on</param>
+		/// <param name="frameBudget">The time to spend attaching and detaching chunks each update. At least one chunk is attached and one detached. A budget of 0 attaches and detaches everything</param>
+		/// <param name="maxConcurrentLoads">The number of chunks that can be loading on workers at once</param>
+		SceneStreamer(const Ref<NodeTree>& tree, Jobs::JobScheduler& scheduler, TimeSpan frameBudget = TimeSpan::FromSeconds(0.002), size_t maxConcurrentLoads = 4);
+
+		~SceneStreamer();
+
+	public:
+		/// <summary>
+		/// The tick order of the streamer's update, so chunks are attached before the tree ticks
+		/// </summary>
+		static constexpr int TickOrder = -100;
+
+	public:
+		/// <summary>
+		/// Adds a chunk that can be streamed in. It starts out unloaded
+		/// </summary>
+		/// <param name="path">The path of the chunk's scene file</param>
+		/// <param name="center">The point the chunk's distance to the focus is measured from</param>
+		/// <param name="parent">The node to attach the chunk to, or nullptr for the tree's root</param>
+		/// <returns>The chunk</returns>
+		Ref<SceneChunk> AddChunk(const string& path, const Vector3& center, const Ref<Node>& parent = nullptr);
+
+		/// <summary>
+		/// Unloads a chunk and stops tracking it
+		/// </summary>
+		/// <param name="chunk">The chunk</param>
+		void RemoveChunk(const Ref<SceneChunk>& chunk);
+
+		/// <summary>
+		/// Requests that a chunk is loaded. Cancels a pending unload
+		/// </summary>
+		/// <param name="chunk">The chunk</param>
+		void RequestLoad(const Ref<SceneChunk>& chunk);
+
+		/// <summary>
+		/// Requests that a chunk is unloaded. Cancels a pending or running load
+		/// </summary>
+		/// <param name="chunk">The chunk</param>
+		void RequestUnload(const Ref<SceneChunk>& chunk);
+
+		/// <summary>
+		/// Sets the point that chunks are prioritized by
+		/// </summary>
+		/// <param name="focus">The focus point, such as the camera's position</param>
+		void SetFocus(const Vector3& focus) { m_Focus = focus; }
+
+		/// <summary>
+		/// Gets the point that chunks are prioritized by
+		/// </summary>
+		/// <returns>The focus point</returns>
+		const Vector3& GetFocus() const { return m_Focus; }
+
+		/// <summary>
+		/// Moves the focus, and requests loads of chunks near it and unloads of chunks far from it.
+		/// Chunks between the radii are left alone, so chunks on the edge don't flip between states as the focus moves
+		/// </summary>
+		/// <param name="focus">The focus point</param>
+		/// <param name="loadRadius">Chunks at most this far from the focus are loaded</param>
+		/// <param name="unloadRadius">Chunks further than this from the focus are unloaded. Should be larger than the load radius</param>
+		void StreamAround(const Vector3& focus, double loadRadius, double unloadRadius);
+
+		/// <summary>
+		/// Starts queued loads, and attaches and detaches chunks within the frame budget
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Updates until every requested load and unload has finished. Blocks the calling thread
+		/// </summary>
+		void Flush();
+
+		/// <summary>
+		/// Gets a summary of the chunks' states
+		/// </summary>
+		/// <returns>The progress</returns>
+		SceneStreamingProgress GetProgress() const;
+
+		/// <summary>
+		/// Gets every chunk
+		/// </summary>
+		/// <returns>The chunks</returns>
+		const List<Ref<SceneChunk>>& GetChunks() const { return m_Chunks; }
+
+		/// <summary>
+		/// Gets the listener that updates the streamer
+		/// </summary>
+		/// <returns>The tick listener</returns>
+		const Ref<TickListener>& GetTickListener() const { return m_TickListener; }
+
+	// RefCounted ----------
+	protected:
+		virtual void Init() override;
+
+	// RefCounted ----------
+
+	private:
+		/// <summary>
+		/// The result of loading a chunk on a worker
+		/// </summary>
+		struct LoadResult
+		{
+			Ref<SceneChunk> Chunk;
+			Ref<PackedScene> Scene;
+			Ref<Node> Root;
+			string Error;
+		};
+
+	private:
+		void Tick(double deltaTime);
+
+		/// <summary>
+		/// Applies the results of finished loads
+		/// </summary>
+		void CollectLoadResults();
+
+		/// <summary>
+		/// Starts loading the nearest queued chunks, up to the maximum number of concurrent loads
+		/// </summary>
+		void StartLoads();
+
+		/// <summary>
+		/// Loads and instantiates a chunk's scene. Runs on a worker
+		/// </summary>
+		void Load(const Ref<SceneChunk>& chunk, Ref<PackedScene> scene);
+
+		/// <summary>
+		/// Destroys nodes that never entered the tree on a worker, so large chunks don't stall the main thread
+		/// </summary>
+		void DestroyInBackground(Ref<Node> root);
+
+		/// <summary>
+		/// Refreshes each chunk's distance to the focus
+		/// </summary>
+		void UpdateDistances();
+
+		/// <summary>
+		/// Removes and returns the chunk in a list that is nearest to or farthest from the focus
+		/// </summary>
+		static Ref<SceneChunk> PopByDistance(List<Ref<SceneChunk>>& chunks, bool nearest);
+
+		/// <summary>
+		/// Removes a chunk from a list if it's in it
+		/// </summary>
+		static void Remove(List<Ref<SceneChunk>>& chunks, const Ref<SceneChunk>& chunk);
+
+	private:
+		/// <summary>
+		/// The tree chunks are streamed into
+		/// </summary>
+		Ref<NodeTree> m_Tree;
+
+		/// <summary>
+		/// The scheduler chunks are loaded on
+		/// </summary>
+		Jobs::JobScheduler& m_Scheduler;
+
+		/// <summary>
+		/// Tracks every job the streamer has started, so it can wait for them before it's destroyed
+		/// </summary>
+		Ref<Jobs::JobCounter> m_Jobs;
+
+		/// <summary>
+		/// The time to spend attaching and detaching chunks each update
+		/// </summary>
+		TimeSpan m_FrameBudget;
+
+		/// <summary>
+		/// The number of chunks that can be loading at once
+		/// </summary>
+		size_t m_MaxConcurrentLoads;
+
+		/// <summary>
+		/// The point chunks are prioritized by
+		/// </summary>
+		Vector3 m_Focus;
+
+		/// <summary>
+		/// Every chunk
+		/// </summary>
+		List<Ref<SceneChunk>> m_Chunks;
+
+		/// <summary>
+		/// Chunks waiting to start loading
+		/// </summary>
+		List<Ref<SceneChunk>> m_Queued;
+
+		/// <summary>
+		/// Chunks waiting to be attached
+		/// </summary>
+		List<Ref<SceneChunk>> m_Ready;
+
+		/// <summary>
+		/// Chunks waiting to be detached
+		/// </summary>
+		List<Ref<SceneChunk>> m_Unloading;
+
+		/// <summary>
+		/// The number of chunks loading on workers
+		/// </summary>
+		size_t m_LoadingCount = 0;
+
+		/// <summary>
+		/// Guards the finished loads
+		/// </summary>
+		std::mutex m_ResultsMutex;
+
+		/// <summary>
+		/// Loads that finished on workers since the last update
+		/// </summary>
+		List<LoadResult> m_Results;
+
+		/// <summary>
+		/// The listener that updates the streamer every tick
+		/// </summary>
+		Ref<TickListener> m_TickListener;
+	};
+}
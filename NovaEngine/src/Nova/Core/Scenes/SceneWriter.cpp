@@ -0,0 +1,290 @@
+#include "SceneWriter.h"
+#include "NodeSnapshot.h"
+#include "PropertyStream.h"
+#include "SceneExceptions.h"
+#include "SceneFormat.h"
+
+#include "Nova/Core/Nodes/NodeTypeRegistry.h"
+
+#include <fstream>
+#include <string.h>
+#include <type_traits>
+#include <unordered_map>
+#include <variant>
+
+namespace Nova
+{
+	namespace
+	{
+		/// <summary>
+		/// Collects the sections of a scene while walking its nodes
+		/// </summary>
+		struct SceneBuilder
+		{
+			List<SceneNodeRecord> Nodes;
+			List<uint32_t> Types;
+			List<uint32_t> Groups;
+			List<ScenePropertyTable> PropertyTables;
+			List<SceneProperty> NamedProperties;
+			List<SceneString> Strings;
+			string StringData;
+			List<uint8_t> Properties;
+
+			std::unordered_map<const NodeTypeInfo*, uint32_t> TypeIndices;
+			std::unordered_map<const NodePropertyTable*, uint32_t> PropertyTableIndices;
+			std::unordered_map<NameID, uint32_t> StringIndices;
+
+			uint32_t AddString(NameID name)
+			{
+				auto [it, isNew] = StringIndices.emplace(name, (uint32_t)Strings.size());
+
+				if (isNew)
+				{
+					const string& value = name.GetString();
+
+					Strings.push_back({ (uint32_t)StringData.size(), (uint32_t)value.size() });
+					StringData += value;
+				}
+
+				return it->second;
+			}
+
+			uint32_t AddType(const Node& node)
+			{
+				const NodeTypeInfo* type = NodeTypeRegistry::Find(typeid(node));
+
+				if (!type)
+					throw SceneException(FormatString("Node \"{0}\" has type {1}, which isn't registered with the NodeTypeRegistry", node.GetName(), typeid(node).name()));
+
+				return AddType(type);
+			}
+
+			uint32_t AddType(const NodeTypeInfo* type)
+			{
+				auto [it, isNew] = TypeIndices.emplace(type, (uint32_t)Types.size());
+
+				if (isNew)
+					Types.push_back(AddString(type->Name));
+
+				return it->second;
+			}
+
+			void AddGroups(const NodeGroupMask& groups, SceneNodeRecord& record)
+			{
+				record.FirstGroup = (uint32_t)Groups.size();
+
+				if (groups.any())
+				{
+					// Group indices are only given out when a process first uses a name, so groups are saved by name
+					for (uint32_t i = 0; i < NodeGroup::MaxGroups; i++)
+					{
+						NodeGroup group;
+
+						if (groups.test(i) && NodeGroup::TryFindByIndex(i, group))
+							Groups.push_back(AddString(group.GetName()));
+					}
+				}
+
+				record.GroupCount = (uint32_t)Groups.size() - record.FirstGroup;
+			}
+
+			void AddProperty(const NodePropertyTable::Entry& entry)
+			{
+				SceneProperty property = {};
+				property.Name = AddString(entry.first);
+				property.Type = (uint32_t)entry.second.index();
+
+				std::visit([&](const auto& value)
+				{
+					using T = std::decay_t<decltype(value)>;
+
+					if constexpr (std::is_same_v<T, string>)
+					{
+						property.Value = (uint64_t)StringData.size() | ((uint64_t)value.size() << 32);
+						StringData += value;
+					}
+					else
+					{
+						memcpy(&property.Value, &value, sizeof(T));
+					}
+				}, entry.second);
+
+				NamedProperties.push_back(property);
+			}
+
+			uint32_t AddPropertyTable(const Ref<const NodePropertyTable>& table)
+			{
+				if (!table)
+					return SceneFormat::NoPropertyTable;
+
+				auto [it, isNew] = PropertyTableIndices.emplace(table.get(), (uint32_t)PropertyTables.size());
+
+				if (isNew)
+				{
+					PropertyTables.push_back({ (uint32_t)NamedProperties.size(), (uint32_t)table->GetEntries().size() });
+
+					for (const NodePropertyTable::Entry& entry : table->GetEntries())
+					{
+						AddProperty(entry);
+					}
+				}
+
+				return it->second;
+			}
+
+			void AddProperties(const Ref<const NodePropertyTable>& defaults, const List<NodePropertyTable::Entry>* overrides, SceneNodeRecord& record)
+			{
+				record.DefaultProperties = AddPropertyTable(defaults);
+				record.FirstOverride = (uint32_t)NamedProperties.size();
+
+				if (overrides)
+				{
+					for (const NodePropertyTable::Entry& entry : *overrides)
+					{
+						AddProperty(entry);
+					}
+				}
+
+				record.OverrideCount = (uint32_t)NamedProperties.size() - record.FirstOverride;
+			}
+
+			void AddNode(const Node& node, uint32_t parent)
+			{
+				const uint32_t index = (uint32_t)Nodes.size();
+				const size_t propertiesOffset = Properties.size();
+
+				PropertyWriter writer(Properties);
+				node.WriteProperties(writer);
+
+				SceneNodeRecord record = {};
+				record.Type = AddType(node);
+				record.Name = AddString(node.GetNameID());
+				record.Parent = parent;
+				record.ChildCount = (uint32_t)node.GetChildren().size();
+				record.Flags = GetFlags(node.GetIsActive(), node.GetIsTickIndependent());
+				record.TickOrder = node.GetTickOrder();
+				record.PropertiesOffset = (uint32_t)propertiesOffset;
+				record.PropertiesSize = (uint32_t)(Properties.size() - propertiesOffset);
+
+				AddGroups(node.GetGroups(), record);
+				AddProperties(node.GetDefaultProperties(), node.GetPropertyOverrides(), record);
+
+				Nodes.push_back(record);
+
+				for (const Ref<Node>& child : node.GetChildren())
+				{
+					AddNode(*child, index);
+				}
+			}
+
+			void AddNode(const NodeSnapshotRecord& node, uint32_t parent)
+			{
+				const uint32_t index = (uint32_t)Nodes.size();
+
+				SceneNodeRecord record = {};
+				record.Type = AddType(node.Type);
+				record.Name = AddString(node.Name);
+				record.Parent = parent;
+				record.ChildCount = (uint32_t)node.Children.size();
+				record.Flags = GetFlags(node.IsActive, node.IsTickIndependent);
+				record.TickOrder = node.TickOrder;
+				record.PropertiesOffset = (uint32_t)Properties.size();
+				record.PropertiesSize = (uint32_t)node.PropertyData.size();
+
+				AddGroups(node.Groups, record);
+				AddProperties(node.DefaultProperties, &node.PropertyOverrides, record);
+
+				Nodes.push_back(record);
+				Properties.insert(Properties.end(), node.PropertyData.begin(), node.PropertyData.end());
+
+				for (const Ref<const NodeSnapshotRecord>& child : node.Children)
+				{
+					AddNode(*child, index);
+				}
+			}
+
+			List<uint8_t> Build() const
+			{
+				SceneHeader header = {};
+				header.Magic = SceneFormat::Magic;
+				header.Version = SceneFormat::Version;
+				header.NodeCount = (uint32_t)Nodes.size();
+				header.TypeCount = (uint32_t)Types.size();
+				header.StringCount = (uint32_t)Strings.size();
+				header.GroupCount = (uint32_t)Groups.size();
+				header.PropertyTableCount = (uint32_t)PropertyTables.size();
+				header.NamedPropertyCount = (uint32_t)NamedProperties.size();
+
+				header.NodesOffset = AlignSection(sizeof(SceneHeader));
+				header.TypesOffset = AlignSection(header.NodesOffset + Nodes.size() * sizeof(SceneNodeRecord));
+				header.GroupsOffset = AlignSection(header.TypesOffset + Types.size() * sizeof(uint32_t));
+				header.PropertyTablesOffset = AlignSection(header.GroupsOffset + Groups.size() * sizeof(uint32_t));
+				header.NamedPropertiesOffset = AlignSection(header.PropertyTablesOffset + PropertyTables.size() * sizeof(ScenePropertyTable));
+				header.StringsOffset = AlignSection(header.NamedPropertiesOffset + NamedProperties.size() * sizeof(SceneProperty));
+				header.StringDataOffset = AlignSection(header.StringsOffset + Strings.size() * sizeof(SceneString));
+				header.StringDataSize = StringData.size();
+				header.PropertiesOffset = AlignSection(header.StringDataOffset + header.StringDataSize);
+				header.PropertiesSize = Properties.size();
+
+				List<uint8_t> bytes(header.PropertiesOffset + header.PropertiesSize, 0);
+
+				memcpy(bytes.data(), &header, sizeof(header));
+				memcpy(bytes.data() + header.NodesOffset, Nodes.data(), Nodes.size() * sizeof(SceneNodeRecord));
+				memcpy(bytes.data() + header.TypesOffset, Types.data(), Types.size() * sizeof(uint32_t));
+				memcpy(bytes.data() + header.GroupsOffset, Groups.data(), Groups.size() * sizeof(uint32_t));
+				memcpy(bytes.data() + header.PropertyTablesOffset, PropertyTables.data(), PropertyTables.size() * sizeof(ScenePropertyTable));
+				memcpy(bytes.data() + header.NamedPropertiesOffset, NamedProperties.data(), NamedProperties.size() * sizeof(SceneProperty));
+				memcpy(bytes.data() + header.StringsOffset, Strings.data(), Strings.size() * sizeof(SceneString));
+				memcpy(bytes.data() + header.StringDataOffset, StringData.data(), StringData.size());
+				memcpy(bytes.data() + header.PropertiesOffset, Properties.data(), Properties.size());
+
+				return bytes;
+			}
+
+			static uint32_t GetFlags(bool isActive, bool isTickIndependent)
+			{
+				return (isActive ? 0 : SceneFormat::FlagInactive) | (isTickIndependent ? SceneFormat::FlagTickIndependent : 0);
+			}
+
+			static uint64_t AlignSection(uint64_t offset)
+			{
+				return (offset + SceneFormat::SectionAlignment - 1) & ~(SceneFormat::SectionAlignment - 1);
+			}
+		};
+
+		void WriteBytes(const List<uint8_t>& bytes, const string& path)
+		{
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<const char*>(bytes.data()), bytes.size());
+
+			if (!file)
+				throw SceneException(FormatString("Unable to write scene file \"{0}\"", path));
+		}
+	}
+
+	List<uint8_t> SceneWriter::Write(const Node& root)
+	{
+		SceneBuilder builder;
+		builder.AddNode(root, SceneFormat::NoParent);
+
+		return builder.Build();
+	}
+
+	List<uint8_t> SceneWriter::Write(const NodeSnapshot& snapshot)
+	{
+		SceneBuilder builder;
+		builder.AddNode(*snapshot.GetRoot(), SceneFormat::NoParent);
+
+		return builder.Build();
+	}
+
+	void SceneWriter::WriteToFile(const Node& root, const string& path)
+	{
+		WriteBytes(Write(root), path);
+	}
+
+	void SceneWriter::WriteToFile(const NodeSnapshot& snapshot, const string& path)
+	{
+		WriteBytes(Write(snapshot), path);
+	}
+}
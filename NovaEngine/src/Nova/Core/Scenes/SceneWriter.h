@@ -0,0 +1,49 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Nodes/Node.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/String.h"
+
+#include <stdint.h>
+
+namespace Nova
+{
+	class NodeSnapshot;
+
+	/// <summary>
+	/// Saves nodes in the binary scene format read by PackedScene. Every node must be of a type registered with the NodeTypeRegistry,
+	/// otherwise a SceneException is thrown
+	/// </summary>
+	class NovaAPI SceneWriter
+	{
+	public:
+		/// <summary>
+		/// Saves a node and its descendants
+		/// </summary>
+		/// <param name="root">The root of the scene</param>
+		/// <returns>The contents of a scene file</returns>
+		static List<uint8_t> Write(const Node& root);
+
+		/// <summary>
+		/// Saves a node and its descendants to a file, replacing it if it exists
+		/// </summary>
+		/// <param name="root">The root of the scene</param>
+		/// <param name="path">The path of the file</param>
+		static void WriteToFile(const Node& root, const string& path);
+
+		/// <summary>
+		/// Saves a snapshot. Snapshots never change, so this can run on any thread while the tree keeps ticking
+		/// </summary>
+		/// <param name="snapshot">The snapshot to save</param>
+		/// <returns>The contents of a scene file</returns>
+		static List<uint8_t> Write(const NodeSnapshot& snapshot);
+
+		/// <summary>
+		/// Saves a snapshot to a file, replacing it if it exists. This can run on any thread
+		/// </summary>
+		/// <param name="snapshot">The snapshot to save</param>
+		/// <param name="path">The path of the file</param>
+		static void WriteToFile(const NodeSnapshot& snapshot, const string& path);
+	};
+}
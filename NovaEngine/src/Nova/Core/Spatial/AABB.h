@@ -0,0 +1,109 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Rect.h"
+#include "Nova/Core/Types/Vector.h"
+
+#include <algorithm>
+
+namespace Nova
+{
+	/// <summary>
+	/// An axis-aligned bounding box stored as its min and max corners, which is what bounds tests want. Convert to and from Rect at API boundaries
+	/// </summary>
+	struct AABB
+	{
+		double MinX = 0.0, MinY = 0.0, MaxX = 0.0, MaxY = 0.0;
+
+		/// <summary>
+		/// Creates the bounds of a rect. Rects with negative sizes are handled
+		/// </summary>
+		static AABB FromRect(const Rect& rect)
+		{
+			const double x2 = rect.Position.X + rect.Size.X;
+			const double y2 = rect.Position.Y + rect.Size.Y;
+
+			return { std::min(rect.Position.X, x2), std::min(rect.Position.Y, y2), std::max(rect.Position.X, x2), std::max(rect.Position.Y, y2) };
+		}
+
+		/// <summary>
+		/// Creates the bounds of an integer rect
+		/// </summary>
+		static AABB FromRect(const Recti& rect)
+		{
+			return FromRect(Rect(Vector2(rect.Size.X, rect.Size.Y), Vector2(rect.Position.X, rect.Position.Y)));
+		}
+
+		/// <summary>
+		/// Creates the smallest bounds containing two bounds
+		/// </summary>
+		static AABB Union(const AABB& lhs, const AABB& rhs)
+		{
+			return { std::min(lhs.MinX, rhs.MinX), std::min(lhs.MinY, rhs.MinY), std::max(lhs.MaxX, rhs.MaxX), std::max(lhs.MaxY, rhs.MaxY) };
+		}
+
+		/// <summary>
+		/// Gets these bounds as a rect
+		/// </summary>
+		Rect ToRect() const { return Rect(Vector2(MaxX - MinX, MaxY - MinY), Vector2(MinX, MinY)); }
+
+		/// <summary>
+		/// Gets the perimeter, which the tree uses as the cost of a node
+		/// </summary>
+		double GetPerimeter() const { return 2.0 * ((MaxX - MinX) + (MaxY - MinY)); }
+
+		/// <summary>
+		/// Gets if these bounds fully contain other bounds
+		/// </summary>
+		bool Contains(const AABB& other) const
+		{
+			return MinX <= other.MinX && MinY <= other.MinY && other.MaxX <= MaxX && other.MaxY <= MaxY;
+		}
+
+		/// <summary>
+		/// Gets if these bounds contain a point. Points on the edge are inside
+		/// </summary>
+		bool Contains(double x, double y) const
+		{
+			return MinX <= x && x <= MaxX && MinY <= y && y <= MaxY;
+		}
+
+		/// <summary>
+		/// Gets if these bounds overlap other bounds. Touching edges overlap
+		/// </summary>
+		bool Overlaps(const AABB& other) const
+		{
+			return MinX <= other.MaxX && other.MinX <= MaxX && MinY <= other.MaxY && other.MinY <= MaxY;
+		}
+
+		/// <summary>
+		/// Finds where a ray enters these bounds
+		/// </summary>
+		/// <param name="originX">The X coordinate of the ray's origin</param>
+		/// <param name="originY">The Y coordinate of the ray's origin</param>
+		/// <param name="inverseDirX">1 divided by the X component of the ray's direction</param>
+		/// <param name="inverseDirY">1 divided by the Y component of the ray's direction</param>
+		/// <param name="maxDistance">The length of the ray, in multiples of its direction</param>
+		/// <param name="distance">Set to the distance along the ray where it enters, or 0 if it starts inside</param>
+		/// <returns>True if the ray hits the bounds within its length</returns>
+		bool IntersectRay(double originX, double originY, double inverseDirX, double inverseDirY, double maxDistance, double& distance) const
+		{
+			// Slab test. Infinite inverse directions for axis-aligned rays work out, except for rays lying exactly on an edge
+			double tx1 = (MinX - originX) * inverseDirX;
+			double tx2 = (MaxX - originX) * inverseDirX;
+			double ty1 = (MinY - originY) * inverseDirY;
+			double ty2 = (MaxY - originY) * inverseDirY;
+
+			double tMin = std::max(std::min(tx1, tx2), std::min(ty1, ty2));
+			double tMax = std::min(std::max(tx1, tx2), std::max(ty1, ty2));
+
+			tMin = std::max(tMin, 0.0);
+
+			if (tMax < tMin || tMin > maxDistance)
+				return false;
+
+			distance = tMin;
+			return true;
+		}
+	};
+}
@@ -0,0 +1,292 @@
+#include "DynamicAABBTree.h"
+
+#include <algorithm>
+
+namespace Nova
+{
+	namespace
+	{
+		AABB Enlarge(const AABB& bounds, double margin)
+		{
+			return { bounds.MinX - margin, bounds.MinY - margin, bounds.MaxX + margin, bounds.MaxY + margin };
+		}
+	}
+
+	DynamicAABBTree::DynamicAABBTree(double margin, double displacementMultiplier) :
+		m_Margin(margin), m_DisplacementMultiplier(displacementMultiplier)
+	{}
+
+	int32_t DynamicAABBTree::CreateProxy(const AABB& bounds, void* userData)
+	{
+		const int32_t proxy = AllocateNode();
+
+		TreeNode& node = m_Nodes[proxy];
+		node.Bounds = Enlarge(bounds, m_Margin);
+		node.UserData = userData;
+		node.Height = 0;
+
+		InsertLeaf(proxy);
+		m_ProxyCount++;
+
+		return proxy;
+	}
+
+	void DynamicAABBTree::DestroyProxy(int32_t proxy)
+	{
+		RemoveLeaf(proxy);
+		FreeNode(proxy);
+
+		m_ProxyCount--;
+	}
+
+	bool DynamicAABBTree::MoveProxy(int32_t proxy, const AABB& bounds, double displacementX, double displacementY)
+	{
+		const AABB& fatBounds = m_Nodes[proxy].Bounds;
+
+		// Nothing to do while the object stays inside its fat bounds, unless they've grown far bigger than it needs (after a fast move, say)
+		if (fatBounds.Contains(bounds) && Enlarge(bounds, m_Margin * 4.0).Contains(fatBounds))
+			return false;
+
+		RemoveLeaf(proxy);
+
+		AABB newBounds = Enlarge(bounds, m_Margin);
+
+		// Predict where the object is heading, so it doesn't leave its bounds again next update
+		const double aheadX = displacementX * m_DisplacementMultiplier;
+		const double aheadY = displacementY * m_DisplacementMultiplier;
+
+		(aheadX < 0.0 ? newBounds.MinX : newBounds.MaxX) += aheadX;
+		(aheadY < 0.0 ? newBounds.MinY : newBounds.MaxY) += aheadY;
+
+		m_Nodes[proxy].Bounds = newBounds;
+		InsertLeaf(proxy);
+
+		return true;
+	}
+
+	bool DynamicAABBTree::Validate() const
+	{
+		if (m_Root == NullProxy)
+			return m_ProxyCount == 0;
+
+		return m_Nodes[m_Root].ParentOrNext == NullProxy && ValidateSubtree(m_Root, NullProxy);
+	}
+
+	int32_t DynamicAABBTree::AllocateNode()
+	{
+		if (m_FreeList == NullProxy)
+		{
+			m_Nodes.emplace_back();
+			return (int32_t)m_Nodes.size() - 1;
+		}
+
+		const int32_t id = m_FreeList;
+		m_FreeList = m_Nodes[id].ParentOrNext;
+		m_Nodes[id] = TreeNode();
+
+		return id;
+	}
+
+	void DynamicAABBTree::FreeNode(int32_t id)
+	{
+		m_Nodes[id] = TreeNode();
+		m_Nodes[id].ParentOrNext = m_FreeList;
+
+		m_FreeList = id;
+	}
+
+	void DynamicAABBTree::InsertLeaf(int32_t leaf)
+	{
+		if (m_Root == NullProxy)
+		{
+			m_Root = leaf;
+			m_Nodes[leaf].ParentOrNext = NullProxy;
+
+			return;
+		}
+
+		const AABB leafBounds = m_Nodes[leaf].Bounds;
+		int32_t sibling = m_Root;
+
+		// Walk down towards the sibling that costs the least to pair with, where the cost is the perimeter the tree gains
+		while (!m_Nodes[sibling].IsLeaf())
+		{
+			const TreeNode& node = m_Nodes[sibling];
+
+			const double perimeter = node.Bounds.GetPerimeter();
+			const double combinedPerimeter = AABB::Union(node.Bounds, leafBounds).GetPerimeter();
+
+			// The cost of pairing with this node, and the cost every node below it inherits from enlarging it
+			const double cost = 2.0 * combinedPerimeter;
+			const double inheritedCost = 2.0 * (combinedPerimeter - perimeter);
+
+			auto childCost = [&](int32_t childID)
+			{
+				const TreeNode& child = m_Nodes[childID];
+				const double pairedPerimeter = AABB::Union(child.Bounds, leafBounds).GetPerimeter();
+
+				return (child.IsLeaf() ? pairedPerimeter : pairedPerimeter - child.Bounds.GetPerimeter()) + inheritedCost;
+			};
+
+			const double cost1 = childCost(node.Child1);
+			const double cost2 = childCost(node.Child2);
+
+			if (cost < cost1 && cost < cost2)
+				break;
+
+			sibling = cost1 < cost2 ? node.Child1 : node.Child2;
+		}
+
+		// Pair the leaf with the sibling under a new branch
+		const int32_t oldParent = m_Nodes[sibling].ParentOrNext;
+		const int32_t newParent = AllocateNode();
+
+		TreeNode& branch = m_Nodes[newParent];
+		branch.ParentOrNext = oldParent;
+		branch.Bounds = AABB::Union(leafBounds, m_Nodes[sibling].Bounds);
+		branch.Height = m_Nodes[sibling].Height + 1;
+		branch.Child1 = sibling;
+		branch.Child2 = leaf;
+
+		if (oldParent == NullProxy)
+			m_Root = newParent;
+		else if (m_Nodes[oldParent].Child1 == sibling)
+			m_Nodes[oldParent].Child1 = newParent;
+		else
+			m_Nodes[oldParent].Child2 = newParent;
+
+		m_Nodes[sibling].ParentOrNext = newParent;
+		m_Nodes[leaf].ParentOrNext = newParent;
+
+		RefitAncestors(oldParent);
+	}
+
+	void DynamicAABBTree::RemoveLeaf(int32_t leaf)
+	{
+		if (leaf == m_Root)
+		{
+			m_Root = NullProxy;
+			return;
+		}
+
+		const int32_t parent = m_Nodes[leaf].ParentOrNext;
+		const int32_t grandParent = m_Nodes[parent].ParentOrNext;
+		const int32_t sibling = m_Nodes[parent].Child1 == leaf ? m_Nodes[parent].Child2 : m_Nodes[parent].Child1;
+
+		// The sibling takes the parent's place
+		m_Nodes[sibling].ParentOrNext = grandParent;
+
+		if (grandParent == NullProxy)
+			m_Root = sibling;
+		else if (m_Nodes[grandParent].Child1 == parent)
+			m_Nodes[grandParent].Child1 = sibling;
+		else
+			m_Nodes[grandParent].Child2 = sibling;
+
+		FreeNode(parent);
+		RefitAncestors(grandParent);
+	}
+
+	void DynamicAABBTree::RefitAncestors(int32_t id)
+	{
+		while (id != NullProxy)
+		{
+			id = Balance(id);
+
+			TreeNode& node = m_Nodes[id];
+			const TreeNode& child1 = m_Nodes[node.Child1];
+			const TreeNode& child2 = m_Nodes[node.Child2];
+
+			node.Height = 1 + std::max(child1.Height, child2.Height);
+			node.Bounds = AABB::Union(child1.Bounds, child2.Bounds);
+
+			id = node.ParentOrNext;
+		}
+	}
+
+	int32_t DynamicAABBTree::Balance(int32_t idA)
+	{
+		TreeNode& a = m_Nodes[idA];
+
+		if (a.IsLeaf() || a.Height < 2)
+			return idA;
+
+		const int32_t idB = a.Child1;
+		const int32_t idC = a.Child2;
+		TreeNode& b = m_Nodes[idB];
+		TreeNode& c = m_Nodes[idC];
+
+		const int32_t balance = c.Height - b.Height;
+
+		// Rotate the taller child up into A's place, and hand A the shorter of that child's children
+		auto rotateUp = [&](int32_t idUp, TreeNode& up, int32_t& aChildSlot, const TreeNode& other)
+		{
+			const int32_t idF = up.Child1;
+			const int32_t idG = up.Child2;
+			TreeNode& f = m_Nodes[idF];
+			TreeNode& g = m_Nodes[idG];
+
+			up.Child1 = idA;
+			up.ParentOrNext = a.ParentOrNext;
+			a.ParentOrNext = idUp;
+
+			if (up.ParentOrNext == NullProxy)
+				m_Root = idUp;
+			else if (m_Nodes[up.ParentOrNext].Child1 == idA)
+				m_Nodes[up.ParentOrNext].Child1 = idUp;
+			else
+				m_Nodes[up.ParentOrNext].Child2 = idUp;
+
+			const bool keepF = f.Height > g.Height;
+			const int32_t idKept = keepF ? idF : idG;
+			const int32_t idGiven = keepF ? idG : idF;
+			TreeNode& kept = m_Nodes[idKept];
+			TreeNode& given = m_Nodes[idGiven];
+
+			up.Child2 = idKept;
+			aChildSlot = idGiven;
+			given.ParentOrNext = idA;
+
+			a.Bounds = AABB::Union(other.Bounds, given.Bounds);
+			a.Height = 1 + std::max(other.Height, given.Height);
+			up.Bounds = AABB::Union(a.Bounds, kept.Bounds);
+			up.Height = 1 + std::max(a.Height, kept.Height);
+		};
+
+		if (balance > 1)
+		{
+			rotateUp(idC, c, a.Child2, b);
+			return idC;
+		}
+
+		if (balance < -1)
+		{
+			rotateUp(idB, b, a.Child1, c);
+			return idB;
+		}
+
+		return idA;
+	}
+
+	bool DynamicAABBTree::ValidateSubtree(int32_t id, int32_t parent) const
+	{
+		const TreeNode& node = m_Nodes[id];
+
+		if (node.ParentOrNext != parent)
+			return false;
+
+		if (node.IsLeaf())
+			return node.Height == 0 && node.Child2 == NullProxy;
+
+		const TreeNode& child1 = m_Nodes[node.Child1];
+		const TreeNode& child2 = m_Nodes[node.Child2];
+
+		if (node.Height != 1 + std::max(child1.Height, child2.Height))
+			return false;
+
+		if (!node.Bounds.Contains(child1.Bounds) || !node.Bounds.Contains(child2.Bounds))
+			return false;
+
+		return ValidateSubtree(node.Child1, id) && ValidateSubtree(node.Child2, id);
+	}
+}
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "AABB.h"
+
+#include <array>
+#include <cmath>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A bounding volume hierarchy of AABBs that supports inserting, removing and moving objects at any time. Each object (a proxy) is stored with fat
+	/// bounds, enlarged by a margin and by how far it last moved, so objects that move a little don't touch the tree at all. Objects that leave their
+	/// fat bounds are reinserted, which only refits the ancestors along their path. The tree is kept balanced with rotations
+	/// </summary>
+	class NovaAPI DynamicAABBTree
+	{
+	public:
+		/// <summary>
+		/// The ID used for "no proxy"
+		/// </summary>
+		static constexpr int32_t NullProxy = -1;
+
+	public:
+		/// <summary>
+		/// Creates an empty tree
+		/// </summary>
+		/// <param name="margin">How much to enlarge bounds on every side</param>
+		/// <param name="displacementMultiplier">How far ahead of a moving object to enlarge its bounds, in multiples of its last displacement</param>
+		DynamicAABBTree(double margin = 1.0, double displacementMultiplier = 2.0);
+
+	public:
+		/// <summary>
+		/// Adds an object to the tree
+		/// </summary>
+		/// <param name="bounds">The object's bounds</param>
+		/// <param name="userData">A pointer to hand back for the object</param>
+		/// <returns>The ID of the proxy</returns>
+		int32_t CreateProxy(const AABB& bounds, void* userData);
+
+		/// <summary>
+		/// Removes an object from the tree
+		/// </summary>
+		/// <param name="proxy">The ID of the proxy</param>
+		void DestroyProxy(int32_t proxy);
+
+		/// <summary>
+		/// Updates an object's bounds
+		/// </summary>
+		/// <param name="proxy">The ID of the proxy</param>
+		/// <param name="bounds">The object's new bounds</param>
+		/// <param name="displacementX">How far the object moved along X since its last update</param>
+		/// <param name="displacementY">How far the object moved along Y since its last update</param>
+		/// <returns>True if the object left its fat bounds and was reinserted</returns>
+		bool MoveProxy(int32_t proxy, const AABB& bounds, double displacementX = 0.0, double displacementY = 0.0);
+
+		/// <summary>
+		/// Gets the pointer an object was created with
+		/// </summary>
+		void* GetUserData(int32_t proxy) const { return m_Nodes[proxy].UserData; }
+
+		/// <summary>
+		/// Gets the fat bounds of an object
+		/// </summary>
+		const AABB& GetFatBounds(int32_t proxy) const { return m_Nodes[proxy].Bounds; }
+
+		/// <summary>
+		/// Gets the number of objects in the tree
+		/// </summary>
+		size_t GetProxyCount() const { return m_ProxyCount; }
+
+		/// <summary>
+		/// Gets the height of the tree
+		/// </summary>
+		int32_t GetHeight() const { return m_Root == NullProxy ? 0 : m_Nodes[m_Root].Height; }
+
+		/// <summary>
+		/// Checks the tree's structure and bounds. For tests
+		/// </summary>
+		/// <returns>True if every parent link, height and bounds are consistent</returns>
+		bool Validate() const;
+
+		/// <summary>
+		/// Calls a function for every object whose fat bounds overlap the given bounds. Safe to call from several threads at once
+		/// </summary>
+		/// <param name="bounds">The bounds to test</param>
+		/// <param name="callback">Called with each proxy ID. Return false to stop the query</param>
+		template<typename Callback>
+		void Query(const AABB& bounds, const Callback& callback) const
+		{
+			NodeStack stack;
+			stack.Push(m_Root);
+
+			while (!stack.IsEmpty())
+			{
+				const int32_t id = stack.Pop();
+
+				if (id == NullProxy)
+					continue;
+
+				const TreeNode& node = m_Nodes[id];
+
+				if (!node.Bounds.Overlaps(bounds))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					if (!callback(id))
+						return;
+				}
+				else
+				{
+					stack.Push(node.Child1);
+					stack.Push(node.Child2);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Calls a function for every object whose fat bounds a ray passes through. Safe to call from several threads at once
+		/// </summary>
+		/// <param name="originX">The X coordinate of the ray's origin</param>
+		/// <param name="originY">The Y coordinate of the ray's origin</param>
+		/// <param name="directionX">The X component of the ray's direction</param>
+		/// <param name="directionY">The Y component of the ray's direction</param>
+		/// <param name="maxDistance">The length of the ray, in multiples of its direction</param>
+		/// <param name="callback">Called with each proxy ID and the distance to its fat bounds. Returns the new length of the ray, so a closest-hit
+		/// search can clip it. Return 0 to stop, or the current length to keep going</param>
+		template<typename Callback>
+		void RayCast(double originX, double originY, double directionX, double directionY, double maxDistance, const Callback& callback) const
+		{
+			const double inverseDirX = 1.0 / directionX;
+			const double inverseDirY = 1.0 / directionY;
+
+			NodeStack stack;
+			stack.Push(m_Root);
+
+			while (!stack.IsEmpty() && maxDistance > 0.0)
+			{
+				const int32_t id = stack.Pop();
+
+				if (id == NullProxy)
+					continue;
+
+				const TreeNode& node = m_Nodes[id];
+				double distance;
+
+				if (!node.Bounds.IntersectRay(originX, originY, inverseDirX, inverseDirY, maxDistance, distance))
+					continue;
+
+				if (node.IsLeaf())
+				{
+					maxDistance = callback(id, distance);
+				}
+				else
+				{
+					stack.Push(node.Child1);
+					stack.Push(node.Child2);
+				}
+			}
+		}
+
+	private:
+		/// <summary>
+		/// A node of the tree. Leaves hold objects, and branches hold the union of their children's bounds
+		/// </summary>
+		struct TreeNode
+		{
+			AABB Bounds;
+			void* UserData = nullptr;
+
+			/// <summary>
+			/// The parent, or the next free node while the node is in the free list
+			/// </summary>
+			int32_t ParentOrNext = NullProxy;
+
+			int32_t Child1 = NullProxy;
+			int32_t Child2 = NullProxy;
+
+			/// <summary>
+			/// 0 for leaves, -1 for free nodes
+			/// </summary>
+			int32_t Height = -1;
+
+			bool IsLeaf() const { return Child1 == NullProxy; }
+		};
+
+		/// <summary>
+		/// A traversal stack that lives on the stack until it gets deeper than a balanced tree ever should
+		/// </summary>
+		class NodeStack
+		{
+		public:
+			void Push(int32_t id)
+			{
+				if (m_Count < m_Fixed.size())
+					m_Fixed[m_Count] = id;
+				else
+					m_Overflow.push_back(id);
+
+				m_Count++;
+			}
+
+			int32_t Pop()
+			{
+				m_Count--;
+
+				if (m_Count < m_Fixed.size())
+					return m_Fixed[m_Count];
+
+				int32_t id = m_Overflow.back();
+				m_Overflow.pop_back();
+
+				return id;
+			}
+
+			bool IsEmpty() const { return m_Count == 0; }
+
+		private:
+			std::array<int32_t, 128> m_Fixed;
+			List<int32_t> m_Overflow;
+			size_t m_Count = 0;
+		};
+
+	private:
+		int32_t AllocateNode();
+		void FreeNode(int32_t id);
+
+		/// <summary>
+		/// Inserts a leaf next to the sibling that grows the tree's total perimeter the least
+		/// </summary>
+		void InsertLeaf(int32_t leaf);
+
+		/// <summary>
+		/// Removes a leaf, replacing its parent with its sibling
+		/// </summary>
+		void RemoveLeaf(int32_t leaf);
+
+		/// <summary>
+		/// Walks from a node up to the root, refitting bounds and heights and rotating unbalanced nodes
+		/// </summary>
+		void RefitAncestors(int32_t id);
+
+		/// <summary>
+		/// Rotates a node if one child is more than one level taller than the other
+		/// </summary>
+		/// <returns>The node that took the given node's place</returns>
+		int32_t Balance(int32_t id);
+
+		/// <summary>
+		/// Checks a subtree's structure, for Validate
+		/// </summary>
+		bool ValidateSubtree(int32_t id, int32_t parent) const;
+
+	private:
+		/// <summary>
+		/// The nodes, including free ones
+		/// </summary>
+		List<TreeNode> m_Nodes;
+
+		/// <summary>
+		/// The root node
+		/// </summary>
+		int32_t m_Root = NullProxy;
+
+		/// <summary>
+		/// The first free node
+		/// </summary>
+		int32_t m_FreeList = NullProxy;
+
+		/// <summary>
+		/// The number of objects in the tree
+		/// </summary>
+		size_t m_ProxyCount = 0;
+
+		/// <summary>
+		/// How much to enlarge bounds on every side
+		/// </summary>
+		double m_Margin;
+
+		/// <summary>
+		/// How far ahead of a moving object to enlarge its bounds
+		/// </summary>
+		double m_DisplacementMultiplier;
+	};
+}
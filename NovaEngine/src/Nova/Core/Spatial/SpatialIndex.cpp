@@ -0,0 +1,163 @@
+#include "SpatialIndex.h"
+
+#include "Nova/Core/Nodes/Node2D.h"
+#include "Nova/Services/Jobs/Parallel.h"
+
+#include <algorithm>
+
+namespace Nova
+{
+	SpatialIndex::SpatialIndex(double margin) :
+		m_Tree(margin)
+	{}
+
+	SpatialIndex::~SpatialIndex()
+	{
+		// Nodes can outlive their tree, so make sure they don't point to us anymore
+		for (const Entry& entry : m_Entries)
+		{
+			entry.NodePtr->m_SpatialIndex = nullptr;
+			entry.NodePtr->m_SpatialEntry = -1;
+		}
+	}
+
+	void SpatialIndex::Update()
+	{
+		for (Entry& entry : m_Entries)
+		{
+			const AABB bounds = AABB::FromRect(entry.NodePtr->GetWorldBounds());
+
+			if (entry.Proxy == DynamicAABBTree::NullProxy)
+			{
+				entry.Bounds = bounds;
+				entry.Proxy = m_Tree.CreateProxy(bounds, entry.NodePtr);
+
+				continue;
+			}
+
+			const double displacementX = bounds.MinX - entry.Bounds.MinX;
+			const double displacementY = bounds.MinY - entry.Bounds.MinY;
+
+			entry.Bounds = bounds;
+			m_Tree.MoveProxy(entry.Proxy, bounds, displacementX, displacementY);
+		}
+	}
+
+	void SpatialIndex::QueryRect(const Rect& rect, List<Node2D*>& results) const
+	{
+		QueryBounds(AABB::FromRect(rect), results);
+	}
+
+	void SpatialIndex::QueryRect(const Recti& rect, List<Node2D*>& results) const
+	{
+		QueryBounds(AABB::FromRect(rect), results);
+	}
+
+	void SpatialIndex::QueryPoint(const Vector2& point, List<Node2D*>& results) const
+	{
+		const AABB bounds = { point.X, point.Y, point.X, point.Y };
+
+		m_Tree.Query(bounds, [&](int32_t proxy)
+			{
+				if (GetBounds(proxy).Contains(point.X, point.Y))
+					results.push_back(static_cast<Node2D*>(m_Tree.GetUserData(proxy)));
+
+				return true;
+			});
+	}
+
+	void SpatialIndex::QueryRay(const Vector2& origin, const Vector2& direction, double maxDistance, List<SpatialRayHit>& hits) const
+	{
+		const size_t firstHit = hits.size();
+		const double inverseDirX = 1.0 / direction.X;
+		const double inverseDirY = 1.0 / direction.Y;
+
+		m_Tree.RayCast(origin.X, origin.Y, direction.X, direction.Y, maxDistance, [&](int32_t proxy, double)
+			{
+				double distance;
+
+				if (GetBounds(proxy).IntersectRay(origin.X, origin.Y, inverseDirX, inverseDirY, maxDistance, distance))
+					hits.push_back({ static_cast<Node2D*>(m_Tree.GetUserData(proxy)), distance });
+
+				return maxDistance;
+			});
+
+		std::sort(hits.begin() + firstHit, hits.end(), [](const SpatialRayHit& lhs, const SpatialRayHit& rhs) { return lhs.Distance < rhs.Distance; });
+	}
+
+	bool SpatialIndex::RayCast(const Vector2& origin, const Vector2& direction, double maxDistance, SpatialRayHit& hit) const
+	{
+		const double inverseDirX = 1.0 / direction.X;
+		const double inverseDirY = 1.0 / direction.Y;
+		bool isHit = false;
+
+		m_Tree.RayCast(origin.X, origin.Y, direction.X, direction.Y, maxDistance, [&](int32_t proxy, double)
+			{
+				double distance;
+
+				// Clip the ray at each hit, so the tree skips anything further away
+				if (GetBounds(proxy).IntersectRay(origin.X, origin.Y, inverseDirX, inverseDirY, maxDistance, distance))
+				{
+					hit = { static_cast<Node2D*>(m_Tree.GetUserData(proxy)), distance };
+					maxDistance = distance;
+					isHit = true;
+				}
+
+				return maxDistance;
+			});
+
+		return isHit;
+	}
+
+	void SpatialIndex::QueryRectBatch(Jobs::JobScheduler& scheduler, const List<Rect>& rects, List<List<Node2D*>>& results) const
+	{
+		results.resize(rects.size());
+
+		// Each query is only a few microseconds, so hand out several per job
+		Jobs::ParallelFor(scheduler, 0, rects.size(), [&](size_t i)
+			{
+				results[i].clear();
+				QueryRect(rects[i], results[i]);
+			}, 64);
+	}
+
+	void SpatialIndex::QueryBounds(const AABB& bounds, List<Node2D*>& results) const
+	{
+		m_Tree.Query(bounds, [&](int32_t proxy)
+			{
+				// The tree stores fat bounds, so check the real ones
+				if (GetBounds(proxy).Overlaps(bounds))
+					results.push_back(static_cast<Node2D*>(m_Tree.GetUserData(proxy)));
+
+				return true;
+			});
+	}
+
+	void SpatialIndex::Register(Node2D* node)
+	{
+		node->m_SpatialIndex = this;
+		node->m_SpatialEntry = (int32_t)m_Entries.size();
+
+		m_Entries.push_back({ node, AABB(), DynamicAABBTree::NullProxy });
+	}
+
+	void SpatialIndex::Unregister(Node2D* node)
+	{
+		const int32_t index = node->m_SpatialEntry;
+
+		if (m_Entries[index].Proxy != DynamicAABBTree::NullProxy)
+			m_Tree.DestroyProxy(m_Entries[index].Proxy);
+
+		m_Entries[index] = m_Entries.back();
+		m_Entries[index].NodePtr->m_SpatialEntry = index;
+		m_Entries.pop_back();
+
+		node->m_SpatialIndex = nullptr;
+		node->m_SpatialEntry = -1;
+	}
+
+	const AABB& SpatialIndex::GetBounds(int32_t proxy) const
+	{
+		return m_Entries[static_cast<const Node2D*>(m_Tree.GetUserData(proxy))->m_SpatialEntry].Bounds;
+	}
+}
@@ -0,0 +1,177 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/Rect.h"
+#include "Nova/Core/Types/Vector.h"
+#include "DynamicAABBTree.h"
+
+#include <stdint.h>
+
+namespace Nova::Jobs
+{
+	class JobScheduler;
+}
+
+namespace Nova
+{
+	class Node2D;
+
+	/// <summary>
+	/// A ray query hit
+	/// </summary>
+	struct SpatialRayHit
+	{
+		/// <summary>
+		/// The node that was hit
+		/// </summary>
+		Node2D* NodePtr;
+
+		/// <summary>
+		/// The distance along the ray to where it enters the node's bounds, in multiples of the ray's direction
+		/// </summary>
+		double Distance;
+	};
+
+	/// <summary>
+	/// Indexes the world bounds of a tree's 2D nodes in a DynamicAABBTree, so spatial queries only visit nearby nodes instead of walking the whole tree.
+	/// Nodes are indexed once they're given bounds with Node2D::SetBounds. Bounds are refreshed by Update, which the tree calls each tick after updating
+	/// transforms, so changes show up in queries from then on. Queries return raw pointers that are valid until the tree's structure changes, and may
+	/// run on several threads at once as long as nothing updates the index meanwhile
+	/// </summary>
+	class NovaAPI SpatialIndex
+	{
+	public:
+		/// <summary>
+		/// Creates an empty index
+		/// </summary>
+		/// <param name="margin">How much to enlarge each node's bounds by in the tree, so small moves don't touch it</param>
+		SpatialIndex(double margin = 1.0);
+		~SpatialIndex();
+
+		SpatialIndex(const SpatialIndex&) = delete;
+		SpatialIndex& operator=(const SpatialIndex&) = delete;
+
+	public:
+		/// <summary>
+		/// Refreshes the world bounds of every indexed node
+		/// </summary>
+		void Update();
+
+		/// <summary>
+		/// Finds every node whose bounds overlap a rect
+		/// </summary>
+		/// <param name="rect">The rect</param>
+		/// <param name="results">The list to append the nodes to</param>
+		void QueryRect(const Rect& rect, List<Node2D*>& results) const;
+
+		/// <summary>
+		/// Finds every node whose bounds overlap an integer rect
+		/// </summary>
+		/// <param name="rect">The rect</param>
+		/// <param name="results">The list to append the nodes to</param>
+		void QueryRect(const Recti& rect, List<Node2D*>& results) const;
+
+		/// <summary>
+		/// Finds every node whose bounds contain a point
+		/// </summary>
+		/// <param name="point">The point</param>
+		/// <param name="results">The list to append the nodes to</param>
+		void QueryPoint(const Vector2& point, List<Node2D*>& results) const;
+
+		/// <summary>
+		/// Finds every node whose bounds a ray passes through, closest first
+		/// </summary>
+		/// <param name="origin">The origin of the ray</param>
+		/// <param name="direction">The direction of the ray</param>
+		/// <param name="maxDistance">The length of the ray, in multiples of its direction</param>
+		/// <param name="hits">The list to append the hits to</param>
+		void QueryRay(const Vector2& origin, const Vector2& direction, double maxDistance, List<SpatialRayHit>& hits) const;
+
+		/// <summary>
+		/// Finds the closest node whose bounds a ray passes through
+		/// </summary>
+		/// <param name="origin">The origin of the ray</param>
+		/// <param name="direction">The direction of the ray</param>
+		/// <param name="maxDistance">The length of the ray, in multiples of its direction</param>
+		/// <param name="hit">Set to the closest hit</param>
+		/// <returns>True if the ray hit a node</returns>
+		bool RayCast(const Vector2& origin, const Vector2& direction, double maxDistance, SpatialRayHit& hit) const;
+
+		/// <summary>
+		/// Runs many rect queries, spread across a scheduler's workers
+		/// </summary>
+		/// <param name="scheduler">The scheduler to run on</param>
+		/// <param name="rects">The rects to query</param>
+		/// <param name="results">Resized to one list of nodes per rect</param>
+		void QueryRectBatch(Jobs::JobScheduler& scheduler, const List<Rect>& rects, List<List<Node2D*>>& results) const;
+
+		/// <summary>
+		/// Gets the number of indexed nodes
+		/// </summary>
+		/// <returns>The number of nodes</returns>
+		size_t GetCount() const { return m_Entries.size(); }
+
+		/// <summary>
+		/// Gets the underlying tree
+		/// </summary>
+		/// <returns>The tree</returns>
+		const DynamicAABBTree& GetTree() const { return m_Tree; }
+
+	private:
+		/// <summary>
+		/// An indexed node
+		/// </summary>
+		struct Entry
+		{
+			/// <summary>
+			/// The node
+			/// </summary>
+			Node2D* NodePtr;
+
+			/// <summary>
+			/// The node's world bounds as of the last update
+			/// </summary>
+			AABB Bounds;
+
+			/// <summary>
+			/// The node's proxy in the tree, or NullProxy until its first update
+			/// </summary>
+			int32_t Proxy;
+		};
+
+	private:
+		/// <summary>
+		/// Adds a node that has bounds and entered the tree
+		/// </summary>
+		void Register(Node2D* node);
+
+		/// <summary>
+		/// Removes a node that left the tree or lost its bounds
+		/// </summary>
+		void Unregister(Node2D* node);
+
+		/// <summary>
+		/// Finds every node whose bounds overlap some bounds
+		/// </summary>
+		void QueryBounds(const AABB& bounds, List<Node2D*>& results) const;
+
+		/// <summary>
+		/// Gets the indexed world bounds of a tree proxy's node
+		/// </summary>
+		const AABB& GetBounds(int32_t proxy) const;
+
+	private:
+		/// <summary>
+		/// The indexed nodes. Each node knows its entry's index
+		/// </summary>
+		List<Entry> m_Entries;
+
+		/// <summary>
+		/// The tree of fat bounds
+		/// </summary>
+		DynamicAABBTree m_Tree;
+
+		friend Node2D;
+	};
+}
@@ -0,0 +1,132 @@
+#include "CpuTopology.h"
+
+#include <algorithm>
+#include <thread>
+
+namespace Nova
+{
+	CpuTopology::CpuTopology()
+	{
+		Detect();
+
+		// Fallback to a flat topology if the platform couldn't tell us anything
+		if (m_Processors.empty())
+		{
+			uint32_t count = std::max(1u, std::thread::hardware_concurrency());
+
+			for (uint32_t i = 0; i < count; i++)
+			{
+				LogicalProcessor processor;
+				processor.Index = i;
+				processor.GroupNumber = (uint8_t)i;
+				processor.Core = i;
+
+				m_Processors.push_back(processor);
+			}
+		}
+
+		Finalize();
+	}
+
+	const CpuTopology& CpuTopology::Get()
+	{
+		static const CpuTopology s_Topology;
+		return s_Topology;
+	}
+
+	bool CpuTopology::ParseWorkerAffinity(const string& value, WorkerAffinity& affinity)
+	{
+		if (value == "none")
+			affinity = WorkerAffinity::None;
+		else if (value == "core")
+			affinity = WorkerAffinity::Core;
+		else if (value == "numa")
+			affinity = WorkerAffinity::NumaNode;
+		else
+			return false;
+
+		return true;
+	}
+
+	List<uint32_t> CpuTopology::GetNodeProcessors(uint32_t numaNode) const
+	{
+		List<uint32_t> processors;
+
+		for (const LogicalProcessor& processor : m_Processors)
+		{
+			if (processor.NumaNode == numaNode)
+				processors.push_back(processor.Index);
+		}
+
+		return processors;
+	}
+
+	List<uint32_t> CpuTopology::GetPlacementOrder() const
+	{
+		// Bucket each core's SMT siblings so we can take one sibling from every core per pass
+		List<List<uint32_t>> coreProcessors(m_CoreCount);
+		for (const LogicalProcessor& processor : m_Processors)
+		{
+			coreProcessors[processor.Core].push_back(processor.Index);
+		}
+
+		// Within a pass, alternate between nodes so consecutive threads spread across sockets
+		List<List<uint32_t>> nodeCores(m_NumaNodeCount);
+		for (uint32_t core = 0; core < (uint32_t)m_CoreCount; core++)
+		{
+			if (!coreProcessors[core].empty())
+				nodeCores[m_Processors[coreProcessors[core][0]].NumaNode].push_back(core);
+		}
+
+		size_t maxSiblings = 0;
+		size_t maxNodeCores = 0;
+		for (const auto& processors : coreProcessors) maxSiblings = std::max(maxSiblings, processors.size());
+		for (const auto& cores : nodeCores) maxNodeCores = std::max(maxNodeCores, cores.size());
+
+		List<uint32_t> order;
+		order.reserve(m_Processors.size());
+
+		for (size_t sibling = 0; sibling < maxSiblings; sibling++)
+		{
+			for (size_t coreSlot = 0; coreSlot < maxNodeCores; coreSlot++)
+			{
+				for (const auto& cores : nodeCores)
+				{
+					if (coreSlot >= cores.size())
+						continue;
+
+					const List<uint32_t>& siblings = coreProcessors[cores[coreSlot]];
+					if (sibling < siblings.size())
+						order.push_back(siblings[sibling]);
+				}
+			}
+		}
+
+		return order;
+	}
+
+	string CpuTopology::ToString() const
+	{
+		return FormatString("{0} logical processors, {1} cores, {2} NUMA nodes", m_Processors.size(), m_CoreCount, m_NumaNodeCount);
+	}
+
+	void CpuTopology::Finalize()
+	{
+		std::sort(m_Processors.begin(), m_Processors.end(), [](const LogicalProcessor& lhs, const LogicalProcessor& rhs)
+			{
+				return lhs.Group != rhs.Group ? lhs.Group < rhs.Group : lhs.GroupNumber < rhs.GroupNumber;
+			});
+
+		m_CoreCount = 0;
+		m_NumaNodeCount = 0;
+
+		for (uint32_t i = 0; i < (uint32_t)m_Processors.size(); i++)
+		{
+			LogicalProcessor& processor = m_Processors[i];
+			processor.Index = i;
+
+			m_CoreCount = std::max(m_CoreCount, (size_t)processor.Core + 1);
+			m_NumaNodeCount = std::max(m_NumaNodeCount, (size_t)processor.NumaNode + 1);
+		}
+	}
+}
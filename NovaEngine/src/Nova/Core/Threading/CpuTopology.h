@@ -0,0 +1,193 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/String.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A logical processor (hardware thread) on this machine
+	/// </summary>
+	struct NovaAPI LogicalProcessor
+	{
+		/// <summary>
+		/// The engine-wide index of this processor
+		/// </summary>
+		uint32_t Index = 0;
+
+		/// <summary>
+		/// The processor group this processor belongs to. Only machines with more than 64 logical processors have more than one group
+		/// </summary>
+		uint16_t Group = 0;
+
+		/// <summary>
+		/// The number of this processor within its group
+		/// </summary>
+		uint8_t GroupNumber = 0;
+
+		/// <summary>
+		/// The physical core this processor belongs to. Processors that share a core are SMT siblings
+		/// </summary>
+		uint32_t Core = 0;
+
+		/// <summary>
+		/// The NUMA node this processor belongs to
+		/// </summary>
+		uint32_t NumaNode = 0;
+
+		/// <summary>
+		/// The efficiency class of this processor's core. Higher values are faster cores on hybrid CPUs
+		/// </summary>
+		uint8_t EfficiencyClass = 0;
+	};
+
+	/// <summary>
+	/// How worker threads are pinned to processors
+	/// </summary>
+	enum class WorkerAffinity
+	{
+		// Let the OS move threads between any processors
+		None = 0,
+
+		// Pin each thread to its own logical processor, using separate physical cores before SMT siblings
+		Core = 1,
+
+		// Pin each thread to the processors of a single NUMA node, spreading threads across nodes
+		NumaNode = 2,
+	};
+
+	/// <summary>
+	/// The processors, cores and NUMA nodes of this machine, plus helpers for pinning threads and allocating node-local memory
+	/// </summary>
+	class NovaAPI CpuTopology
+	{
+	public:
+		/// <summary>
+		/// Gets the topology of this machine. Detected the first time it is called
+		/// </summary>
+		/// <returns>The machine's topology</returns>
+		static const CpuTopology& Get();
+
+		/// <summary>
+		/// Parses an affinity mode from a string ("none", "core" or "numa")
+		/// </summary>
+		/// <param name="value">The string to parse</param>
+		/// <param name="affinity">Set to the parsed mode</param>
+		/// <returns>True if the string was a valid mode</returns>
+		static bool ParseWorkerAffinity(const string& value, WorkerAffinity& affinity);
+
+	public:
+		/// <summary>
+		/// Gets every logical processor, ordered by index
+		/// </summary>
+		/// <returns>The logical processors</returns>
+		const List<LogicalProcessor>& GetProcessors() const { return m_Processors; }
+
+		/// <summary>
+		/// Gets the number of logical processors
+		/// </summary>
+		/// <returns>The number of logical processors</returns>
+		size_t GetProcessorCount() const { return m_Processors.size(); }
+
+		/// <summary>
+		/// Gets the number of physical cores
+		/// </summary>
+		/// <returns>The number of physical cores</returns>
+		size_t GetCoreCount() const { return m_CoreCount; }
+
+		/// <summary>
+		/// Gets the number of NUMA nodes
+		/// </summary>
+		/// <returns>The number of NUMA nodes</returns>
+		size_t GetNumaNodeCount() const { return m_NumaNodeCount; }
+
+		/// <summary>
+		/// Gets the indices of the processors that belong to a NUMA node
+		/// </summary>
+		/// <param name="numaNode">The NUMA node</param>
+		/// <returns>The processors on the node</returns>
+		List<uint32_t> GetNodeProcessors(uint32_t numaNode) const;
+
+		/// <summary>
+		/// Gets an order to place threads on processors so that consecutive threads land on different physical cores and alternate between NUMA nodes.
+		/// SMT siblings come after every core has been used once
+		/// </summary>
+		/// <returns>Processor indices in placement order</returns>
+		List<uint32_t> GetPlacementOrder() const;
+
+		/// <summary>
+		/// Gets a short human-readable summary of the topology
+		/// </summary>
+		/// <returns>The summary</returns>
+		string ToString() const;
+
+	public:
+		/// <summary>
+		/// Pins the calling thread to a single logical processor
+		/// </summary>
+		/// <param name="processorIndex">The index of the processor</param>
+		/// <returns>True if the thread was pinned</returns>
+		static bool PinCurrentThread(uint32_t processorIndex);
+
+		/// <summary>
+		/// Restricts the calling thread to the processors of a NUMA node
+		/// </summary>
+		/// <param name="numaNode">The NUMA node</param>
+		/// <returns>True if the thread was pinned</returns>
+		static bool PinCurrentThreadToNode(uint32_t numaNode);
+
+		/// <summary>
+		/// Gets the NUMA node of the processor the calling thread is running on
+		/// </summary>
+		/// <returns>The NUMA node</returns>
+		static uint32_t GetCurrentNumaNode();
+
+		/// <summary>
+		/// Allocates page-aligned memory whose physical pages come from a NUMA node. Intended for large buffers, as allocations are rounded up to whole pages
+		/// </summary>
+		/// <param name="size">The number of bytes to allocate</param>
+		/// <param name="numaNode">The NUMA node to allocate from</param>
+		/// <returns>The allocated memory, or nullptr if the allocation failed</returns>
+		static void* AllocateOnNode(size_t size, uint32_t numaNode);
+
+		/// <summary>
+		/// Frees memory allocated with AllocateOnNode
+		/// </summary>
+		/// <param name="memory">The memory to free</param>
+		/// <param name="size">The size that was allocated</param>
+		static void FreeOnNode(void* memory, size_t size);
+
+	private:
+		CpuTopology();
+
+		/// <summary>
+		/// Fills in the processors from the platform
+		/// </summary>
+		void Detect();
+
+		/// <summary>
+		/// Counts cores and nodes once the processors are known
+		/// </summary>
+		void Finalize();
+
+	private:
+		/// <summary>
+		/// Every logical processor, ordered by index
+		/// </summary>
+		List<LogicalProcessor> m_Processors;
+
+		/// <summary>
+		/// The number of physical cores
+		/// </summary>
+		size_t m_CoreCount = 0;
+
+		/// <summary>
+		/// The number of NUMA nodes
+		/// </summary>
+		size_t m_NumaNodeCount = 0;
+	};
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+
+#include <stddef.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// A lightweight, cooperatively scheduled execution context with its own stack. Switching between fibers doesn't enter the kernel
+	/// </summary>
+	class NovaAPI Fiber
+	{
+	public:
+		/// <summary>
+		/// The function a fiber starts running when it is first switched to. It must never return
+		/// </summary>
+		using EntryFunction = void(*)(void* userData);
+
+		/// <summary>
+		/// The default stack size for new fibers
+		/// </summary>
+		static const size_t DefaultStackSize;
+
+	public:
+		/// <summary>
+		/// Creates a fiber that runs the given function once it is first switched to
+		/// </summary>
+		/// <param name="entry">The function to run. Must never return</param>
+		/// <param name="userData">Data to pass to the function</param>
+		/// <param name="stackSize">The size of the fiber's stack in bytes</param>
+		Fiber(EntryFunction entry, void* userData, size_t stackSize = DefaultStackSize);
+
+		~Fiber();
+
+		Fiber(const Fiber&) = delete;
+		Fiber& operator=(const Fiber&) = delete;
+
+	private:
+		/// <summary>
+		/// Creates a fiber that represents a thread that was converted into a fiber
+		/// </summary>
+		Fiber();
+
+	public:
+		/// <summary>
+		/// Converts the calling thread into a fiber so that it can switch to other fibers. The thread is converted back once the returned fiber is destroyed
+		/// </summary>
+		/// <returns>The fiber for the calling thread</returns>
+		static ManagedPtr<Fiber> ConvertCurrentThread();
+
+		/// <summary>
+		/// Suspends the calling fiber and resumes this one. Must be called from a fiber
+		/// </summary>
+		void SwitchTo();
+
+	private:
+		/// <summary>
+		/// The platform handle for this fiber
+		/// </summary>
+		void* m_Handle = nullptr;
+
+		/// <summary>
+		/// The function this fiber runs
+		/// </summary>
+		EntryFunction m_Entry = nullptr;
+
+		/// <summary>
+		/// The data passed to this fiber's function
+		/// </summary>
+		void* m_UserData = nullptr;
+
+		/// <summary>
+		/// True if this fiber was converted from a thread rather than created
+		/// </summary>
+		bool m_IsThreadFiber = false;
+	};
+}
\ No newline at end of file
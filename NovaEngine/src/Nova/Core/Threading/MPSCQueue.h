@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+
+#include <atomic>
+#include <optional>
+
+namespace Nova
+{
+	/// <summary>
+	/// A lock-free, unbounded queue that any number of threads can push to, but only a single thread can pop from
+	/// </summary>
+	template<typename T>
+	class NovaAPI MPSCQueue
+	{
+	private:
+		/// <summary>
+		/// A link in the queue
+		/// </summary>
+		struct QueueNode
+		{
+			std::atomic<QueueNode*> Next = nullptr;
+			std::optional<T> Value;
+		};
+
+	public:
+		MPSCQueue()
+		{
+			// The queue always contains a stub node so producers never have to check for an empty queue
+			QueueNode* stub = new QueueNode();
+			m_Head.store(stub, std::memory_order_relaxed);
+			m_Tail = stub;
+		}
+
+		~MPSCQueue()
+		{
+			while (m_Tail)
+			{
+				QueueNode* next = m_Tail->Next.load(std::memory_order_relaxed);
+				delete m_Tail;
+				m_Tail = next;
+			}
+		}
+
+		MPSCQueue(const MPSCQueue&) = delete;
+		MPSCQueue& operator=(const MPSCQueue&) = delete;
+
+	public:
+		/// <summary>
+		/// Pushes a value onto the queue. Safe to call from any thread
+		/// </summary>
+		/// <param name="value">The value to push</param>
+		void Push(T value)
+		{
+			QueueNode* node = new QueueNode();
+			node->Value.emplace(std::move(value));
+
+			// Swap ourselves in as the new head, then link the previous head to us
+			QueueNode* previous = m_Head.exchange(node, std::memory_order_acq_rel);
+			previous->Next.store(node, std::memory_order_release);
+		}
+
+		/// <summary>
+		/// Pops a value off of the queue. Must only be called from the consuming thread
+		/// </summary>
+		/// <param name="value">Set to the popped value if one was available</param>
+		/// <returns>True if a value was popped</returns>
+		bool Pop(T& value)
+		{
+			QueueNode* tail = m_Tail;
+			QueueNode* next = tail->Next.load(std::memory_order_acquire);
+
+			if (!next)
+				return false;
+
+			// The next node becomes the new stub once its value has been taken
+			value = std::move(*next->Value);
+			next->Value.reset();
+
+			m_Tail = next;
+			delete tail;
+
+			return true;
+		}
+
+		/// <summary>
+		/// Gets if the queue has no values that are ready to be popped. Must only be called from the consuming thread
+		/// </summary>
+		/// <returns>True if the queue is empty</returns>
+		bool IsEmpty() const
+		{
+			return m_Tail->Next.load(std::memory_order_acquire) == nullptr;
+		}
+
+	private:
+		/// <summary>
+		/// The most recently pushed node. Shared between producers
+		/// </summary>
+		std::atomic<QueueNode*> m_Head;
+
+		/// <summary>
+		/// The stub node that sits before the next value to pop. Only touched by the consumer
+		/// </summary>
+		QueueNode* m_Tail;
+	};
+}
\ No newline at end of file
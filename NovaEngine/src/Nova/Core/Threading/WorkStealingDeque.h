@@ -0,0 +1,204 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+
+#include <atomic>
+#include <stdint.h>
+#include <type_traits>
+
+namespace Nova
+{
+	/// <summary>
+	/// A Chase-Lev work-stealing deque. The owning thread pushes and pops from the bottom, while any other thread can steal from the top.
+	/// Only trivially copyable values (such as pointers) can be stored
+	/// </summary>
+	template<typename T>
+	class NovaAPI WorkStealingDeque
+	{
+		static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque can only store trivially copyable values");
+
+	private:
+		/// <summary>
+		/// A circular array of items. Its capacity is always a power of 2
+		/// </summary>
+		struct Buffer
+		{
+			Buffer(int64_t capacity) :
+				Capacity(capacity), Mask(capacity - 1), Items(new std::atomic<T>[capacity])
+			{}
+
+			~Buffer()
+			{
+				delete[] Items;
+			}
+
+			T Get(int64_t index) const { return Items[index & Mask].load(std::memory_order_relaxed); }
+			void Put(int64_t index, T item) { Items[index & Mask].store(item, std::memory_order_relaxed); }
+
+			const int64_t Capacity;
+			const int64_t Mask;
+			std::atomic<T>* Items;
+		};
+
+	public:
+		/// <summary>
+		/// Creates a deque with the given starting capacity
+		/// </summary>
+		/// <param name="capacity">The starting capacity. Must be a power of 2</param>
+		WorkStealingDeque(int64_t capacity = 1024) :
+			m_Top(0), m_Bottom(0), m_Buffer(new Buffer(capacity))
+		{}
+
+		~WorkStealingDeque()
+		{
+			delete m_Buffer.load(std::memory_order_relaxed);
+
+			for (Buffer* buffer : m_RetiredBuffers)
+			{
+				delete buffer;
+			}
+		}
+
+		WorkStealingDeque(const WorkStealingDeque&) = delete;
+		WorkStealingDeque& operator=(const WorkStealingDeque&) = delete;
+
+	public:
+		/// <summary>
+		/// Pushes an item to the bottom of the deque. Must only be called by the owning thread
+		/// </summary>
+		/// <param name="item">The item to push</param>
+		void Push(T item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+			if (bottom - top > buffer->Capacity - 1)
+			{
+				buffer = Grow(buffer, bottom, top);
+			}
+
+			buffer->Put(bottom, item);
+
+			std::atomic_thread_fence(std::memory_order_release);
+			m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+		}
+
+		/// <summary>
+		/// Pops an item from the bottom of the deque. Must only be called by the owning thread
+		/// </summary>
+		/// <param name="item">Set to the popped item if one was available</param>
+		/// <returns>True if an item was popped</returns>
+		bool Pop(T& item)
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed) - 1;
+			Buffer* buffer = m_Buffer.load(std::memory_order_relaxed);
+
+			// Reserve the bottom item before checking for thieves
+			m_Bottom.store(bottom, std::memory_order_relaxed);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			if (top > bottom)
+			{
+				// The deque was empty
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+				return false;
+			}
+
+			item = buffer->Get(bottom);
+
+			if (top == bottom)
+			{
+				// This is the last item, so race any thieves for it
+				bool won = m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+				m_Bottom.store(bottom + 1, std::memory_order_relaxed);
+
+				return won;
+			}
+
+			return true;
+		}
+
+		/// <summary>
+		/// Steals an item from the top of the deque. Safe to call from any thread
+		/// </summary>
+		/// <param name="item">Set to the stolen item if one was available</param>
+		/// <returns>True if an item was stolen</returns>
+		bool Steal(T& item)
+		{
+			int64_t top = m_Top.load(std::memory_order_acquire);
+			std::atomic_thread_fence(std::memory_order_seq_cst);
+			int64_t bottom = m_Bottom.load(std::memory_order_acquire);
+
+			if (top >= bottom)
+				return false;
+
+			Buffer* buffer = m_Buffer.load(std::memory_order_acquire);
+			T stolen = buffer->Get(top);
+
+			// Someone else got to the item first
+			if (!m_Top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+				return false;
+
+			item = stolen;
+			return true;
+		}
+
+		/// <summary>
+		/// Gets an approximate count of the items in the deque
+		/// </summary>
+		/// <returns>The approximate number of items in the deque</returns>
+		int64_t GetSize() const
+		{
+			int64_t bottom = m_Bottom.load(std::memory_order_relaxed);
+			int64_t top = m_Top.load(std::memory_order_relaxed);
+
+			return bottom > top ? bottom - top : 0;
+		}
+
+	private:
+		/// <summary>
+		/// Doubles the capacity of the deque. Must only be called by the owning thread
+		/// </summary>
+		/// <returns>The new buffer</returns>
+		Buffer* Grow(Buffer* buffer, int64_t bottom, int64_t top)
+		{
+			Buffer* newBuffer = new Buffer(buffer->Capacity * 2);
+
+			for (int64_t i = top; i < bottom; i++)
+			{
+				newBuffer->Put(i, buffer->Get(i));
+			}
+
+			// Thieves may still be reading from the old buffer, so keep it alive until we're destroyed
+			m_RetiredBuffers.push_back(buffer);
+			m_Buffer.store(newBuffer, std::memory_order_release);
+
+			return newBuffer;
+		}
+
+	private:
+		/// <summary>
+		/// The index that thieves steal from
+		/// </summary>
+		alignas(64) std::atomic<int64_t> m_Top;
+
+		/// <summary>
+		/// The index that the owner pushes to and pops from
+		/// </summary>
+		alignas(64) std::atomic<int64_t> m_Bottom;
+
+		/// <summary>
+		/// The current buffer of items
+		/// </summary>
+		std::atomic<Buffer*> m_Buffer;
+
+		/// <summary>
+		/// Buffers that have been replaced by larger ones
+		/// </summary>
+		List<Buffer*> m_RetiredBuffers;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "Clock.h"
+
+#include <mutex>
+
+namespace Nova
+{
+	std::atomic<const Clock::Calibration*> Clock::s_Calibration = nullptr;
+
+	int64_t Clock::GetNanoseconds()
+	{
+		const Calibration& calibration = GetCalibration();
+
+		return calibration.BaseNanoseconds + (int64_t)((double)(ReadTicks(calibration.Source) - calibration.BaseTicks) * calibration.NanosecondsPerTick);
+	}
+
+	uint64_t Clock::GetTicks()
+	{
+		return ReadTicks(GetCalibration().Source);
+	}
+
+	int64_t Clock::TicksToNanoseconds(uint64_t ticks)
+	{
+		// Ticks are relative to the base, so a double keeps sub-nanosecond accuracy for ~100 days of uptime
+		return (int64_t)((double)ticks * GetCalibration().NanosecondsPerTick);
+	}
+
+	uint64_t Clock::GetTickFrequency()
+	{
+		return GetCalibration().TickFrequency;
+	}
+
+	bool Clock::SetSource(ClockSource source)
+	{
+		const ClockSource requested = source;
+
+		if (source == ClockSource::CycleCounter && !IsCycleCounterInvariant())
+			source = ClockSource::PerformanceCounter;
+
+		// Only one thread replaces the calibration at a time, so none of them continues from a time another has already replaced
+		static std::mutex mutex;
+		std::lock_guard lock(mutex);
+
+		if (source != GetCalibration().Source)
+		{
+			// Continue from the current time so the clock never jumps backwards
+			s_Calibration.store(new Calibration(Calibrate(source, GetNanoseconds())), std::memory_order_release);
+		}
+
+		return source == requested;
+	}
+
+	const Clock::Calibration& Clock::GetCalibration()
+	{
+		if (const Calibration* calibration = s_Calibration.load(std::memory_order_acquire))
+			return *calibration;
+
+		// Calibrating on first use rather than in a static initializer means reads from other initializers never see an uncalibrated clock
+		static const bool isCalibrated = [] {
+			Calibration* calibration = new Calibration(Calibrate(ClockSource::PerformanceCounter, 0));
+
+			// Count from the counter's own origin rather than from this first read, so times from before it, such as a first tick backdated by
+			// one frame, can still be represented
+			calibration->BaseNanoseconds = (int64_t)((double)calibration->BaseTicks * calibration->NanosecondsPerTick);
+
+			const Calibration* expected = nullptr;
+			s_Calibration.compare_exchange_strong(expected, calibration, std::memory_order_acq_rel);
+
+			return true;
+		}();
+
+		(void)isCalibrated;
+
+		return *s_Calibration.load(std::memory_order_acquire);
+	}
+
+	Clock::Calibration Clock::Calibrate(ClockSource source, int64_t baseNanoseconds)
+	{
+		Calibration calibration = {};
+		calibration.Source = source;
+		calibration.BaseNanoseconds = baseNanoseconds;
+
+		if (source == ClockSource::CycleCounter)
+		{
+			// Measure the cycle counter against the performance counter over a short window
+			const uint64_t pcFrequency = ReadPerformanceCounterFrequency();
+			const uint64_t pcWindow = pcFrequency / 100;
+
+			uint64_t pcStart = ReadPerformanceCounter();
+			uint64_t cycleStart = GetCycles();
+			uint64_t pcEnd = pcStart;
+
+			while (pcEnd - pcStart < pcWindow)
+			{
+				pcEnd = ReadPerformanceCounter();
+			}
+
+			uint64_t cycleEnd = GetCycles();
+
+			calibration.TickFrequency = (uint64_t)((double)(cycleEnd - cycleStart) * (double)pcFrequency / (double)(pcEnd - pcStart));
+		}
+		else
+		{
+			calibration.TickFrequency = ReadPerformanceCounterFrequency();
+		}
+
+		calibration.NanosecondsPerTick = 1000000000.0 / (double)calibration.TickFrequency;
+		calibration.BaseTicks = ReadTicks(source);
+
+		return calibration;
+	}
+
+	uint64_t Clock::ReadTicks(ClockSource source)
+	{
+		if (source == ClockSource::CycleCounter)
+			return GetCycles();
+
+		return ReadPerformanceCounter();
+	}
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+
+#include <atomic>
+#include <stdint.h>
+
+namespace Nova
+{
+	/// <summary>
+	/// The hardware sources that the Clock can read time from
+	/// </summary>
+	enum class ClockSource
+	{
+		// The platform's high-resolution performance counter. Always available and always monotonic
+		PerformanceCounter = 0,
+
+		// The CPU's timestamp counter (rdtsc). Only selectable if the CPU reports an invariant TSC
+		CycleCounter = 1,
+	};
+
+	/// <summary>
+	/// A calibrated, monotonic clock with nanosecond resolution. This is the time source used by DateTime and TimeSpan. Thread-safe, and calibrated
+	/// on first use, so it can be read during static initialization
+	/// </summary>
+	class NovaAPI Clock
+	{
+	public:
+		/// <summary>
+		/// Gets the number of nanoseconds that have passed since the origin of the performance counter, usually when the system started
+		/// </summary>
+		/// <returns>A monotonic number of nanoseconds</returns>
+		static int64_t GetNanoseconds();
+
+		/// <summary>
+		/// Reads the raw tick value from the current clock source. Use TicksToNanoseconds to convert the difference between two reads
+		/// </summary>
+		/// <returns>The raw tick value of the current clock source</returns>
+		static uint64_t GetTicks();
+
+		/// <summary>
+		/// Reads the CPU's timestamp counter directly. This is the cheapest way to time a scope, but the value is in CPU cycles
+		/// </summary>
+		/// <returns>The current value of the CPU's timestamp counter</returns>
+		static uint64_t GetCycles();
+
+		/// <summary>
+		/// Converts a number of ticks from the current clock source into nanoseconds
+		/// </summary>
+		/// <param name="ticks">The number of ticks</param>
+		/// <returns>The number of nanoseconds the ticks represent</returns>
+		static int64_t TicksToNanoseconds(uint64_t ticks);
+
+		/// <summary>
+		/// Gets the number of ticks per second of the current clock source
+		/// </summary>
+		/// <returns>The number of ticks per second</returns>
+		static uint64_t GetTickFrequency();
+
+		/// <summary>
+		/// Sets the source of this clock. Falls back to the performance counter if the requested source is not usable on this machine. Threads reading
+		/// the clock meanwhile see either the old or the new source, never a mix of the two
+		/// </summary>
+		/// <param name="source">The desired clock source</param>
+		/// <returns>True if the requested source is now in use</returns>
+		static bool SetSource(ClockSource source);
+
+		/// <summary>
+		/// Gets the source this clock is currently reading from
+		/// </summary>
+		/// <returns>The current clock source</returns>
+		static ClockSource GetSource() { return GetCalibration().Source; }
+
+		/// <summary>
+		/// Gets if the CPU's timestamp counter runs at a constant rate regardless of power states, and can thus be used as a clock source
+		/// </summary>
+		/// <returns>True if the CPU's timestamp counter is invariant</returns>
+		static bool IsCycleCounterInvariant();
+
+	private:
+		/// <summary>
+		/// Everything needed to turn ticks of a source into nanoseconds. Never changed once published, so readers need no lock
+		/// </summary>
+		struct Calibration
+		{
+			/// <summary>
+			/// The source the ticks are read from
+			/// </summary>
+			ClockSource Source;
+
+			/// <summary>
+			/// The number of ticks per second of the source
+			/// </summary>
+			uint64_t TickFrequency;
+
+			/// <summary>
+			/// The tick value of the source that nanoseconds are measured from
+			/// </summary>
+			uint64_t BaseTicks;
+
+			/// <summary>
+			/// The number of nanoseconds that had passed at BaseTicks. Keeps the clock monotonic when the source changes
+			/// </summary>
+			int64_t BaseNanoseconds;
+
+			/// <summary>
+			/// Pre-computed conversion factor from ticks to nanoseconds so reads don't need a division
+			/// </summary>
+			double NanosecondsPerTick;
+		};
+
+	private:
+		/// <summary>
+		/// Gets the calibration in use, calibrating the performance counter the first time
+		/// </summary>
+		/// <returns>The current calibration</returns>
+		static const Calibration& GetCalibration();
+
+		/// <summary>
+		/// Measures the frequency of a source and captures the base tick that nanoseconds are measured from
+		/// </summary>
+		/// <param name="source">The source to calibrate</param>
+		/// <param name="baseNanoseconds">The time the base tick stands for</param>
+		/// <returns>The new calibration</returns>
+		static Calibration Calibrate(ClockSource source, int64_t baseNanoseconds);
+
+		/// <summary>
+		/// Reads the raw tick value of a source
+		/// </summary>
+		/// <param name="source">The source to read</param>
+		/// <returns>The raw tick value</returns>
+		static uint64_t ReadTicks(ClockSource source);
+
+		/// <summary>
+		/// Reads the raw tick value of the platform's performance counter
+		/// </summary>
+		/// <returns>The raw performance counter value</returns>
+		static uint64_t ReadPerformanceCounter();
+
+		/// <summary>
+		/// Gets the frequency of the platform's performance counter
+		/// </summary>
+		/// <returns>The number of performance counter ticks per second</returns>
+		static uint64_t ReadPerformanceCounterFrequency();
+
+	private:
+		/// <summary>
+		/// The calibration in use, or nullptr before the first read. Replaced calibrations are never freed, as other threads may still be reading
+		/// them, but the source only ever changes a handful of times
+		/// </summary>
+		static std::atomic<const Calibration*> s_Calibration;
+	};
+}
\ No newline at end of file
@@ -1,136 +1,157 @@
 #include "DateTime.h"
 
-#include <chrono>
+#include <algorithm>
 
 namespace Nova
 {
 	TimeSpan::TimeSpan(int64_t microseconds) :
-		m_Microseconds(microseconds)
+		m_Nanoseconds(microseconds * NSecsPerMicrosecond)
 	{}
 
 	TimeSpan TimeSpan::Now()
 	{
-		auto now = std::chrono::steady_clock::now();
-
-		return TimeSpan(std::chrono::time_point_cast<std::chrono::microseconds>(now).time_since_epoch().count());
+		return FromNanoseconds(Clock::GetNanoseconds());
 	}
 
 	TimeSpan TimeSpan::FromSeconds(double seconds)
 	{
-		return TimeSpan((int64_t)(seconds * (double)USecsPerSecond));
+		return FromNanoseconds((int64_t)(seconds * (double)(USecsPerSecond * NSecsPerMicrosecond)));
+	}
+
+	TimeSpan TimeSpan::FromNanoseconds(int64_t nanoseconds)
+	{
+		TimeSpan span;
+		span.m_Nanoseconds = nanoseconds;
+		return span;
 	}
 
+	const int64_t TimeSpan::NSecsPerMicrosecond = 1000;
 	const int64_t TimeSpan::USecsPerMillisecond = 1000;
 	const int64_t TimeSpan::USecsPerSecond = 1000000;
 	const int64_t TimeSpan::USecsPerMinute = 60000000;
 	const int64_t TimeSpan::USecsPerHour = 3600000000;
 	const int64_t TimeSpan::USecsPerDay = 86400000000;
 
+	int64_t TimeSpan::GetNanoseconds() const
+	{
+		return m_Nanoseconds;
+	}
+
 	int64_t TimeSpan::GetMicroseconds() const
 	{
-		return m_Microseconds;
+		return m_Nanoseconds / NSecsPerMicrosecond;
+	}
+
+	double TimeSpan::GetTotalMicroseconds() const
+	{
+		return m_Nanoseconds / (double)NSecsPerMicrosecond;
 	}
 
 	int TimeSpan::GetMilliseconds() const
 	{
-		return int((m_Microseconds % USecsPerSecond) / USecsPerMillisecond);
+		return int((GetMicroseconds() % USecsPerSecond) / USecsPerMillisecond);
 	}
 
 	double TimeSpan::GetTotalMilliseconds() const
 	{
-		return m_Microseconds / (double)USecsPerMillisecond;
+		return GetTotalMicroseconds() / (double)USecsPerMillisecond;
 	}
 
 	int TimeSpan::GetSeconds() const
 	{
-		return int((m_Microseconds % USecsPerMinute) / USecsPerSecond);
+		return int((GetMicroseconds() % USecsPerMinute) / USecsPerSecond);
 	}
 
 	double TimeSpan::GetTotalSeconds() const
 	{
-		return m_Microseconds / (double)USecsPerSecond;
+		return GetTotalMicroseconds() / (double)USecsPerSecond;
 	}
 
 	int TimeSpan::GetMinutes() const
 	{
-		return int((m_Microseconds % USecsPerHour) / USecsPerMinute);
+		return int((GetMicroseconds() % USecsPerHour) / USecsPerMinute);
 	}
 
 	double TimeSpan::GetTotalMinutes() const
 	{
-		return m_Microseconds / (double)USecsPerMinute;
+		return GetTotalMicroseconds() / (double)USecsPerMinute;
 	}
 
 	int TimeSpan::GetHours() const
 	{
-		return int((m_Microseconds % USecsPerDay) / USecsPerHour);
+		return int((GetMicroseconds() % USecsPerDay) / USecsPerHour);
 	}
 
 	double TimeSpan::GetTotalHours() const
 	{
-		return m_Microseconds / (double)USecsPerHour;
+		return GetTotalMicroseconds() / (double)USecsPerHour;
 	}
 
 	int TimeSpan::GetDays() const
 	{
-		return int(m_Microseconds / USecsPerDay);
+		return int(GetMicroseconds() / USecsPerDay);
 	}
 
 	double TimeSpan::GetTotalDays() const
 	{
-		return m_Microseconds / (double)USecsPerDay;
+		return GetTotalMicroseconds() / (double)USecsPerDay;
 	}
 
 	TimeSpan TimeSpan::operator+(const TimeSpan& rhs) const
 	{
-		return TimeSpan(m_Microseconds + rhs.m_Microseconds);
+		return FromNanoseconds(m_Nanoseconds + rhs.m_Nanoseconds);
 	}
 
 	TimeSpan TimeSpan::operator-(const TimeSpan& rhs) const
 	{
-		return TimeSpan(m_Microseconds - rhs.m_Microseconds);
+		return FromNanoseconds(m_Nanoseconds - rhs.m_Nanoseconds);
 	}
 
 	bool TimeSpan::operator>(const TimeSpan& rhs) const
 	{
-		return m_Microseconds > rhs.m_Microseconds;
+		return m_Nanoseconds > rhs.m_Nanoseconds;
 	}
 
 	bool TimeSpan::operator<(const TimeSpan& rhs) const
 	{
-		return m_Microseconds < rhs.m_Microseconds;
+		return m_Nanoseconds < rhs.m_Nanoseconds;
 	}
 
 	bool TimeSpan::operator==(const TimeSpan& rhs) const
 	{
-		return m_Microseconds == rhs.m_Microseconds;
+		return m_Nanoseconds == rhs.m_Nanoseconds;
 	}
 
 	DateTime::DateTime(uint64_t microsecondsSinceEpoch) :
-		m_MicrosecondsSinceEpoch(microsecondsSinceEpoch)
+		m_NanosecondsSinceEpoch(microsecondsSinceEpoch * TimeSpan::NSecsPerMicrosecond)
 	{}
 
 	DateTime DateTime::Now()
 	{
-		auto now = std::chrono::steady_clock::now();
+		return FromNanoseconds(Clock::GetNanoseconds());
+	}
 
-		return DateTime(std::chrono::time_point_cast<std::chrono::microseconds>(now).time_since_epoch().count());
+	DateTime DateTime::FromNanoseconds(uint64_t nanosecondsSinceEpoch)
+	{
+		DateTime time(0);
+		time.m_NanosecondsSinceEpoch = nanosecondsSinceEpoch;
+		return time;
 	}
 
 	DateTime DateTime::operator+(const TimeSpan& rhs) const
 	{
-		// Can't have DateTimes before epoch, so ensure the microseconds will remain >= 0
-		return DateTime(std::max((int64_t)(m_MicrosecondsSinceEpoch + rhs.GetMicroseconds()), (int64_t)0));
+		// Can't have DateTimes before epoch, so ensure the nanoseconds will remain >= 0
+		return FromNanoseconds(std::max((int64_t)(m_NanosecondsSinceEpoch + rhs.GetNanoseconds()), (int64_t)0));
 	}
 
 	DateTime DateTime::operator-(const TimeSpan& rhs) const
 	{
-		// Can't have DateTimes before epoch, so ensure the microseconds will remain >= 0
-		return DateTime(std::max((int64_t)(m_MicrosecondsSinceEpoch - rhs.GetMicroseconds()), (int64_t)0));
+		// Can't have DateTimes before epoch, so ensure the nanoseconds will remain >= 0
+		return FromNanoseconds(std::max((int64_t)(m_NanosecondsSinceEpoch - rhs.GetNanoseconds()), (int64_t)0));
 	}
 
 	TimeSpan DateTime::operator-(const DateTime& rhs) const
 	{
-		return TimeSpan(m_MicrosecondsSinceEpoch - rhs.m_MicrosecondsSinceEpoch);
+		return TimeSpan::FromNanoseconds(m_NanosecondsSinceEpoch - rhs.m_NanosecondsSinceEpoch);
 	}
 }
\ No newline at end of file
@@ -1,13 +1,14 @@
 #pragma once
 
 #include "Nova/Core/EngineAPI.h"
+#include "Clock.h"
 
 #include <stdint.h>
 
 namespace Nova
 {
 	/// <summary>
-	/// Represents a duration of time with microsecond precision
+	/// Represents a duration of time with nanosecond precision
 	/// </summary>
 	struct NovaAPI TimeSpan
 	{
@@ -32,7 +33,17 @@ namespace Nova
 		/// <returns>A TimeSpan representing the given number of seconds</returns>
 		static TimeSpan FromSeconds(double seconds);
 
+		/// <summary>
+		/// Creates a TimeSpan that represents the given number of nanoseconds
+		/// </summary>
+		/// <param name="nanoseconds">The number of nanoseconds for the TimeSpan</param>
+		/// <returns>A TimeSpan representing the given number of nanoseconds</returns>
+		static TimeSpan FromNanoseconds(int64_t nanoseconds);
+
 	public:
+		// The amount of nanoseconds in 1 microsecond
+		static const int64_t NSecsPerMicrosecond;
+
 		// The amount of microseconds in 1 millisecond
 		static const int64_t USecsPerMillisecond;
 
@@ -49,12 +60,24 @@ namespace Nova
 		static const int64_t USecsPerDay;
 
 	public:
+		/// <summary>
+		/// Gets the number of nanoseconds of this TimeSpan
+		/// </summary>
+		/// <returns>The number of nanoseconds of this TimeSpan</returns>
+		int64_t GetNanoseconds() const;
+
 		/// <summary>
 		/// Gets the number of microseconds of this TimeSpan
 		/// </summary>
 		/// <returns>The number of microseconds of this TimeSpan</returns>
 		int64_t GetMicroseconds() const;
 
+		/// <summary>
+		/// Gets the total number of microseconds that this TimeSpan's duration contains, including fractions of a microsecond
+		/// </summary>
+		/// <returns>The total number of microseconds in this TimeSpan's duration</returns>
+		double GetTotalMicroseconds() const;
+
 		/// <summary>
 		/// Gets the milliseconds component of this TimeSpan
 		/// </summary>
@@ -123,9 +146,9 @@ namespace Nova
 
 	private:
 		/// <summary>
-		/// The number of microseconds in this TimeSpan
+		/// The number of nanoseconds in this TimeSpan
 		/// </summary>
-		int64_t m_Microseconds;
+		int64_t m_Nanoseconds;
 	};
 
 	/// <summary>
@@ -143,6 +166,13 @@ namespace Nova
 		/// <returns>The current time</returns>
 		static DateTime Now();
 
+		/// <summary>
+		/// Creates a DateTime from the given number of nanoseconds since epoch
+		/// </summary>
+		/// <param name="nanosecondsSinceEpoch">The number of nanoseconds since epoch</param>
+		/// <returns>A DateTime representing the given point in time</returns>
+		static DateTime FromNanoseconds(uint64_t nanosecondsSinceEpoch);
+
 	public:
 		DateTime operator+(const TimeSpan& rhs) const;
 		DateTime operator-(const TimeSpan& rhs) const;
@@ -150,8 +180,8 @@ namespace Nova
 
 	private:
 		/// <summary>
-		/// The number of microseconds that have passed since unix epoch
+		/// The number of nanoseconds that have passed since the clock's epoch
 		/// </summary>
-		uint64_t m_MicrosecondsSinceEpoch;
+		uint64_t m_NanosecondsSinceEpoch;
 	};
 }
\ No newline at end of file
@@ -0,0 +1,119 @@
+#include "Matrix4.h"
+
+#include <cmath>
+
+#if defined(_M_X64) || defined(__SSE2__)
+#define NOVA_MATRIX4_SSE
+#include <xmmintrin.h>
+#endif
+
+namespace Nova
+{
+	Matrix4::Matrix4() :
+		Elements{ 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f }
+	{}
+
+	Matrix4 Matrix4::FromTranslationRotationScale(const Vector3& translation, const Quaternion& rotation, const Vector3& scale)
+	{
+		const float x = rotation.X, y = rotation.Y, z = rotation.Z, w = rotation.W;
+
+		Matrix4 result;
+		float* m = result.Elements;
+
+		m[0] = (1.0f - 2.0f * (y * y + z * z)) * scale.X;
+		m[1] = (2.0f * (x * y + z * w)) * scale.X;
+		m[2] = (2.0f * (x * z - y * w)) * scale.X;
+
+		m[4] = (2.0f * (x * y - z * w)) * scale.Y;
+		m[5] = (1.0f - 2.0f * (x * x + z * z)) * scale.Y;
+		m[6] = (2.0f * (y * z + x * w)) * scale.Y;
+
+		m[8] = (2.0f * (x * z + y * w)) * scale.Z;
+		m[9] = (2.0f * (y * z - x * w)) * scale.Z;
+		m[10] = (1.0f - 2.0f * (x * x + y * y)) * scale.Z;
+
+		m[12] = translation.X;
+		m[13] = translation.Y;
+		m[14] = translation.Z;
+
+		return result;
+	}
+
+	Matrix4 Matrix4::FromTranslationRotationScale2D(const Vector2& translation, double rotation, const Vector2& scale)
+	{
+		const float cosine = (float)std::cos(rotation);
+		const float sine = (float)std::sin(rotation);
+
+		Matrix4 result;
+		float* m = result.Elements;
+
+		m[0] = cosine * (float)scale.X;
+		m[1] = sine * (float)scale.X;
+
+		m[4] = -sine * (float)scale.Y;
+		m[5] = cosine * (float)scale.Y;
+
+		m[12] = (float)translation.X;
+		m[13] = (float)translation.Y;
+
+		return result;
+	}
+
+	void Matrix4::Multiply(const Matrix4& lhs, const Matrix4& rhs, Matrix4& result)
+	{
+#ifdef NOVA_MATRIX4_SSE
+		const __m128 column0 = _mm_load_ps(lhs.Elements);
+		const __m128 column1 = _mm_load_ps(lhs.Elements + 4);
+		const __m128 column2 = _mm_load_ps(lhs.Elements + 8);
+		const __m128 column3 = _mm_load_ps(lhs.Elements + 12);
+
+		// Each result column is the left-hand columns weighted by the matching right-hand column
+		for (int column = 0; column < 4; column++)
+		{
+			const float* weights = rhs.Elements + column * 4;
+
+			__m128 sum = _mm_mul_ps(column0, _mm_set1_ps(weights[0]));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column1, _mm_set1_ps(weights[1])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column2, _mm_set1_ps(weights[2])));
+			sum = _mm_add_ps(sum, _mm_mul_ps(column3, _mm_set1_ps(weights[3])));
+
+			_mm_store_ps(result.Elements + column * 4, sum);
+		}
+#else
+		for (int column = 0; column < 4; column++)
+		{
+			for (int row = 0; row < 4; row++)
+			{
+				float sum = 0.0f;
+
+				for (int i = 0; i < 4; i++)
+				{
+					sum += lhs.Elements[i * 4 + row] * rhs.Elements[column * 4 + i];
+				}
+
+				result.Elements[column * 4 + row] = sum;
+			}
+		}
+#endif
+	}
+
+	Matrix4 Matrix4::operator*(const Matrix4& other) const
+	{
+		Matrix4 result;
+		Multiply(*this, other, result);
+
+		return result;
+	}
+
+	Vector3 Matrix4::TransformPoint(const Vector3& point) const
+	{
+		const float* m = Elements;
+
+		return Vector3(
+			m[0] * point.X + m[4] * point.Y + m[8] * point.Z + m[12],
+			m[1] * point.X + m[5] * point.Y + m[9] * point.Z + m[13],
+			m[2] * point.X + m[6] * point.Y + m[10] * point.Z + m[14]);
+	}
+
+	const Matrix4 Matrix4::IDENTITY = Matrix4();
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Vector.h"
+#include "Quaternion.h"
+
+namespace Nova
+{
+	/// <summary>
+	/// A 4x4 single-precision transform matrix. Stored column-major and 16-byte aligned so columns can be loaded straight into SIMD registers
+	/// </summary>
+	struct alignas(16) NovaAPI Matrix4
+	{
+		/// <summary>
+		/// Creates an identity matrix
+		/// </summary>
+		Matrix4();
+
+		/// <summary>
+		/// Creates a transform that scales, then rotates, then translates
+		/// </summary>
+		/// <param name="translation">The translation</param>
+		/// <param name="rotation">The rotation</param>
+		/// <param name="scale">The scale</param>
+		/// <returns>The transform</returns>
+		static Matrix4 FromTranslationRotationScale(const Vector3& translation, const Quaternion& rotation, const Vector3& scale);
+
+		/// <summary>
+		/// Creates a 2D transform in the XY plane that scales, then rotates, then translates
+		/// </summary>
+		/// <param name="translation">The translation</param>
+		/// <param name="rotation">The rotation around the Z axis (in radians)</param>
+		/// <param name="scale">The scale</param>
+		/// <returns>The transform</returns>
+		static Matrix4 FromTranslationRotationScale2D(const Vector2& translation, double rotation, const Vector2& scale);
+
+		/// <summary>
+		/// Multiplies two matrices. The result transforms by the right-hand matrix first
+		/// </summary>
+		/// <param name="lhs">The left-hand matrix</param>
+		/// <param name="rhs">The right-hand matrix</param>
+		/// <param name="result">Set to the product. May not alias either input</param>
+		static void Multiply(const Matrix4& lhs, const Matrix4& rhs, Matrix4& result);
+
+		Matrix4 operator*(const Matrix4& other) const;
+
+		/// <summary>
+		/// Transforms a point
+		/// </summary>
+		/// <param name="point">The point</param>
+		/// <returns>The transformed point</returns>
+		Vector3 TransformPoint(const Vector3& point) const;
+
+		/// <summary>
+		/// Gets the translation part of the transform
+		/// </summary>
+		/// <returns>The translation</returns>
+		Vector3 GetTranslation() const { return Vector3(Elements[12], Elements[13], Elements[14]); }
+
+		/// <summary>
+		/// The elements of the matrix. The element at a column and row is at [column * 4 + row]
+		/// </summary>
+		float Elements[16];
+
+		static const Matrix4 IDENTITY;
+	};
+}
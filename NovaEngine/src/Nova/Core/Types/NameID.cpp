@@ -0,0 +1,92 @@
+#include "NameID.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace Nova
+{
+	namespace
+	{
+		/// <summary>
+		/// Every interned string. Strings live in a deque so references to them stay valid as more are added, and the map's keys view them
+		/// </summary>
+		struct NameTable
+		{
+			NameTable()
+			{
+				Strings.emplace_back();
+				IDs.emplace(std::string_view(Strings.back()), 0);
+			}
+
+			std::shared_mutex Mutex;
+			std::deque<string> Strings;
+			std::unordered_map<std::string_view, uint32_t> IDs;
+		};
+
+		NameTable& GetNameTable()
+		{
+			static NameTable table;
+			return table;
+		}
+	}
+
+	NameID::NameID(std::string_view name)
+	{
+		// The empty name is always ID 0, which is common enough for unnamed nodes to skip the lock
+		if (name.empty())
+			return;
+
+		NameTable& table = GetNameTable();
+
+		{
+			std::shared_lock lock(table.Mutex);
+
+			auto it = table.IDs.find(name);
+
+			if (it != table.IDs.end())
+			{
+				m_Value = it->second;
+				return;
+			}
+		}
+
+		std::unique_lock lock(table.Mutex);
+
+		// Another thread may have interned it between the locks
+		auto it = table.IDs.find(name);
+
+		if (it != table.IDs.end())
+		{
+			m_Value = it->second;
+			return;
+		}
+
+		m_Value = (uint32_t)table.Strings.size();
+		table.Strings.emplace_back(name);
+		table.IDs.emplace(std::string_view(table.Strings.back()), m_Value);
+	}
+
+	bool NameID::TryFind(std::string_view name, NameID& id)
+	{
+		NameTable& table = GetNameTable();
+		std::shared_lock lock(table.Mutex);
+
+		auto it = table.IDs.find(name);
+
+		if (it == table.IDs.end())
+			return false;
+
+		id.m_Value = it->second;
+		return true;
+	}
+
+	const string& NameID::GetString() const
+	{
+		NameTable& table = GetNameTable();
+		std::shared_lock lock(table.Mutex);
+
+		return table.Strings[m_Value];
+	}
+}
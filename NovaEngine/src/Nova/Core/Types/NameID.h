@@ -0,0 +1,67 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "String.h"
+
+#include <functional>
+#include <stdint.h>
+#include <string_view>
+
+namespace Nova
+{
+	/// <summary>
+	/// An interned string. Each distinct string is stored once for the lifetime of the process, so names can be compared and hashed as integers.
+	/// Interning is thread safe
+	/// </summary>
+	class NovaAPI NameID
+	{
+	public:
+		/// <summary>
+		/// Creates the empty name
+		/// </summary>
+		NameID() = default;
+
+		/// <summary>
+		/// Interns a string
+		/// </summary>
+		/// <param name="name">The string</param>
+		explicit NameID(std::string_view name);
+
+	public:
+		/// <summary>
+		/// Finds the ID of a string without interning it. Never allocates
+		/// </summary>
+		/// <param name="name">The string</param>
+		/// <param name="id">Set to the string's ID if it has been interned</param>
+		/// <returns>True if the string has been interned</returns>
+		static bool TryFind(std::string_view name, NameID& id);
+
+		/// <summary>
+		/// Gets the interned string
+		/// </summary>
+		/// <returns>The string. The reference stays valid for the lifetime of the process</returns>
+		const string& GetString() const;
+
+		/// <summary>
+		/// Gets the integer value of this name
+		/// </summary>
+		/// <returns>The value, which is 0 for the empty name</returns>
+		uint32_t GetValue() const { return m_Value; }
+
+		bool operator==(const NameID& other) const { return m_Value == other.m_Value; }
+		bool operator!=(const NameID& other) const { return m_Value != other.m_Value; }
+		bool operator<(const NameID& other) const { return m_Value < other.m_Value; }
+
+	private:
+		/// <summary>
+		/// The index of the string in the name table
+		/// </summary>
+		uint32_t m_Value = 0;
+	};
+}
+
+template<>
+struct std::hash<Nova::NameID>
+{
+	size_t operator()(const Nova::NameID& name) const noexcept { return std::hash<uint32_t>()(name.GetValue()); }
+};
@@ -0,0 +1,32 @@
+#include "Quaternion.h"
+
+#include <cmath>
+
+namespace Nova
+{
+	Quaternion::Quaternion() :
+		Quaternion(0.0f, 0.0f, 0.0f, 1.0f)
+	{}
+
+	Quaternion::Quaternion(float x, float y, float z, float w) :
+		X(x), Y(y), Z(z), W(w)
+	{}
+
+	Quaternion Quaternion::FromAxisAngle(const Vector3& axis, float angle)
+	{
+		float halfSin = std::sin(angle * 0.5f);
+
+		return Quaternion(axis.X * halfSin, axis.Y * halfSin, axis.Z * halfSin, std::cos(angle * 0.5f));
+	}
+
+	Quaternion Quaternion::operator*(const Quaternion& other) const
+	{
+		return Quaternion(
+			W * other.X + X * other.W + Y * other.Z - Z * other.Y,
+			W * other.Y - X * other.Z + Y * other.W + Z * other.X,
+			W * other.Z + X * other.Y - Y * other.X + Z * other.W,
+			W * other.W - X * other.X - Y * other.Y - Z * other.Z);
+	}
+
+	const Quaternion Quaternion::IDENTITY = Quaternion();
+}
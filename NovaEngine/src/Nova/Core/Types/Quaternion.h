@@ -0,0 +1,36 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Vector.h"
+
+namespace Nova
+{
+	/// <summary>
+	/// A rotation in 3D space, stored as a unit quaternion
+	/// </summary>
+	struct NovaAPI Quaternion
+	{
+		/// <summary>
+		/// Creates the identity rotation
+		/// </summary>
+		Quaternion();
+		Quaternion(float x, float y, float z, float w);
+
+		/// <summary>
+		/// Creates a rotation around an axis
+		/// </summary>
+		/// <param name="axis">The axis to rotate around. Must be normalized</param>
+		/// <param name="angle">The angle to rotate by (in radians)</param>
+		/// <returns>The rotation</returns>
+		static Quaternion FromAxisAngle(const Vector3& axis, float angle);
+
+		/// <summary>
+		/// Combines two rotations. The right-hand rotation is applied first
+		/// </summary>
+		Quaternion operator*(const Quaternion& other) const;
+
+		float X, Y, Z, W;
+
+		static const Quaternion IDENTITY;
+	};
+}
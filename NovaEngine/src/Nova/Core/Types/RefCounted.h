@@ -62,6 +62,25 @@ namespace Nova
 			return obj;
 		}
 
+		/// <summary>
+		/// Creates a RefCounted object using an allocator for the object and its reference count
+		/// </summary>
+		/// <param name="allocator">The allocator to use</param>
+		/// <param name="...args">The arguments to pass to the class's constructor</param>
+		/// <returns>A reference to the created object</returns>
+		template <typename T, typename Alloc, typename ... Args>
+		static Ref<T> CreateWithAllocator(const Alloc& allocator, Args&& ... args)
+		{
+			static_assert(std::is_base_of<RefCounted, T>::value, "Only RefCounted objects can be created");
+
+			Ref<T> obj = std::allocate_shared<T>(allocator, std::forward<Args>(args)...);
+
+			Ref<RefCounted> objRef = static_pointer_cast<RefCounted>(obj);
+			objRef->Init();
+
+			return obj;
+		}
+
 	protected:
 		/// <summary>
 		/// Called when the RefCounted object has been constructed. It's safe to use GetSelfRef/GetSelfWeakRef now
@@ -102,4 +121,18 @@ namespace Nova
 
 		return RefCounted::Create<T>(std::forward<Args>(args)...);
 	}
+
+	/// <summary>
+	/// Creates a RefCounted object, allocating the object and its reference count with the given allocator
+	/// </summary>
+	/// <param name="allocator">The allocator to use</param>
+	/// <param name="...args">The arguments to pass to the class's constructor</param>
+	/// <returns>A reference to the created object</returns>
+	template<typename T, typename Alloc, typename ... Args>
+	Ref<T> AllocateRef(const Alloc& allocator, Args&& ... args)
+	{
+		static_assert(std::is_base_of<RefCounted, T>::value, "Only RefCounted objects can be created");
+
+		return RefCounted::CreateWithAllocator<T>(allocator, std::forward<Args>(args)...);
+	}
 }
\ No newline at end of file
@@ -29,4 +29,20 @@ namespace Nova
 	{
 		return this->X == lhs.X && this->Y == lhs.Y;
 	}
+
+	Vector3::Vector3() :
+		Vector3(0.0f, 0.0f, 0.0f)
+	{}
+
+	Vector3::Vector3(float x, float y, float z) :
+		X(x), Y(y), Z(z)
+	{}
+
+	const Vector3 Vector3::ZERO = Vector3(0.0f, 0.0f, 0.0f);
+	const Vector3 Vector3::ONE = Vector3(1.0f, 1.0f, 1.0f);
+
+	bool Vector3::operator==(const Vector3& other) const
+	{
+		return X == other.X && Y == other.Y && Z == other.Z;
+	}
 }
\ No newline at end of file
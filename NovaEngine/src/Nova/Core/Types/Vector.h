@@ -36,4 +36,20 @@ namespace Nova
 
 		bool operator==(const Vector2i& lhs) const;
 	};
+
+	/// <summary>
+	/// A three-dimensional vector with single-precision coordinates, used for 3D transforms
+	/// </summary>
+	struct NovaAPI Vector3
+	{
+		Vector3();
+		Vector3(float x, float y, float z);
+
+		float X, Y, Z;
+
+		static const Vector3 ZERO;
+		static const Vector3 ONE;
+
+		bool operator==(const Vector3& other) const;
+	};
 }
\ No newline at end of file
@@ -0,0 +1,51 @@
+// Windows implementation of the Clock's hardware reads
+
+#include "Nova/Core/Types/Clock.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+#include <intrin.h>
+
+namespace Nova
+{
+	uint64_t Clock::GetCycles()
+	{
+		return __rdtsc();
+	}
+
+	bool Clock::IsCycleCounterInvariant()
+	{
+		int cpuInfo[4];
+
+		// Make sure the extended leaf is supported before querying it
+		__cpuid(cpuInfo, 0x80000000);
+		if ((unsigned int)cpuInfo[0] < 0x80000007)
+			return false;
+
+		// EDX bit 8 reports an invariant TSC
+		__cpuid(cpuInfo, 0x80000007);
+		return (cpuInfo[3] & (1 << 8)) != 0;
+	}
+
+	uint64_t Clock::ReadPerformanceCounter()
+	{
+		// QPC reads the invariant TSC in user-mode on modern hardware, so this doesn't enter the kernel
+		LARGE_INTEGER counter;
+		QueryPerformanceCounter(&counter);
+
+		return (uint64_t)counter.QuadPart;
+	}
+
+	uint64_t Clock::ReadPerformanceCounterFrequency()
+	{
+		LARGE_INTEGER frequency;
+		QueryPerformanceFrequency(&frequency);
+
+		return (uint64_t)frequency.QuadPart;
+	}
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,137 @@
+// Windows implementation of topology detection, thread pinning and NUMA allocation
+
+#include "Nova/Core/Threading/CpuTopology.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+namespace Nova
+{
+	namespace
+	{
+		/// <summary>
+		/// Queries processor relationships of the given type
+		/// </summary>
+		List<uint8_t> QueryProcessorInformation(LOGICAL_PROCESSOR_RELATIONSHIP relationship)
+		{
+			DWORD length = 0;
+			GetLogicalProcessorInformationEx(relationship, nullptr, &length);
+
+			List<uint8_t> buffer(length);
+			if (length == 0 || !GetLogicalProcessorInformationEx(relationship, (PSYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX)buffer.data(), &length))
+				buffer.clear();
+
+			return buffer;
+		}
+
+		/// <summary>
+		/// Invokes a function for each relationship in a buffer returned by QueryProcessorInformation
+		/// </summary>
+		template<typename Func>
+		void ForEachRelationship(const List<uint8_t>& buffer, const Func& func)
+		{
+			size_t offset = 0;
+
+			while (offset < buffer.size())
+			{
+				auto info = (const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX*)(buffer.data() + offset);
+				func(*info);
+
+				offset += info->Size;
+			}
+		}
+	}
+
+	void CpuTopology::Detect()
+	{
+		uint32_t core = 0;
+
+		ForEachRelationship(QueryProcessorInformation(RelationProcessorCore), [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info)
+			{
+				for (WORD group = 0; group < info.Processor.GroupCount; group++)
+				{
+					const GROUP_AFFINITY& affinity = info.Processor.GroupMask[group];
+
+					for (uint8_t bit = 0; bit < sizeof(KAFFINITY) * 8; bit++)
+					{
+						if ((affinity.Mask & ((KAFFINITY)1 << bit)) == 0)
+							continue;
+
+						LogicalProcessor processor;
+						processor.Group = affinity.Group;
+						processor.GroupNumber = bit;
+						processor.Core = core;
+						processor.EfficiencyClass = info.Processor.EfficiencyClass;
+
+						m_Processors.push_back(processor);
+					}
+				}
+
+				core++;
+			});
+
+		ForEachRelationship(QueryProcessorInformation(RelationNumaNode), [&](const SYSTEM_LOGICAL_PROCESSOR_INFORMATION_EX& info)
+			{
+				const GROUP_AFFINITY& affinity = info.NumaNode.GroupMask;
+
+				for (LogicalProcessor& processor : m_Processors)
+				{
+					if (processor.Group == affinity.Group && (affinity.Mask & ((KAFFINITY)1 << processor.GroupNumber)) != 0)
+						processor.NumaNode = info.NumaNode.NodeNumber;
+				}
+			});
+	}
+
+	bool CpuTopology::PinCurrentThread(uint32_t processorIndex)
+	{
+		const List<LogicalProcessor>& processors = Get().GetProcessors();
+
+		if (processorIndex >= processors.size())
+			return false;
+
+		GROUP_AFFINITY affinity = {};
+		affinity.Group = processors[processorIndex].Group;
+		affinity.Mask = (KAFFINITY)1 << processors[processorIndex].GroupNumber;
+
+		return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+	}
+
+	bool CpuTopology::PinCurrentThreadToNode(uint32_t numaNode)
+	{
+		GROUP_AFFINITY affinity = {};
+
+		// A thread can only be pinned within one processor group, which is always the case for a node's mask
+		if (!GetNumaNodeProcessorMaskEx((USHORT)numaNode, &affinity) || affinity.Mask == 0)
+			return false;
+
+		return SetThreadGroupAffinity(GetCurrentThread(), &affinity, nullptr) != 0;
+	}
+
+	uint32_t CpuTopology::GetCurrentNumaNode()
+	{
+		PROCESSOR_NUMBER number;
+		GetCurrentProcessorNumberEx(&number);
+
+		USHORT node = 0;
+		if (!GetNumaProcessorNodeEx(&number, &node))
+			return 0;
+
+		return node;
+	}
+
+	void* CpuTopology::AllocateOnNode(size_t size, uint32_t numaNode)
+	{
+		return VirtualAllocExNuma(GetCurrentProcess(), nullptr, size, MEM_RESERVE | MEM_COMMIT, PAGE_READWRITE, numaNode);
+	}
+
+	void CpuTopology::FreeOnNode(void* memory, size_t size)
+	{
+		if (memory)
+			VirtualFree(memory, 0, MEM_RELEASE);
+	}
+}
+
+#endif
@@ -0,0 +1,56 @@
+// Windows implementation of fibers
+
+#include "Nova/Core/Threading/Fiber.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+namespace Nova
+{
+	const size_t Fiber::DefaultStackSize = 64 * 1024;
+
+	Fiber::Fiber(EntryFunction entry, void* userData, size_t stackSize) :
+		m_Entry(entry), m_UserData(userData)
+	{
+		auto start = [](LPVOID parameter)
+		{
+			Fiber* fiber = static_cast<Fiber*>(parameter);
+			fiber->m_Entry(fiber->m_UserData);
+		};
+
+		m_Handle = CreateFiber(stackSize, start, this);
+	}
+
+	Fiber::Fiber() :
+		m_IsThreadFiber(true)
+	{
+		m_Handle = ConvertThreadToFiber(nullptr);
+	}
+
+	Fiber::~Fiber()
+	{
+		if (m_IsThreadFiber)
+		{
+			ConvertFiberToThread();
+		}
+		else if (m_Handle)
+		{
+			DeleteFiber(m_Handle);
+		}
+	}
+
+	ManagedPtr<Fiber> Fiber::ConvertCurrentThread()
+	{
+		return ManagedPtr<Fiber>(new Fiber());
+	}
+
+	void Fiber::SwitchTo()
+	{
+		SwitchToFiber(m_Handle);
+	}
+}
+
+#endif
\ No newline at end of file
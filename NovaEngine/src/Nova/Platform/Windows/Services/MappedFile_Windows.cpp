@@ -0,0 +1,93 @@
+// Windows implementation of memory-mapped files
+
+#include "Nova/Services/FileIO/MappedFile.h"
+#include "Nova/Services/FileIO/FileIOExceptions.h"
+
+#ifdef PLATFORM_WINDOWS
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+#include <string>
+
+namespace Nova::FileIO
+{
+	static std::wstring ToWidePath(const string& path)
+	{
+		int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), (int)path.size(), nullptr, 0);
+
+		std::wstring widePath(length, L'\0');
+		MultiByteToWideChar(CP_UTF8, 0, path.c_str(), (int)path.size(), widePath.data(), length);
+
+		return widePath;
+	}
+
+	void MappedFile::Open(const string& path)
+	{
+		Close();
+
+		// Random access lets the OS skip read-ahead, as mapped data is rarely read front to back
+		HANDLE file = CreateFileW(ToWidePath(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+			throw MappedFileException(FormatString("Unable to open file \"{0}\": {1}", path, GetLastError()));
+
+		LARGE_INTEGER fileSize;
+
+		if (!GetFileSizeEx(file, &fileSize))
+		{
+			DWORD error = GetLastError();
+			CloseHandle(file);
+
+			throw MappedFileException(FormatString("Unable to get the size of file \"{0}\": {1}", path, error));
+		}
+
+		m_File = file;
+		m_Size = (size_t)fileSize.QuadPart;
+
+		// Empty files can't be mapped, but they're still open
+		if (m_Size == 0)
+			return;
+
+		HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+
+		if (!mapping)
+		{
+			DWORD error = GetLastError();
+			Close();
+
+			throw MappedFileException(FormatString("Unable to map file \"{0}\": {1}", path, error));
+		}
+
+		m_Mapping = mapping;
+		m_Data = static_cast<const uint8_t*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+		if (!m_Data)
+		{
+			DWORD error = GetLastError();
+			Close();
+
+			throw MappedFileException(FormatString("Unable to map a view of file \"{0}\": {1}", path, error));
+		}
+	}
+
+	void MappedFile::Close()
+	{
+		if (m_Data)
+			UnmapViewOfFile(m_Data);
+
+		if (m_Mapping)
+			CloseHandle(m_Mapping);
+
+		if (m_File)
+			CloseHandle(m_File);
+
+		m_File = nullptr;
+		m_Mapping = nullptr;
+		m_Data = nullptr;
+		m_Size = 0;
+	}
+}
+
+#endif
@@ -0,0 +1,269 @@
+#ifdef PLATFORM_WINDOWS
+
+#include "CompletionPortFileIOBackend.h"
+#include "Nova/Services/FileIO/FileIOExceptions.h"
+#include "Nova/Core/Types/String.h"
+
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <Windows.h>
+
+#include <algorithm>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// The completion key posted to wake the completion thread when shutting down
+	/// </summary>
+	static constexpr ULONG_PTR ShutdownKey = 1;
+
+	struct CompletionPortFileIOBackend::Operation
+	{
+		/// <summary>
+		/// The OS read state. Must stay at a stable address until the completion is dequeued
+		/// </summary>
+		OVERLAPPED Overlapped;
+
+		/// <summary>
+		/// The file being read
+		/// </summary>
+		HANDLE File;
+
+		/// <summary>
+		/// The read
+		/// </summary>
+		Ref<FileReadRequest> Request;
+	};
+
+	/// <summary>
+	/// Converts a UTF-8 path to the wide string Windows expects
+	/// </summary>
+	static std::wstring ToWidePath(const string& path)
+	{
+		int length = MultiByteToWideChar(CP_UTF8, 0, path.c_str(), (int)path.size(), nullptr, 0);
+
+		std::wstring widePath(length, L'\0');
+		MultiByteToWideChar(CP_UTF8, 0, path.c_str(), (int)path.size(), widePath.data(), length);
+
+		return widePath;
+	}
+
+	CompletionPortFileIOBackend::CompletionPortFileIOBackend(CompletionCallback onCompleted, size_t maxInFlight) :
+		FileIOBackend(std::move(onCompleted)),
+		m_MaxInFlight(std::max<size_t>(maxInFlight, 1))
+	{
+		// A single thread drains completions. The reads themselves are done by the OS
+		m_Port = CreateIoCompletionPort(INVALID_HANDLE_VALUE, nullptr, 0, 1);
+
+		if (!m_Port)
+			throw FileIOBackendInitException(FormatString("Unable to create IO completion port: {0}", GetLastError()));
+
+		m_CompletionThread = std::thread(&CompletionPortFileIOBackend::CompletionMain, this);
+	}
+
+	CompletionPortFileIOBackend::~CompletionPortFileIOBackend()
+	{
+		m_IsShuttingDown.store(true, std::memory_order_release);
+		m_Queue.Close();
+
+		for (const auto& request : m_Queue.TakeAll())
+		{
+			FinishRead(request, FileReadStatus::Cancelled);
+		}
+
+		{
+			std::lock_guard lock(m_InFlightMutex);
+
+			for (Operation* operation : m_InFlight)
+			{
+				CancelIoEx(operation->File, &operation->Overlapped);
+			}
+		}
+
+		// The completion thread exits once it has seen this and every read in flight has completed
+		PostQueuedCompletionStatus(m_Port, 0, ShutdownKey, nullptr);
+		m_CompletionThread.join();
+
+		CloseHandle(m_Port);
+	}
+
+	void CompletionPortFileIOBackend::Submit(const List<Ref<FileReadRequest>>& requests)
+	{
+		m_Queue.Push(requests);
+		IssueReads();
+	}
+
+	void CompletionPortFileIOBackend::Cancel(const Ref<FileReadRequest>& request)
+	{
+		if (m_Queue.Remove(request))
+		{
+			FinishRead(request, FileReadStatus::Cancelled);
+			return;
+		}
+
+		std::lock_guard lock(m_InFlightMutex);
+
+		if (Operation* operation = static_cast<Operation*>(GetBackendData(request)))
+			CancelIoEx(operation->File, &operation->Overlapped);
+	}
+
+	void CompletionPortFileIOBackend::IssueReads()
+	{
+		while (!m_IsShuttingDown.load(std::memory_order_acquire))
+		{
+			// Reserve a slot before taking a read, so concurrent submitters can't go over the limit
+			size_t inFlight = m_InFlightCount.load(std::memory_order_relaxed);
+
+			do
+			{
+				if (inFlight >= m_MaxInFlight)
+					return;
+			} while (!m_InFlightCount.compare_exchange_weak(inFlight, inFlight + 1, std::memory_order_acq_rel));
+
+			Ref<FileReadRequest> request;
+
+			if (!m_Queue.TryPop(request) || !StartRead(request))
+			{
+				m_InFlightCount.fetch_sub(1, std::memory_order_acq_rel);
+
+				if (!request)
+					return;
+			}
+		}
+	}
+
+	bool CompletionPortFileIOBackend::StartRead(const Ref<FileReadRequest>& request)
+	{
+		if (!BeginRead(request))
+			return false;
+
+		HANDLE file = CreateFileW(ToWidePath(request->GetPath()).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+			FILE_FLAG_OVERLAPPED | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+
+		if (file == INVALID_HANDLE_VALUE)
+		{
+			FinishRead(request, FileReadStatus::Failed, 0, FormatString("Unable to open file: {0}", GetLastError()));
+			return false;
+		}
+
+		LARGE_INTEGER fileSize;
+		const uint64_t offset = request->GetOffset();
+
+		if (!GetFileSizeEx(file, &fileSize) || offset > (uint64_t)fileSize.QuadPart)
+		{
+			CloseHandle(file);
+			FinishRead(request, FileReadStatus::Failed, 0, "The offset is past the end of the file");
+			return false;
+		}
+
+		// A single overlapped read transfers at most 4GB
+		uint64_t size = request->GetRequestedSize();
+		if (size == 0 || size > (uint64_t)fileSize.QuadPart - offset)
+			size = (uint64_t)fileSize.QuadPart - offset;
+
+		if (size > MAXDWORD)
+		{
+			CloseHandle(file);
+			FinishRead(request, FileReadStatus::Failed, 0, "Reads larger than 4GB must be split");
+			return false;
+		}
+
+		if (!CreateIoCompletionPort(file, m_Port, 0, 0))
+		{
+			CloseHandle(file);
+			FinishRead(request, FileReadStatus::Failed, 0, FormatString("Unable to associate file with completion port: {0}", GetLastError()));
+			return false;
+		}
+
+		uint8_t* buffer = PrepareBuffer(request, std::max<size_t>((size_t)size, 1));
+
+		Operation* operation = new Operation();
+		operation->Overlapped.Offset = (DWORD)(offset & 0xFFFFFFFF);
+		operation->Overlapped.OffsetHigh = (DWORD)(offset >> 32);
+		operation->File = file;
+		operation->Request = request;
+
+		{
+			std::lock_guard lock(m_InFlightMutex);
+
+			m_InFlight.insert(operation);
+			GetBackendData(request) = operation;
+		}
+
+		// Even reads that complete synchronously post a completion, so they are all finished on the completion thread
+		if (!ReadFile(file, buffer, (DWORD)size, nullptr, &operation->Overlapped))
+		{
+			DWORD error = GetLastError();
+
+			if (error != ERROR_IO_PENDING)
+			{
+				FinishOperation(operation, 0, error);
+				return false;
+			}
+		}
+
+		return true;
+	}
+
+	void CompletionPortFileIOBackend::FinishOperation(Operation* operation, size_t bytesRead, uint32_t error)
+	{
+		{
+			std::lock_guard lock(m_InFlightMutex);
+
+			m_InFlight.erase(operation);
+			GetBackendData(operation->Request) = nullptr;
+		}
+
+		CloseHandle(operation->File);
+
+		switch (error)
+		{
+		case ERROR_SUCCESS:
+		case ERROR_HANDLE_EOF:
+			FinishRead(operation->Request, FileReadStatus::Completed, bytesRead);
+			break;
+
+		case ERROR_OPERATION_ABORTED:
+			FinishRead(operation->Request, FileReadStatus::Cancelled);
+			break;
+
+		default:
+			FinishRead(operation->Request, FileReadStatus::Failed, 0, FormatString("Unable to read file: {0}", error));
+			break;
+		}
+
+		delete operation;
+	}
+
+	void CompletionPortFileIOBackend::CompletionMain()
+	{
+		bool isShutdownRequested = false;
+
+		while (!isShutdownRequested || m_InFlightCount.load(std::memory_order_acquire) > 0)
+		{
+			DWORD bytesRead = 0;
+			ULONG_PTR key = 0;
+			OVERLAPPED* overlapped = nullptr;
+
+			BOOL succeeded = GetQueuedCompletionStatus(m_Port, &bytesRead, &key, &overlapped, INFINITE);
+
+			if (!overlapped)
+			{
+				if (key == ShutdownKey)
+					isShutdownRequested = true;
+
+				continue;
+			}
+
+			Operation* operation = CONTAINING_RECORD(overlapped, Operation, Overlapped);
+
+			FinishOperation(operation, bytesRead, succeeded ? ERROR_SUCCESS : GetLastError());
+			m_InFlightCount.fetch_sub(1, std::memory_order_acq_rel);
+
+			// A slot opened up, so issue the next highest priority read
+			IssueReads();
+		}
+	}
+}
+
+#endif
@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Services/FileIO/FileIOBackend.h"
+#include "Nova/Services/FileIO/FileRequestQueue.h"
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// A FileIOBackend that issues overlapped reads and collects their results from an IO completion port (Windows only).
+	/// Many reads are kept in flight at once without a thread per read, and the queue decides which reads are issued next
+	/// </summary>
+	class NovaAPI CompletionPortFileIOBackend : public FileIOBackend
+	{
+	public:
+		/// <summary>
+		/// Creates the completion port and starts the completion thread
+		/// </summary>
+		/// <param name="onCompleted">Called whenever a read is done</param>
+		/// <param name="maxInFlight">The maximum number of reads issued to the OS at once. The rest wait in the queue by priority</param>
+		CompletionPortFileIOBackend(CompletionCallback onCompleted, size_t maxInFlight = 64);
+		~CompletionPortFileIOBackend();
+
+	public:
+		// FileIOBackend ----------
+		void Submit(const List<Ref<FileReadRequest>>& requests) override;
+		void Cancel(const Ref<FileReadRequest>& request) override;
+
+	private:
+		/// <summary>
+		/// An overlapped read that has been issued
+		/// </summary>
+		struct Operation;
+
+		/// <summary>
+		/// Issues queued reads until the in-flight limit is reached
+		/// </summary>
+		void IssueReads();
+
+		/// <summary>
+		/// Opens the file and issues an overlapped read
+		/// </summary>
+		/// <param name="request">The read</param>
+		/// <returns>True if the read is now in flight, false if it finished straight away</returns>
+		bool StartRead(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Finishes an issued read and releases its operation
+		/// </summary>
+		/// <param name="operation">The read</param>
+		/// <param name="bytesRead">The number of bytes transferred</param>
+		/// <param name="error">The OS error code, or 0 if the read succeeded</param>
+		void FinishOperation(Operation* operation, size_t bytesRead, uint32_t error);
+
+		/// <summary>
+		/// The entry point for the completion thread
+		/// </summary>
+		void CompletionMain();
+
+	private:
+		/// <summary>
+		/// Reads waiting to be issued
+		/// </summary>
+		FileRequestQueue m_Queue;
+
+		/// <summary>
+		/// The completion port handle
+		/// </summary>
+		void* m_Port = nullptr;
+
+		/// <summary>
+		/// The maximum number of reads issued to the OS at once
+		/// </summary>
+		const size_t m_MaxInFlight;
+
+		/// <summary>
+		/// The number of reads issued to the OS
+		/// </summary>
+		std::atomic<size_t> m_InFlightCount = 0;
+
+		/// <summary>
+		/// The reads issued to the OS, so they can be cancelled
+		/// </summary>
+		std::unordered_set<Operation*> m_InFlight;
+
+		/// <summary>
+		/// Guards the set of issued reads
+		/// </summary>
+		std::mutex m_InFlightMutex;
+
+		/// <summary>
+		/// Set once the backend is shutting down, so no more reads are issued
+		/// </summary>
+		std::atomic<bool> m_IsShuttingDown = false;
+
+		/// <summary>
+		/// The thread that waits on the completion port
+		/// </summary>
+		std::thread m_CompletionThread;
+	};
+}
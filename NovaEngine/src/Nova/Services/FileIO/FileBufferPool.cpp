@@ -0,0 +1,85 @@
+#include "FileBufferPool.h"
+
+namespace Nova::FileIO
+{
+	const size_t FileBufferPool::s_MinBufferSize = 4096;
+	const size_t FileBufferPool::s_SizeClassCount = 13;
+
+	FileBufferPool::FileBufferPool(size_t maxFreePerClass) :
+		m_FreeBuffers(s_SizeClassCount), m_MaxFreePerClass(maxFreePerClass)
+	{}
+
+	FileBufferPool::~FileBufferPool()
+	{
+		for (const auto& buffers : m_FreeBuffers)
+		{
+			for (uint8_t* buffer : buffers)
+			{
+				delete[] buffer;
+			}
+		}
+	}
+
+	uint8_t* FileBufferPool::Acquire(size_t size, size_t& capacity)
+	{
+		size_t sizeClass = GetSizeClass(size);
+
+		// Too big to pool
+		if (sizeClass >= s_SizeClassCount)
+		{
+			capacity = size;
+			return new uint8_t[size];
+		}
+
+		capacity = s_MinBufferSize << sizeClass;
+
+		{
+			std::lock_guard lock(m_Mutex);
+
+			List<uint8_t*>& buffers = m_FreeBuffers[sizeClass];
+			if (!buffers.empty())
+			{
+				uint8_t* buffer = buffers.back();
+				buffers.pop_back();
+
+				return buffer;
+			}
+		}
+
+		return new uint8_t[capacity];
+	}
+
+	void FileBufferPool::Release(uint8_t* buffer, size_t capacity)
+	{
+		if (!buffer)
+			return;
+
+		size_t sizeClass = GetSizeClass(capacity);
+
+		if (sizeClass < s_SizeClassCount && (s_MinBufferSize << sizeClass) == capacity)
+		{
+			std::lock_guard lock(m_Mutex);
+
+			List<uint8_t*>& buffers = m_FreeBuffers[sizeClass];
+			if (buffers.size() < m_MaxFreePerClass)
+			{
+				buffers.push_back(buffer);
+				return;
+			}
+		}
+
+		delete[] buffer;
+	}
+
+	size_t FileBufferPool::GetSizeClass(size_t size)
+	{
+		size_t sizeClass = 0;
+
+		while (sizeClass < s_SizeClassCount && (s_MinBufferSize << sizeClass) < size)
+		{
+			sizeClass++;
+		}
+
+		return sizeClass;
+	}
+}
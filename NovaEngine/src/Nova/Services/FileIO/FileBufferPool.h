@@ -0,0 +1,78 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/List.h"
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// Recycles read buffers so streaming doesn't hit the heap for every read. Buffers are grouped into power-of-two size classes
+	/// </summary>
+	class NovaAPI FileBufferPool : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates an empty pool
+		/// </summary>
+		/// <param name="maxFreePerClass">The maximum number of free buffers kept for each size class</param>
+		FileBufferPool(size_t maxFreePerClass = 8);
+
+		~FileBufferPool();
+
+	public:
+		/// <summary>
+		/// Gets a buffer that can hold at least the given number of bytes. Safe to call from any thread
+		/// </summary>
+		/// <param name="size">The number of bytes needed</param>
+		/// <param name="capacity">Set to the actual size of the buffer</param>
+		/// <returns>The buffer</returns>
+		uint8_t* Acquire(size_t size, size_t& capacity);
+
+		/// <summary>
+		/// Returns a buffer to the pool. Safe to call from any thread
+		/// </summary>
+		/// <param name="buffer">The buffer</param>
+		/// <param name="capacity">The capacity returned when the buffer was acquired</param>
+		void Release(uint8_t* buffer, size_t capacity);
+
+	private:
+		/// <summary>
+		/// Gets the size class for a number of bytes
+		/// </summary>
+		/// <param name="size">The number of bytes</param>
+		/// <returns>The index of the smallest class that fits</returns>
+		static size_t GetSizeClass(size_t size);
+
+	private:
+		/// <summary>
+		/// The smallest buffer the pool hands out
+		/// </summary>
+		static const size_t s_MinBufferSize;
+
+		/// <summary>
+		/// The number of size classes. Larger buffers are allocated directly
+		/// </summary>
+		static const size_t s_SizeClassCount;
+
+	private:
+		/// <summary>
+		/// Free buffers for each size class
+		/// </summary>
+		List<List<uint8_t*>> m_FreeBuffers;
+
+		/// <summary>
+		/// The maximum number of free buffers kept for each size class
+		/// </summary>
+		const size_t m_MaxFreePerClass;
+
+		/// <summary>
+		/// Guards the free lists
+		/// </summary>
+		std::mutex m_Mutex;
+	};
+}
@@ -0,0 +1,37 @@
+#include "FileIOBackend.h"
+
+namespace Nova::FileIO
+{
+	FileIOBackend::FileIOBackend(CompletionCallback onCompleted) :
+		m_OnCompleted(std::move(onCompleted))
+	{}
+
+	bool FileIOBackend::BeginRead(const Ref<FileReadRequest>& request)
+	{
+		if (request->IsCancelRequested())
+		{
+			FinishRead(request, FileReadStatus::Cancelled);
+			return false;
+		}
+
+		FileReadStatus expected = FileReadStatus::Pending;
+		return request->m_Status.compare_exchange_strong(expected, FileReadStatus::InProgress, std::memory_order_acq_rel);
+	}
+
+	void FileIOBackend::FinishRead(const Ref<FileReadRequest>& request, FileReadStatus status, size_t bytesRead, const string& error)
+	{
+		FileReadStatus current = request->m_Status.load(std::memory_order_acquire);
+
+		if (current >= FileReadStatus::Completed)
+			return;
+
+		// Results are written before the status is published, so readers that see a finished status also see the data
+		request->m_BytesRead = bytesRead;
+		request->m_Error = error;
+
+		if (!request->m_Status.compare_exchange_strong(current, status, std::memory_order_acq_rel))
+			return;
+
+		m_OnCompleted(request);
+	}
+}
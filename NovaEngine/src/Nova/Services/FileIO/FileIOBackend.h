@@ -0,0 +1,98 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/List.h"
+#include "FileReadRequest.h"
+
+#include <functional>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// Types of file IO APIs
+	/// </summary>
+	enum class FileIOAPI
+	{
+		// The fastest API available on this platform
+		Default = 0,
+
+		// Blocking reads on a pool of IO threads. Available everywhere
+		ThreadPool = 1,
+
+		// Overlapped reads completed through an IO completion port (Windows only)
+		CompletionPort = 2,
+	};
+
+	/// <summary>
+	/// Represents an API that performs file reads for a FileIOService
+	/// </summary>
+	class NovaAPI FileIOBackend
+	{
+	public:
+		/// <summary>
+		/// Called on an IO thread when a read has finished, failed or been cancelled
+		/// </summary>
+		using CompletionCallback = std::function<void(const Ref<FileReadRequest>&)>;
+
+	public:
+		/// <summary>
+		/// Creates a backend
+		/// </summary>
+		/// <param name="onCompleted">Called whenever a read is done</param>
+		FileIOBackend(CompletionCallback onCompleted);
+
+		virtual ~FileIOBackend() = default;
+
+	public:
+		/// <summary>
+		/// Queues a batch of reads. Safe to call from any thread
+		/// </summary>
+		/// <param name="requests">The reads to queue</param>
+		virtual void Submit(const List<Ref<FileReadRequest>>& requests) = 0;
+
+		/// <summary>
+		/// Cancels a read. Reads that are already finishing may still complete. Safe to call from any thread
+		/// </summary>
+		/// <param name="request">The read to cancel</param>
+		virtual void Cancel(const Ref<FileReadRequest>& request) = 0;
+
+	protected:
+		/// <summary>
+		/// Marks a read as issued
+		/// </summary>
+		/// <param name="request">The read</param>
+		/// <returns>False if the read was cancelled before it could be issued</returns>
+		bool BeginRead(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Gets the buffer to read into, taking one from the pool if the caller didn't provide one
+		/// </summary>
+		/// <param name="request">The read</param>
+		/// <param name="size">The number of bytes that will be read</param>
+		/// <returns>The buffer</returns>
+		static uint8_t* PrepareBuffer(const Ref<FileReadRequest>& request, size_t size) { return request->PrepareBuffer(size); }
+
+		/// <summary>
+		/// Gets the backend-specific data slot for a read
+		/// </summary>
+		/// <param name="request">The read</param>
+		/// <returns>The data slot</returns>
+		static void*& GetBackendData(const Ref<FileReadRequest>& request) { return request->m_BackendData; }
+
+		/// <summary>
+		/// Finishes a read and reports it. A read is only ever reported once
+		/// </summary>
+		/// <param name="request">The read</param>
+		/// <param name="status">The final status</param>
+		/// <param name="bytesRead">The number of bytes that were read</param>
+		/// <param name="error">Why the read failed (if it did)</param>
+		void FinishRead(const Ref<FileReadRequest>& request, FileReadStatus status, size_t bytesRead = 0, const string& error = "");
+
+	private:
+		/// <summary>
+		/// Called whenever a read is done
+		/// </summary>
+		CompletionCallback m_OnCompleted;
+	};
+}
@@ -0,0 +1,13 @@
+#include "FileIOExceptions.h"
+
+namespace Nova::FileIO
+{
+	FileIOBackendInitException::FileIOBackendInitException(const string& error) : Exception(error)
+	{}
+
+	FileReadException::FileReadException(const string& error) : Exception(error)
+	{}
+
+	MappedFileException::MappedFileException(const string& error) : Exception(error)
+	{}
+}
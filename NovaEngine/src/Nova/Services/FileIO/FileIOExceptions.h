@@ -0,0 +1,34 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Exception.h"
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// An exception for when a file IO backend couldn't be initialized
+	/// </summary>
+	class NovaAPI FileIOBackendInitException : public Exception
+	{
+	public:
+		FileIOBackendInitException(const string& error);
+	};
+
+	/// <summary>
+	/// An exception for when a read is queued with invalid parameters
+	/// </summary>
+	class NovaAPI FileReadException : public Exception
+	{
+	public:
+		FileReadException(const string& error);
+	};
+
+	/// <summary>
+	/// An exception for when a file couldn't be mapped into memory
+	/// </summary>
+	class NovaAPI MappedFileException : public Exception
+	{
+	public:
+		MappedFileException(const string& error);
+	};
+}
\ No newline at end of file
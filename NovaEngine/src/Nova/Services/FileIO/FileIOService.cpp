@@ -0,0 +1,140 @@
+#include "FileIOService.h"
+#include "FileIOExceptions.h"
+
+#include "Nova/Core/Services/EngineServiceExceptions.h"
+#include "Nova/Core/Engine/Engine.h"
+
+#include "ThreadPool/ThreadPoolFileIOBackend.h"
+#include "CompletionPort/CompletionPortFileIOBackend.h"
+
+namespace Nova::FileIO
+{
+	FileReadCompletedEvent::FileReadCompletedEvent(const Ref<FileReadRequest>& request) :
+		Request(request)
+	{}
+
+	FileIOService::FileIOService(FileIOAPI api, size_t threadCount) :
+		m_BufferPool(MakeRef<FileBufferPool>())
+	{
+		CreateBackend(api, threadCount);
+
+		m_TickListener = CreateTickListener(s_TickOrder, &FileIOService::Tick);
+		AddListenerToMainLoop(m_TickListener);
+
+		Engine::Get()->Log(LogLevel::Verbose, "FileIOService initialized");
+	}
+
+	FileIOService::~FileIOService()
+	{
+		RemoveListenerFromMainLoop(m_TickListener);
+
+		// Stops the IO threads. Anything still queued is cancelled
+		m_Backend.reset();
+
+		Engine::Get()->Log(LogLevel::Verbose, "FileIOService destroyed");
+	}
+
+	const int FileIOService::s_TickOrder = -950;
+
+	Ref<FileReadRequest> FileIOService::Read(const FileReadParams& params)
+	{
+		Ref<FileReadRequest> request = CreateRequest(params);
+		m_Backend->Submit({ request });
+
+		return request;
+	}
+
+	List<Ref<FileReadRequest>> FileIOService::ReadBatch(const List<FileReadParams>& params)
+	{
+		List<Ref<FileReadRequest>> requests;
+		requests.reserve(params.size());
+
+		for (const auto& readParams : params)
+		{
+			requests.push_back(CreateRequest(readParams));
+		}
+
+		m_Backend->Submit(requests);
+
+		return requests;
+	}
+
+	void FileIOService::Cancel(const Ref<FileReadRequest>& request)
+	{
+		if (request->IsDone())
+			return;
+
+		request->m_IsCancelRequested.store(true, std::memory_order_release);
+		m_Backend->Cancel(request);
+	}
+
+	void FileIOService::CreateBackend(FileIOAPI api, size_t threadCount)
+	{
+		if (api == FileIOAPI::Default)
+		{
+#ifdef PLATFORM_WINDOWS
+			api = FileIOAPI::CompletionPort;
+#else
+			api = FileIOAPI::ThreadPool;
+#endif
+		}
+
+		auto onCompleted = [this](const Ref<FileReadRequest>& request) { OnBackendReadCompleted(request); };
+
+#ifdef PLATFORM_WINDOWS
+		if (api == FileIOAPI::CompletionPort)
+		{
+			try
+			{
+				Engine::Get()->Log(LogLevel::Verbose, "Creating CompletionPortFileIOBackend");
+				m_Backend = MakeManagedPtr<CompletionPortFileIOBackend>(onCompleted);
+				m_API = api;
+
+				return;
+			}
+			catch (const FileIOBackendInitException& ex)
+			{
+				Engine::Get()->Log(LogLevel::Warning, "Falling back to ThreadPoolFileIOBackend: {0}", ex.what());
+				api = FileIOAPI::ThreadPool;
+			}
+		}
+#endif
+
+		switch (api)
+		{
+		case FileIOAPI::ThreadPool:
+			Engine::Get()->Log(LogLevel::Verbose, "Creating ThreadPoolFileIOBackend with {0} threads", threadCount);
+			m_Backend = MakeManagedPtr<ThreadPoolFileIOBackend>(onCompleted, threadCount);
+			break;
+
+		default:
+			throw EngineServiceInitException("Unsupported API");
+		}
+
+		m_API = api;
+	}
+
+	Ref<FileReadRequest> FileIOService::CreateRequest(const FileReadParams& params)
+	{
+		if (params.Buffer && params.Size == 0)
+			throw FileReadException(FormatString("Reading \"{0}\" into a caller-provided buffer requires a size", params.Path));
+
+		return MakeRef<FileReadRequest>(params, m_BufferPool);
+	}
+
+	void FileIOService::OnBackendReadCompleted(const Ref<FileReadRequest>& request)
+	{
+		m_CompletedReads.Push(request);
+	}
+
+	void FileIOService::Tick(double deltaTime)
+	{
+		Ref<FileReadRequest> request;
+
+		while (m_CompletedReads.Pop(request))
+		{
+			FileReadCompletedEvent e(request);
+			OnReadCompleted.Emit(e);
+		}
+	}
+}
@@ -0,0 +1,135 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Services/EngineService.h"
+#include "Nova/Core/Events/Event.h"
+#include "Nova/Core/Events/EventSource.h"
+#include "Nova/Core/Events/TickListener.h"
+#include "Nova/Core/Threading/MPSCQueue.h"
+#include "Nova/Core/Types/List.h"
+#include "FileIOBackend.h"
+#include "FileBufferPool.h"
+#include "FileReadRequest.h"
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// Event data for when a read has finished, failed or been cancelled
+	/// </summary>
+	struct NovaAPI FileReadCompletedEvent : public Event
+	{
+		FileReadCompletedEvent(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// The read that is done
+		/// </summary>
+		Ref<FileReadRequest> Request;
+	};
+
+	/// <summary>
+	/// A service that reads files asynchronously. Completions are reported on the main loop through OnReadCompleted
+	/// </summary>
+	class NovaAPI FileIOService : public EngineService
+	{
+	public:
+		/// <summary>
+		/// Creates the service
+		/// </summary>
+		/// <param name="api">The API to read with</param>
+		/// <param name="threadCount">The number of IO threads when reading with the thread pool</param>
+		FileIOService(FileIOAPI api = FileIOAPI::Default, size_t threadCount = 2);
+		~FileIOService();
+
+	public:
+		/// <summary>
+		/// Queues a read. Safe to call from any thread
+		/// </summary>
+		/// <param name="params">The read to queue</param>
+		/// <returns>The read</returns>
+		Ref<FileReadRequest> Read(const FileReadParams& params);
+
+		/// <summary>
+		/// Queues a batch of reads with a single submission. Safe to call from any thread
+		/// </summary>
+		/// <param name="params">The reads to queue</param>
+		/// <returns>The reads, in the same order as the parameters</returns>
+		List<Ref<FileReadRequest>> ReadBatch(const List<FileReadParams>& params);
+
+		/// <summary>
+		/// Cancels a read. A read that is already finishing may still complete. Safe to call from any thread
+		/// </summary>
+		/// <param name="request">The read to cancel</param>
+		void Cancel(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Gets the API being used to read files
+		/// </summary>
+		/// <returns>The file IO API</returns>
+		FileIOAPI GetAPI() const { return m_API; }
+
+	private:
+		/// <summary>
+		/// Creates a FileIOBackend for this service
+		/// </summary>
+		/// <param name="api">The api to use</param>
+		/// <param name="threadCount">The number of IO threads for the thread pool</param>
+		void CreateBackend(FileIOAPI api, size_t threadCount);
+
+		/// <summary>
+		/// Creates a read request, checking its parameters
+		/// </summary>
+		/// <param name="params">The read parameters</param>
+		/// <returns>The read</returns>
+		Ref<FileReadRequest> CreateRequest(const FileReadParams& params);
+
+		/// <summary>
+		/// Called by the backend on an IO thread when a read is done
+		/// </summary>
+		/// <param name="request">The read</param>
+		void OnBackendReadCompleted(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Reports completed reads
+		/// </summary>
+		/// <param name="deltaTime">The time since the last tick (in seconds)</param>
+		void Tick(double deltaTime);
+
+	public:
+		/// <summary>
+		/// Invoked on the main loop when a read has finished, failed or been cancelled
+		/// </summary>
+		EventSource<FileReadCompletedEvent> OnReadCompleted;
+
+	private:
+		/// <summary>
+		/// The tick order that completions are reported at. Early in the tick so data is available to the rest of the frame
+		/// </summary>
+		static const int s_TickOrder;
+
+	private:
+		/// <summary>
+		/// The API being used to read files
+		/// </summary>
+		FileIOAPI m_API;
+
+		/// <summary>
+		/// Buffers shared by reads that didn't provide their own
+		/// </summary>
+		Ref<FileBufferPool> m_BufferPool;
+
+		/// <summary>
+		/// Reads that are done but haven't been reported yet
+		/// </summary>
+		MPSCQueue<Ref<FileReadRequest>> m_CompletedReads;
+
+		/// <summary>
+		/// The file IO backend
+		/// </summary>
+		ManagedPtr<FileIOBackend> m_Backend;
+
+		/// <summary>
+		/// Our main tick listener
+		/// </summary>
+		Ref<TickListener> m_TickListener;
+	};
+}
@@ -0,0 +1,37 @@
+#include "FileReadRequest.h"
+
+namespace Nova::FileIO
+{
+	FileReadParams::FileReadParams(const string& path, uint64_t offset, size_t size) :
+		Path(path), Offset(offset), Size(size), Buffer(nullptr), Priority(0)
+	{}
+
+	std::atomic<uint64_t> FileReadRequest::s_NextSequence = 0;
+
+	FileReadRequest::FileReadRequest(const FileReadParams& params, const Ref<FileBufferPool>& bufferPool) :
+		m_Path(params.Path),
+		m_Offset(params.Offset),
+		m_RequestedSize(params.Size),
+		m_Priority(params.Priority),
+		m_Sequence(s_NextSequence.fetch_add(1, std::memory_order_relaxed)),
+		m_Data(static_cast<uint8_t*>(params.Buffer)),
+		m_BufferPool(bufferPool)
+	{}
+
+	FileReadRequest::~FileReadRequest()
+	{
+		if (m_IsPooledBuffer)
+			m_BufferPool->Release(m_Data, m_PooledCapacity);
+	}
+
+	uint8_t* FileReadRequest::PrepareBuffer(size_t size)
+	{
+		if (!m_Data)
+		{
+			m_Data = m_BufferPool->Acquire(size, m_PooledCapacity);
+			m_IsPooledBuffer = true;
+		}
+
+		return m_Data;
+	}
+}
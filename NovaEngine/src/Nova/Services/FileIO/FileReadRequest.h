@@ -0,0 +1,226 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/String.h"
+#include "FileBufferPool.h"
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// The state of a file read
+	/// </summary>
+	enum class FileReadStatus
+	{
+		// Waiting for a backend to start the read
+		Pending = 0,
+
+		// The read has been issued
+		InProgress = 1,
+
+		// The read finished. Fewer bytes than requested are read if the file ends first
+		Completed = 2,
+
+		// The read failed. See FileReadRequest::GetError
+		Failed = 3,
+
+		// The read was cancelled before it finished
+		Cancelled = 4,
+	};
+
+	/// <summary>
+	/// Describes a read to queue on a FileIOService
+	/// </summary>
+	struct NovaAPI FileReadParams
+	{
+		FileReadParams(const string& path, uint64_t offset = 0, size_t size = 0);
+
+		/// <summary>
+		/// The path of the file to read
+		/// </summary>
+		string Path;
+
+		/// <summary>
+		/// The offset in the file to start reading from
+		/// </summary>
+		uint64_t Offset;
+
+		/// <summary>
+		/// The number of bytes to read. If 0, reads to the end of the file
+		/// </summary>
+		size_t Size;
+
+		/// <summary>
+		/// The buffer to read into. If null, a pooled buffer is used. A caller-provided buffer must hold Size bytes and outlive the read
+		/// </summary>
+		void* Buffer;
+
+		/// <summary>
+		/// The priority of the read. Higher priority reads are issued first
+		/// </summary>
+		int Priority;
+	};
+
+	/// <summary>
+	/// An asynchronous read from a file. Query it once the service reports it as done
+	/// </summary>
+	class NovaAPI FileReadRequest : public RefCounted
+	{
+	public:
+		FileReadRequest(const FileReadParams& params, const Ref<FileBufferPool>& bufferPool);
+		~FileReadRequest();
+
+	public:
+		/// <summary>
+		/// Gets the path of the file being read
+		/// </summary>
+		/// <returns>The file path</returns>
+		const string& GetPath() const { return m_Path; }
+
+		/// <summary>
+		/// Gets the offset in the file the read starts at
+		/// </summary>
+		/// <returns>The file offset</returns>
+		uint64_t GetOffset() const { return m_Offset; }
+
+		/// <summary>
+		/// Gets the number of bytes that were requested
+		/// </summary>
+		/// <returns>The requested size, or 0 to read to the end of the file</returns>
+		size_t GetRequestedSize() const { return m_RequestedSize; }
+
+		/// <summary>
+		/// Gets the priority of the read
+		/// </summary>
+		/// <returns>The priority</returns>
+		int GetPriority() const { return m_Priority; }
+
+		/// <summary>
+		/// Gets the state of the read
+		/// </summary>
+		/// <returns>The read status</returns>
+		FileReadStatus GetStatus() const { return m_Status.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// Gets if the read has finished, failed or been cancelled
+		/// </summary>
+		/// <returns>True if the read is done</returns>
+		bool IsDone() const { return GetStatus() >= FileReadStatus::Completed; }
+
+		/// <summary>
+		/// Gets if cancellation has been requested
+		/// </summary>
+		/// <returns>True if the read should be cancelled</returns>
+		bool IsCancelRequested() const { return m_IsCancelRequested.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// Gets the data that was read. Only valid once the read has completed
+		/// </summary>
+		/// <returns>The data</returns>
+		const uint8_t* GetData() const { return m_Data; }
+
+		/// <summary>
+		/// Gets the number of bytes that were read
+		/// </summary>
+		/// <returns>The number of bytes read</returns>
+		size_t GetBytesRead() const { return m_BytesRead; }
+
+		/// <summary>
+		/// Gets why the read failed
+		/// </summary>
+		/// <returns>The error message, or an empty string if the read didn't fail</returns>
+		const string& GetError() const { return m_Error; }
+
+	private:
+		/// <summary>
+		/// Makes sure there's a buffer that can hold the given number of bytes, taking one from the pool if the caller didn't provide one
+		/// </summary>
+		/// <param name="size">The number of bytes to be read</param>
+		/// <returns>The buffer to read into</returns>
+		uint8_t* PrepareBuffer(size_t size);
+
+	private:
+		/// <summary>
+		/// The path of the file being read
+		/// </summary>
+		const string m_Path;
+
+		/// <summary>
+		/// The offset in the file the read starts at
+		/// </summary>
+		const uint64_t m_Offset;
+
+		/// <summary>
+		/// The number of bytes that were requested
+		/// </summary>
+		const size_t m_RequestedSize;
+
+		/// <summary>
+		/// The priority of the read
+		/// </summary>
+		const int m_Priority;
+
+		/// <summary>
+		/// The order the request was created in, so reads with the same priority are issued first-come first-served
+		/// </summary>
+		const uint64_t m_Sequence;
+
+		/// <summary>
+		/// The state of the read
+		/// </summary>
+		std::atomic<FileReadStatus> m_Status = FileReadStatus::Pending;
+
+		/// <summary>
+		/// Set once cancellation is requested
+		/// </summary>
+		std::atomic<bool> m_IsCancelRequested = false;
+
+		/// <summary>
+		/// The buffer the data is read into
+		/// </summary>
+		uint8_t* m_Data;
+
+		/// <summary>
+		/// True if the buffer came from the pool and must be returned to it
+		/// </summary>
+		bool m_IsPooledBuffer = false;
+
+		/// <summary>
+		/// The capacity of the pooled buffer
+		/// </summary>
+		size_t m_PooledCapacity = 0;
+
+		/// <summary>
+		/// The pool to take a buffer from if the caller didn't provide one
+		/// </summary>
+		Ref<FileBufferPool> m_BufferPool;
+
+		/// <summary>
+		/// The number of bytes that were read
+		/// </summary>
+		size_t m_BytesRead = 0;
+
+		/// <summary>
+		/// Why the read failed
+		/// </summary>
+		string m_Error;
+
+		/// <summary>
+		/// Backend-specific data for a read that is in flight
+		/// </summary>
+		void* m_BackendData = nullptr;
+
+		/// <summary>
+		/// The counter used to order requests
+		/// </summary>
+		static std::atomic<uint64_t> s_NextSequence;
+
+		friend class FileIOBackend;
+		friend class FileIOService;
+		friend class FileRequestQueue;
+	};
+}
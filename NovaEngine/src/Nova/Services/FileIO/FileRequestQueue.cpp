@@ -0,0 +1,112 @@
+#include "FileRequestQueue.h"
+
+#include <algorithm>
+
+namespace Nova::FileIO
+{
+	void FileRequestQueue::Push(const Ref<FileReadRequest>& request)
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+
+			m_Heap.push_back(request);
+			std::push_heap(m_Heap.begin(), m_Heap.end(), &FileRequestQueue::Compare);
+		}
+
+		m_Condition.notify_one();
+	}
+
+	void FileRequestQueue::Push(const List<Ref<FileReadRequest>>& requests)
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+
+			for (const auto& request : requests)
+			{
+				m_Heap.push_back(request);
+				std::push_heap(m_Heap.begin(), m_Heap.end(), &FileRequestQueue::Compare);
+			}
+		}
+
+		m_Condition.notify_all();
+	}
+
+	bool FileRequestQueue::TryPop(Ref<FileReadRequest>& request)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		if (m_Heap.empty())
+			return false;
+
+		request = PopTop();
+		return true;
+	}
+
+	bool FileRequestQueue::WaitPop(Ref<FileReadRequest>& request)
+	{
+		std::unique_lock lock(m_Mutex);
+
+		m_Condition.wait(lock, [this]() { return m_IsClosed || !m_Heap.empty(); });
+
+		if (m_IsClosed)
+			return false;
+
+		request = PopTop();
+		return true;
+	}
+
+	bool FileRequestQueue::Remove(const Ref<FileReadRequest>& request)
+	{
+		std::lock_guard lock(m_Mutex);
+
+		auto it = std::find(m_Heap.begin(), m_Heap.end(), request);
+
+		if (it == m_Heap.end())
+			return false;
+
+		// Cancellation is rare, so just rebuild the heap
+		m_Heap.erase(it);
+		std::make_heap(m_Heap.begin(), m_Heap.end(), &FileRequestQueue::Compare);
+
+		return true;
+	}
+
+	void FileRequestQueue::Close()
+	{
+		{
+			std::lock_guard lock(m_Mutex);
+			m_IsClosed = true;
+		}
+
+		m_Condition.notify_all();
+	}
+
+	List<Ref<FileReadRequest>> FileRequestQueue::TakeAll()
+	{
+		std::lock_guard lock(m_Mutex);
+
+		List<Ref<FileReadRequest>> requests;
+		requests.swap(m_Heap);
+
+		return requests;
+	}
+
+	bool FileRequestQueue::Compare(const Ref<FileReadRequest>& lhs, const Ref<FileReadRequest>& rhs)
+	{
+		// std heaps put the largest element on top, so "less" means lower priority or submitted later
+		if (lhs->m_Priority != rhs->m_Priority)
+			return lhs->m_Priority < rhs->m_Priority;
+
+		return lhs->m_Sequence > rhs->m_Sequence;
+	}
+
+	Ref<FileReadRequest> FileRequestQueue::PopTop()
+	{
+		std::pop_heap(m_Heap.begin(), m_Heap.end(), &FileRequestQueue::Compare);
+
+		Ref<FileReadRequest> request = std::move(m_Heap.back());
+		m_Heap.pop_back();
+
+		return request;
+	}
+}
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "FileReadRequest.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// A thread-safe queue of reads waiting to be issued, ordered by priority and then by submission order
+	/// </summary>
+	class NovaAPI FileRequestQueue
+	{
+	public:
+		/// <summary>
+		/// Queues a read
+		/// </summary>
+		/// <param name="request">The read to queue</param>
+		void Push(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Queues a batch of reads, waking all waiting threads once
+		/// </summary>
+		/// <param name="requests">The reads to queue</param>
+		void Push(const List<Ref<FileReadRequest>>& requests);
+
+		/// <summary>
+		/// Takes the highest priority read without waiting
+		/// </summary>
+		/// <param name="request">Set to the read</param>
+		/// <returns>True if a read was taken</returns>
+		bool TryPop(Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Waits for a read and takes the highest priority one
+		/// </summary>
+		/// <param name="request">Set to the read</param>
+		/// <returns>False if the queue was closed</returns>
+		bool WaitPop(Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Removes a read that hasn't been taken yet
+		/// </summary>
+		/// <param name="request">The read to remove</param>
+		/// <returns>True if the read was still queued</returns>
+		bool Remove(const Ref<FileReadRequest>& request);
+
+		/// <summary>
+		/// Wakes every waiting thread and makes WaitPop return false from now on
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// Removes and returns every queued read
+		/// </summary>
+		/// <returns>The reads that were queued</returns>
+		List<Ref<FileReadRequest>> TakeAll();
+
+	private:
+		/// <summary>
+		/// Heap comparator. The highest priority, earliest read ends up on top
+		/// </summary>
+		static bool Compare(const Ref<FileReadRequest>& lhs, const Ref<FileReadRequest>& rhs);
+
+		/// <summary>
+		/// Pops the top of the heap. The lock must be held
+		/// </summary>
+		Ref<FileReadRequest> PopTop();
+
+	private:
+		/// <summary>
+		/// The queued reads as a binary heap
+		/// </summary>
+		List<Ref<FileReadRequest>> m_Heap;
+
+		/// <summary>
+		/// Guards the heap
+		/// </summary>
+		std::mutex m_Mutex;
+
+		/// <summary>
+		/// Signalled when reads are queued or the queue is closed
+		/// </summary>
+		std::condition_variable m_Condition;
+
+		/// <summary>
+		/// True once the queue has been closed
+		/// </summary>
+		bool m_IsClosed = false;
+	};
+}
@@ -0,0 +1,38 @@
+#include "MappedFile.h"
+
+#include <utility>
+
+namespace Nova::FileIO
+{
+	MappedFile::MappedFile(const string& path)
+	{
+		Open(path);
+	}
+
+	MappedFile::~MappedFile()
+	{
+		Close();
+	}
+
+	MappedFile::MappedFile(MappedFile&& other) noexcept :
+		m_File(std::exchange(other.m_File, nullptr)),
+		m_Mapping(std::exchange(other.m_Mapping, nullptr)),
+		m_Data(std::exchange(other.m_Data, nullptr)),
+		m_Size(std::exchange(other.m_Size, 0))
+	{}
+
+	MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+	{
+		if (this != &other)
+		{
+			Close();
+
+			m_File = std::exchange(other.m_File, nullptr);
+			m_Mapping = std::exchange(other.m_Mapping, nullptr);
+			m_Data = std::exchange(other.m_Data, nullptr);
+			m_Size = std::exchange(other.m_Size, 0);
+		}
+
+		return *this;
+	}
+}
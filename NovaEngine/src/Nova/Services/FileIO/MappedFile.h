@@ -0,0 +1,88 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/String.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// A read-only view of a whole file mapped into memory. Pages are loaded by the OS as they're first touched, so opening is cheap no matter the
+	/// size of the file, and data can be used in place without copying it into a buffer
+	/// </summary>
+	class NovaAPI MappedFile
+	{
+	public:
+		/// <summary>
+		/// Creates a closed file
+		/// </summary>
+		MappedFile() = default;
+
+		/// <summary>
+		/// Maps a file. Throws a MappedFileException if the file can't be opened or mapped
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		MappedFile(const string& path);
+
+		~MappedFile();
+
+		MappedFile(const MappedFile&) = delete;
+		MappedFile& operator=(const MappedFile&) = delete;
+
+		MappedFile(MappedFile&& other) noexcept;
+		MappedFile& operator=(MappedFile&& other) noexcept;
+
+	public:
+		/// <summary>
+		/// Maps a file, closing the previous one. Throws a MappedFileException if the file can't be opened or mapped
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		void Open(const string& path);
+
+		/// <summary>
+		/// Unmaps the file. Pointers into its data are invalid afterwards
+		/// </summary>
+		void Close();
+
+		/// <summary>
+		/// Gets if a file is mapped
+		/// </summary>
+		/// <returns>True if a file is mapped</returns>
+		bool IsOpen() const { return m_File != nullptr; }
+
+		/// <summary>
+		/// Gets the contents of the file. The data is aligned to the OS's page size
+		/// </summary>
+		/// <returns>The file's data, or nullptr if no file is mapped or it's empty</returns>
+		const uint8_t* GetData() const { return m_Data; }
+
+		/// <summary>
+		/// Gets the size of the file
+		/// </summary>
+		/// <returns>The number of bytes in the file</returns>
+		size_t GetSize() const { return m_Size; }
+
+	private:
+		/// <summary>
+		/// The OS handle of the open file
+		/// </summary>
+		void* m_File = nullptr;
+
+		/// <summary>
+		/// The OS handle of the file's mapping. Empty files have no mapping
+		/// </summary>
+		void* m_Mapping = nullptr;
+
+		/// <summary>
+		/// The mapped contents of the file
+		/// </summary>
+		const uint8_t* m_Data = nullptr;
+
+		/// <summary>
+		/// The size of the file
+		/// </summary>
+		size_t m_Size = 0;
+	};
+}
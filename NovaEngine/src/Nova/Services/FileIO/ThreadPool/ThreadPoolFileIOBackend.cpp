@@ -0,0 +1,98 @@
+#include "ThreadPoolFileIOBackend.h"
+
+#include <algorithm>
+#include <fstream>
+
+namespace Nova::FileIO
+{
+	ThreadPoolFileIOBackend::ThreadPoolFileIOBackend(CompletionCallback onCompleted, size_t threadCount) :
+		FileIOBackend(std::move(onCompleted))
+	{
+		threadCount = std::max<size_t>(threadCount, 1);
+
+		for (size_t i = 0; i < threadCount; i++)
+		{
+			m_Threads.emplace_back(&ThreadPoolFileIOBackend::ThreadMain, this);
+		}
+	}
+
+	ThreadPoolFileIOBackend::~ThreadPoolFileIOBackend()
+	{
+		// Reads that are being performed finish, everything else is cancelled
+		m_Queue.Close();
+
+		for (std::thread& thread : m_Threads)
+		{
+			thread.join();
+		}
+
+		for (const auto& request : m_Queue.TakeAll())
+		{
+			FinishRead(request, FileReadStatus::Cancelled);
+		}
+	}
+
+	void ThreadPoolFileIOBackend::Submit(const List<Ref<FileReadRequest>>& requests)
+	{
+		m_Queue.Push(requests);
+	}
+
+	void ThreadPoolFileIOBackend::Cancel(const Ref<FileReadRequest>& request)
+	{
+		// A read that an IO thread already took sees the cancel flag before it starts, or finishes as normal
+		if (m_Queue.Remove(request))
+			FinishRead(request, FileReadStatus::Cancelled);
+	}
+
+	void ThreadPoolFileIOBackend::ThreadMain()
+	{
+		Ref<FileReadRequest> request;
+
+		while (m_Queue.WaitPop(request))
+		{
+			ProcessRead(request);
+			request.reset();
+		}
+	}
+
+	void ThreadPoolFileIOBackend::ProcessRead(const Ref<FileReadRequest>& request)
+	{
+		if (!BeginRead(request))
+			return;
+
+		std::ifstream file(request->GetPath(), std::ios::binary);
+
+		if (!file)
+		{
+			FinishRead(request, FileReadStatus::Failed, 0, "Unable to open file");
+			return;
+		}
+
+		file.seekg(0, std::ios::end);
+		const uint64_t fileSize = (uint64_t)file.tellg();
+		const uint64_t offset = request->GetOffset();
+
+		if (offset > fileSize)
+		{
+			FinishRead(request, FileReadStatus::Failed, 0, "The offset is past the end of the file");
+			return;
+		}
+
+		size_t size = request->GetRequestedSize();
+		if (size == 0 || size > fileSize - offset)
+			size = (size_t)(fileSize - offset);
+
+		uint8_t* buffer = PrepareBuffer(request, std::max<size_t>(size, 1));
+
+		file.seekg((std::streamoff)offset);
+		file.read(reinterpret_cast<char*>(buffer), (std::streamsize)size);
+
+		if (file.bad())
+		{
+			FinishRead(request, FileReadStatus::Failed, 0, "Unable to read file");
+			return;
+		}
+
+		FinishRead(request, FileReadStatus::Completed, (size_t)file.gcount());
+	}
+}
@@ -0,0 +1,53 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Services/FileIO/FileIOBackend.h"
+#include "Nova/Services/FileIO/FileRequestQueue.h"
+
+#include <thread>
+
+namespace Nova::FileIO
+{
+	/// <summary>
+	/// A portable FileIOBackend that performs blocking positioned reads on a pool of IO threads
+	/// </summary>
+	class NovaAPI ThreadPoolFileIOBackend : public FileIOBackend
+	{
+	public:
+		/// <summary>
+		/// Creates the backend and starts its IO threads
+		/// </summary>
+		/// <param name="onCompleted">Called whenever a read is done</param>
+		/// <param name="threadCount">The number of IO threads. Reads beyond this many wait in the queue by priority</param>
+		ThreadPoolFileIOBackend(CompletionCallback onCompleted, size_t threadCount = 2);
+		~ThreadPoolFileIOBackend();
+
+	public:
+		// FileIOBackend ----------
+		void Submit(const List<Ref<FileReadRequest>>& requests) override;
+		void Cancel(const Ref<FileReadRequest>& request) override;
+
+	private:
+		/// <summary>
+		/// The entry point for IO threads
+		/// </summary>
+		void ThreadMain();
+
+		/// <summary>
+		/// Performs a read on the calling thread
+		/// </summary>
+		/// <param name="request">The read</param>
+		void ProcessRead(const Ref<FileReadRequest>& request);
+
+	private:
+		/// <summary>
+		/// Reads waiting for a free IO thread
+		/// </summary>
+		FileRequestQueue m_Queue;
+
+		/// <summary>
+		/// The IO threads
+		/// </summary>
+		List<std::thread> m_Threads;
+	};
+}
@@ -0,0 +1,45 @@
+#include "ContinuationQueue.h"
+
+#include "Nova/Core/Engine/Engine.h"
+#include "Nova/Core/Types/Clock.h"
+
+namespace Nova::Jobs
+{
+	void ContinuationQueue::Post(JobFunction continuation)
+	{
+		m_PendingCount.fetch_add(1, std::memory_order_relaxed);
+		m_Continuations.Push(std::move(continuation));
+	}
+
+	size_t ContinuationQueue::Drain(TimeSpan budget)
+	{
+		const int64_t start = Clock::GetNanoseconds();
+		const int64_t budgetNanoseconds = budget.GetNanoseconds();
+
+		size_t count = 0;
+		JobFunction continuation;
+
+		while (m_Continuations.Pop(continuation))
+		{
+			m_PendingCount.fetch_sub(1, std::memory_order_relaxed);
+			count++;
+
+			try
+			{
+				continuation();
+			}
+			catch (...)
+			{
+				Exception ex = Exception::GetException();
+
+				if (Engine* engine = Engine::Get())
+					engine->Log(LogLevel::Error, "An unhandled {0} exception occurred while running a continuation: {1}", typeid(ex).name(), ex.what());
+			}
+
+			if (budgetNanoseconds > 0 && Clock::GetNanoseconds() - start >= budgetNanoseconds)
+				break;
+		}
+
+		return count;
+	}
+}
@@ -0,0 +1,56 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/DateTime.h"
+#include "Nova/Core/Threading/MPSCQueue.h"
+#include "Job.h"
+
+#include <atomic>
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// A queue of continuations that any thread can post to, drained by a single loop thread within a time budget.
+	/// Anything that doesn't fit in the budget is left for the next drain, so a burst of completed work can't stall a frame
+	/// </summary>
+	class NovaAPI ContinuationQueue
+	{
+	public:
+		ContinuationQueue() = default;
+
+		ContinuationQueue(const ContinuationQueue&) = delete;
+		ContinuationQueue& operator=(const ContinuationQueue&) = delete;
+
+	public:
+		/// <summary>
+		/// Queues a continuation. Safe to call from any thread
+		/// </summary>
+		/// <param name="continuation">The continuation to run</param>
+		void Post(JobFunction continuation);
+
+		/// <summary>
+		/// Runs queued continuations until the queue is empty or the budget has been spent. At least one continuation is always run so the queue makes progress.
+		/// Must only be called from the draining thread
+		/// </summary>
+		/// <param name="budget">The maximum time to spend. A budget of 0 runs everything</param>
+		/// <returns>The number of continuations that were run</returns>
+		size_t Drain(TimeSpan budget);
+
+		/// <summary>
+		/// Gets the approximate number of continuations waiting to run
+		/// </summary>
+		/// <returns>The number of queued continuations</returns>
+		size_t GetPendingCount() const { return m_PendingCount.load(std::memory_order_relaxed); }
+
+	private:
+		/// <summary>
+		/// The queued continuations
+		/// </summary>
+		MPSCQueue<JobFunction> m_Continuations;
+
+		/// <summary>
+		/// The number of queued continuations
+		/// </summary>
+		std::atomic<size_t> m_PendingCount = 0;
+	};
+}
@@ -0,0 +1,27 @@
+#include "FrameJob.h"
+
+namespace Nova::Jobs
+{
+	FrameJob::FrameJob(JobScheduler* scheduler, int order, FrameJobFunction function) :
+		m_Scheduler(scheduler), m_Order(order), m_Function(std::move(function))
+	{}
+
+	// RefCounted ----------
+	void FrameJob::Init()
+	{
+		m_TickListener = MakeRef<TickListener>(m_Order, GetSelfRef<FrameJob>(), &FrameJob::Tick);
+	}
+
+	// RefCounted ----------
+
+	void FrameJob::Tick(double deltaTime)
+	{
+		Ref<JobCounter> counter = m_Scheduler->Run([this, deltaTime]()
+			{
+				m_Function(deltaTime);
+			});
+
+		// The loop thread helps out with the frame's jobs until they're done
+		m_Scheduler->Wait(counter);
+	}
+}
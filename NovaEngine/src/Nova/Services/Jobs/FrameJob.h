@@ -0,0 +1,70 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Events/TickListener.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "JobScheduler.h"
+
+#include <functional>
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// The function a frame job runs each tick
+	/// </summary>
+	using FrameJobFunction = std::function<void(double deltaTime)>;
+
+	/// <summary>
+	/// Runs a root job on a scheduler every time its loop ticks, and holds the tick until the job and everything it waits on has finished.
+	/// The root job can run child jobs and wait for them, so a frame can be written as a graph of fiber jobs
+	/// </summary>
+	class NovaAPI FrameJob : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a frame job. Use JobService::AddFrameJob to attach it to a loop
+		/// </summary>
+		/// <param name="scheduler">The scheduler to run the job on</param>
+		/// <param name="order">The tick order for the job</param>
+		/// <param name="function">The function to run each tick</param>
+		FrameJob(JobScheduler* scheduler, int order, FrameJobFunction function);
+
+	protected:
+		virtual void Init() override;
+
+	public:
+		/// <summary>
+		/// Gets the listener that ticks this frame job
+		/// </summary>
+		/// <returns>The frame job's TickListener</returns>
+		const Ref<TickListener>& GetTickListener() const { return m_TickListener; }
+
+	private:
+		/// <summary>
+		/// Runs the root job and waits for it to finish
+		/// </summary>
+		/// <param name="deltaTime">The time since the last tick (in seconds)</param>
+		void Tick(double deltaTime);
+
+	private:
+		/// <summary>
+		/// The scheduler that runs the job
+		/// </summary>
+		JobScheduler* m_Scheduler;
+
+		/// <summary>
+		/// The tick order for the job
+		/// </summary>
+		int m_Order;
+
+		/// <summary>
+		/// The function to run each tick
+		/// </summary>
+		FrameJobFunction m_Function;
+
+		/// <summary>
+		/// The listener that ticks this frame job
+		/// </summary>
+		Ref<TickListener> m_TickListener;
+	};
+}
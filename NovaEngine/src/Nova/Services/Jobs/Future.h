@@ -0,0 +1,399 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/List.h"
+#include "JobScheduler.h"
+#include "ContinuationQueue.h"
+#include "JobExceptions.h"
+
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <type_traits>
+#include <variant>
+
+namespace Nova::Jobs
+{
+	template<typename T>
+	class Future;
+
+	template<typename T>
+	class Promise;
+
+	namespace Detail
+	{
+		/// <summary>
+		/// The type a future stores its value as. Futures of void store an empty value
+		/// </summary>
+		template<typename T>
+		struct FutureStorage { using Type = T; };
+
+		template<>
+		struct FutureStorage<void> { using Type = std::monostate; };
+
+		/// <summary>
+		/// The type returned by a continuation for a future of T
+		/// </summary>
+		template<typename T, typename Func>
+		struct ContinuationResult { using Type = std::invoke_result_t<Func&, const T&>; };
+
+		template<typename Func>
+		struct ContinuationResult<void, Func> { using Type = std::invoke_result_t<Func&>; };
+
+		/// <summary>
+		/// The state shared between a promise and its futures
+		/// </summary>
+		template<typename T>
+		class FutureState : public RefCounted
+		{
+		public:
+			/// <summary>
+			/// A function run once the state is ready
+			/// </summary>
+			using Continuation = std::function<void(const Ref<FutureState<T>>&)>;
+
+		public:
+			/// <summary>
+			/// Stores the value and runs all continuations
+			/// </summary>
+			template<typename ... Args>
+			void SetValue(Args&& ... args)
+			{
+				Complete([&]() { Value.emplace(std::forward<Args>(args)...); });
+			}
+
+			/// <summary>
+			/// Stores an exception and runs all continuations
+			/// </summary>
+			void SetException(std::exception_ptr exception)
+			{
+				Complete([&]() { Exception = exception; });
+			}
+
+			/// <summary>
+			/// Runs a continuation once the state is ready, or right away if it already is
+			/// </summary>
+			void AddContinuation(Continuation continuation)
+			{
+				{
+					std::lock_guard lock(Mutex);
+
+					if (!IsReady.load(std::memory_order_relaxed))
+					{
+						Continuations.push_back(std::move(continuation));
+						return;
+					}
+				}
+
+				continuation(GetSelfRef<FutureState<T>>());
+			}
+
+		private:
+			/// <summary>
+			/// Marks the state as ready and runs the continuations outside of the lock
+			/// </summary>
+			template<typename Setter>
+			void Complete(const Setter& setter)
+			{
+				List<Continuation> continuations;
+
+				{
+					std::lock_guard lock(Mutex);
+
+					if (IsReady.load(std::memory_order_relaxed))
+						throw FutureException("The promise has already been fulfilled");
+
+					setter();
+					IsReady.store(true, std::memory_order_release);
+
+					continuations.swap(Continuations);
+				}
+
+				// Continuations are handed a reference instead of capturing one, so an unfulfilled promise doesn't keep itself alive
+				Ref<FutureState<T>> self = GetSelfRef<FutureState<T>>();
+
+				for (const Continuation& continuation : continuations)
+				{
+					continuation(self);
+				}
+			}
+
+		public:
+			/// <summary>
+			/// Guards the value and continuations
+			/// </summary>
+			std::mutex Mutex;
+
+			/// <summary>
+			/// True once a value or exception has been set
+			/// </summary>
+			std::atomic<bool> IsReady = false;
+
+			/// <summary>
+			/// The value, once set
+			/// </summary>
+			std::optional<typename FutureStorage<T>::Type> Value;
+
+			/// <summary>
+			/// The exception, if the work failed
+			/// </summary>
+			std::exception_ptr Exception;
+
+			/// <summary>
+			/// Functions to run once the state is ready
+			/// </summary>
+			List<Continuation> Continuations;
+		};
+
+		/// <summary>
+		/// Calls a function and fulfils a promise with its result or exception
+		/// </summary>
+		template<typename R, typename Func>
+		void Fulfil(Promise<R>& promise, Func& func)
+		{
+			try
+			{
+				if constexpr (std::is_void_v<R>)
+				{
+					func();
+					promise.SetValue();
+				}
+				else
+				{
+					promise.SetValue(func());
+				}
+			}
+			catch (...)
+			{
+				promise.SetException(std::current_exception());
+			}
+		}
+
+		/// <summary>
+		/// Runs a continuation with a ready state's value, forwarding the state's exception instead if it has one
+		/// </summary>
+		template<typename T, typename R, typename Func>
+		void RunContinuation(const FutureState<T>& state, Promise<R>& promise, Func& func)
+		{
+			if (state.Exception)
+			{
+				promise.SetException(state.Exception);
+				return;
+			}
+
+			auto invoke = [&]() -> R
+			{
+				if constexpr (std::is_void_v<T>)
+					return func();
+				else
+					return func(*state.Value);
+			};
+
+			Fulfil(promise, invoke);
+		}
+	}
+
+	/// <summary>
+	/// The result of asynchronous work. Continuations attached with Then run once the result is ready, either inline, on a JobScheduler, or on a ContinuationQueue
+	/// such as the main thread's
+	/// </summary>
+	template<typename T>
+	class Future
+	{
+	public:
+		/// <summary>
+		/// Creates an invalid future that isn't attached to a promise
+		/// </summary>
+		Future() = default;
+
+	private:
+		explicit Future(const Ref<Detail::FutureState<T>>& state) :
+			m_State(state)
+		{}
+
+	public:
+		/// <summary>
+		/// Gets if this future is attached to a promise
+		/// </summary>
+		/// <returns>True if the future is valid</returns>
+		bool IsValid() const { return m_State != nullptr; }
+
+		/// <summary>
+		/// Gets if the result is available
+		/// </summary>
+		/// <returns>True if the promise has been fulfilled</returns>
+		bool IsReady() const { return m_State && m_State->IsReady.load(std::memory_order_acquire); }
+
+		/// <summary>
+		/// Gets if the work failed with an exception
+		/// </summary>
+		/// <returns>True if the result is an exception</returns>
+		bool HasException() const { return IsReady() && m_State->Exception != nullptr; }
+
+		/// <summary>
+		/// Gets the result. Rethrows the exception if the work failed
+		/// </summary>
+		/// <returns>The value (if any)</returns>
+		decltype(auto) GetValue() const
+		{
+			if (!IsReady())
+				throw FutureException("The future isn't ready yet");
+
+			if (m_State->Exception)
+				std::rethrow_exception(m_State->Exception);
+
+			if constexpr (std::is_void_v<T>)
+				return;
+			else
+				return (*m_State->Value);
+		}
+
+		/// <summary>
+		/// Runs a function with the result on whichever thread fulfils the promise (or right away if it already has been)
+		/// </summary>
+		/// <param name="func">The function to run, taking the value (if any)</param>
+		/// <returns>A future for the function's result</returns>
+		template<typename Func>
+		auto Then(Func func)
+		{
+			return ThenWith([](JobFunction continuation) { continuation(); }, std::move(func));
+		}
+
+		/// <summary>
+		/// Runs a function with the result as a job once the promise is fulfilled
+		/// </summary>
+		/// <param name="scheduler">The scheduler to run the function on</param>
+		/// <param name="func">The function to run, taking the value (if any)</param>
+		/// <returns>A future for the function's result</returns>
+		template<typename Func>
+		auto Then(JobScheduler& scheduler, Func func)
+		{
+			JobScheduler* schedulerPtr = &scheduler;
+			return ThenWith([schedulerPtr](JobFunction continuation) { schedulerPtr->Run(std::move(continuation)); }, std::move(func));
+		}
+
+		/// <summary>
+		/// Runs a function with the result on the thread that drains the given queue once the promise is fulfilled
+		/// </summary>
+		/// <param name="queue">The queue to post the function to, such as JobService::GetMainThreadQueue</param>
+		/// <param name="func">The function to run, taking the value (if any)</param>
+		/// <returns>A future for the function's result</returns>
+		template<typename Func>
+		auto Then(ContinuationQueue& queue, Func func)
+		{
+			ContinuationQueue* queuePtr = &queue;
+			return ThenWith([queuePtr](JobFunction continuation) { queuePtr->Post(std::move(continuation)); }, std::move(func));
+		}
+
+	private:
+		/// <summary>
+		/// Attaches a continuation that is handed to the dispatch function once the promise is fulfilled
+		/// </summary>
+		template<typename Dispatch, typename Func>
+		auto ThenWith(Dispatch dispatch, Func func)
+		{
+			using Result = typename Detail::ContinuationResult<T, Func>::Type;
+
+			if (!m_State)
+				throw FutureException("Can't continue an invalid future");
+
+			Promise<Result> promise;
+			Future<Result> future = promise.GetFuture();
+
+			m_State->AddContinuation([dispatch, promise, func](const Ref<Detail::FutureState<T>>& state) mutable
+				{
+					dispatch([state, promise, func]() mutable
+						{
+							Detail::RunContinuation(*state, promise, func);
+						});
+				});
+
+			return future;
+		}
+
+	private:
+		/// <summary>
+		/// The state shared with the promise
+		/// </summary>
+		Ref<Detail::FutureState<T>> m_State;
+
+		friend class Promise<T>;
+	};
+
+	/// <summary>
+	/// The producing side of a Future. Fulfil it exactly once with SetValue or SetException. Safe to fulfil from any thread
+	/// </summary>
+	template<typename T>
+	class Promise
+	{
+	public:
+		Promise() :
+			m_State(MakeRef<Detail::FutureState<T>>())
+		{}
+
+	public:
+		/// <summary>
+		/// Gets a future for this promise's result
+		/// </summary>
+		/// <returns>The future</returns>
+		Future<T> GetFuture() const { return Future<T>(m_State); }
+
+		/// <summary>
+		/// Fulfils the promise with a value and runs its continuations
+		/// </summary>
+		/// <param name="value">The value (omitted for promises of void)</param>
+		template<typename ... Args>
+		void SetValue(Args&& ... value) { m_State->SetValue(std::forward<Args>(value)...); }
+
+		/// <summary>
+		/// Fulfils the promise with an exception and runs its continuations
+		/// </summary>
+		/// <param name="exception">The exception</param>
+		void SetException(std::exception_ptr exception) { m_State->SetException(exception); }
+
+	private:
+		/// <summary>
+		/// The state shared with futures
+		/// </summary>
+		Ref<Detail::FutureState<T>> m_State;
+	};
+
+	/// <summary>
+	/// Runs a function as a job and returns a future for its result
+	/// </summary>
+	/// <param name="scheduler">The scheduler to run the function on</param>
+	/// <param name="func">The function to run</param>
+	/// <returns>A future for the function's result</returns>
+	template<typename Func>
+	auto RunAsync(JobScheduler& scheduler, Func func)
+	{
+		using Result = std::invoke_result_t<Func&>;
+
+		Promise<Result> promise;
+		Future<Result> future = promise.GetFuture();
+
+		scheduler.Run([promise, func]() mutable
+			{
+				Detail::Fulfil(promise, func);
+			});
+
+		return future;
+	}
+
+	/// <summary>
+	/// Creates a future that is already fulfilled with a value
+	/// </summary>
+	/// <param name="value">The value</param>
+	/// <returns>A ready future</returns>
+	template<typename T>
+	Future<std::decay_t<T>> MakeReadyFuture(T&& value)
+	{
+		Promise<std::decay_t<T>> promise;
+		promise.SetValue(std::forward<T>(value));
+
+		return promise.GetFuture();
+	}
+}
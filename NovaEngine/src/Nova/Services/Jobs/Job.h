@@ -0,0 +1,64 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Threading/Fiber.h"
+
+#include <functional>
+
+namespace Nova::Jobs
+{
+	class JobCounter;
+	class JobScheduler;
+
+	/// <summary>
+	/// The function a job runs
+	/// </summary>
+	using JobFunction = std::function<void()>;
+
+	/// <summary>
+	/// A unit of work that is queued on a JobScheduler
+	/// </summary>
+	struct NovaAPI Job
+	{
+		Job(JobFunction function, const Ref<JobCounter>& counter, bool isOwnedByScheduler = true) :
+			Function(std::move(function)), Counter(counter), IsOwnedByScheduler(isOwnedByScheduler)
+		{}
+
+		/// <summary>
+		/// The function to run
+		/// </summary>
+		JobFunction Function;
+
+		/// <summary>
+		/// The counter to decrement once this job has finished (if any)
+		/// </summary>
+		Ref<JobCounter> Counter;
+
+		/// <summary>
+		/// If true, the scheduler deletes this job once it has run. Otherwise the caller owns it and can queue it again once it has finished
+		/// </summary>
+		bool IsOwnedByScheduler;
+	};
+
+	/// <summary>
+	/// A fiber that jobs run on. A job that waits for a counter suspends its fiber so the worker can run other jobs in the meantime
+	/// </summary>
+	struct NovaAPI JobFiber
+	{
+		/// <summary>
+		/// The fiber's execution context
+		/// </summary>
+		ManagedPtr<Fiber> Context;
+
+		/// <summary>
+		/// The job this fiber is running
+		/// </summary>
+		Job* CurrentJob = nullptr;
+
+		/// <summary>
+		/// The scheduler that owns this fiber
+		/// </summary>
+		JobScheduler* Scheduler = nullptr;
+	};
+}
\ No newline at end of file
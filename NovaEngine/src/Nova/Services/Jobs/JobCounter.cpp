@@ -0,0 +1,57 @@
+#include "JobCounter.h"
+
+namespace Nova::Jobs
+{
+	JobCounter::JobCounter(int value) :
+		m_Value(value)
+	{}
+
+	JobCounter::~JobCounter()
+	{
+		// Continuations that never got to run are owned by us
+		for (Job* job : m_Continuations)
+		{
+			delete job;
+		}
+	}
+
+	void JobCounter::Add(int amount)
+	{
+		m_Value.Add(amount);
+	}
+
+	bool JobCounter::Decrement()
+	{
+		return m_Value.Decrement() == 0;
+	}
+
+	bool JobCounter::AddContinuation(Job* job)
+	{
+		std::lock_guard lock(m_WaitersMutex);
+
+		if (IsComplete())
+			return false;
+
+		m_Continuations.push_back(job);
+		return true;
+	}
+
+	bool JobCounter::AddWaitingFiber(JobFiber* fiber)
+	{
+		std::lock_guard lock(m_WaitersMutex);
+
+		if (IsComplete())
+			return false;
+
+		m_WaitingFibers.push_back(fiber);
+		return true;
+	}
+
+	void JobCounter::TakeWaiters(List<Job*>& continuations, List<JobFiber*>& waitingFibers)
+	{
+		std::lock_guard lock(m_WaitersMutex);
+
+		continuations.swap(m_Continuations);
+		waitingFibers.swap(m_WaitingFibers);
+	}
+}
\ No newline at end of file
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/Counters.h"
+#include "Nova/Core/Types/List.h"
+#include "Job.h"
+
+#include <mutex>
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// Counts the number of unfinished jobs that were run with it. Continuations and fibers waiting on the counter are queued once it reaches 0
+	/// </summary>
+	class NovaAPI JobCounter : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates a counter with the given starting value
+		/// </summary>
+		/// <param name="value">The starting number of unfinished jobs</param>
+		JobCounter(int value = 0);
+
+		~JobCounter();
+
+	public:
+		/// <summary>
+		/// Gets the number of unfinished jobs for this counter
+		/// </summary>
+		/// <returns>The number of unfinished jobs</returns>
+		int GetValue() const { return m_Value.Get(); }
+
+		/// <summary>
+		/// Gets if all jobs for this counter have finished
+		/// </summary>
+		/// <returns>True if all jobs have finished</returns>
+		bool IsComplete() const { return GetValue() <= 0; }
+
+	private:
+		/// <summary>
+		/// Adds unfinished jobs to this counter
+		/// </summary>
+		/// <param name="amount">The number of jobs to add</param>
+		void Add(int amount);
+
+		/// <summary>
+		/// Marks a job as finished
+		/// </summary>
+		/// <returns>True if this was the last unfinished job</returns>
+		bool Decrement();
+
+		/// <summary>
+		/// Attaches a job to run once this counter reaches 0
+		/// </summary>
+		/// <param name="job">The job to run</param>
+		/// <returns>False if the counter has already reached 0, in which case the job should be run right away</returns>
+		bool AddContinuation(Job* job);
+
+		/// <summary>
+		/// Suspends a fiber until this counter reaches 0
+		/// </summary>
+		/// <param name="fiber">The fiber that is waiting</param>
+		/// <returns>False if the counter has already reached 0, in which case the fiber should be resumed right away</returns>
+		bool AddWaitingFiber(JobFiber* fiber);
+
+		/// <summary>
+		/// Removes and returns all continuations and waiting fibers attached to this counter
+		/// </summary>
+		/// <param name="continuations">Filled with the continuations to run</param>
+		/// <param name="waitingFibers">Filled with the fibers to resume</param>
+		void TakeWaiters(List<Job*>& continuations, List<JobFiber*>& waitingFibers);
+
+	private:
+		/// <summary>
+		/// The number of unfinished jobs
+		/// </summary>
+		AtomicCounter<int> m_Value;
+
+		/// <summary>
+		/// Guards the lists of continuations and waiting fibers
+		/// </summary>
+		std::mutex m_WaitersMutex;
+
+		/// <summary>
+		/// Jobs to queue once this counter reaches 0
+		/// </summary>
+		List<Job*> m_Continuations;
+
+		/// <summary>
+		/// Fibers to resume once this counter reaches 0
+		/// </summary>
+		List<JobFiber*> m_WaitingFibers;
+
+		friend class JobScheduler;
+	};
+}
\ No newline at end of file
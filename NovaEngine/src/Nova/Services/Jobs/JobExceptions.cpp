@@ -0,0 +1,10 @@
+#include "JobExceptions.h"
+
+namespace Nova::Jobs
+{
+	TaskGraphException::TaskGraphException(const string& error) : Exception(error)
+	{}
+
+	FutureException::FutureException(const string& error) : Exception(error)
+	{}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/Exception.h"
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// An exception for when a task graph is built incorrectly, such as a cycle between tasks
+	/// </summary>
+	class NovaAPI TaskGraphException : public Exception
+	{
+	public:
+		TaskGraphException(const string& error);
+	};
+
+	/// <summary>
+	/// An exception for when a future or promise is used incorrectly, such as reading a future that isn't ready
+	/// </summary>
+	class NovaAPI FutureException : public Exception
+	{
+	public:
+		FutureException(const string& error);
+	};
+}
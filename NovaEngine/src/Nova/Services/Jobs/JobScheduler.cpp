@@ -0,0 +1,568 @@
+#include "JobScheduler.h"
+
+#include "Nova/Core/Engine/Engine.h"
+
+namespace Nova::Jobs
+{
+	// The number of times a worker looks for work before going to sleep
+	static const int s_SpinsBeforeSleep = 64;
+
+	// The number of fibers created up-front for each worker by default
+	static const size_t s_FibersPerWorker = 4;
+
+	thread_local JobScheduler* JobScheduler::s_CurrentScheduler = nullptr;
+	thread_local int JobScheduler::s_CurrentWorkerIndex = -1;
+	thread_local JobFiber* JobScheduler::s_CurrentFiber = nullptr;
+
+	JobScheduler::JobScheduler(size_t workerCount, size_t fiberCount, size_t fiberStackSize, WorkerAffinity affinity) :
+		m_FiberStackSize(fiberStackSize), m_Affinity(affinity)
+	{
+		if (workerCount == 0)
+			workerCount = GetDefaultWorkerCount();
+
+		if (fiberCount == 0)
+			fiberCount = workerCount * s_FibersPerWorker;
+
+		for (size_t i = 0; i < fiberCount; i++)
+		{
+			m_FreeFibers.push_back(CreateFiber());
+		}
+
+		m_Workers.reserve(workerCount);
+
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			ManagedPtr<Worker> worker = MakeManagedPtr<Worker>();
+			worker->RandomState = (uint32_t)(i * 2654435761u) | 1u;
+
+			m_Workers.push_back(std::move(worker));
+		}
+
+		PlaceWorkers();
+
+		// Only start the threads once every worker exists, as they steal from each other
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			m_Workers[i]->Thread = std::thread(&JobScheduler::WorkerMain, this, (int)i);
+		}
+	}
+
+	JobScheduler::~JobScheduler()
+	{
+		m_IsRunning.store(false);
+
+		{
+			std::lock_guard lock(m_SleepMutex);
+		}
+		m_SleepCondition.notify_all();
+
+		for (const auto& worker : m_Workers)
+		{
+			if (worker->Thread.joinable())
+				worker->Thread.join();
+		}
+
+		// Cleanup jobs that never got to run
+		for (const auto& worker : m_Workers)
+		{
+			Job* job;
+			while (worker->Jobs.Pop(job))
+			{
+				if (job->IsOwnedByScheduler)
+					delete job;
+			}
+		}
+
+		for (Job* job : m_SharedJobs)
+		{
+			if (job->IsOwnedByScheduler)
+				delete job;
+		}
+
+		// Fibers are all suspended by now, so they're destroyed along with the pool
+	}
+
+	size_t JobScheduler::GetDefaultWorkerCount()
+	{
+		size_t hardwareThreads = std::thread::hardware_concurrency();
+
+		// Leave a thread for the main loop, which helps out while it waits
+		return hardwareThreads > 1 ? hardwareThreads - 1 : 1;
+	}
+
+	Ref<JobCounter> JobScheduler::Run(JobFunction function)
+	{
+		Ref<JobCounter> counter = MakeRef<JobCounter>();
+		Run(std::move(function), counter);
+
+		return counter;
+	}
+
+	void JobScheduler::Run(JobFunction function, const Ref<JobCounter>& counter)
+	{
+		if (counter)
+			counter->Add(1);
+
+		Submit(new Job(std::move(function), counter));
+	}
+
+	void JobScheduler::Run(const List<JobFunction>& functions, const Ref<JobCounter>& counter)
+	{
+		// Count every job up-front so the counter can't reach 0 while we're still queueing
+		if (counter)
+			counter->Add((int)functions.size());
+
+		for (const auto& function : functions)
+		{
+			Submit(new Job(function, counter));
+		}
+	}
+
+	void JobScheduler::Run(Job& job)
+	{
+		if (job.Counter)
+			job.Counter->Add(1);
+
+		Submit(&job);
+	}
+
+	void JobScheduler::Run(const List<Job*>& jobs)
+	{
+		for (Job* job : jobs)
+		{
+			if (job->Counter)
+				job->Counter->Add(1);
+		}
+
+		for (Job* job : jobs)
+		{
+			Submit(job);
+		}
+	}
+
+	void JobScheduler::ContinueWith(const Ref<JobCounter>& counter, JobFunction function, const Ref<JobCounter>& continuationCounter)
+	{
+		if (continuationCounter)
+			continuationCounter->Add(1);
+
+		Job* job = new Job(std::move(function), continuationCounter);
+
+		if (!counter || !counter->AddContinuation(job))
+			Submit(job);
+	}
+
+	void JobScheduler::Wait(const Ref<JobCounter>& counter)
+	{
+		if (counter->IsComplete())
+			return;
+
+		// Jobs give up their fiber until the counter completes, which may resume them on a different worker
+		if (s_CurrentScheduler == this && s_CurrentFiber)
+		{
+			SuspendFiber(FiberAction::Wait, counter.get());
+			return;
+		}
+
+		int workerIndex = GetCurrentWorkerIndex();
+
+		// Help run jobs instead of blocking the thread
+		while (!counter->IsComplete())
+		{
+			if (Job* job = FindJob(workerIndex))
+			{
+				Execute(job);
+			}
+			else
+			{
+				std::this_thread::yield();
+			}
+		}
+	}
+
+	int JobScheduler::GetCurrentWorkerIndex() const
+	{
+		return s_CurrentScheduler == this ? s_CurrentWorkerIndex : -1;
+	}
+
+	void JobScheduler::PlaceWorkers()
+	{
+		if (m_Affinity == WorkerAffinity::None)
+			return;
+
+		List<uint32_t> order = CpuTopology::Get().GetPlacementOrder();
+
+		// The first processor in the order is left for the main thread, unless it's all we have
+		size_t firstProcessor = order.size() > 1 ? 1 : 0;
+		size_t processorCount = order.size() - firstProcessor;
+
+		for (size_t i = 0; i < m_Workers.size(); i++)
+		{
+			uint32_t processor = order[firstProcessor + i % processorCount];
+
+			m_Workers[i]->Processor = (int)processor;
+			m_Workers[i]->NumaNode = CpuTopology::Get().GetProcessors()[processor].NumaNode;
+		}
+	}
+
+	void JobScheduler::PinWorker(const Worker& worker) const
+	{
+		bool pinned = true;
+
+		if (m_Affinity == WorkerAffinity::Core)
+			pinned = CpuTopology::PinCurrentThread((uint32_t)worker.Processor);
+		else if (m_Affinity == WorkerAffinity::NumaNode)
+			pinned = CpuTopology::PinCurrentThreadToNode(worker.NumaNode);
+
+		if (!pinned)
+		{
+			if (Engine* engine = Engine::Get())
+				engine->Log(LogLevel::Warning, "Failed to pin job worker to processor {0} (NUMA node {1})", worker.Processor, worker.NumaNode);
+		}
+	}
+
+	void JobScheduler::WorkerMain(int workerIndex)
+	{
+		s_CurrentScheduler = this;
+		s_CurrentWorkerIndex = workerIndex;
+
+		Worker& worker = *m_Workers[workerIndex];
+		PinWorker(worker);
+
+		worker.ThreadFiber = Fiber::ConvertCurrentThread();
+
+		int idleSpins = 0;
+
+		while (m_IsRunning.load(std::memory_order_acquire))
+		{
+			// Resume waiting jobs before starting new ones so suspended fibers don't pile up
+			if (JobFiber* fiber = TakeReadyFiber())
+			{
+				SwitchToFiber(workerIndex, fiber);
+				idleSpins = 0;
+			}
+			else if (Job* job = FindJob(workerIndex))
+			{
+				RunOnFiber(workerIndex, job);
+				idleSpins = 0;
+			}
+			else if (++idleSpins < s_SpinsBeforeSleep)
+			{
+				std::this_thread::yield();
+			}
+			else
+			{
+				Sleep();
+				idleSpins = 0;
+			}
+		}
+
+		worker.ThreadFiber.reset();
+
+		s_CurrentScheduler = nullptr;
+		s_CurrentWorkerIndex = -1;
+	}
+
+	void JobScheduler::FiberMain(void* userData)
+	{
+		JobFiber* fiber = static_cast<JobFiber*>(userData);
+		JobScheduler* scheduler = fiber->Scheduler;
+
+		// Fibers are reused for new jobs, so this never returns
+		while (true)
+		{
+			Job* job = fiber->CurrentJob;
+			fiber->CurrentJob = nullptr;
+
+			scheduler->Execute(job);
+			scheduler->SuspendFiber(FiberAction::Release);
+		}
+	}
+
+	void JobScheduler::RunOnFiber(int workerIndex, Job* job)
+	{
+		JobFiber* fiber = AcquireFiber();
+		fiber->CurrentJob = job;
+
+		SwitchToFiber(workerIndex, fiber);
+	}
+
+	void JobScheduler::SwitchToFiber(int workerIndex, JobFiber* fiber)
+	{
+		s_CurrentFiber = fiber;
+		fiber->Context->SwitchTo();
+		s_CurrentFiber = nullptr;
+
+		// The fiber has switched back to us, so it's safe to hand it off now
+		Worker& worker = *m_Workers[workerIndex];
+
+		FiberAction action = worker.PendingAction;
+		JobFiber* pendingFiber = worker.PendingFiber;
+		JobCounter* pendingCounter = worker.PendingCounter;
+
+		worker.PendingAction = FiberAction::None;
+		worker.PendingFiber = nullptr;
+		worker.PendingCounter = nullptr;
+
+		switch (action)
+		{
+		case FiberAction::Release:
+			ReleaseFiber(pendingFiber);
+			break;
+		case FiberAction::Wait:
+			// The counter may have completed while we were switching
+			if (!pendingCounter->AddWaitingFiber(pendingFiber))
+				QueueReadyFiber(pendingFiber);
+			break;
+		default:
+			break;
+		}
+	}
+
+	void JobScheduler::SuspendFiber(FiberAction action, JobCounter* counter)
+	{
+		Worker& worker = *m_Workers[s_CurrentWorkerIndex];
+
+		worker.PendingAction = action;
+		worker.PendingFiber = s_CurrentFiber;
+		worker.PendingCounter = counter;
+
+		worker.ThreadFiber->SwitchTo();
+	}
+
+	JobFiber* JobScheduler::AcquireFiber()
+	{
+		std::lock_guard lock(m_FibersMutex);
+
+		if (m_FreeFibers.empty())
+			return CreateFiber();
+
+		JobFiber* fiber = m_FreeFibers.back();
+		m_FreeFibers.pop_back();
+
+		return fiber;
+	}
+
+	void JobScheduler::ReleaseFiber(JobFiber* fiber)
+	{
+		std::lock_guard lock(m_FibersMutex);
+		m_FreeFibers.push_back(fiber);
+	}
+
+	JobFiber* JobScheduler::CreateFiber()
+	{
+		ManagedPtr<JobFiber> fiber = MakeManagedPtr<JobFiber>();
+		fiber->Scheduler = this;
+		fiber->Context = MakeManagedPtr<Fiber>(&JobScheduler::FiberMain, fiber.get(), m_FiberStackSize);
+
+		m_Fibers.push_back(std::move(fiber));
+		return m_Fibers.back().get();
+	}
+
+	void JobScheduler::QueueReadyFiber(JobFiber* fiber)
+	{
+		m_QueuedJobs.fetch_add(1);
+
+		{
+			std::lock_guard lock(m_ReadyFibersMutex);
+			m_ReadyFibers.push_back(fiber);
+		}
+
+		WakeWorker();
+	}
+
+	JobFiber* JobScheduler::TakeReadyFiber()
+	{
+		std::lock_guard lock(m_ReadyFibersMutex);
+
+		if (m_ReadyFibers.empty())
+			return nullptr;
+
+		JobFiber* fiber = m_ReadyFibers.front();
+		m_ReadyFibers.pop_front();
+
+		m_QueuedJobs.fetch_sub(1);
+		return fiber;
+	}
+
+	void JobScheduler::Submit(Job* job)
+	{
+		int workerIndex = GetCurrentWorkerIndex();
+
+		m_QueuedJobs.fetch_add(1);
+
+		if (workerIndex >= 0)
+		{
+			m_Workers[workerIndex]->Jobs.Push(job);
+		}
+		else
+		{
+			std::lock_guard lock(m_SharedJobsMutex);
+			m_SharedJobs.push_back(job);
+		}
+
+		WakeWorker();
+	}
+
+	Job* JobScheduler::FindJob(int workerIndex)
+	{
+		Job* job = nullptr;
+
+		// Our own work first, as it's most likely to still be in cache
+		if (workerIndex >= 0 && m_Workers[workerIndex]->Jobs.Pop(job))
+		{
+			m_QueuedJobs.fetch_sub(1);
+			return job;
+		}
+
+		{
+			std::lock_guard lock(m_SharedJobsMutex);
+
+			if (!m_SharedJobs.empty())
+			{
+				job = m_SharedJobs.front();
+				m_SharedJobs.pop_front();
+
+				m_QueuedJobs.fetch_sub(1);
+				return job;
+			}
+		}
+
+		job = StealJob(workerIndex);
+
+		if (job)
+			m_QueuedJobs.fetch_sub(1);
+
+		return job;
+	}
+
+	Job* JobScheduler::StealJob(int workerIndex)
+	{
+		const size_t workerCount = m_Workers.size();
+
+		if (workerCount == 0)
+			return nullptr;
+
+		// Start at a random victim so thieves don't all pile onto the same worker
+		size_t start = 0;
+		if (workerIndex >= 0)
+		{
+			uint32_t& state = m_Workers[workerIndex]->RandomState;
+			state ^= state << 13;
+			state ^= state >> 17;
+			state ^= state << 5;
+
+			start = state % workerCount;
+		}
+
+		Job* job = nullptr;
+
+		// Steal from workers on our own NUMA node first, as their jobs' data is most likely in local memory
+		uint32_t localNode = workerIndex >= 0 ? m_Workers[workerIndex]->NumaNode : 0;
+		bool hasRemoteNodes = false;
+
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			size_t victim = (start + i) % workerCount;
+
+			if ((int)victim == workerIndex)
+				continue;
+
+			if (m_Workers[victim]->NumaNode != localNode)
+			{
+				hasRemoteNodes = true;
+				continue;
+			}
+
+			if (m_Workers[victim]->Jobs.Steal(job))
+				return job;
+		}
+
+		if (!hasRemoteNodes)
+			return nullptr;
+
+		for (size_t i = 0; i < workerCount; i++)
+		{
+			size_t victim = (start + i) % workerCount;
+
+			if (m_Workers[victim]->NumaNode != localNode && m_Workers[victim]->Jobs.Steal(job))
+				return job;
+		}
+
+		return nullptr;
+	}
+
+	void JobScheduler::Execute(Job* job)
+	{
+		try
+		{
+			job->Function();
+		}
+		catch (...)
+		{
+			Exception ex = Exception::GetException();
+
+			if (Engine* engine = Engine::Get())
+				engine->Log(LogLevel::Error, "An unhandled {0} exception occurred while running a job: {1}", typeid(ex).name(), ex.what());
+		}
+
+		if (job->IsOwnedByScheduler)
+		{
+			if (job->Counter)
+				FinishJob(job->Counter);
+
+			delete job;
+		}
+		else if (job->Counter)
+		{
+			// The owner may free or requeue the job as soon as the counter reaches 0, so it can't be touched after that
+			Ref<JobCounter> counter = job->Counter;
+			FinishJob(counter);
+		}
+	}
+
+	void JobScheduler::FinishJob(const Ref<JobCounter>& counter)
+	{
+		if (!counter->Decrement())
+			return;
+
+		List<Job*> continuations;
+		List<JobFiber*> waitingFibers;
+		counter->TakeWaiters(continuations, waitingFibers);
+
+		for (JobFiber* fiber : waitingFibers)
+		{
+			QueueReadyFiber(fiber);
+		}
+
+		for (Job* continuation : continuations)
+		{
+			Submit(continuation);
+		}
+	}
+
+	void JobScheduler::Sleep()
+	{
+		std::unique_lock lock(m_SleepMutex);
+
+		m_SleepingWorkers.fetch_add(1);
+
+		m_SleepCondition.wait(lock, [this]()
+			{
+				return m_QueuedJobs.load() > 0 || !m_IsRunning.load();
+			});
+
+		m_SleepingWorkers.fetch_sub(1);
+	}
+
+	void JobScheduler::WakeWorker()
+	{
+		if (m_SleepingWorkers.load() == 0)
+			return;
+
+		// Take the lock so a worker that is about to sleep can't miss the notification
+		{
+			std::lock_guard lock(m_SleepMutex);
+		}
+		m_SleepCondition.notify_one();
+	}
+}
\ No newline at end of file
@@ -0,0 +1,407 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/Counters.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Threading/CpuTopology.h"
+#include "Nova/Core/Threading/Fiber.h"
+#include "Nova/Core/Threading/WorkStealingDeque.h"
+#include "Job.h"
+#include "JobCounter.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// Runs jobs on a pool of worker threads. Each worker owns a work-stealing deque and steals from the others when it runs out of work.
+	/// Jobs run on fibers, so a job that waits for a counter is suspended and its worker moves on to other jobs until the counter reaches 0
+	/// </summary>
+	class NovaAPI JobScheduler
+	{
+	public:
+		/// <summary>
+		/// Creates a scheduler and starts its workers
+		/// </summary>
+		/// <param name="workerCount">The number of worker threads. If 0, one worker is created for each hardware thread except the calling thread</param>
+		/// <param name="fiberCount">The number of fibers to create up-front. If 0, a few are created for each worker. More are created if every fiber is busy</param>
+		/// <param name="fiberStackSize">The stack size of each fiber in bytes</param>
+		/// <param name="affinity">How worker threads are pinned to processors</param>
+		JobScheduler(size_t workerCount = 0, size_t fiberCount = 0, size_t fiberStackSize = Fiber::DefaultStackSize, WorkerAffinity affinity = WorkerAffinity::None);
+
+		~JobScheduler();
+
+		JobScheduler(const JobScheduler&) = delete;
+		JobScheduler& operator=(const JobScheduler&) = delete;
+
+	public:
+		/// <summary>
+		/// Gets the number of workers to create by default for this machine
+		/// </summary>
+		/// <returns>The default number of workers</returns>
+		static size_t GetDefaultWorkerCount();
+
+	public:
+		/// <summary>
+		/// Queues a job. Safe to call from any thread
+		/// </summary>
+		/// <param name="function">The function the job runs</param>
+		/// <returns>A counter that reaches 0 once the job has finished</returns>
+		Ref<JobCounter> Run(JobFunction function);
+
+		/// <summary>
+		/// Queues a job that decrements the given counter once it has finished. Safe to call from any thread
+		/// </summary>
+		/// <param name="function">The function the job runs</param>
+		/// <param name="counter">The counter to track the job with</param>
+		void Run(JobFunction function, const Ref<JobCounter>& counter);
+
+		/// <summary>
+		/// Queues a batch of jobs that all decrement the given counter once they have finished. Safe to call from any thread
+		/// </summary>
+		/// <param name="functions">The functions to run as jobs</param>
+		/// <param name="counter">The counter to track the jobs with</param>
+		void Run(const List<JobFunction>& functions, const Ref<JobCounter>& counter);
+
+		/// <summary>
+		/// Queues a job that the caller owns, such as one that is queued again every frame, so running it doesn't allocate. The job's counter (if any)
+		/// is incremented. The job must stay alive and mustn't be queued again until its counter shows it has finished. Safe to call from any thread
+		/// </summary>
+		/// <param name="job">The job to queue. Must not be owned by the scheduler</param>
+		void Run(Job& job);
+
+		/// <summary>
+		/// Queues a batch of jobs that the caller owns. Every job is counted before any of them are queued, so a shared counter can't reach 0 while
+		/// the batch is still being queued. Safe to call from any thread
+		/// </summary>
+		/// <param name="jobs">The jobs to queue. Must not be owned by the scheduler</param>
+		void Run(const List<Job*>& jobs);
+
+		/// <summary>
+		/// Queues a job to run once the given counter reaches 0. Runs the job right away if the counter is already at 0
+		/// </summary>
+		/// <param name="counter">The counter to wait for</param>
+		/// <param name="function">The function the continuation runs</param>
+		/// <param name="continuationCounter">An optional counter to track the continuation with</param>
+		void ContinueWith(const Ref<JobCounter>& counter, JobFunction function, const Ref<JobCounter>& continuationCounter = nullptr);
+
+		/// <summary>
+		/// Waits until the given counter reaches 0. When called from a job, the job's fiber is suspended and the worker runs other jobs until the counter completes.
+		/// Otherwise, the calling thread runs queued jobs while it waits
+		/// </summary>
+		/// <param name="counter">The counter to wait for</param>
+		void Wait(const Ref<JobCounter>& counter);
+
+		/// <summary>
+		/// Gets the number of worker threads in this scheduler
+		/// </summary>
+		/// <returns>The number of worker threads</returns>
+		size_t GetWorkerCount() const { return m_Workers.size(); }
+
+		/// <summary>
+		/// Gets the index of the worker the calling thread belongs to
+		/// </summary>
+		/// <returns>The worker index, or -1 if the calling thread is not one of this scheduler's workers</returns>
+		int GetCurrentWorkerIndex() const;
+
+		/// <summary>
+		/// Gets the NUMA node a worker is placed on. Use with CpuTopology::AllocateOnNode to give a worker's jobs node-local memory
+		/// </summary>
+		/// <param name="workerIndex">The index of the worker</param>
+		/// <returns>The worker's NUMA node. Always 0 unless workers are pinned</returns>
+		uint32_t GetWorkerNumaNode(int workerIndex) const { return m_Workers[workerIndex]->NumaNode; }
+
+		/// <summary>
+		/// Gets how worker threads are pinned to processors
+		/// </summary>
+		/// <returns>The worker affinity</returns>
+		WorkerAffinity GetAffinity() const { return m_Affinity; }
+
+	private:
+		/// <summary>
+		/// What a worker should do with a job fiber once it has switched back to the worker
+		/// </summary>
+		enum class FiberAction
+		{
+			/// <summary>
+			/// Nothing to do
+			/// </summary>
+			None,
+
+			/// <summary>
+			/// The fiber finished its job and can be reused
+			/// </summary>
+			Release,
+
+			/// <summary>
+			/// The fiber is waiting for a counter and should be resumed once it reaches 0
+			/// </summary>
+			Wait,
+		};
+
+		/// <summary>
+		/// A worker thread and its queue of jobs
+		/// </summary>
+		struct Worker
+		{
+			/// <summary>
+			/// Jobs queued by this worker
+			/// </summary>
+			WorkStealingDeque<Job*> Jobs;
+
+			/// <summary>
+			/// The thread this worker runs on
+			/// </summary>
+			std::thread Thread;
+
+			/// <summary>
+			/// State for picking random workers to steal from
+			/// </summary>
+			uint32_t RandomState = 0;
+
+			/// <summary>
+			/// The logical processor this worker is placed on, or -1 if it isn't pinned
+			/// </summary>
+			int Processor = -1;
+
+			/// <summary>
+			/// The NUMA node this worker is placed on. Workers steal from workers on the same node first
+			/// </summary>
+			uint32_t NumaNode = 0;
+
+			/// <summary>
+			/// The fiber the worker thread was converted into. Job fibers switch back to it once they finish or wait
+			/// </summary>
+			ManagedPtr<Fiber> ThreadFiber;
+
+			/// <summary>
+			/// What to do with the job fiber that last switched back to this worker
+			/// </summary>
+			FiberAction PendingAction = FiberAction::None;
+
+			/// <summary>
+			/// The job fiber that last switched back to this worker
+			/// </summary>
+			JobFiber* PendingFiber = nullptr;
+
+			/// <summary>
+			/// The counter the pending fiber is waiting for
+			/// </summary>
+			JobCounter* PendingCounter = nullptr;
+		};
+
+	private:
+		/// <summary>
+		/// Picks a processor and NUMA node for each worker based on the affinity
+		/// </summary>
+		void PlaceWorkers();
+
+		/// <summary>
+		/// Pins the calling worker thread based on the affinity
+		/// </summary>
+		/// <param name="worker">The worker to pin</param>
+		void PinWorker(const Worker& worker) const;
+
+		/// <summary>
+		/// The entrypoint for worker threads
+		/// </summary>
+		/// <param name="workerIndex">The index of the worker</param>
+		void WorkerMain(int workerIndex);
+
+		/// <summary>
+		/// Queues a job on the calling worker's deque, or the shared queue if the calling thread is not a worker
+		/// </summary>
+		/// <param name="job">The job to queue</param>
+		void Submit(Job* job);
+
+		/// <summary>
+		/// The entrypoint for job fibers. Runs jobs until the scheduler is destroyed
+		/// </summary>
+		/// <param name="userData">The JobFiber being run</param>
+		static void FiberMain(void* userData);
+
+		/// <summary>
+		/// Runs a job on a job fiber, switching back to the worker once it has finished
+		/// </summary>
+		/// <param name="workerIndex">The index of the calling worker</param>
+		/// <param name="job">The job to run</param>
+		void RunOnFiber(int workerIndex, Job* job);
+
+		/// <summary>
+		/// Switches from the calling worker to a job fiber and handles whatever the fiber asked for once it switches back
+		/// </summary>
+		/// <param name="workerIndex">The index of the calling worker</param>
+		/// <param name="fiber">The fiber to switch to</param>
+		void SwitchToFiber(int workerIndex, JobFiber* fiber);
+
+		/// <summary>
+		/// Suspends the calling job fiber and switches back to its worker
+		/// </summary>
+		/// <param name="action">What the worker should do with the fiber</param>
+		/// <param name="counter">The counter the fiber is waiting for (if any)</param>
+		void SuspendFiber(FiberAction action, JobCounter* counter = nullptr);
+
+		/// <summary>
+		/// Gets a fiber that is free to run a new job, creating one if none are left
+		/// </summary>
+		/// <returns>A free job fiber</returns>
+		JobFiber* AcquireFiber();
+
+		/// <summary>
+		/// Returns a fiber to the pool once its job has finished
+		/// </summary>
+		/// <param name="fiber">The fiber to release</param>
+		void ReleaseFiber(JobFiber* fiber);
+
+		/// <summary>
+		/// Creates a new job fiber
+		/// </summary>
+		/// <returns>The created fiber. Owned by this scheduler</returns>
+		JobFiber* CreateFiber();
+
+		/// <summary>
+		/// Queues a suspended fiber to be resumed by the next free worker
+		/// </summary>
+		/// <param name="fiber">The fiber to resume</param>
+		void QueueReadyFiber(JobFiber* fiber);
+
+		/// <summary>
+		/// Takes a suspended fiber that is ready to be resumed
+		/// </summary>
+		/// <returns>The fiber to resume, or nullptr if none are ready</returns>
+		JobFiber* TakeReadyFiber();
+
+		/// <summary>
+		/// Finds the next job to run, checking our own deque, then the shared queue, then other workers
+		/// </summary>
+		/// <param name="workerIndex">The index of the calling worker, or -1 if the calling thread is not a worker</param>
+		/// <returns>The job to run, or nullptr if no work was found</returns>
+		Job* FindJob(int workerIndex);
+
+		/// <summary>
+		/// Attempts to steal a job from another worker
+		/// </summary>
+		/// <param name="workerIndex">The index of the calling worker, or -1 if the calling thread is not a worker</param>
+		/// <returns>The stolen job, or nullptr if nothing could be stolen</returns>
+		Job* StealJob(int workerIndex);
+
+		/// <summary>
+		/// Runs a job and releases its counter
+		/// </summary>
+		/// <param name="job">The job to run. Deleted once it has finished</param>
+		void Execute(Job* job);
+
+		/// <summary>
+		/// Decrements a counter for a finished job and queues its continuations and waiting fibers if it reached 0
+		/// </summary>
+		/// <param name="counter">The counter to decrement</param>
+		void FinishJob(const Ref<JobCounter>& counter);
+
+		/// <summary>
+		/// Puts the calling worker to sleep until there is work queued or the scheduler is shutting down
+		/// </summary>
+		void Sleep();
+
+		/// <summary>
+		/// Wakes a sleeping worker (if any)
+		/// </summary>
+		void WakeWorker();
+
+	private:
+		/// <summary>
+		/// The scheduler the calling thread is a worker for
+		/// </summary>
+		static thread_local JobScheduler* s_CurrentScheduler;
+
+		/// <summary>
+		/// The index of the worker the calling thread is
+		/// </summary>
+		static thread_local int s_CurrentWorkerIndex;
+
+		/// <summary>
+		/// The job fiber the calling thread is currently running
+		/// </summary>
+		static thread_local JobFiber* s_CurrentFiber;
+
+	private:
+		/// <summary>
+		/// The worker threads for this scheduler
+		/// </summary>
+		List<ManagedPtr<Worker>> m_Workers;
+
+		/// <summary>
+		/// Every job fiber created by this scheduler
+		/// </summary>
+		List<ManagedPtr<JobFiber>> m_Fibers;
+
+		/// <summary>
+		/// Job fibers that aren't running or waiting on a job
+		/// </summary>
+		List<JobFiber*> m_FreeFibers;
+
+		/// <summary>
+		/// Guards the fiber pool
+		/// </summary>
+		std::mutex m_FibersMutex;
+
+		/// <summary>
+		/// The stack size of new job fibers
+		/// </summary>
+		const size_t m_FiberStackSize;
+
+		/// <summary>
+		/// How worker threads are pinned to processors
+		/// </summary>
+		const WorkerAffinity m_Affinity;
+
+		/// <summary>
+		/// Suspended fibers whose counters have reached 0
+		/// </summary>
+		std::deque<JobFiber*> m_ReadyFibers;
+
+		/// <summary>
+		/// Guards the ready fiber queue
+		/// </summary>
+		std::mutex m_ReadyFibersMutex;
+
+		/// <summary>
+		/// Jobs queued from threads that are not workers
+		/// </summary>
+		std::deque<Job*> m_SharedJobs;
+
+		/// <summary>
+		/// Guards the shared job queue
+		/// </summary>
+		std::mutex m_SharedJobsMutex;
+
+		/// <summary>
+		/// The number of jobs and ready fibers that are queued but not yet picked up
+		/// </summary>
+		std::atomic<int64_t> m_QueuedJobs = 0;
+
+		/// <summary>
+		/// The number of workers that are asleep
+		/// </summary>
+		std::atomic<int> m_SleepingWorkers = 0;
+
+		/// <summary>
+		/// Guards worker sleeping
+		/// </summary>
+		std::mutex m_SleepMutex;
+
+		/// <summary>
+		/// Signalled when work is queued for sleeping workers
+		/// </summary>
+		std::condition_variable m_SleepCondition;
+
+		/// <summary>
+		/// If false, workers will exit
+		/// </summary>
+		std::atomic<bool> m_IsRunning = true;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "JobService.h"
+
+#include "Nova/Core/Engine/Engine.h"
+
+#include <algorithm>
+
+namespace Nova::Jobs
+{
+	JobService::JobService(size_t workerCount, size_t fiberCount) :
+		m_Scheduler(MakeManagedPtr<JobScheduler>(workerCount ? workerCount : Engine::Get()->GetWorkerCount(), fiberCount, Fiber::DefaultStackSize, Engine::Get()->GetWorkerAffinity())),
+		m_MainThreadBudget(TimeSpan::FromSeconds(0.002))
+	{
+		m_MainThreadQueueListener = CreateTickListener(s_MainThreadQueueTickOrder, &JobService::DrainMainThreadQueue);
+		AddListenerToMainLoop(m_MainThreadQueueListener);
+
+		Engine::Get()->Log(LogLevel::Verbose, "JobService initialized with {0} workers", m_Scheduler->GetWorkerCount());
+	}
+
+	JobService::~JobService()
+	{
+		RemoveListenerFromMainLoop(m_MainThreadQueueListener);
+
+		for (const auto& frameJob : m_FrameJobs)
+		{
+			RemoveListenerFromMainLoop(frameJob->GetTickListener());
+		}
+		m_FrameJobs.clear();
+
+		for (const auto& taskGraph : m_TaskGraphs)
+		{
+			RemoveListenerFromMainLoop(taskGraph->GetTickListener());
+		}
+		m_TaskGraphs.clear();
+
+		// Finish up our workers before anything they use is destroyed
+		m_Scheduler.reset();
+
+		Engine::Get()->Log(LogLevel::Verbose, "JobService destroyed");
+	}
+
+	const int JobService::s_MainThreadQueueTickOrder = -900;
+
+	Ref<FrameJob> JobService::AddFrameJob(int order, FrameJobFunction function)
+	{
+		Ref<FrameJob> frameJob = MakeRef<FrameJob>(m_Scheduler.get(), order, std::move(function));
+
+		m_FrameJobs.push_back(frameJob);
+		AddListenerToMainLoop(frameJob->GetTickListener());
+
+		return frameJob;
+	}
+
+	void JobService::RemoveFrameJob(const Ref<FrameJob>& frameJob)
+	{
+		auto it = std::find(m_FrameJobs.begin(), m_FrameJobs.end(), frameJob);
+
+		if (it == m_FrameJobs.end())
+			return;
+
+		RemoveListenerFromMainLoop(frameJob->GetTickListener());
+		m_FrameJobs.erase(it);
+	}
+
+	Ref<TaskGraph> JobService::AddTaskGraph(int order)
+	{
+		Ref<TaskGraph> taskGraph = MakeRef<TaskGraph>(m_Scheduler.get(), order);
+
+		m_TaskGraphs.push_back(taskGraph);
+		AddListenerToMainLoop(taskGraph->GetTickListener());
+
+		return taskGraph;
+	}
+
+	void JobService::RemoveTaskGraph(const Ref<TaskGraph>& taskGraph)
+	{
+		auto it = std::find(m_TaskGraphs.begin(), m_TaskGraphs.end(), taskGraph);
+
+		if (it == m_TaskGraphs.end())
+			return;
+
+		RemoveListenerFromMainLoop(taskGraph->GetTickListener());
+		m_TaskGraphs.erase(it);
+	}
+
+	void JobService::DrainMainThreadQueue(double deltaTime)
+	{
+		m_MainThreadQueue.Drain(m_MainThreadBudget);
+	}
+}
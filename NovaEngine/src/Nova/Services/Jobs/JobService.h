@@ -0,0 +1,160 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Services/EngineService.h"
+#include "JobScheduler.h"
+#include "FrameJob.h"
+#include "TaskGraph.h"
+#include "Future.h"
+#include "ContinuationQueue.h"
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// A service that runs jobs on a pool of work-stealing worker threads
+	/// </summary>
+	class NovaAPI JobService : public EngineService
+	{
+	public:
+		/// <summary>
+		/// Creates the service and starts its workers
+		/// </summary>
+		/// <param name="workerCount">The number of worker threads. If 0, the engine's worker count is used, or one worker for each hardware thread except the main thread</param>
+		/// <param name="fiberCount">The number of job fibers to create up-front. If 0, a few are created for each worker</param>
+		JobService(size_t workerCount = 0, size_t fiberCount = 0);
+		~JobService();
+
+	public:
+		/// <summary>
+		/// Queues a job. Safe to call from any thread
+		/// </summary>
+		/// <param name="function">The function the job runs</param>
+		/// <returns>A counter that reaches 0 once the job has finished</returns>
+		Ref<JobCounter> Run(JobFunction function) { return m_Scheduler->Run(std::move(function)); }
+
+		/// <summary>
+		/// Queues a job that decrements the given counter once it has finished. Safe to call from any thread
+		/// </summary>
+		/// <param name="function">The function the job runs</param>
+		/// <param name="counter">The counter to track the job with</param>
+		void Run(JobFunction function, const Ref<JobCounter>& counter) { m_Scheduler->Run(std::move(function), counter); }
+
+		/// <summary>
+		/// Queues a batch of jobs that all decrement the given counter once they have finished. Safe to call from any thread
+		/// </summary>
+		/// <param name="functions">The functions to run as jobs</param>
+		/// <param name="counter">The counter to track the jobs with</param>
+		void Run(const List<JobFunction>& functions, const Ref<JobCounter>& counter) { m_Scheduler->Run(functions, counter); }
+
+		/// <summary>
+		/// Queues a job to run once the given counter reaches 0
+		/// </summary>
+		/// <param name="counter">The counter to wait for</param>
+		/// <param name="function">The function the continuation runs</param>
+		/// <param name="continuationCounter">An optional counter to track the continuation with</param>
+		void ContinueWith(const Ref<JobCounter>& counter, JobFunction function, const Ref<JobCounter>& continuationCounter = nullptr) { m_Scheduler->ContinueWith(counter, std::move(function), continuationCounter); }
+
+		/// <summary>
+		/// Waits until the given counter reaches 0. Jobs are suspended while they wait, while other threads run queued jobs until the counter completes
+		/// </summary>
+		/// <param name="counter">The counter to wait for</param>
+		void Wait(const Ref<JobCounter>& counter) { m_Scheduler->Wait(counter); }
+
+		/// <summary>
+		/// Runs a job every time the main loop ticks. The tick doesn't finish until the job and any jobs it waits on have finished
+		/// </summary>
+		/// <param name="order">The tick order for the job</param>
+		/// <param name="function">The function to run each tick</param>
+		/// <returns>The frame job. Pass it to RemoveFrameJob to stop running it</returns>
+		Ref<FrameJob> AddFrameJob(int order, FrameJobFunction function);
+
+		/// <summary>
+		/// Stops running a frame job
+		/// </summary>
+		/// <param name="frameJob">The frame job to stop</param>
+		void RemoveFrameJob(const Ref<FrameJob>& frameJob);
+
+		/// <summary>
+		/// Creates an empty task graph that is executed every time the main loop ticks
+		/// </summary>
+		/// <param name="order">The tick order for the graph</param>
+		/// <returns>The task graph. Pass it to RemoveTaskGraph to stop executing it</returns>
+		Ref<TaskGraph> AddTaskGraph(int order);
+
+		/// <summary>
+		/// Stops executing a task graph
+		/// </summary>
+		/// <param name="taskGraph">The task graph to stop</param>
+		void RemoveTaskGraph(const Ref<TaskGraph>& taskGraph);
+
+		/// <summary>
+		/// Runs a function as a job and returns a future for its result
+		/// </summary>
+		/// <param name="func">The function to run</param>
+		/// <returns>A future for the function's result</returns>
+		template<typename Func>
+		auto RunAsync(Func func) { return Jobs::RunAsync(*m_Scheduler, std::move(func)); }
+
+		/// <summary>
+		/// Gets the queue of continuations that run on the main thread. Pass it to Future::Then to get results back to the main loop
+		/// </summary>
+		/// <returns>The main thread's continuation queue</returns>
+		ContinuationQueue& GetMainThreadQueue() { return m_MainThreadQueue; }
+
+		/// <summary>
+		/// Sets the maximum time spent running main thread continuations each tick. Continuations that don't fit wait for the next tick
+		/// </summary>
+		/// <param name="budget">The time budget. A budget of 0 runs every queued continuation</param>
+		void SetMainThreadBudget(TimeSpan budget) { m_MainThreadBudget = budget; }
+
+		/// <summary>
+		/// Gets the scheduler that runs this service's jobs
+		/// </summary>
+		/// <returns>The job scheduler</returns>
+		JobScheduler* GetScheduler() const { return m_Scheduler.get(); }
+
+	private:
+		/// <summary>
+		/// Runs main thread continuations within the budget
+		/// </summary>
+		/// <param name="deltaTime">The time since the last tick (in seconds)</param>
+		void DrainMainThreadQueue(double deltaTime);
+
+	private:
+		/// <summary>
+		/// The tick order that main thread continuations run at. Early in the tick so results are visible to the rest of the frame
+		/// </summary>
+		static const int s_MainThreadQueueTickOrder;
+
+	private:
+		/// <summary>
+		/// The scheduler that runs our jobs
+		/// </summary>
+		ManagedPtr<JobScheduler> m_Scheduler;
+
+		/// <summary>
+		/// Frame jobs attached to the main loop
+		/// </summary>
+		List<Ref<FrameJob>> m_FrameJobs;
+
+		/// <summary>
+		/// Task graphs attached to the main loop
+		/// </summary>
+		List<Ref<TaskGraph>> m_TaskGraphs;
+
+		/// <summary>
+		/// Continuations that run on the main thread
+		/// </summary>
+		ContinuationQueue m_MainThreadQueue;
+
+		/// <summary>
+		/// The maximum time spent running main thread continuations each tick
+		/// </summary>
+		TimeSpan m_MainThreadBudget;
+
+		/// <summary>
+		/// The listener that drains main thread continuations
+		/// </summary>
+		Ref<TickListener> m_MainThreadQueueListener;
+	};
+}
\ No newline at end of file
@@ -0,0 +1,337 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Types/List.h"
+#include "JobScheduler.h"
+
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <stddef.h>
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// The default number of elements each job handles in the parallel algorithms. Ranges this size or smaller run serially on the calling thread
+	/// </summary>
+	constexpr size_t DefaultGrainSize = 4096;
+
+	namespace Detail
+	{
+		/// <summary>
+		/// Splits a range into chunks of at least the given grain size
+		/// </summary>
+		/// <param name="count">The number of elements in the range</param>
+		/// <param name="grainSize">The minimum number of elements per chunk</param>
+		/// <param name="scheduler">The scheduler the chunks will run on</param>
+		/// <returns>The number of chunks to split the range into</returns>
+		inline size_t GetChunkCount(size_t count, size_t grainSize, const JobScheduler& scheduler)
+		{
+			if (grainSize == 0)
+				grainSize = 1;
+
+			// Enough chunks for stealing to even out uneven work, but not so many that job overhead dominates
+			size_t maxChunks = (scheduler.GetWorkerCount() + 1) * 4;
+			size_t chunks = (count + grainSize - 1) / grainSize;
+
+			return std::max<size_t>(1, std::min(chunks, maxChunks));
+		}
+
+		/// <summary>
+		/// Gets the start of a chunk when a range is split evenly
+		/// </summary>
+		/// <param name="count">The number of elements in the range</param>
+		/// <param name="chunkCount">The number of chunks</param>
+		/// <param name="chunk">The chunk index</param>
+		/// <returns>The offset of the chunk's first element</returns>
+		inline size_t GetChunkStart(size_t count, size_t chunkCount, size_t chunk)
+		{
+			return (count / chunkCount) * chunk + std::min(chunk, count % chunkCount);
+		}
+
+		/// <summary>
+		/// Runs a function once for each chunk, running the first chunk on the calling thread, and waits for them all to finish. If any chunk throws,
+		/// the first exception thrown is rethrown on the calling thread once every chunk has finished, as they still reference the function
+		/// </summary>
+		/// <param name="scheduler">The scheduler to run the chunks on</param>
+		/// <param name="chunkCount">The number of chunks</param>
+		/// <param name="func">The function to run, taking the chunk index</param>
+		template<typename ChunkFunc>
+		void RunChunks(JobScheduler& scheduler, size_t chunkCount, const ChunkFunc& func)
+		{
+			if (chunkCount <= 1)
+			{
+				func((size_t)0);
+				return;
+			}
+
+			// Only the chunk that sets the flag writes the exception, and it's only read once every chunk has finished
+			std::exception_ptr exception;
+			std::atomic_flag hasException;
+
+			auto runChunk = [&func, &exception, &hasException](size_t chunk)
+				{
+					try
+					{
+						func(chunk);
+					}
+					catch (...)
+					{
+						if (!hasException.test_and_set(std::memory_order_relaxed))
+							exception = std::current_exception();
+					}
+				};
+
+			List<JobFunction> jobs;
+			jobs.reserve(chunkCount - 1);
+
+			for (size_t chunk = 1; chunk < chunkCount; chunk++)
+			{
+				jobs.emplace_back([&runChunk, chunk]() { runChunk(chunk); });
+			}
+
+			Ref<JobCounter> counter = MakeRef<JobCounter>();
+			scheduler.Run(jobs, counter);
+
+			runChunk((size_t)0);
+			scheduler.Wait(counter);
+
+			if (exception)
+				std::rethrow_exception(exception);
+		}
+	}
+
+	/// <summary>
+	/// Calls a function for each sub-range of [begin, end), spreading the sub-ranges across the scheduler's workers
+	/// </summary>
+	/// <param name="scheduler">The scheduler to run on</param>
+	/// <param name="begin">The first index</param>
+	/// <param name="end">One past the last index</param>
+	/// <param name="func">The function to call, taking the start and end of a sub-range</param>
+	/// <param name="grainSize">The minimum number of indices per job</param>
+	template<typename RangeFunc>
+	void ParallelForRange(JobScheduler& scheduler, size_t begin, size_t end, const RangeFunc& func, size_t grainSize = DefaultGrainSize)
+	{
+		if (end <= begin)
+			return;
+
+		const size_t count = end - begin;
+
+		if (count <= grainSize)
+		{
+			func(begin, end);
+			return;
+		}
+
+		const size_t chunkCount = Detail::GetChunkCount(count, grainSize, scheduler);
+
+		Detail::RunChunks(scheduler, chunkCount, [&](size_t chunk)
+			{
+				func(begin + Detail::GetChunkStart(count, chunkCount, chunk), begin + Detail::GetChunkStart(count, chunkCount, chunk + 1));
+			});
+	}
+
+	/// <summary>
+	/// Calls a function for each index in [begin, end), spreading the indices across the scheduler's workers
+	/// </summary>
+	/// <param name="scheduler">The scheduler to run on</param>
+	/// <param name="begin">The first index</param>
+	/// <param name="end">One past the last index</param>
+	/// <param name="func">The function to call, taking an index</param>
+	/// <param name="grainSize">The minimum number of indices per job</param>
+	template<typename IndexFunc>
+	void ParallelFor(JobScheduler& scheduler, size_t begin, size_t end, const IndexFunc& func, size_t grainSize = DefaultGrainSize)
+	{
+		ParallelForRange(scheduler, begin, end, [&func](size_t rangeBegin, size_t rangeEnd)
+			{
+				for (size_t i = rangeBegin; i < rangeEnd; i++)
+				{
+					func(i);
+				}
+			}, grainSize);
+	}
+
+	/// <summary>
+	/// Maps each index in [begin, end) to a value and combines the values. Partial results are combined in index order, so the result is deterministic
+	/// </summary>
+	/// <param name="scheduler">The scheduler to run on</param>
+	/// <param name="begin">The first index</param>
+	/// <param name="end">One past the last index</param>
+	/// <param name="identity">The value that leaves other values unchanged when combined with them</param>
+	/// <param name="map">The function that maps an index to a value</param>
+	/// <param name="reduce">The associative function that combines two values</param>
+	/// <param name="grainSize">The minimum number of indices per job</param>
+	/// <returns>The combined value</returns>
+	template<typename T, typename MapFunc, typename ReduceFunc>
+	T ParallelReduce(JobScheduler& scheduler, size_t begin, size_t end, T identity, const MapFunc& map, const ReduceFunc& reduce, size_t grainSize = DefaultGrainSize)
+	{
+		if (end <= begin)
+			return identity;
+
+		const size_t count = end - begin;
+		const size_t chunkCount = count <= grainSize ? 1 : Detail::GetChunkCount(count, grainSize, scheduler);
+
+		List<T> partials(chunkCount, identity);
+
+		Detail::RunChunks(scheduler, chunkCount, [&](size_t chunk)
+			{
+				size_t chunkEnd = begin + Detail::GetChunkStart(count, chunkCount, chunk + 1);
+
+				// Accumulate locally so chunks don't write to neighbouring partials (and cache lines) every iteration
+				T partial = identity;
+				for (size_t i = begin + Detail::GetChunkStart(count, chunkCount, chunk); i < chunkEnd; i++)
+				{
+					partial = reduce(partial, map(i));
+				}
+
+				partials[chunk] = partial;
+			});
+
+		T result = identity;
+		for (const T& partial : partials)
+		{
+			result = reduce(result, partial);
+		}
+
+		return result;
+	}
+
+	/// <summary>
+	/// Writes the inclusive prefix combination of [first, last) to the output. The output can be the same as the input
+	/// </summary>
+	/// <param name="scheduler">The scheduler to run on</param>
+	/// <param name="first">The start of the input</param>
+	/// <param name="last">The end of the input</param>
+	/// <param name="output">The start of the output</param>
+	/// <param name="op">The associative function that combines two values</param>
+	/// <param name="grainSize">The minimum number of elements per job</param>
+	template<typename InputIt, typename OutputIt, typename ScanOp = std::plus<>>
+	void ParallelScan(JobScheduler& scheduler, InputIt first, InputIt last, OutputIt output, const ScanOp& op = ScanOp(), size_t grainSize = DefaultGrainSize)
+	{
+		using ValueType = typename std::iterator_traits<InputIt>::value_type;
+
+		const size_t count = (size_t)std::distance(first, last);
+
+		if (count == 0)
+			return;
+
+		if (count <= grainSize)
+		{
+			std::inclusive_scan(first, last, output, op);
+			return;
+		}
+
+		const size_t chunkCount = Detail::GetChunkCount(count, grainSize, scheduler);
+
+		// First pass: scan each chunk on its own
+		Detail::RunChunks(scheduler, chunkCount, [&](size_t chunk)
+			{
+				size_t chunkStart = Detail::GetChunkStart(count, chunkCount, chunk);
+				size_t chunkEnd = Detail::GetChunkStart(count, chunkCount, chunk + 1);
+
+				std::inclusive_scan(first + chunkStart, first + chunkEnd, output + chunkStart, op);
+			});
+
+		// Carry each chunk's total into the next. There are only a handful of chunks, so this is cheap
+		List<ValueType> carries(chunkCount);
+		for (size_t chunk = 1; chunk < chunkCount; chunk++)
+		{
+			ValueType chunkTotal = output[Detail::GetChunkStart(count, chunkCount, chunk) - 1];
+			carries[chunk] = chunk == 1 ? chunkTotal : op(carries[chunk - 1], chunkTotal);
+		}
+
+		// Second pass: add the carries to every chunk after the first
+		Detail::RunChunks(scheduler, chunkCount - 1, [&](size_t chunk)
+			{
+				chunk++;
+
+				size_t chunkStart = Detail::GetChunkStart(count, chunkCount, chunk);
+				size_t chunkEnd = Detail::GetChunkStart(count, chunkCount, chunk + 1);
+
+				for (size_t i = chunkStart; i < chunkEnd; i++)
+				{
+					output[i] = op(carries[chunk], output[i]);
+				}
+			});
+	}
+
+	/// <summary>
+	/// Sorts [first, last) with a parallel merge sort. Chunks are sorted on the workers, then merged in parallel rounds through a scratch buffer.
+	/// The sort is not stable
+	/// </summary>
+	/// <param name="scheduler">The scheduler to run on</param>
+	/// <param name="first">The start of the range to sort</param>
+	/// <param name="last">The end of the range to sort</param>
+	/// <param name="comp">The comparator. Returns true if the left value should come before the right value</param>
+	/// <param name="grainSize">The minimum number of elements per job</param>
+	template<typename RandomIt, typename Compare = std::less<>>
+	void ParallelSort(JobScheduler& scheduler, RandomIt first, RandomIt last, const Compare& comp = Compare(), size_t grainSize = DefaultGrainSize)
+	{
+		using ValueType = typename std::iterator_traits<RandomIt>::value_type;
+
+		const size_t count = (size_t)std::distance(first, last);
+
+		if (count <= grainSize)
+		{
+			std::sort(first, last, comp);
+			return;
+		}
+
+		const size_t chunkCount = Detail::GetChunkCount(count, grainSize, scheduler);
+
+		List<size_t> bounds(chunkCount + 1);
+		for (size_t chunk = 0; chunk <= chunkCount; chunk++)
+		{
+			bounds[chunk] = Detail::GetChunkStart(count, chunkCount, chunk);
+		}
+
+		Detail::RunChunks(scheduler, chunkCount, [&](size_t chunk)
+			{
+				std::sort(first + bounds[chunk], first + bounds[chunk + 1], comp);
+			});
+
+		// Merge neighbouring runs until there's only one left, swapping between the range and the buffer each round
+		List<ValueType> buffer(std::make_move_iterator(first), std::make_move_iterator(last));
+		bool isInBuffer = true;
+
+		while (bounds.size() > 2)
+		{
+			const size_t runCount = bounds.size() - 1;
+			const size_t mergeCount = (runCount + 1) / 2;
+
+			Detail::RunChunks(scheduler, mergeCount, [&](size_t merge)
+				{
+					size_t start = bounds[merge * 2];
+					size_t middle = bounds[std::min(merge * 2 + 1, runCount)];
+					size_t end = bounds[std::min(merge * 2 + 2, runCount)];
+
+					if (isInBuffer)
+						std::merge(std::make_move_iterator(buffer.begin() + start), std::make_move_iterator(buffer.begin() + middle),
+							std::make_move_iterator(buffer.begin() + middle), std::make_move_iterator(buffer.begin() + end), first + start, comp);
+					else
+						std::merge(std::make_move_iterator(first + start), std::make_move_iterator(first + middle),
+							std::make_move_iterator(first + middle), std::make_move_iterator(first + end), buffer.begin() + start, comp);
+				});
+
+			List<size_t> mergedBounds;
+			mergedBounds.reserve(mergeCount + 1);
+
+			for (size_t i = 0; i < bounds.size(); i += 2)
+			{
+				mergedBounds.push_back(bounds[i]);
+			}
+
+			if (mergedBounds.back() != count)
+				mergedBounds.push_back(count);
+
+			bounds.swap(mergedBounds);
+			isInBuffer = !isInBuffer;
+		}
+
+		if (isInBuffer)
+			std::move(buffer.begin(), buffer.end(), first);
+	}
+}
@@ -0,0 +1,200 @@
+#include "TaskGraph.h"
+
+#include "JobExceptions.h"
+
+namespace Nova::Jobs
+{
+	TaskGraph::TaskGraph(JobScheduler* scheduler, int order) :
+		m_Scheduler(scheduler), m_Order(order), m_ExecutionCounter(MakeRef<JobCounter>())
+	{}
+
+	// RefCounted ----------
+	void TaskGraph::Init()
+	{
+		m_TickListener = MakeRef<TickListener>(m_Order, GetSelfRef<TaskGraph>(), &TaskGraph::Tick);
+	}
+
+	// RefCounted ----------
+
+	TaskID TaskGraph::AddTask(const string& name, TaskFunction function)
+	{
+		TaskNode task;
+		task.Name = name;
+		task.Function = std::move(function);
+
+		m_Tasks.push_back(std::move(task));
+		m_IsDirty = true;
+
+		return (TaskID)(m_Tasks.size() - 1);
+	}
+
+	void TaskGraph::AddDependency(TaskID task, TaskID dependency)
+	{
+		ValidateTask(task);
+		ValidateTask(dependency);
+
+		if (task == dependency)
+			throw TaskGraphException(FormatString("Task \"{0}\" can't depend on itself", m_Tasks[task].Name));
+
+		m_Tasks[task].Dependencies.push_back(dependency);
+		m_IsDirty = true;
+	}
+
+	void TaskGraph::RemoveTask(TaskID task)
+	{
+		ValidateTask(task);
+
+		TaskNode& node = m_Tasks[task];
+		node.IsRemoved = true;
+		node.Function = nullptr;
+		node.Dependencies.clear();
+
+		m_IsDirty = true;
+	}
+
+	void TaskGraph::Compile()
+	{
+		const size_t taskCount = m_Tasks.size();
+
+		// Count dependencies and gather successors for every live task
+		List<int> dependencyCounts(taskCount, 0);
+		List<List<TaskID>> successors(taskCount);
+
+		for (TaskID task = 0; task < taskCount; task++)
+		{
+			if (m_Tasks[task].IsRemoved)
+				continue;
+
+			for (TaskID dependency : m_Tasks[task].Dependencies)
+			{
+				if (m_Tasks[dependency].IsRemoved)
+					continue;
+
+				dependencyCounts[task]++;
+				successors[dependency].push_back(task);
+			}
+		}
+
+		// Kahn's algorithm, so each task ends up after everything it depends on
+		List<TaskID> order;
+		order.reserve(taskCount);
+
+		List<int> remaining(dependencyCounts);
+
+		for (TaskID task = 0; task < taskCount; task++)
+		{
+			if (!m_Tasks[task].IsRemoved && remaining[task] == 0)
+				order.push_back(task);
+		}
+
+		for (size_t i = 0; i < order.size(); i++)
+		{
+			for (TaskID successor : successors[order[i]])
+			{
+				if (--remaining[successor] == 0)
+					order.push_back(successor);
+			}
+		}
+
+		for (TaskID task = 0; task < taskCount; task++)
+		{
+			if (!m_Tasks[task].IsRemoved && remaining[task] > 0)
+				throw TaskGraphException(FormatString("Task \"{0}\" is part of a dependency cycle", m_Tasks[task].Name));
+		}
+
+		// Flatten into the schedule, remapping task IDs to schedule indices
+		List<uint32_t> scheduleIndices(taskCount, 0);
+		for (uint32_t i = 0; i < (uint32_t)order.size(); i++)
+		{
+			scheduleIndices[order[i]] = i;
+		}
+
+		m_Schedule.clear();
+		m_Successors.clear();
+		m_TaskJobs.clear();
+		m_RootJobs.clear();
+
+		// Reserved up-front, as the root jobs point into the list
+		m_Schedule.reserve(order.size());
+		m_TaskJobs.reserve(order.size());
+
+		for (uint32_t i = 0; i < (uint32_t)order.size(); i++)
+		{
+			TaskID task = order[i];
+
+			ScheduledTask scheduled;
+			scheduled.Task = task;
+			scheduled.DependencyCount = dependencyCounts[task];
+			scheduled.FirstSuccessor = (uint32_t)m_Successors.size();
+			scheduled.SuccessorCount = (uint32_t)successors[task].size();
+
+			for (TaskID successor : successors[task])
+			{
+				m_Successors.push_back(scheduleIndices[successor]);
+			}
+
+			m_Schedule.push_back(scheduled);
+			m_TaskJobs.emplace_back([this, i]() { RunScheduledTask(i); }, m_ExecutionCounter, false);
+
+			if (scheduled.DependencyCount == 0)
+				m_RootJobs.push_back(&m_TaskJobs.back());
+		}
+
+		m_PendingDependencies = ManagedPtr<std::atomic<int>[]>(new std::atomic<int>[m_Schedule.size()]);
+
+		m_IsDirty = false;
+	}
+
+	void TaskGraph::Execute(double deltaTime)
+	{
+		if (m_IsDirty)
+			Compile();
+
+		if (m_Schedule.empty())
+			return;
+
+		m_DeltaTime = deltaTime;
+
+		for (size_t i = 0; i < m_Schedule.size(); i++)
+		{
+			m_PendingDependencies[i].store(m_Schedule[i].DependencyCount, std::memory_order_relaxed);
+		}
+
+		// Successors are queued with the same counter before their dependency finishes, so it only reaches 0 once every task is done
+		m_Scheduler->Run(m_RootJobs);
+		m_Scheduler->Wait(m_ExecutionCounter);
+	}
+
+	const string& TaskGraph::GetTaskName(TaskID task) const
+	{
+		ValidateTask(task);
+
+		return m_Tasks[task].Name;
+	}
+
+	void TaskGraph::Tick(double deltaTime)
+	{
+		Execute(deltaTime);
+	}
+
+	void TaskGraph::RunScheduledTask(uint32_t index)
+	{
+		const ScheduledTask& scheduled = m_Schedule[index];
+
+		m_Tasks[scheduled.Task].Function(m_DeltaTime);
+
+		for (uint32_t i = 0; i < scheduled.SuccessorCount; i++)
+		{
+			uint32_t successor = m_Successors[scheduled.FirstSuccessor + i];
+
+			if (m_PendingDependencies[successor].fetch_sub(1, std::memory_order_acq_rel) == 1)
+				m_Scheduler->Run(m_TaskJobs[successor]);
+		}
+	}
+
+	void TaskGraph::ValidateTask(TaskID task) const
+	{
+		if (task >= m_Tasks.size() || m_Tasks[task].IsRemoved)
+			throw TaskGraphException(FormatString("Task {0} doesn't exist in the graph", task));
+	}
+}
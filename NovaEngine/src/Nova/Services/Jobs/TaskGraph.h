@@ -0,0 +1,235 @@
+#pragma once
+
+#include "Nova/Core/EngineAPI.h"
+#include "Nova/Core/Events/TickListener.h"
+#include "Nova/Core/Types/RefCounted.h"
+#include "Nova/Core/Types/List.h"
+#include "Nova/Core/Types/String.h"
+#include "JobScheduler.h"
+
+#include <atomic>
+#include <functional>
+#include <stdint.h>
+
+namespace Nova::Jobs
+{
+	/// <summary>
+	/// The function a task runs each time its graph is executed
+	/// </summary>
+	using TaskFunction = std::function<void(double deltaTime)>;
+
+	/// <summary>
+	/// Identifies a task within a TaskGraph
+	/// </summary>
+	using TaskID = uint32_t;
+
+	/// <summary>
+	/// A graph of tasks that is declared once and executed every tick. The graph is compiled into a flat, topologically ordered schedule
+	/// with precomputed dependency counts, so executing it only resets the counts and queues the tasks that have no dependencies.
+	/// The graph is recompiled before the next execution whenever its structure changes
+	/// </summary>
+	class NovaAPI TaskGraph : public RefCounted
+	{
+	public:
+		/// <summary>
+		/// Creates an empty task graph. Use JobService::AddTaskGraph to execute it every tick
+		/// </summary>
+		/// <param name="scheduler">The scheduler to run tasks on</param>
+		/// <param name="order">The tick order for the graph</param>
+		TaskGraph(JobScheduler* scheduler, int order = 0);
+
+	protected:
+		virtual void Init() override;
+
+	public:
+		/// <summary>
+		/// Adds a task to the graph. Must not be called while the graph is executing
+		/// </summary>
+		/// <param name="name">The name of the task</param>
+		/// <param name="function">The function the task runs</param>
+		/// <returns>The task's ID</returns>
+		TaskID AddTask(const string& name, TaskFunction function);
+
+		/// <summary>
+		/// Makes a task run only after another task has finished. Must not be called while the graph is executing
+		/// </summary>
+		/// <param name="task">The task that depends on the other task</param>
+		/// <param name="dependency">The task to run first</param>
+		void AddDependency(TaskID task, TaskID dependency);
+
+		/// <summary>
+		/// Removes a task and all of its dependencies from the graph. Must not be called while the graph is executing
+		/// </summary>
+		/// <param name="task">The task to remove</param>
+		void RemoveTask(TaskID task);
+
+		/// <summary>
+		/// Builds the schedule for the graph, along with a job for each task. Called automatically before executing if the graph has changed
+		/// </summary>
+		void Compile();
+
+		/// <summary>
+		/// Runs every task in the graph and waits for them to finish
+		/// </summary>
+		/// <param name="deltaTime">The time passed to each task (in seconds)</param>
+		void Execute(double deltaTime);
+
+		/// <summary>
+		/// Gets if the graph has changed since it was last compiled
+		/// </summary>
+		/// <returns>True if the graph needs to be compiled</returns>
+		bool IsDirty() const { return m_IsDirty; }
+
+		/// <summary>
+		/// Gets the number of tasks that will run when the graph is executed
+		/// </summary>
+		/// <returns>The number of scheduled tasks</returns>
+		size_t GetScheduledTaskCount() const { return m_Schedule.size(); }
+
+		/// <summary>
+		/// Gets the name of a task
+		/// </summary>
+		/// <param name="task">The task's ID</param>
+		/// <returns>The name of the task</returns>
+		const string& GetTaskName(TaskID task) const;
+
+		/// <summary>
+		/// Gets the listener that executes this graph
+		/// </summary>
+		/// <returns>The graph's TickListener</returns>
+		const Ref<TickListener>& GetTickListener() const { return m_TickListener; }
+
+	private:
+		/// <summary>
+		/// A task as it was declared
+		/// </summary>
+		struct TaskNode
+		{
+			/// <summary>
+			/// The name of the task
+			/// </summary>
+			string Name;
+
+			/// <summary>
+			/// The function the task runs
+			/// </summary>
+			TaskFunction Function;
+
+			/// <summary>
+			/// The tasks that must finish before this one
+			/// </summary>
+			List<TaskID> Dependencies;
+
+			/// <summary>
+			/// True if the task has been removed from the graph
+			/// </summary>
+			bool IsRemoved = false;
+		};
+
+		/// <summary>
+		/// A task in the compiled schedule
+		/// </summary>
+		struct ScheduledTask
+		{
+			/// <summary>
+			/// The task this entry runs
+			/// </summary>
+			TaskID Task;
+
+			/// <summary>
+			/// The number of tasks that must finish before this one
+			/// </summary>
+			int DependencyCount;
+
+			/// <summary>
+			/// The offset of this task's successors in the successor list
+			/// </summary>
+			uint32_t FirstSuccessor;
+
+			/// <summary>
+			/// The number of tasks that depend on this one
+			/// </summary>
+			uint32_t SuccessorCount;
+		};
+
+	private:
+		/// <summary>
+		/// Executes the graph when the loop ticks
+		/// </summary>
+		/// <param name="deltaTime">The time since the last tick (in seconds)</param>
+		void Tick(double deltaTime);
+
+		/// <summary>
+		/// Runs a scheduled task, then queues any successors that no longer have unfinished dependencies
+		/// </summary>
+		/// <param name="index">The index of the task in the schedule</param>
+		void RunScheduledTask(uint32_t index);
+
+		/// <summary>
+		/// Throws if the given task doesn't exist
+		/// </summary>
+		/// <param name="task">The task's ID</param>
+		void ValidateTask(TaskID task) const;
+
+	private:
+		/// <summary>
+		/// The scheduler that runs tasks
+		/// </summary>
+		JobScheduler* m_Scheduler;
+
+		/// <summary>
+		/// The tick order for the graph
+		/// </summary>
+		int m_Order;
+
+		/// <summary>
+		/// Every task that was added, indexed by ID
+		/// </summary>
+		List<TaskNode> m_Tasks;
+
+		/// <summary>
+		/// If true, the graph must be recompiled before it is executed
+		/// </summary>
+		bool m_IsDirty = false;
+
+		/// <summary>
+		/// The compiled tasks in topological order
+		/// </summary>
+		List<ScheduledTask> m_Schedule;
+
+		/// <summary>
+		/// The schedule indices of each task's successors, stored contiguously
+		/// </summary>
+		List<uint32_t> m_Successors;
+
+		/// <summary>
+		/// A job for each scheduled task, built once and queued again on every execution, so executing the graph doesn't allocate
+		/// </summary>
+		List<Job> m_TaskJobs;
+
+		/// <summary>
+		/// The jobs of the tasks that have no dependencies
+		/// </summary>
+		List<Job*> m_RootJobs;
+
+		/// <summary>
+		/// The number of unfinished dependencies for each scheduled task during execution
+		/// </summary>
+		ManagedPtr<std::atomic<int>[]> m_PendingDependencies;
+
+		/// <summary>
+		/// Tracks every task queued during execution
+		/// </summary>
+		Ref<JobCounter> m_ExecutionCounter;
+
+		/// <summary>
+		/// The delta time for the current execution
+		/// </summary>
+		double m_DeltaTime = 0.0;
+
+		/// <summary>
+		/// The listener that executes this graph
+		/// </summary>
+		Ref<TickListener> m_TickListener;
+	};
+}